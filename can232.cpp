@@ -15,11 +15,14 @@ accept liability for any damage arising from its use.
 *******************************************************************************/
 
 #include "can232.h"
+#include "gmlan.h"
 #include "interfaces.h"
 #include "sizedefs.h"
 
 // constants
 #define CMD_BUF_LENGTH      32              ///< command buffer size
+#define OUT_BUF_LENGTH      512             ///< received frame text buffer size
+#define OUT_LINE_LENGTH     (1+8+1+16+4+1)  ///< longest frame line, 29 bit id with timestamp
 
 // command characters
 
@@ -39,6 +42,8 @@ accept liability for any damage arising from its use.
 #define CMD_DIRECT_SPEED    's'             ///< sxxyy: set the CAN bus speed registers directly
 ///< xx: BTR0 register setting
 ///< yy: BTR1 register setting
+#define CMD_AUTO_SPEED      'B'             ///< Find the CAN bus speed by listening, replies Bxxxxxx
+///< xxxxxx: bit rate found
 
 #define CMD_SEND_11BIT      't'             ///< tiiildd..: send 11 bit id CAN frame
 ///< iii: identfier 0x0..0x7ff
@@ -50,7 +55,17 @@ accept liability for any damage arising from its use.
 ///< dd..: data byte values 0x0..0xff (l pairs)
 
 
-#define CMD_READ_FLAGS      'F'             ///< Read flags !?!
+#define CMD_READ_FLAGS      'F'             ///< Read status flags, replies Fxx
+#define FLAG_RX_FULL        0x01            ///< receive ring overflowed
+#define FLAG_ERR_WARNING    0x04            ///< error counter reached the warning limit
+#define FLAG_DATA_OVERRUN   0x08            ///< CAN controller lost a frame
+#define FLAG_ERR_PASSIVE    0x20            ///< error counter above 127
+#define FLAG_BUS_ERROR      0x80            ///< bus off
+
+#define CMD_READ_HEALTH     'E'             ///< Read the controller's error counters, replies Esttrr + 6 * cccccccc
+///< s: state, 0 active, 1 error warning, 2 error passive, 3 bus off
+///< tt, rr: TX and RX error counters
+///< cccccccc: bus errors, error warning, error passive, bus off, aborted frames and controller resets
 
 #define CMD_FILTER          'f'             ///< Filter which CAN message types to allow
 #define CMD_FILTER_NONE     '0'             ///< Allow all CAN message types
@@ -73,9 +88,17 @@ static char cmd_buffer[CMD_BUF_LENGTH];     ///< command string buffer
 static uint32_t can_id;                     ///< can message id
 static uint32_t can_len;                    ///< can message length
 static uint8_t can_msg[8];                  ///< can message frame - up to 8 bytes
+static bool can_timestamp = false;          ///< add timestamps to received frames
+static char out_buffer[OUT_BUF_LENGTH];     ///< received frames as text
+static uint32_t rx_overruns = 0;            ///< can_rx_overruns at the last 'F' command
+static uint32_t hw_overruns = 0;            ///< can_hw_overruns at the last 'F' command
+static const char hex_digit[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                   '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+                                  };
 
 // private functions
 uint8_t execute_can_cmd();
+void can232_send_frames();
 
 // command argument macros
 #define CHECK_ARGLENGTH(len) \
@@ -93,6 +116,8 @@ void can232() {
     char ret;
     char rx_char;
     while (true) {
+        // send received messages to the pc over USB connection
+        can232_send_frames();
         // read chars from USB
         if (pc.readable()) {
             // turn Error LED off for next command
@@ -101,8 +126,8 @@ void can232() {
             switch (rx_char) {
                     // 'ESC' key to go back to mbed Just4Trionic 'home' menu
                 case '\e':
+                    GMLANEnd();
                     can_close();
-                    can.attach(NULL);
                     return;
                     // end-of-command reached
                 case TERM_OK :
@@ -125,6 +150,51 @@ void can232() {
     }
 }
 
+//-----------------------------------------------------------------------------
+/**
+    Writes 'digits' hex characters of 'value' to 'out'.
+
+    @return                    pointer after the last character
+*/
+
+static inline char *put_hex(char *out, uint32_t value, uint8_t digits) {
+    for (int8_t shift = (digits - 1) * 4; shift >= 0; shift -= 4)
+        *out++ = hex_digit[(value >> shift) & 0x0f];
+    return out;
+}
+
+//-----------------------------------------------------------------------------
+/**
+    Sends the received CAN frames to the pc, formatted into a buffer that is
+    written in one go instead of a printf for every field. Stops when the
+    buffer is full so that commands from the pc are not held up.
+*/
+
+void can232_send_frames() {
+    CANMessage can_MsgRx;
+    uint32_t rx_time;
+    char *out = out_buffer;
+
+    while ((out + OUT_LINE_LENGTH <= out_buffer + OUT_BUF_LENGTH) && can_rx_read(can_MsgRx, &rx_time)) {
+        if (can_MsgRx.format == CANExtended) {
+            *out++ = 'W';
+            out = put_hex(out, can_MsgRx.id, 8);
+        } else {
+            *out++ = 'w';
+            out = put_hex(out, can_MsgRx.id, 3);
+        }
+        *out++ = hex_digit[can_MsgRx.len & 0x0f];
+        for (uint8_t i = 0; i < can_MsgRx.len; i++)
+            out = put_hex(out, can_MsgRx.data[i], 2);
+        if (can_timestamp)
+            out = put_hex(out, (rx_time / 1000) % 60000, 4);
+        *out++ = '\r';
+        *out++ = '\n';
+    }
+    if (out > out_buffer)
+        pc.write(out_buffer, out - out_buffer);
+}
+
 //-----------------------------------------------------------------------------
 /**
     Executes a command and returns result flag (does not transmit the flag
@@ -156,6 +226,7 @@ uint8_t execute_can_cmd() {
             break;
 
         case CMD_CLOSE:
+            GMLANEnd();
             can_close();
             return TERM_OK;
         case CMD_OPEN:
@@ -195,7 +266,6 @@ uint8_t execute_can_cmd() {
                 default:
                     return TERM_ERR;
             }
-            can.attach(&show_can_message);
             return TERM_OK;
 
         case CMD_DIRECT_SPEED:
@@ -213,9 +283,66 @@ uint8_t execute_can_cmd() {
                 default:
                     return TERM_ERR;
             }
-            can.attach(&show_can_message);
             return TERM_OK;
 
+        case CMD_AUTO_SPEED: {
+            if (cmd_length != 1) return TERM_ERR;
+            uint32_t rate = can_autobaud();
+            if (!rate) return TERM_ERR;
+            can_configure(2, rate, 0);
+            char reply[7] = {CMD_AUTO_SPEED};
+            put_hex(reply + 1, rate, 6);
+            pc.write(reply, sizeof(reply));
+            return TERM_OK;
+        }
+
+        case CMD_READ_HEALTH: {
+            if (cmd_length != 1) return TERM_ERR;
+            can_health_t health;
+            can_get_health(health);
+            const uint32_t counts[] = {health.bus_errors, health.warnings, health.passive,
+                                       health.bus_off, health.tx_aborts, health.resets};
+            char reply[1 + 1 + 2 + 2 + 6 * 8];
+            char *out = reply;
+            *out++ = CMD_READ_HEALTH;
+            out = put_hex(out, health.state, 1);
+            out = put_hex(out, health.tx_errors, 2);
+            out = put_hex(out, health.rx_errors, 2);
+            for (uint8_t i = 0; i < 6; i++)
+                out = put_hex(out, counts[i], 8);
+            pc.write(reply, sizeof(reply));
+            return TERM_OK;
+        }
+
+        case CMD_READ_FLAGS: {
+            if (cmd_length != 1) return TERM_ERR;
+            uint32_t status = can_get_status();
+            uint8_t flags = 0;
+            if (can_rx_overruns != rx_overruns) flags |= FLAG_RX_FULL;
+            if (can_hw_overruns != hw_overruns) flags |= FLAG_DATA_OVERRUN;
+            if (status & (1 << 6)) flags |= FLAG_ERR_WARNING;
+            if (((status >> 16) & 0xff) > 127 || ((status >> 24) & 0xff) > 127) flags |= FLAG_ERR_PASSIVE;
+            if (status & (1 << 7)) flags |= FLAG_BUS_ERROR;
+            rx_overruns = can_rx_overruns;
+            hw_overruns = can_hw_overruns;
+            pc.putc(CMD_READ_FLAGS);
+            pc.putc(hex_digit[flags >> 4]);
+            pc.putc(hex_digit[flags & 0x0f]);
+            return TERM_OK;
+        }
+
+        case CMD_TIMESTAMP:
+            CHECK_ARGLENGTH(0);
+            switch (cmd) {
+                case '0':
+                    can_timestamp = false;
+                    return TERM_OK;
+                case '1':
+                    can_timestamp = true;
+                    return TERM_OK;
+            }
+            break;
+
         case CMD_FILTER:
             CHECK_ARGLENGTH(0);
             switch (cmd) {
@@ -223,48 +350,13 @@ uint8_t execute_can_cmd() {
                     can_use_filters(false);                             // Accept all messages (Acceptance Filters disabled)
                     return TERM_OK;
                 case CMD_FILTER_T5:
-                    can_reset_filters();
-                    can_add_filter(2, 0x005);         //005h -
-                    can_add_filter(2, 0x006);         //006h -
-                    can_add_filter(2, 0x00C);         //00Ch -
-                    can_add_filter(2, 0x008);         //008h -
+                    can_filter_load(2, can_filter_T5);
                     return TERM_OK;
                 case CMD_FILTER_T7:
-                    can_reset_filters();
-                    can_add_filter(2, 0x220);         //220h
-                    can_add_filter(2, 0x238);         //238h
-                    can_add_filter(2, 0x240);         //240h
-                    can_add_filter(2, 0x258);         //258h
-                    can_add_filter(2, 0x266);         //266h - Ack
-                    return TERM_OK;
-                    can_add_filter(2, 0x1A0);         //1A0h - Engine information
-                    can_add_filter(2, 0x280);         //280h - Pedals, reverse gear
-                    can_add_filter(2, 0x290);         //290h - Steering wheel and SID buttons
-                    can_add_filter(2, 0x2F0);         //2F0h - Vehicle speed
-                    can_add_filter(2, 0x320);         //320h - Doors, central locking and seat belts
-                    can_add_filter(2, 0x370);         //370h - Mileage
-                    can_add_filter(2, 0x3A0);         //3A0h - Vehicle speed
-                    can_add_filter(2, 0x3B0);         //3B0h - Head lights
-                    can_add_filter(2, 0x3E0);         //3E0h - Automatic Gearbox
-                    can_add_filter(2, 0x410);         //410h - Light dimmer and light sensor
-                    can_add_filter(2, 0x430);         //430h - SID beep request (interesting for Knock indicator?)
-                    can_add_filter(2, 0x460);         //460h - Engine rpm and speed
-                    can_add_filter(2, 0x4A0);         //4A0h - Steering wheel, Vehicle Identification Number
-                    can_add_filter(2, 0x520);         //520h - ACC, inside temperature
-                    can_add_filter(2, 0x530);         //530h - ACC
-                    can_add_filter(2, 0x5C0);         //5C0h - Coolant temperature, air pressure
-                    can_add_filter(2, 0x630);         //630h - Fuel usage
-                    can_add_filter(2, 0x640);         //640h - Mileage
-                    can_add_filter(2, 0x7A0);         //7A0h - Outside temperature
+                    can_filter_load(2, can_filter_T7);
                     return TERM_OK;
                 case CMD_FILTER_T8:
-                    can_reset_filters();
-                    can_add_filter(2, 0x645);         //645h - CIM
-                    can_add_filter(2, 0x7E0);         //7E0h -
-                    can_add_filter(2, 0x7E8);         //7E8h -
-                    can_add_filter(2, 0x311);         //311h -
-                    can_add_filter(2, 0x5E8);         //5E8h -
-                    //can_add_filter(2, 0x101);         //101h -
+                    can_filter_load(2, can_filter_T8);
                     return TERM_OK;
             }
             break;
@@ -18,10 +18,133 @@ accept liability for any damage arising from its use.
 #include "canutils.h"
 #include <cstdint>
 #include "interfaces.h"
+#ifdef T8_SIMULATOR
+#include "t8sim.h"
+#endif
 
 //CAN can2(p30, p29);
-// Use a timer to see if things take too long
-Timer CANTimer;
+
+// CAN receive ring, filled by can_isr() and emptied by can_rx_read()
+static CANMessage can_rx_ring[CAN_RX_RING_SIZE];
+static uint32_t can_rx_stamp[CAN_RX_RING_SIZE];     // us_ticker time the frame was taken from the controller
+static volatile uint32_t can_rx_head = 0;           // written by the interrupt only
+static volatile uint32_t can_rx_tail = 0;           // written by the consumer only
+EventFlags can_rx_event;
+volatile uint32_t can_rx_overruns = 0;
+volatile uint32_t can_hw_overruns = 0;
+volatile uint32_t can_rx_frames = 0;
+volatile uint32_t can_bus_errors = 0;
+static volatile uint32_t can_rx_bits = 0;          // bits of every frame received, for can_bus_load()
+static volatile bool can_rx_measuring = false;     // drop frames meant for the ring, see can_bus_load()
+
+// Per id receive mailboxes, filled by can_isr() and emptied by can_mailbox_wait()
+struct can_mailbox_t {
+    volatile bool used;
+    uint8_t users;                                      // can_mailbox_open() calls not yet closed
+    uint32_t id;
+    CANMessage ring[CAN_MAILBOX_SIZE];
+    uint32_t stamp[CAN_MAILBOX_SIZE];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+};
+static can_mailbox_t can_mailbox[CAN_MAILBOXES];
+
+// Watched ids, see can_watch()
+struct can_watch_t {
+    volatile bool used;
+    uint32_t id;
+    volatile uint32_t last;                             // can_time_us() of the last frame
+    volatile bool absorb;                               // drop the next frame starting with absorb_data
+    uint32_t absorb_time;
+    uint8_t absorb_len;
+    uint8_t absorb_data[8];
+};
+static can_watch_t can_watches[CAN_WATCHES];
+
+// CAN transmit queue, sorted by can_tx_key(), filled by can_tx_post() and emptied
+// into the transmit buffers by can_tx_load()
+struct can_tx_entry_t {
+    CANMessage msg;
+    uint32_t ticket;
+};
+static can_tx_entry_t can_tx_queue[CAN_TX_QUEUE_SIZE];
+static uint16_t can_tx_count = 0;
+static uint32_t can_tx_buffer[3] = {0, 0, 0};          // ticket in each transmit buffer, 0 if free
+static volatile uint8_t can_tx_state[CAN_TX_TICKETS];  // CAN_TX_PENDING/SENT/ABORTED by ticket
+static uint32_t can_tx_ticket = 0;
+static uint16_t can_tx_prio = 0;                        // TFI PRIO, transmit buffers go in loading order
+static uint32_t can_tx_loaded[3];                       // us_ticker time each transmit buffer was loaded
+EventFlags can_tx_event;
+#ifdef T8_SIMULATOR
+static Timeout can_sim_tx;                              // end of the frame in the simulated transmit buffer
+static CANMessage can_sim_msg;
+#endif
+
+// Controller health, followed by can_health_update() and can_health_check()
+static volatile uint8_t can_state = CAN_STATE_ACTIVE;
+static volatile uint8_t can_tx_errors_peak = 0;
+static volatile uint8_t can_rx_errors_peak = 0;
+static volatile uint32_t can_warnings = 0;
+static volatile uint32_t can_passive = 0;
+static volatile uint32_t can_bus_off = 0;
+static volatile uint32_t can_tx_aborts = 0;
+static volatile uint32_t can_resets = 0;
+static uint32_t can_bus_off_time = 0;                   // us_ticker time the controller went bus off
+static Ticker can_health_ticker;
+
+static void can_af_reset();
+static uint32_t can_btr(uint32_t baud);
+static void can_tx_load();
+#ifdef T8_SIMULATOR
+static void can_sim_tx_done();
+#endif
+
+// Acceptance filter presets for can_filter_load()
+const can_filter_t can_filter_T5[] = {
+    {CAN_AF_STD, 0x005},                //005h -
+    {CAN_AF_STD, 0x006},                //006h -
+    {CAN_AF_STD, 0x00C},                //00Ch -
+    {CAN_AF_STD, 0x008},                //008h -
+    {CAN_AF_END}
+};
+
+const can_filter_t can_filter_T7[] = {
+    {CAN_AF_STD, 0x220},                //220h
+    {CAN_AF_STD, 0x238},                //238h
+    {CAN_AF_STD, 0x240},                //240h
+    {CAN_AF_STD, 0x258},                //258h
+    {CAN_AF_STD, 0x266},                //266h - Ack
+//    {CAN_AF_STD, 0x1A0},                //1A0h - Engine information
+//    {CAN_AF_STD, 0x280},                //280h - Pedals, reverse gear
+//    {CAN_AF_STD, 0x290},                //290h - Steering wheel and SID buttons
+//    {CAN_AF_STD, 0x2F0},                //2F0h - Vehicle speed
+//    {CAN_AF_STD, 0x320},                //320h - Doors, central locking and seat belts
+//    {CAN_AF_STD, 0x370},                //370h - Mileage
+//    {CAN_AF_STD, 0x3A0},                //3A0h - Vehicle speed
+//    {CAN_AF_STD, 0x3B0},                //3B0h - Head lights
+//    {CAN_AF_STD, 0x3E0},                //3E0h - Automatic Gearbox
+//    {CAN_AF_STD, 0x410},                //410h - Light dimmer and light sensor
+//    {CAN_AF_STD, 0x430},                //430h - SID beep request (interesting for Knock indicator?)
+//    {CAN_AF_STD, 0x460},                //460h - Engine rpm and speed
+//    {CAN_AF_STD, 0x4A0},                //4A0h - Steering wheel, Vehicle Identification Number
+//    {CAN_AF_STD, 0x520},                //520h - ACC, inside temperature
+//    {CAN_AF_STD, 0x530},                //530h - ACC
+//    {CAN_AF_STD, 0x5C0},                //5C0h - Coolant temperature, air pressure
+//    {CAN_AF_STD, 0x630},                //630h - Fuel usage
+//    {CAN_AF_STD, 0x640},                //640h - Mileage
+//    {CAN_AF_STD, 0x7A0},                //7A0h - Outside temperature
+    {CAN_AF_END}
+};
+
+const can_filter_t can_filter_T8[] = {
+    {CAN_AF_STD, 0x645},                //645h - CIM
+    {CAN_AF_STD, 0x7E0},                //7E0h -
+    {CAN_AF_STD, 0x7E8},                //7E8h -
+    {CAN_AF_STD, 0x311},                //311h -
+    {CAN_AF_STD, 0x5E8},                //5E8h -
+//    {CAN_AF_STD, 0x101},                //101h -
+    {CAN_AF_END}
+};
 
 
 //LPC_CANx->MOD |= 1;          // Disble CAN controller 2
@@ -46,8 +169,6 @@ void can_configure(uint8_t chan, uint32_t baud, bool listen)
     LPC_CAN_TypeDef *pCANx = (chan == 1) ? LPC_CAN1 : LPC_CAN2;
 
     uint32_t result;
-    uint8_t TQU, TSEG1=0, TSEG2=0;
-    uint16_t BRP=0;
 
     switch (chan) {
         case 1:
@@ -70,6 +191,28 @@ void can_configure(uint8_t chan, uint32_t baud, bool listen)
     // CANx->CMR = CAN_CMR_AT | CAN_CMR_RRB | CAN_CMR_CDO;
     result = pCANx->ICR;                                // Read interrupt register to clear it
 
+    pCANx->BTR  = can_btr(baud);
+
+    can_af_reset();                                     // Initialise the Acceptance Filters
+    can_use_filters(false);                             // Accept all messages (Acceptance Filters disabled)
+    // Go :-)
+    pCANx->MOD = (listen <<1) | (1 << 3);               // Enable CAN controller in active/listen mode, transmit priority by TFI PRIO
+    if (chan == 2) {
+        can_rx_start();                                 // Receive interrupt was disabled above
+    }
+}
+
+//
+// can_btr
+//
+// return:    the BTR register setting for 'baud'
+//
+static uint32_t can_btr(uint32_t baud)
+{
+    uint32_t result;
+    uint8_t TQU, TSEG1=0, TSEG2=0;
+    uint16_t BRP=0;
+
     // Calculate a suitable BTR register setting
     // The Bit Rate Pre-scaler (BRP) can be in the range of 1-1024
     // Bit Time can be be between 25 and 8 Time Quanta (TQU) according to CANopen
@@ -87,16 +230,909 @@ void can_configure(uint8_t chan, uint32_t baud, bool listen)
             break;
         }
     }
-    pCANx->BTR  = (TSEG2<<20)|(TSEG1<<16)|(0<<14)|BRP;  // Set bit timing, SAM = 0, TSEG2, TSEG1, SJW = 1 (0+1), BRP
+    return (TSEG2<<20)|(TSEG1<<16)|(0<<14)|BRP;         // Bit timing, SAM = 0, TSEG2, TSEG1, SJW = 1 (0+1), BRP
+}
 
-    can_reset_filters();                                // Initialise the Acceptance Filters
-    can_use_filters(false);                             // Accept all messages (Acceptance Filters disabled)
-    // Go :-)
-    pCANx->MOD = (listen <<1);                          // Enable CAN controller in active/listen mode
+//
+// can_get_bitrate
+//
+// return:    the bit rate CAN controller 2 is set to, from its BTR register
+//
+uint32_t can_get_bitrate()
+{
+    uint32_t btr = LPC_CAN2->BTR;
+    uint32_t TQU = 1 + ((btr >> 16) & 0x0F) + 1 + ((btr >> 20) & 0x07) + 1;
+    return CANsuppliedCLK / (((btr & 0x3FF) + 1) * TQU);
+}
+
+//
+// can_bus_load
+//
+// Measures how busy the bus is for 'ms' milliseconds. The acceptance filter is
+// bypassed while measuring so every frame is seen, frames nobody has a mailbox
+// for are dropped instead of filling the receive ring. Frames this node sends
+// are not counted.
+//
+// return:    the bus load in percent, a slight underestimate as bit stuffing is not counted
+//
+float can_bus_load(uint16_t ms)
+{
+    uint32_t afmr = LPC_CANAF->AFMR;
+    can_rx_measuring = true;
+    LPC_CANAF->AFMR = 2;                                // Bypass, accept everything
+    uint32_t bits = can_rx_bits;
+    ThisThread::sleep_for(ms);
+    bits = can_rx_bits - bits;
+    LPC_CANAF->AFMR = afmr;
+    can_rx_measuring = false;
+    return (100.0 * (float)bits) / ((float)can_get_bitrate() * (float)ms / 1000.0);
 }
 
+//
+// can_autobaud
+//
+// Finds the bus's bit rate by listening at each of CAN_AUTOBAUD_RATES in listen
+// only mode, so nothing is sent or acknowledged while the rate is wrong. A wrong
+// rate shows as a bus error within a frame or two, the right one as frames
+// without any. If no rate gets CAN_AUTOBAUD_FRAMES clean frames the one with
+// the most frames and no errors at all is taken. A rate that had errors is
+// never returned, going active at it would put error frames on the bus. The
+// controller is left listening, at the rate found if there is one.
+//
+// inputs:    longest time in milliseconds to listen at each rate
+// return:    the bit rate, 0 if no rate was heard without errors
+//
+uint32_t can_autobaud(uint16_t dwell)
+{
+    const uint32_t rates[] = CAN_AUTOBAUD_RATES;
+    uint32_t best = 0;
+    uint32_t best_frames = 0;
+    for (uint8_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        can_configure(2, rates[i], true);
+        uint32_t frames = can_rx_frames;
+        uint32_t errors = can_bus_errors;
+        Timer timer;
+        timer.start();
+        while (timer.read_ms() < dwell && can_bus_errors == errors && can_rx_frames - frames < CAN_AUTOBAUD_FRAMES)
+            ThisThread::sleep_for(1);
+        frames = can_rx_frames - frames;
+        errors = can_bus_errors - errors;
+        if (frames >= CAN_AUTOBAUD_FRAMES && !errors)
+            return rates[i];
+        if (!errors && frames > best_frames) {
+            best = rates[i];
+            best_frames = frames;
+        }
+    }
+    if (best)
+        can_configure(2, best, true);
+    return best;
+}
 
-void can_reset_filters()
+//
+// can_set_bitrate
+//
+// Changes CAN controller 2's bit rate in the middle of a session, unlike
+// can_configure() the acceptance filters, mailboxes and queued frames are left
+// alone. Frames already in the transmit buffers are aborted.
+//
+void can_set_bitrate(uint32_t baud)
+{
+    core_util_critical_section_enter();
+    uint32_t mod = LPC_CAN2->MOD;
+    LPC_CAN2->MOD = mod | 0x01;                         // Reset mode, BTR can only be written here
+    LPC_CAN2->BTR = can_btr(baud);
+    for (uint8_t buf = 0; buf < 3; buf++) {
+        if (can_tx_buffer[buf])
+            can_tx_state[can_tx_buffer[buf] & (CAN_TX_TICKETS - 1)] = CAN_TX_ABORTED;
+        can_tx_buffer[buf] = 0;
+    }
+    can_tx_prio = 0;
+    LPC_CAN2->MOD = mod & ~0x01;
+    can_tx_load();
+    core_util_critical_section_exit();
+    can_tx_event.set(CAN_TX_EVENT);
+}
+
+//
+// can_tx_key
+//
+// Arbitration order of a frame, the 11 bit id lines up with the top of a 29 bit id.
+//
+static inline uint32_t can_tx_key(const CANMessage &msg)
+{
+    return (msg.format == CANExtended) ? msg.id : (msg.id << 18);
+}
+
+//
+// can_tx_load
+//
+// Moves queued frames into free transmit buffers. The controller is in
+// transmit priority mode (MOD.TPM) so it sends buffers in order of the PRIO
+// field which counts up for each loaded frame, restarting once every buffer
+// is free again. Called with interrupts disabled or from can_isr().
+//
+static void can_tx_load()
+{
+    if (can_state == CAN_STATE_BUS_OFF)
+        return;                                         // keep the queue until the controller is back
+#ifdef T8_SIMULATOR
+    // Nothing goes to the controller, transmit buffer 0 holds one frame at a time
+    // for as long as the simulated bus takes to send it, see can_sim_tx_done()
+    if (can_tx_buffer[0] || !can_tx_count)
+        return;
+    can_sim_msg = can_tx_queue[0].msg;
+    can_tx_buffer[0] = can_tx_queue[0].ticket;
+    can_tx_loaded[0] = us_ticker_read();
+    can_tx_count--;
+    for (uint16_t i = 0; i < can_tx_count; i++)
+        can_tx_queue[i] = can_tx_queue[i + 1];
+    can_sim_tx.attach_us(&can_sim_tx_done, t8sim_frame_us(can_sim_msg));
+    return;
+#endif
+    for (uint8_t buf = 0; buf < 3 && can_tx_count; buf++) {
+        if (can_tx_buffer[buf] || !(LPC_CAN2->SR & (1 << (2 + 8 * buf))))
+            continue;                                   // busy
+        if (can_tx_prio > 0xFF) {
+            if (can_tx_buffer[0] || can_tx_buffer[1] || can_tx_buffer[2])
+                return;                                 // wait for the others to go before restarting PRIO
+            can_tx_prio = 0;
+        }
+        CANMessage *msg = &can_tx_queue[0].msg;
+        volatile uint32_t *tx = (volatile uint32_t *)&LPC_CAN2->TFI1 + 4 * buf;   // TFI, TID, TDA, TDB
+        tx[0] = (can_tx_prio++ & 0xFF) | ((uint32_t)(msg->len & 0x0F) << 16)
+                | (msg->type == CANRemote ? (1UL << 30) : 0)
+                | (msg->format == CANExtended ? (1UL << 31) : 0);
+        tx[1] = msg->id;
+        tx[2] = msg->data[0] | (msg->data[1] << 8) | (msg->data[2] << 16) | ((uint32_t)msg->data[3] << 24);
+        tx[3] = msg->data[4] | (msg->data[5] << 8) | (msg->data[6] << 16) | ((uint32_t)msg->data[7] << 24);
+        can_tx_buffer[buf] = can_tx_queue[0].ticket;
+        can_tx_loaded[buf] = us_ticker_read();
+        can_tx_count--;
+        for (uint16_t i = 0; i < can_tx_count; i++)
+            can_tx_queue[i] = can_tx_queue[i + 1];
+        LPC_CAN2->CMR = (1 << 0) | (1 << (5 + buf));    // Transmission request for this buffer
+        CANTXLEDON;
+    }
+}
+
+#ifdef T8_SIMULATOR
+//
+// can_sim_tx_done
+//
+// Timeout callback at the end of the frame in the simulated transmit buffer, the
+// simulated T8 gets the frame now and the next one is loaded. A frame aborted
+// meanwhile, by can_set_bitrate() or can_rx_start(), is not delivered.
+//
+static void can_sim_tx_done()
+{
+    core_util_critical_section_enter();
+    if (can_tx_buffer[0]) {
+        can_tx_state[can_tx_buffer[0] & (CAN_TX_TICKETS - 1)] = CAN_TX_SENT;
+        can_tx_buffer[0] = 0;
+        t8sim_frame(can_sim_msg);
+    }
+    can_tx_load();
+    core_util_critical_section_exit();
+    can_tx_event.set(CAN_TX_EVENT);
+}
+#endif
+
+//
+// can_tx_release
+//
+// Records the outcome of every transmit buffer the controller has finished with
+// and refills them.
+//
+static void can_tx_release()
+{
+    uint32_t sr = LPC_CAN2->SR;
+    for (uint8_t buf = 0; buf < 3; buf++) {
+        uint32_t ticket = can_tx_buffer[buf];
+        if (ticket && (sr & (1 << (2 + 8 * buf)))) {
+            can_tx_state[ticket & (CAN_TX_TICKETS - 1)] = (sr & (1 << (3 + 8 * buf))) ? CAN_TX_SENT : CAN_TX_ABORTED;
+            can_tx_buffer[buf] = 0;
+        }
+    }
+    can_tx_load();
+    can_tx_event.set(CAN_TX_EVENT);
+}
+
+//
+// can_tx_drop
+//
+// Forgets the frames in the transmit buffers, marking them aborted. Frames still
+// in the queue are kept. Called with interrupts disabled or from an interrupt.
+//
+static void can_tx_drop()
+{
+    for (uint8_t buf = 0; buf < 3; buf++) {
+        if (can_tx_buffer[buf])
+            can_tx_state[can_tx_buffer[buf] & (CAN_TX_TICKETS - 1)] = CAN_TX_ABORTED;
+        can_tx_buffer[buf] = 0;
+    }
+}
+
+//
+// can_health_update
+//
+// Follows the controller's error state from its global status register, counting
+// each time a worse state is entered. A bus off throws away the frames in the
+// transmit buffers and starts the controller's recovery (128 times 11 recessive
+// bits) by taking it out of the reset mode it went into. The queue is loaded
+// again once it is back. Called from can_isr() and can_health_check().
+//
+static void can_health_update()
+{
+    uint32_t gsr = LPC_CAN2->GSR;
+    uint8_t tx_errors = (gsr >> 24) & 0xFF;
+    uint8_t rx_errors = (gsr >> 16) & 0xFF;
+    if (tx_errors > can_tx_errors_peak)
+        can_tx_errors_peak = tx_errors;
+    if (rx_errors > can_rx_errors_peak)
+        can_rx_errors_peak = rx_errors;
+    uint8_t state = CAN_STATE_ACTIVE;
+    if (gsr & (1 << 7))
+        state = CAN_STATE_BUS_OFF;
+    else if (tx_errors > 127 || rx_errors > 127)
+        state = CAN_STATE_PASSIVE;
+    else if (gsr & (1 << 6))
+        state = CAN_STATE_WARNING;
+    if (state > can_state) {
+        switch (state) {
+            case CAN_STATE_WARNING:
+                can_warnings++;
+                break;
+            case CAN_STATE_PASSIVE:
+                can_passive++;
+                break;
+            case CAN_STATE_BUS_OFF:
+                can_bus_off++;
+                can_bus_off_time = us_ticker_read();
+                can_tx_drop();
+                LPC_CAN2->MOD &= ~1UL;                  // Leave reset mode to start bus off recovery
+                break;
+        }
+    }
+    bool recovered = (can_state == CAN_STATE_BUS_OFF && state != CAN_STATE_BUS_OFF);
+    can_state = state;
+    if (recovered) {
+        can_tx_load();
+        can_tx_event.set(CAN_TX_EVENT);
+    }
+}
+
+//
+// can_controller_reset
+//
+// Last resort when a bus off has not recovered, resets the controller and clears
+// its error counters. The bit rate, listen only mode and acceptance filter stay
+// as they were and the transmit queue carries on.
+//
+static void can_controller_reset()
+{
+    uint32_t mod = LPC_CAN2->MOD & ((1 << 1) | (1 << 3));   // Listen only and transmit priority mode
+    LPC_CAN2->MOD = mod | 1;                            // Put into reset mode
+    LPC_CAN2->GSR = 0;                                  // Clear the error counters
+    LPC_CAN2->CMR = (1 << 1) | (1 << 2) | (1 << 3);     // Abort transmission, release receive buffer, clear data overrun
+    LPC_CAN2->MOD = mod;
+    can_tx_drop();
+    can_resets++;
+    can_state = CAN_STATE_ACTIVE;
+    can_tx_load();
+    can_tx_event.set(CAN_TX_EVENT);
+}
+
+//
+// can_health_check
+//
+// Ticker callback every CAN_HEALTH_MS. The controller retries a frame that is not
+// acknowledged by itself, a frame that has been retried for CAN_TX_STALL_MS is
+// aborted so the frames behind it can go. A bus off that has not recovered after
+// CAN_BUS_OFF_MS resets the controller.
+//
+static void can_health_check()
+{
+    core_util_critical_section_enter();
+    can_health_update();
+    uint32_t now = us_ticker_read();
+    if (can_state == CAN_STATE_BUS_OFF) {
+        if (now - can_bus_off_time > CAN_BUS_OFF_MS * 1000UL)
+            can_controller_reset();
+    } else {
+        for (uint8_t buf = 0; buf < 3; buf++) {
+            if (can_tx_buffer[buf] && now - can_tx_loaded[buf] > CAN_TX_STALL_MS * 1000UL) {
+                LPC_CAN2->CMR = (1 << 1) | (1 << (5 + buf));    // Abort transmission of this buffer
+                can_tx_loaded[buf] = now;
+                can_tx_aborts++;
+            }
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+//
+// can_rx_put
+//
+// Stores a received frame in its mailbox, or in the receive ring if its id has
+// no mailbox. Frames that do not fit are counted in can_rx_overruns, frames a
+// watch is absorbing are dropped.
+//
+// return:    the can_rx_event flag to set, 0 if the frame was dropped
+//
+static uint32_t can_rx_put(const CANMessage &msg, uint32_t stamp)
+{
+    for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+        can_watch_t *w = &can_watches[n];
+        if (w->used && w->id == msg.id) {
+            w->last = stamp;
+            if (w->absorb) {
+                // only the first frame after the absorbed request can be its answer
+                w->absorb = false;
+                if (stamp - w->absorb_time < CAN_ABSORB_US && msg.len >= w->absorb_len
+                        && !memcmp(msg.data, w->absorb_data, w->absorb_len))
+                    return 0;
+            }
+        }
+    }
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++) {
+        can_mailbox_t *mb = &can_mailbox[n];
+        if (mb->used && mb->id == msg.id) {
+            uint32_t head = mb->head;
+            if (head - mb->tail >= CAN_MAILBOX_SIZE) {
+                can_rx_overruns++;
+            } else {
+                mb->ring[head & (CAN_MAILBOX_SIZE - 1)] = msg;
+                mb->stamp[head & (CAN_MAILBOX_SIZE - 1)] = stamp;
+                mb->head = head + 1;
+            }
+            return CAN_MAILBOX_EVENT(n);
+        }
+    }
+    if (can_rx_measuring)
+        return 0;
+    uint32_t head = can_rx_head;
+    if (head - can_rx_tail >= CAN_RX_RING_SIZE) {
+        can_rx_overruns++;
+    } else {
+        can_rx_ring[head & (CAN_RX_RING_SIZE - 1)] = msg;
+        can_rx_stamp[head & (CAN_RX_RING_SIZE - 1)] = stamp;
+        can_rx_head = head + 1;
+    }
+    return CAN_RX_EVENT;
+}
+
+//
+// can_isr
+//
+// CAN interrupt, drains the controller's single receive buffer into the ring
+// and wakes anyone waiting in can_rx_wait().
+//
+static void can_isr()
+{
+    uint32_t icr = LPC_CAN2->ICR;                       // Reading clears the interrupt flags
+    if (icr & (1 << 3)) {                               // Data overrun, a frame was lost in the controller
+        can_hw_overruns++;
+        LPC_CAN2->CMR = (1 << 3);                       // Clear data overrun
+    }
+    if (icr & (1 << 7)) {                               // Bus error
+        can_bus_errors++;
+    }
+    if (icr & ((1 << 2) | (1 << 5))) {                  // Error warning, bus off or error passive changed
+        can_health_update();
+    }
+    if (icr & ((1 << 1) | (1 << 9) | (1 << 10))) {      // A transmit buffer was released
+        can_tx_release();
+    }
+    uint32_t events = 0;
+    while (LPC_CAN2->GSR & 1) {                         // Receive buffer status, a frame is waiting
+        CANMessage msg;
+        uint32_t stamp = us_ticker_read();
+        uint32_t rfs = LPC_CAN2->RFS;
+        uint32_t rda = LPC_CAN2->RDA;
+        uint32_t rdb = LPC_CAN2->RDB;
+        msg.id = LPC_CAN2->RID;
+        msg.len = (rfs >> 16) & 0x0F;
+        if (msg.len > 8) {
+            msg.len = 8;
+        }
+        msg.format = (rfs & (1UL << 31)) ? CANExtended : CANStandard;
+        msg.type = (rfs & (1UL << 30)) ? CANRemote : CANData;
+        for (uint8_t i = 0; i < 4; i++) {
+            msg.data[i] = (rda >> (8 * i)) & 0xFF;
+            msg.data[i + 4] = (rdb >> (8 * i)) & 0xFF;
+        }
+        LPC_CAN2->CMR = (1 << 2);                       // Release receive buffer
+        can_rx_frames++;
+        can_rx_bits += ((msg.format == CANExtended) ? CAN_FRAME_BITS_EXT : CAN_FRAME_BITS_STD)
+                       + ((msg.type == CANData) ? 8 * msg.len : 0);
+        events |= can_rx_put(msg, stamp);
+    }
+    if (events) {
+        can_rx_event.set(events);
+        CANRXLEDON;
+    }
+}
+
+#ifdef T8_SIMULATOR
+//
+// can_rx_inject
+//
+// Delivers a frame from the simulated T8 as if the controller had received it.
+//
+void can_rx_inject(const CANMessage &msg)
+{
+    core_util_critical_section_enter();
+    can_rx_bits += CAN_FRAME_BITS_STD + 8 * msg.len;
+    uint32_t events = can_rx_put(msg, us_ticker_read());
+    core_util_critical_section_exit();
+    if (events) {
+        can_rx_event.set(events);
+        CANRXLEDON;
+    }
+}
+#endif
+
+void can_rx_start()
+{
+    // Throw away anything left over and take over the CAN interrupt
+    core_util_critical_section_enter();
+    can_rx_tail = can_rx_head;
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++)
+        can_mailbox[n].tail = can_mailbox[n].head;
+    can_tx_drop();
+    for (uint16_t i = 0; i < can_tx_count; i++)
+        can_tx_state[can_tx_queue[i].ticket & (CAN_TX_TICKETS - 1)] = CAN_TX_ABORTED;
+    can_tx_count = 0;
+    can_tx_prio = 0;
+    can_state = CAN_STATE_ACTIVE;
+    core_util_critical_section_exit();
+    can_tx_event.set(CAN_TX_EVENT);
+    NVIC_SetVector(CAN_IRQn, (uint32_t)&can_isr);
+    LPC_CAN2->MOD |= (1 << 3);                          // Transmit priority by TFI PRIO, not by id
+    LPC_CAN2->IER |= (1 << 0) | (1 << 1) | (1 << 2) | (1 << 3) | (1 << 5) | (1 << 7) | (1 << 9) | (1 << 10); // Receive, transmit 1-3, error warning, data overrun, error passive and bus error interrupts
+    NVIC_EnableIRQ(CAN_IRQn);
+    can_health_ticker.attach_us(&can_health_check, CAN_HEALTH_MS * 1000);
+}
+
+void can_rx_stop()
+{
+    can_health_ticker.detach();
+    LPC_CAN2->IER &= ~((1 << 0) | (1 << 1) | (1 << 2) | (1 << 3) | (1 << 5) | (1 << 7) | (1 << 9) | (1 << 10));
+}
+
+//
+// can_tx_post
+//
+// Queues a frame for sending without waiting.
+//
+// inputs:    the frame
+// return:    a ticket for can_tx_status() / can_tx_wait(), 0 if the queue is full
+//
+uint32_t can_tx_post(const CANMessage &msg)
+{
+    uint32_t ticket = 0;
+    core_util_critical_section_enter();
+    if (can_tx_count < CAN_TX_QUEUE_SIZE) {
+        if (++can_tx_ticket == 0)
+            can_tx_ticket = 1;
+        ticket = can_tx_ticket;
+        can_tx_state[ticket & (CAN_TX_TICKETS - 1)] = CAN_TX_PENDING;
+        // insert behind everything of the same or higher priority
+        uint32_t key = can_tx_key(msg);
+        uint16_t i = can_tx_count;
+        while (i > 0 && can_tx_key(can_tx_queue[i - 1].msg) > key) {
+            can_tx_queue[i] = can_tx_queue[i - 1];
+            i--;
+        }
+        can_tx_queue[i].msg = msg;
+        can_tx_queue[i].ticket = ticket;
+        can_tx_count++;
+        can_tx_load();
+        for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+            if (can_watches[n].used && can_watches[n].id == msg.id)
+                can_watches[n].last = can_time_us();
+        }
+    }
+    core_util_critical_section_exit();
+    return ticket;
+}
+
+//
+// can_tx_status
+//
+// return:    CAN_TX_PENDING, CAN_TX_SENT or CAN_TX_ABORTED for a ticket from
+//            can_tx_post(), only the last CAN_TX_TICKETS tickets are tracked.
+//
+uint8_t can_tx_status(uint32_t ticket)
+{
+    return can_tx_state[ticket & (CAN_TX_TICKETS - 1)];
+}
+
+//
+// can_tx_wait
+//
+// Sleeps for up to 'timeout' milliseconds until a posted frame is on the bus.
+//
+// return:    bool TRUE if the frame was sent
+//
+bool can_tx_wait(uint32_t ticket, uint32_t timeout)
+{
+    Timer timer;
+    timer.start();
+    while (true) {
+        // Clear before looking so a release in between still wakes us
+        can_tx_event.clear(CAN_TX_EVENT);
+        uint8_t state = can_tx_status(ticket);
+        if (state != CAN_TX_PENDING)
+            return state == CAN_TX_SENT;
+        int32_t remaining = timeout - timer.read_ms();
+        if (remaining <= 0)
+            return false;
+        can_tx_event.wait_any(CAN_TX_EVENT, remaining);
+    }
+}
+
+//
+// can_rx_read
+//
+// Takes the oldest frame from the receive ring without waiting.
+//
+// inputs:    reference to a CANMessage for the frame, optional pointer for
+//            its receive time in microseconds (see can_time_us)
+// return:    bool TRUE if there was a message, FALSE if the ring is empty.
+//
+bool can_rx_read(CANMessage &msg, uint32_t *timestamp)
+{
+    // can_mailbox_open() may take frames out of the ring
+    core_util_critical_section_enter();
+    uint32_t tail = can_rx_tail;
+    if (tail == can_rx_head) {
+        core_util_critical_section_exit();
+        return false;
+    }
+    msg = can_rx_ring[tail & (CAN_RX_RING_SIZE - 1)];
+    if (timestamp) {
+        *timestamp = can_rx_stamp[tail & (CAN_RX_RING_SIZE - 1)];
+    }
+    can_rx_tail = tail + 1;
+    core_util_critical_section_exit();
+    return true;
+}
+
+//
+// can_rx_wait
+//
+// As can_rx_read but sleeps for up to 'timeout' milliseconds for a frame.
+//
+bool can_rx_wait(CANMessage &msg, uint32_t timeout, uint32_t *timestamp)
+{
+    // Clear before looking so a frame arriving in between still wakes us
+    can_rx_event.clear(CAN_RX_EVENT);
+    if (can_rx_read(msg, timestamp)) {
+        return true;
+    }
+    if (timeout == 0) {
+        return false;
+    }
+    can_rx_event.wait_any(CAN_RX_EVENT, timeout);
+    return can_rx_read(msg, timestamp);
+}
+
+//
+// can_mailbox_open
+//
+// Gives an id its own receive mailbox. Frames with this id that are still
+// waiting in the receive ring are moved into the mailbox, so a reply that
+// arrived before the mailbox was opened is not lost.
+//
+// inputs:    CAN id
+// return:    bool FALSE if all mailboxes are in use
+//
+bool can_mailbox_open(uint32_t id)
+{
+    bool result = false;
+    core_util_critical_section_enter();
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++) {
+        if (can_mailbox[n].used && can_mailbox[n].id == id) {
+            can_mailbox[n].users++;
+            core_util_critical_section_exit();
+            return true;
+        }
+    }
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++) {
+        can_mailbox_t *mb = &can_mailbox[n];
+        if (!mb->used) {
+            mb->id = id;
+            mb->users = 1;
+            mb->head = 0;
+            mb->tail = 0;
+            // Move this id's frames out of the ring, keeping the order of the rest
+            uint32_t keep = can_rx_tail;
+            for (uint32_t i = can_rx_tail; i != can_rx_head; i++) {
+                uint32_t from = i & (CAN_RX_RING_SIZE - 1);
+                if (can_rx_ring[from].id == id && mb->head < CAN_MAILBOX_SIZE) {
+                    mb->ring[mb->head] = can_rx_ring[from];
+                    mb->stamp[mb->head++] = can_rx_stamp[from];
+                } else {
+                    uint32_t to = keep++ & (CAN_RX_RING_SIZE - 1);
+                    can_rx_ring[to] = can_rx_ring[from];
+                    can_rx_stamp[to] = can_rx_stamp[from];
+                }
+            }
+            can_rx_head = keep;
+            mb->used = true;
+            result = true;
+            break;
+        }
+    }
+    core_util_critical_section_exit();
+    return result;
+}
+
+//
+// can_mailbox_close
+//
+// Undoes one can_mailbox_open(). Once every opener has closed it, frames for
+// the id go to the receive ring again and anything left in the mailbox is
+// thrown away, so no stale reply is handed to the next waiter.
+//
+void can_mailbox_close(uint32_t id)
+{
+    core_util_critical_section_enter();
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++) {
+        if (can_mailbox[n].used && can_mailbox[n].id == id && --can_mailbox[n].users == 0)
+            can_mailbox[n].used = false;
+    }
+    core_util_critical_section_exit();
+}
+
+//
+// can_mailbox_event
+//
+// return:    the can_rx_event flag for the open mailbox of 'id', 0 if it has none
+//
+uint32_t can_mailbox_event(uint32_t id)
+{
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++) {
+        if (can_mailbox[n].used && can_mailbox[n].id == id)
+            return CAN_MAILBOX_EVENT(n);
+    }
+    return 0;
+}
+
+//
+// can_mailbox_flush
+//
+// Throws away whatever is waiting in the mailbox for 'id', done before a new
+// request so a late reply to an earlier one can't be taken for its answer.
+//
+void can_mailbox_flush(uint32_t id)
+{
+    core_util_critical_section_enter();
+    for (uint8_t n = 0; n < CAN_MAILBOXES; n++) {
+        if (can_mailbox[n].used && can_mailbox[n].id == id)
+            can_mailbox[n].tail = can_mailbox[n].head;
+    }
+    core_util_critical_section_exit();
+}
+
+//
+// can_mailbox_wait
+//
+// Sleeps for up to 'timeout' milliseconds for a frame in the mailbox for 'id'.
+// The mailbox must be open, whoever starts a conversation with an ECU keeps it
+// open with can_mailbox_open() until the conversation is over so no reply
+// slips into the receive ring in between.
+//
+// inputs:    CAN id, reference to a CANMessage for the frame, time to wait and
+//            optional pointer for its receive time
+// return:    bool TRUE if there was a message, FALSE on timeout or without
+//            an open mailbox
+//
+bool can_mailbox_wait(uint32_t id, CANMessage &msg, uint32_t timeout, uint32_t *timestamp)
+{
+    uint32_t event = can_mailbox_event(id);
+    if (!event)
+        return false;
+    uint8_t n = 0;
+    while (CAN_MAILBOX_EVENT(n) != event)
+        n++;
+    can_mailbox_t *mb = &can_mailbox[n];
+    Timer timer;
+    timer.start();
+    while (true) {
+        // Clear before looking so a frame arriving in between still wakes us
+        can_rx_event.clear(event);
+        uint32_t tail = mb->tail;
+        if (tail != mb->head) {
+            msg = mb->ring[tail & (CAN_MAILBOX_SIZE - 1)];
+            if (timestamp) {
+                *timestamp = mb->stamp[tail & (CAN_MAILBOX_SIZE - 1)];
+            }
+            mb->tail = tail + 1;
+            return true;
+        }
+        int32_t remaining = timeout - timer.read_ms();
+        if (remaining <= 0)
+            return false;
+        can_rx_event.wait_any(event, remaining);
+    }
+}
+
+//
+// can_time_us
+//
+// The free running microsecond clock used for receive timestamps, it wraps
+// around after about 71 minutes.
+//
+uint32_t can_time_us()
+{
+    return us_ticker_read();
+}
+
+//
+// can_watch
+//
+// Starts recording when frames with 'id' are sent or received, see can_watch_idle_us().
+//
+// return:    false if all CAN_WATCHES are in use
+//
+bool can_watch(uint32_t id)
+{
+    for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+        if (can_watches[n].used && can_watches[n].id == id)
+            return true;
+    }
+    for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+        can_watch_t *w = &can_watches[n];
+        if (!w->used) {
+            w->id = id;
+            w->last = can_time_us();
+            w->absorb = false;
+            w->used = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+void can_unwatch(uint32_t id)
+{
+    for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+        if (can_watches[n].used && can_watches[n].id == id)
+            can_watches[n].used = false;
+    }
+}
+
+//
+// can_watch_idle_us
+//
+// return:    microseconds since a frame with a watched id was last sent or received,
+//            0 if the id is not watched
+//
+uint32_t can_watch_idle_us(uint32_t id)
+{
+    for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+        if (can_watches[n].used && can_watches[n].id == id)
+            return can_time_us() - can_watches[n].last;
+    }
+    return 0;
+}
+
+//
+// can_watch_absorb
+//
+// If the next frame received with a watched id starts with 'data' it is thrown
+// away instead of being delivered, provided it arrives within CAN_ABSORB_US.
+// Any other frame on the id ends the absorb, so it can't swallow a reply meant
+// for someone else later on.
+//
+static void can_watch_absorb(uint32_t id, const char *data, uint8_t len)
+{
+    for (uint8_t n = 0; n < CAN_WATCHES; n++) {
+        can_watch_t *w = &can_watches[n];
+        if (w->used && w->id == id) {
+            core_util_critical_section_enter();
+            w->absorb_len = (len > 8) ? 8 : len;
+            memcpy(w->absorb_data, data, w->absorb_len);
+            w->absorb_time = can_time_us();
+            w->absorb = true;
+            core_util_critical_section_exit();
+        }
+    }
+}
+
+//
+// can_tx_post_if_idle
+//
+// Queues a frame like can_tx_post(), but only if neither its id nor 'RespID' has
+// been seen for 'idle_us'. Looking and queueing happen in one critical section,
+// so a frame another thread queues for the id can't slip in between and be
+// followed by this one. With 'absorb' the answer to the frame is dropped, see
+// can_watch_absorb(). Both ids must be watched.
+//
+// return:    a ticket for can_tx_status() / can_tx_wait(), 0 if the ids were
+//            busy or the queue is full
+//
+uint32_t can_tx_post_if_idle(const CANMessage &msg, uint32_t RespID, uint32_t idle_us, const char *absorb, uint8_t absorb_len)
+{
+    uint32_t ticket = 0;
+    core_util_critical_section_enter();
+    if (can_watch_idle_us(msg.id) >= idle_us && can_watch_idle_us(RespID) >= idle_us) {
+        ticket = can_tx_post(msg);
+        if (ticket && absorb)
+            can_watch_absorb(RespID, absorb, absorb_len);
+    }
+    core_util_critical_section_exit();
+    return ticket;
+}
+
+//
+// can_get_status
+//
+// return:    the CAN controller's global status register, error warning (bit 6),
+//            bus off (bit 7) and the RX (bits 16-23) and TX (bits 24-31) error counters
+//
+uint32_t can_get_status()
+{
+    return LPC_CAN2->GSR;
+}
+
+//
+// can_get_health
+//
+// Fills in the controller's error state, its error counters now and at their
+// highest, and how often each kind of trouble has happened since start up.
+//
+void can_get_health(can_health_t &health)
+{
+    core_util_critical_section_enter();
+    uint32_t gsr = LPC_CAN2->GSR;
+    health.state = can_state;
+    health.tx_errors = (gsr >> 24) & 0xFF;
+    health.rx_errors = (gsr >> 16) & 0xFF;
+    health.tx_errors_peak = can_tx_errors_peak;
+    health.rx_errors_peak = can_rx_errors_peak;
+    health.bus_errors = can_bus_errors;
+    health.warnings = can_warnings;
+    health.passive = can_passive;
+    health.bus_off = can_bus_off;
+    health.tx_aborts = can_tx_aborts;
+    health.resets = can_resets;
+    health.hw_overruns = can_hw_overruns;
+    health.rx_overruns = can_rx_overruns;
+    core_util_critical_section_exit();
+}
+
+//
+// can_show_health
+//
+// Displays what can_get_health() reports.
+//
+void can_show_health()
+{
+    static const char *const states[] = {"error active", "error warning", "error passive", "bus off"};
+    can_health_t health;
+    can_get_health(health);
+    printf("CAN controller is %s\r\n", states[health.state & 3]);
+    printf("TX errors %d (highest %d), RX errors %d (highest %d)\r\n",
+           health.tx_errors, health.tx_errors_peak, health.rx_errors, health.rx_errors_peak);
+    printf("Bus errors %lu, error warning %lu, error passive %lu, bus off %lu\r\n",
+           health.bus_errors, health.warnings, health.passive, health.bus_off);
+    printf("Frames aborted %lu, controller resets %lu\r\n", health.tx_aborts, health.resets);
+    printf("Frames lost by the controller %lu, by the receive buffers %lu\r\n",
+           health.hw_overruns, health.rx_overruns);
+}
+
+
+//
+// can_af_reset
+//
+// Clears the acceptance filter memory and pointers, the filter set in RAM is kept
+// so it can be loaded again with can_filter_apply().
+//
+static void can_af_reset()
 {
     // Initialise the Acceptance Filters
     LPC_CANAF->AFMR = 0x01;                             // Put Acceptance Filter into reset/configuration mode
@@ -110,109 +1146,243 @@ void can_reset_filters()
     LPC_CANAF->AFMR = 0x00;                             // Enable Acceptance Filter all messages should be rejected
 }
 
+void can_reset_filters()
+{
+    can_filter_clear();
+    can_af_reset();
+}
+
 void can_use_filters(bool active)
 {
     active ? LPC_CANAF->AFMR = 0 : LPC_CANAF->AFMR = 2;
 }
 
-/*--------------------------------------------
-  setup acceptance filter for CAN controller 2
-  original http://www.dragonwake.com/download/LPC1768/Example/CAN/CAN.c
-  simplified for CAN2 interface and std id (11 bit) only
- *--------------------------------------------*/
-void can_add_filter(uint8_t chan, uint32_t id)
+// Acceptance filter set, every list is kept sorted because the acceptance
+// filter searches each section with a binary search.
+// Entries carry the controller number (chan - 1) above the id, 11 bit entries
+// in bits 13-15 and 29 bit entries in bits 29-31.
+static uint16_t can_af_std[CAN_AF_STD_MAX];
+static uint32_t can_af_std_grp[CAN_AF_STD_GRP_MAX];         // first << 16 | last
+static uint32_t can_af_ext[CAN_AF_EXT_MAX];
+static uint32_t can_af_ext_grp[CAN_AF_EXT_GRP_MAX][2];      // first, last
+static uint16_t can_af_std_cnt = 0;
+static uint16_t can_af_std_grp_cnt = 0;
+static uint16_t can_af_ext_cnt = 0;
+static uint16_t can_af_ext_grp_cnt = 0;
+
+//
+// can_af_words
+//
+// The number of filter memory words needed for the filter set plus 'extra' words.
+//
+static uint32_t can_af_words(uint32_t extra)
+{
+    return ((can_af_std_cnt + 1) >> 1) + can_af_std_grp_cnt + can_af_ext_cnt
+           + (can_af_ext_grp_cnt << 1) + extra;
+}
+
+//
+// can_filter_clear
+//
+// Empties the filter set, the acceptance filter is unchanged until
+// can_filter_apply() is called.
+//
+void can_filter_clear()
+{
+    can_af_std_cnt = 0;
+    can_af_std_grp_cnt = 0;
+    can_af_ext_cnt = 0;
+    can_af_ext_grp_cnt = 0;
+}
+
+//
+// can_filter_add
+//
+// Adds an individual 11 bit id to the filter set.
+//
+// inputs:    CAN controller (1 or 2) and id
+// return:    bool FALSE if the filter set is full
+//
+bool can_filter_add(uint8_t chan, uint32_t id)
 {
+    uint16_t entry = ((chan - 1) << 13) | (id & 0x7FF);
+    uint16_t i = can_af_std_cnt;
+    for (uint16_t j = 0; j < can_af_std_cnt; j++) {
+        if (can_af_std[j] == entry)
+            return true;                                // already there
+    }
+    if (can_af_std_cnt >= CAN_AF_STD_MAX || can_af_words((can_af_std_cnt & 1) ? 0 : 1) > CAN_AF_RAM_WORDS)
+        return false;
+    while (i > 0 && can_af_std[i-1] > entry) {
+        can_af_std[i] = can_af_std[i-1];
+        i--;
+    }
+    can_af_std[i] = entry;
+    can_af_std_cnt++;
+    return true;
+}
+
+//
+// can_filter_add_range
+//
+// Adds a range of 11 bit ids, first and last included, to the filter set.
+//
+bool can_filter_add_range(uint8_t chan, uint32_t first, uint32_t last)
+{
+    if (first > last || can_af_std_grp_cnt >= CAN_AF_STD_GRP_MAX || can_af_words(1) > CAN_AF_RAM_WORDS)
+        return false;
+    uint32_t entry = ((((chan - 1) << 13) | (first & 0x7FF)) << 16) | ((chan - 1) << 13) | (last & 0x7FF);
+    uint16_t i = can_af_std_grp_cnt;
+    while (i > 0 && can_af_std_grp[i-1] > entry) {
+        can_af_std_grp[i] = can_af_std_grp[i-1];
+        i--;
+    }
+    can_af_std_grp[i] = entry;
+    can_af_std_grp_cnt++;
+    return true;
+}
+
+//
+// can_filter_add_ext
+//
+// Adds an individual 29 bit id to the filter set.
+//
+bool can_filter_add_ext(uint8_t chan, uint32_t id)
+{
+    uint32_t entry = ((uint32_t)(chan - 1) << 29) | (id & 0x1FFFFFFF);
+    uint16_t i = can_af_ext_cnt;
+    for (uint16_t j = 0; j < can_af_ext_cnt; j++) {
+        if (can_af_ext[j] == entry)
+            return true;
+    }
+    if (can_af_ext_cnt >= CAN_AF_EXT_MAX || can_af_words(1) > CAN_AF_RAM_WORDS)
+        return false;
+    while (i > 0 && can_af_ext[i-1] > entry) {
+        can_af_ext[i] = can_af_ext[i-1];
+        i--;
+    }
+    can_af_ext[i] = entry;
+    can_af_ext_cnt++;
+    return true;
+}
+
+//
+// can_filter_add_ext_range
+//
+// Adds a range of 29 bit ids, first and last included, to the filter set.
+//
+bool can_filter_add_ext_range(uint8_t chan, uint32_t first, uint32_t last)
+{
+    if (first > last || can_af_ext_grp_cnt >= CAN_AF_EXT_GRP_MAX || can_af_words(2) > CAN_AF_RAM_WORDS)
+        return false;
+    uint32_t scc = (uint32_t)(chan - 1) << 29;
+    first = scc | (first & 0x1FFFFFFF);
+    last = scc | (last & 0x1FFFFFFF);
+    uint16_t i = can_af_ext_grp_cnt;
+    while (i > 0 && can_af_ext_grp[i-1][0] > first) {
+        can_af_ext_grp[i][0] = can_af_ext_grp[i-1][0];
+        can_af_ext_grp[i][1] = can_af_ext_grp[i-1][1];
+        i--;
+    }
+    can_af_ext_grp[i][0] = first;
+    can_af_ext_grp[i][1] = last;
+    can_af_ext_grp_cnt++;
+    return true;
+}
 
-    static int CAN_std_cnt = 0;
-    uint32_t buf0, buf1;
-    int cnt1, cnt2, bound1;
-
-    /* Acceptance Filter Memory full */
-    if (((CAN_std_cnt + 1) >> 1) >= 512)
-        return;                                         // error: objects full
-
-    /* Setup Acceptance Filter Configuration
-      Acceptance Filter Mode Register = Off  */
-    LPC_CANAF->AFMR = 0x00000001;
-
-    id &= 0x000007FF;                                   // Mask out 16-bits of ID
-    id |= (chan-1) << 13;                               // Add CAN controller number (1 or 2)
-
-    if (CAN_std_cnt == 0)  {                     /* For entering first  ID */
-        LPC_CANAF_RAM->mask[0] = 0x0000FFFF | (id << 16);
-    }  else if (CAN_std_cnt == 1)  {             /* For entering second ID */
-        if ((LPC_CANAF_RAM->mask[0] >> 16) > id)
-            LPC_CANAF_RAM->mask[0] = (LPC_CANAF_RAM->mask[0] >> 16) | (id << 16);
-        else
-            LPC_CANAF_RAM->mask[0] = (LPC_CANAF_RAM->mask[0] & 0xFFFF0000) | id;
-    }  else  {
-        /* Find where to insert new ID */
-        cnt1 = 0;
-        cnt2 = CAN_std_cnt;
-        bound1 = (CAN_std_cnt - 1) >> 1;
-        while (cnt1 <= bound1)  {                  /* Loop through standard existing IDs */
-            if ((LPC_CANAF_RAM->mask[cnt1] >> 16) > id)  {
-                cnt2 = cnt1 * 2;
+//
+// can_filter_load
+//
+// Replaces the filter set with a table ending in a CAN_AF_END entry and
+// loads it into the acceptance filter.
+//
+// inputs:    CAN controller (1 or 2) and the table
+// return:    bool FALSE if some entries did not fit, the rest are loaded
+//
+bool can_filter_load(uint8_t chan, const can_filter_t *table)
+{
+    bool result = true;
+    can_filter_clear();
+    for (; table->type != CAN_AF_END; table++) {
+        switch (table->type) {
+            case CAN_AF_STD:
+                result &= can_filter_add(chan, table->first);
                 break;
-            }
-            if ((LPC_CANAF_RAM->mask[cnt1] & 0x0000FFFF) > id)  {
-                cnt2 = cnt1 * 2 + 1;
+            case CAN_AF_STD_GRP:
+                result &= can_filter_add_range(chan, table->first, table->last);
+                break;
+            case CAN_AF_EXT:
+                result &= can_filter_add_ext(chan, table->first);
+                break;
+            case CAN_AF_EXT_GRP:
+                result &= can_filter_add_ext_range(chan, table->first, table->last);
                 break;
-            }
-            cnt1++;                                  /* cnt1 = U32 where to insert new ID */
-        }                                          /* cnt2 = U16 where to insert new ID */
-
-        if (cnt1 > bound1)  {                      /* Adding ID as last entry */
-            if ((CAN_std_cnt & 0x0001) == 0)         /* Even number of IDs exists */
-                LPC_CANAF_RAM->mask[cnt1]  = 0x0000FFFF | (id << 16);
-            else                                     /* Odd  number of IDs exists */
-                LPC_CANAF_RAM->mask[cnt1]  = (LPC_CANAF_RAM->mask[cnt1] & 0xFFFF0000) | id;
-        }  else  {
-            buf0 = LPC_CANAF_RAM->mask[cnt1];        /* Remember current entry */
-            if ((cnt2 & 0x0001) == 0)                /* Insert new mask to even address */
-                buf1 = (id << 16) | (buf0 >> 16);
-            else                                     /* Insert new mask to odd  address */
-                buf1 = (buf0 & 0xFFFF0000) | id;
-
-            LPC_CANAF_RAM->mask[cnt1] = buf1;        /* Insert mask */
-
-            bound1 = CAN_std_cnt >> 1;
-            /* Move all remaining standard mask entries one place up */
-            while (cnt1 < bound1)  {
-                cnt1++;
-                buf1  = LPC_CANAF_RAM->mask[cnt1];
-                LPC_CANAF_RAM->mask[cnt1] = (buf1 >> 16) | (buf0 << 16);
-                buf0  = buf1;
-            }
-
-            if ((CAN_std_cnt & 0x0001) == 0)         /* Even number of IDs exists */
-                LPC_CANAF_RAM->mask[cnt1] = (LPC_CANAF_RAM->mask[cnt1] & 0xFFFF0000) | (0x0000FFFF);
         }
     }
-    CAN_std_cnt++;
+    can_filter_apply();
+    return result;
+}
 
-    /* Calculate std ID start address (buf0) and ext ID start address <- none (buf1) */
-    buf0 = ((CAN_std_cnt + 1) >> 1) << 2;
-    /* Setup acceptance filter pointers */
-    LPC_CANAF->SFF_sa     = 0;
-    LPC_CANAF->SFF_GRP_sa = buf0;
-    LPC_CANAF->EFF_sa     = buf0;
-    LPC_CANAF->EFF_GRP_sa = buf0;
-    LPC_CANAF->ENDofTable = buf0;
+//
+// can_filter_apply
+//
+// Writes the whole filter set into the acceptance filter memory in one pass,
+// sets the section pointers to match and turns the acceptance filter on.
+// Frames that match no entry are rejected by the hardware.
+//
+void can_filter_apply()
+{
+    uint32_t addr = 0;
+
+    LPC_CANAF->AFMR = 0x01;                             // Put Acceptance Filter into reset/configuration mode
+    // Individual 11 bit ids, two per word, an odd entry is paired with a disabled one
+    LPC_CANAF->SFF_sa = 0;
+    for (uint16_t i = 0; i < can_af_std_cnt; i += 2) {
+        uint32_t second = (i + 1 < can_af_std_cnt) ? can_af_std[i+1] : 0xFFFF;
+        LPC_CANAF_RAM->mask[addr++] = ((uint32_t)can_af_std[i] << 16) | second;
+    }
+    // 11 bit ranges, one word each
+    LPC_CANAF->SFF_GRP_sa = addr << 2;
+    for (uint16_t i = 0; i < can_af_std_grp_cnt; i++)
+        LPC_CANAF_RAM->mask[addr++] = can_af_std_grp[i];
+    // Individual 29 bit ids
+    LPC_CANAF->EFF_sa = addr << 2;
+    for (uint16_t i = 0; i < can_af_ext_cnt; i++)
+        LPC_CANAF_RAM->mask[addr++] = can_af_ext[i];
+    // 29 bit ranges, two words each
+    LPC_CANAF->EFF_GRP_sa = addr << 2;
+    for (uint16_t i = 0; i < can_af_ext_grp_cnt; i++) {
+        LPC_CANAF_RAM->mask[addr++] = can_af_ext_grp[i][0];
+        LPC_CANAF_RAM->mask[addr++] = can_af_ext_grp[i][1];
+    }
+    LPC_CANAF->ENDofTable = addr << 2;
+    LPC_CANAF->AFMR = 0x00;                             // Use acceptance filter
+}
 
-    LPC_CANAF->AFMR = 0x00000000;                  /* Use acceptance filter */
-} // CAN2_wrFilter
+//
+// can_add_filter
+//
+// Adds one 11 bit id to the filter set and loads the acceptance filter.
+// Use can_filter_load() for more than a few ids.
+//
+void can_add_filter(uint8_t chan, uint32_t id)
+{
+    can_filter_add(chan, id);
+    can_filter_apply();
+}
 
 
 void can_open()
 {
     // activate external can transceiver
     can.reset();
+    can_rx_start();
 }
 
 void can_close()
 {
     // disable external can transceiver
+    can_rx_stop();
     can.reset();
 }
 
@@ -237,27 +1407,6 @@ uint8_t can_set_speed(uint32_t speed)
     return (can.frequency(speed)) ? TERM_OK : TERM_ERR;
 }
 
-//
-// show_can_message
-//
-// Displays a CAN message in the RX buffer if there is one.
-//
-// inputs:    none
-// return:    bool TRUE if there was a message, FALSE if no message.
-//
-extern void show_can_message()
-{
-    CANMessage can_MsgRx;
-    if (can.read(can_MsgRx)) {
-        CANRXLEDON;
-        printf("w%03x%d", can_MsgRx.id, can_MsgRx.len);
-        for (char i=0; i<can_MsgRx.len; i++)
-            printf("%02x", can_MsgRx.data[i]);
-        //printf(" %c ", can_MsgRx.data[2]);
-        printf("\r\n");
-    }
-    return;
-}
 //
 // show_T5can_message
 //
@@ -269,7 +1418,7 @@ extern void show_can_message()
 extern void show_T5can_message()
 {
     CANMessage can_MsgRx;
-    if (can.read(can_MsgRx)) {
+    if (can_rx_read(can_MsgRx)) {
         CANRXLEDON;
         switch (can_MsgRx.id) {
             case 0x005:
@@ -296,7 +1445,7 @@ extern void show_T5can_message()
 extern void show_T7can_message()
 {
     CANMessage can_MsgRx;
-    if (can.read(can_MsgRx)) {
+    if (can_rx_read(can_MsgRx)) {
         CANRXLEDON;
         switch (can_MsgRx.id) {
             case 0x1A0:         //1A0h - Engine information
@@ -339,7 +1488,7 @@ extern void show_T7can_message()
 extern void show_T8can_message()
 {
     CANMessage can_MsgRx;
-    if (can.read(can_MsgRx)) {
+    if (can_rx_read(can_MsgRx)) {
         CANRXLEDON;
         switch (can_MsgRx.id) {
             case 0x645: // CIM
@@ -370,7 +1519,7 @@ extern void show_T8can_message()
 extern void silent_can_message()
 {
     CANMessage can_MsgRx;
-    if (can.read(can_MsgRx)) {
+    if (can_rx_read(can_MsgRx)) {
         CANRXLEDON;
     }
     return;
@@ -385,8 +1534,6 @@ extern void silent_can_message()
 //
 extern bool can_send_timeout (uint32_t id, char *frame, uint8_t len, uint16_t timeout)
 {
-    CANTimer.reset();
-    CANTimer.start();
 #ifdef DEBUG
     printf("ID:%03x Len:%03x", id, len);
     for (char i=0; i<len; i++) {
@@ -394,38 +1541,35 @@ extern bool can_send_timeout (uint32_t id, char *frame, uint8_t len, uint16_t ti
     }
     printf("\n\r");
 #endif
-    while (CANTimer.read_ms() < timeout) {
-        if (can.write(CANMessage(id, frame, len))) {
-            CANTimer.stop();
-            CANTXLEDON;
-//            led1 = 1;
-            return true;
-        }
-    }
-    can.reset();
-    CANTimer.stop();
-    return false;
+    return can_send_timeout(id, frame, len, CANStandard, CANData, timeout);
 }
 
+//
+// Queues a CAN frame for sending, waiting for up to 'timeout' milliseconds
+// if the transmit queue is full
+//
+// return:    TRUE if the frame was queued
+//
 extern bool can_send_timeout(uint32_t id, char *frame, uint8_t len, uint8_t format, uint8_t type, uint16_t timeout) {
-    CANTimer.reset();
-    CANTimer.start();
-
-    while (CANTimer.read_ms() < timeout) {
-        if (can.write(CANMessage(id, frame, len))) {
-            CANTimer.stop();
-            CANTXLEDON;
+    CANMessage msg(id, frame, len, type ? CANRemote : CANData, format ? CANExtended : CANStandard);
+    Timer timer;
+    timer.start();
+    while (true) {
+        can_tx_event.clear(CAN_TX_EVENT);
+        if (can_tx_post(msg)) {
             return true;
         }
+        int32_t remaining = timeout - timer.read_ms();
+        if (remaining <= 0) {
+            return false;
+        }
+        can_tx_event.wait_any(CAN_TX_EVENT, remaining);
     }
-    can.reset();
-    CANTimer.stop();
-    return false;
 }
 
 //
 // Waits for a CAN Message with the specified 'id' for a time specified by the 'timeout'
-// All other messages are ignored
+// Messages for other ids are left in their mailbox or the receive ring
 // The CAN message frame is returned using the pointer to 'frame'
 //
 // inputs:    integer CAN message 'id', pointer to 'frame' for returning the data
@@ -437,10 +1581,15 @@ extern bool can_send_timeout(uint32_t id, char *frame, uint8_t len, uint8_t form
 extern bool can_wait_timeout (uint32_t id, char *frame, uint8_t len, uint16_t timeout)
 {
     CANMessage CANMsgRx;
-    CANTimer.reset();
-    CANTimer.start();
-    while (CANTimer.read_ms() < timeout) {
-        if (can.read(CANMsgRx)) {
+    Timer timer;
+    timer.start();
+    int32_t remaining;
+    // with a mailbox open for 'id' frames for other ids are left for whoever wants
+    // them, otherwise they are read from the receive ring and dropped
+    bool mailbox = (id != 0) && can_mailbox_event(id);
+    bool result = false;
+    while (!result && (remaining = timeout - timer.read_ms()) > 0) {
+        if (mailbox ? can_mailbox_wait(id, CANMsgRx, remaining) : can_rx_wait(CANMsgRx, remaining)) {
 #ifdef DEBUG
             printf("ID:%03x Len:%03x", CANMsgRx.id, CANMsgRx.len);
             for (char i=0; i<len; i++) {
@@ -451,16 +1600,13 @@ extern bool can_wait_timeout (uint32_t id, char *frame, uint8_t len, uint16_t ti
             CANRXLEDON;
 //            led2 = 1;
             if (CANMsgRx.id == id || id ==0) {
-                CANTimer.stop();
 //                if (CANMsgRx.len != len)
 //                    return FALSE;
                 for (int i=0; i<len; i++)
                     frame[i] = CANMsgRx.data[i];
-                return true;
+                result = true;
             }
         }
     }
-    can.reset();
-    CANTimer.stop();
-    return false;
+    return result;
 }
@@ -21,6 +21,113 @@ accept liability for any damage arising from its use.
 
 #define CANsuppliedCLK 24000000
 
+// Received frames are moved from the controller into a ring by the CAN interrupt
+// There must only be one consumer reading the ring at a time
+#define CAN_RX_RING_SIZE 64                 // frames, must be a power of 2
+#define CAN_RX_EVENT 0x01                   // can_rx_event flag set for every received frame
+
+// Frames with an id that has a mailbox go to the mailbox instead of the ring,
+// so a waiter never has to read past (and lose) frames meant for someone else
+#define CAN_MAILBOXES 8                     // ids that can have their own queue
+#define CAN_MAILBOX_SIZE 8                  // frames, must be a power of 2
+#define CAN_MAILBOX_EVENT(n) (0x02 << (n))  // can_rx_event flag for mailbox n
+
+// Frames to send wait in a queue ordered by id (lowest first, same id in order
+// of posting) and are moved into the controller's three transmit buffers by the
+// CAN interrupt as they become free
+#define CAN_TX_QUEUE_SIZE 32                // frames waiting for a transmit buffer
+#define CAN_TX_TICKETS 64                   // tracked tickets, must be a power of 2
+#define CAN_TX_EVENT 0x01                   // can_tx_event flag set when a transmit buffer is released
+
+// Watched ids have the time of their last frame, sent or received, recorded and
+// can have one expected reply thrown away as it arrives, so a background task can
+// tell when a conversation is idle and keep its own replies out of the way
+#define CAN_WATCHES 8                       // two per GMLAN keep-alive
+#define CAN_ABSORB_US 1000000               // an absorb not matched within this is forgotten
+
+// Bus load is measured with the acceptance filter bypassed, the frames the
+// measurement lets through are counted and dropped unless a mailbox wants them
+#define CAN_FRAME_BITS_STD 47               // 11 bit id frame without data, bit stuffing not counted
+#define CAN_FRAME_BITS_EXT 67               // 29 bit id frame without data
+
+// can_autobaud() listens at each of these bit rates in turn, giving up on one at
+// the first bus error and settling on the first that has frames without errors,
+// a rate that had any error is never chosen
+#define CAN_AUTOBAUD_RATES {47619, 83333, 125000, 250000, 500000, 615000, 1000000}
+#define CAN_AUTOBAUD_MS 25                  // longest time spent at each rate
+#define CAN_AUTOBAUD_FRAMES 2               // clean frames that settle it
+
+// can_tx_status() results
+#define CAN_TX_PENDING 0                    // queued or being sent
+#define CAN_TX_SENT 1                       // on the bus
+#define CAN_TX_ABORTED 2                    // thrown away by can_configure() / can_open() or recovery
+
+// The controller's error state is followed from its error interrupts and checked
+// every CAN_HEALTH_MS. A frame it keeps retrying is aborted, a bus off is left to
+// the controller's own recovery and only if that does not finish in time is the
+// controller reset, keeping the bit rate, mode and acceptance filter
+#define CAN_HEALTH_MS 10                    // how often the status is checked
+#define CAN_TX_STALL_MS 250                 // a frame still not sent after this is aborted
+#define CAN_BUS_OFF_MS 500                  // a bus off not recovered after this resets the controller
+
+// can_health_t states
+#define CAN_STATE_ACTIVE 0                  // error counters below 96
+#define CAN_STATE_WARNING 1                 // an error counter has reached 96
+#define CAN_STATE_PASSIVE 2                 // an error counter is over 127
+#define CAN_STATE_BUS_OFF 3                 // the transmit error counter passed 255
+
+struct can_health_t {
+    uint8_t state;
+    uint8_t tx_errors;                      // transmit and receive error counters
+    uint8_t rx_errors;
+    uint8_t tx_errors_peak;                 // highest counts seen
+    uint8_t rx_errors_peak;
+    uint32_t bus_errors;
+    uint32_t warnings;                      // times each state was entered
+    uint32_t passive;
+    uint32_t bus_off;
+    uint32_t tx_aborts;                     // frames aborted after CAN_TX_STALL_MS
+    uint32_t resets;                        // controller resets after CAN_BUS_OFF_MS
+    uint32_t hw_overruns;
+    uint32_t rx_overruns;
+};
+
+extern EventFlags can_rx_event;
+extern EventFlags can_tx_event;
+extern volatile uint32_t can_rx_overruns;   // frames dropped because the ring was full
+extern volatile uint32_t can_hw_overruns;   // frames lost by the controller (data overrun)
+extern volatile uint32_t can_rx_frames;     // frames received
+extern volatile uint32_t can_bus_errors;    // bus errors the controller has seen
+
+extern void can_rx_start();
+extern void can_rx_stop();
+extern bool can_rx_read(CANMessage &msg, uint32_t *timestamp = NULL);
+extern bool can_rx_wait(CANMessage &msg, uint32_t timeout, uint32_t *timestamp = NULL);
+extern uint32_t can_time_us();
+extern bool can_mailbox_open(uint32_t id);
+extern void can_mailbox_close(uint32_t id);
+extern void can_mailbox_flush(uint32_t id);
+extern uint32_t can_mailbox_event(uint32_t id);
+#ifdef T8_SIMULATOR
+extern void can_rx_inject(const CANMessage &msg);
+#endif
+extern bool can_mailbox_wait(uint32_t id, CANMessage &msg, uint32_t timeout, uint32_t *timestamp = NULL);
+extern uint32_t can_tx_post(const CANMessage &msg);
+extern uint8_t can_tx_status(uint32_t ticket);
+extern bool can_tx_wait(uint32_t ticket, uint32_t timeout);
+extern uint32_t can_get_status();
+extern void can_get_health(can_health_t &health);
+extern void can_show_health();
+extern uint32_t can_get_bitrate();
+extern float can_bus_load(uint16_t ms);
+extern void can_set_bitrate(uint32_t baud);
+extern uint32_t can_autobaud(uint16_t dwell = CAN_AUTOBAUD_MS);
+extern bool can_watch(uint32_t id);
+extern void can_unwatch(uint32_t id);
+extern uint32_t can_watch_idle_us(uint32_t id);
+extern uint32_t can_tx_post_if_idle(const CANMessage &msg, uint32_t RespID, uint32_t idle_us,
+                                    const char *absorb = NULL, uint8_t absorb_len = 0);
+
 extern void can_disable(uint8_t chan);
 extern void can_enable(uint8_t chan);
 extern void can_configure(uint8_t chan, uint32_t baud, bool listen);
@@ -28,12 +135,46 @@ extern void can_add_filter(uint8_t chan, uint32_t id);
 extern void can_reset_filters();
 extern void can_use_filters(bool active);
 
+// Acceptance filter set, collected in RAM and loaded by can_filter_apply()
+// The filter memory holds 512 words, an individual 11 bit id takes half a word,
+// an 11 bit range or a 29 bit id one word and a 29 bit range two words
+#define CAN_AF_RAM_WORDS    512
+#define CAN_AF_STD_MAX      128             // individual 11 bit ids
+#define CAN_AF_STD_GRP_MAX  32              // 11 bit id ranges
+#define CAN_AF_EXT_MAX      64              // individual 29 bit ids
+#define CAN_AF_EXT_GRP_MAX  32              // 29 bit id ranges
+
+extern void can_filter_clear();
+extern bool can_filter_add(uint8_t chan, uint32_t id);
+extern bool can_filter_add_range(uint8_t chan, uint32_t first, uint32_t last);
+extern bool can_filter_add_ext(uint8_t chan, uint32_t id);
+extern bool can_filter_add_ext_range(uint8_t chan, uint32_t first, uint32_t last);
+extern void can_filter_apply();
+
+// can_filter_load() table entries, 'last' is only used by ranges
+#define CAN_AF_END          0
+#define CAN_AF_STD          1               // 11 bit id
+#define CAN_AF_STD_GRP      2               // 11 bit ids first..last
+#define CAN_AF_EXT          3               // 29 bit id
+#define CAN_AF_EXT_GRP      4               // 29 bit ids first..last
+
+struct can_filter_t {
+    uint8_t type;
+    uint32_t first;
+    uint32_t last;
+};
+
+extern bool can_filter_load(uint8_t chan, const can_filter_t *table);
+
+extern const can_filter_t can_filter_T5[];
+extern const can_filter_t can_filter_T7[];
+extern const can_filter_t can_filter_T8[];
+
 extern void can_open();
 extern void can_close();
 extern void can_monitor();
 extern void can_active();
 extern uint8_t can_set_speed(uint32_t speed);
-extern void show_can_message();
 extern void show_T5can_message();
 extern void show_T7can_message();
 extern void show_T8can_message();
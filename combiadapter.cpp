@@ -27,17 +27,28 @@ SOFTWARE.
 #include "canutils.h"
 #include "bdmcpu32.h"
 #include "bdmtrionic.h"
+#include "gmlanlog.h"
 
 bool CombiReceivePacket(packet_t *packet, uint32_t timeout);
+bool CombiReceivePacketInto(packet_t *packet, uint8_t *buffer, uint16_t buffer_len, uint32_t timeout = osWaitForever);
 bool CombiSendReplyPacket(packet_t *reply, packet_t *source, uint8_t *data, uint16_t data_len, uint8_t term, uint32_t timeout);
 bool CombiSendPacket(packet_t *packet, uint32_t timeout);
 void swab(WORD *word);
 bool readflash(LONG start_addr, LONG size);
 bool writeflash(char *flash_type, LONG start_addr, LONG size);
+bool writeflash_win(char *flash_type, LONG start_addr, LONG size, uint8_t window);
 
 uint8_t version[2] = {0x03, 0x01};
-uint8_t data_buff[64];
+uint8_t data_buff[0x100];
 uint8_t egt_temp[5] = {0};
+uint8_t can_open_flags = 0;
+uint8_t can_flush_ms = CAN_BATCH_FLUSH_MS;
+uint8_t can_batch[CAN_BATCH_SIZE];
+uint16_t can_batch_len = 0;
+uint8_t can_log_batch[CAN_LOG_SIZE];
+uint16_t can_log_len = 0;
+bool can_filter_host = false;       // the host has set up its own filters
+Mutex combi_send_lock;              // one packet at a time, replies and CAN batches share the pipe
 Thread can_rx_thd;
 Thread egt_thd;
 
@@ -50,25 +61,117 @@ void egt_read_thd(void) {
     }
 }
 
+void can_send_frame(CANMessage *can_MsgRx, uint32_t rx_time) {
+    packet_t combiPacket;
+    uint8_t buff[19] = {0};
+    buff[0] = can_MsgRx->id & 0xFF;
+    buff[1] = (can_MsgRx->id >> 8) & 0xFF;
+    buff[2] = (can_MsgRx->id >> 16) & 0xFF;
+    buff[3] = (can_MsgRx->id >> 24) & 0xFF;
+    buff[12] = can_MsgRx->len;
+    for (int i = 0; i < can_MsgRx->len; i++) {
+        buff[4+i] = can_MsgRx->data[i];
+    }
+    combiPacket.cmd_code = cmd_can_frame;
+    combiPacket.data_len = 15;
+    if (can_open_flags & CAN_OPEN_TIMESTAMP) {
+        // the two spare bytes are too small for the stamp, so it follows the frame
+        for (uint8_t i = 0; i < 4; i++) {
+            buff[15+i] = (rx_time >> (8 * i)) & 0xFF;
+        }
+        combiPacket.data_len = 19;
+    }
+    combiPacket.data = buff;
+    combiPacket.term = cmd_term_ack;
+    CombiSendPacket(&combiPacket, 0);
+}
+
+void can_batch_flush() {
+    if (can_batch_len == 0) {
+        return;
+    }
+    packet_t combiPacket;
+    combiPacket.cmd_code = cmd_can_frame_batch;
+    combiPacket.data_len = can_batch_len;
+    combiPacket.data = can_batch;
+    combiPacket.term = cmd_term_ack;
+    CombiSendPacket(&combiPacket, 0);
+    can_batch_len = 0;
+}
+
+// sends the adapter clock so the host can map frame timestamps to its own time
+void can_send_timesync() {
+    packet_t combiPacket;
+    uint8_t buff[4];
+    uint32_t now = can_time_us();
+    for (uint8_t i = 0; i < 4; i++) {
+        buff[i] = (now >> (8 * i)) & 0xFF;
+    }
+    combiPacket.cmd_code = cmd_can_timesync;
+    combiPacket.data_len = 4;
+    combiPacket.data = buff;
+    combiPacket.term = cmd_term_ack;
+    CombiSendPacket(&combiPacket, 0);
+}
+
+// returns true if this is the first record of a new batch
+bool can_batch_add(CANMessage *can_MsgRx, uint32_t rx_time) {
+    uint8_t id_len = (can_MsgRx->format == CANExtended) ? 4 : 2;
+    uint8_t ts_len = (can_open_flags & CAN_OPEN_TIMESTAMP) ? 4 : 0;
+    if (can_batch_len + 1 + id_len + ts_len + can_MsgRx->len > CAN_BATCH_SIZE) {
+        can_batch_flush();
+    }
+    bool first = (can_batch_len == 0);
+    uint8_t *rec = can_batch + can_batch_len;
+    *rec++ = (can_MsgRx->len & CAN_BATCH_LEN_MASK)
+            | (can_MsgRx->type == CANRemote ? CAN_BATCH_REMOTE : 0)
+            | (id_len == 4 ? CAN_BATCH_EXTENDED : 0)
+            | (ts_len ? CAN_BATCH_TIMESTAMP : 0);
+    for (uint8_t i = 0; i < id_len; i++) {
+        *rec++ = (can_MsgRx->id >> (8 * i)) & 0xFF;
+    }
+    for (uint8_t i = 0; i < ts_len; i++) {
+        *rec++ = (rx_time >> (8 * i)) & 0xFF;
+    }
+    for (uint8_t i = 0; i < can_MsgRx->len; i++) {
+        *rec++ = can_MsgRx->data[i];
+    }
+    can_batch_len = rec - can_batch;
+    return first;
+}
+
 void can_read_thd(void) {
     CANMessage can_MsgRx;
+    uint32_t rx_time;
+    Timer flush_timer;
+    Timer sync_timer;
+    sync_timer.start();
     while(true) {
-        if (can.read(can_MsgRx)) {
+        // sleep until a frame arrives, or until the pending batch is due
+        uint32_t wait_ms = 100;
+        if (can_batch_len) {
+            int32_t left = can_flush_ms - flush_timer.read_ms();
+            wait_ms = left > 0 ? left : 0;
+        }
+        if (can_rx_wait(can_MsgRx, wait_ms, &rx_time)) {
             led2 = 1;
-            packet_t combiPacket;
-            uint8_t buff[15] = {0};
-            buff[0] = can_MsgRx.id & 0xFF;
-            buff[1] = (can_MsgRx.id >> 8) & 0xFF;
-            buff[2] = (can_MsgRx.id >> 16) & 0xFF;
-            buff[3] = (can_MsgRx.id >> 24) & 0xFF;
-            buff[12] = can_MsgRx.len;
-            for (int i = 0; i < can_MsgRx.len; i++) {
-                buff[4+i] = can_MsgRx.data[i];
-            }
-            combiPacket.cmd_code = cmd_can_frame;
-            combiPacket.data_len = 15;
-            combiPacket.data = buff;
-            CombiSendPacket(&combiPacket, 0);
+            if (can_open_flags & CAN_OPEN_BATCH) {
+                if (can_batch_add(&can_MsgRx, rx_time)) {
+                    flush_timer.reset();
+                    flush_timer.start();
+                }
+            } else {
+                can_send_frame(&can_MsgRx, rx_time);
+            }
+        }
+        // the oldest frame in a batch waits no longer than the flush deadline
+        if (can_batch_len && (flush_timer.read_ms() >= can_flush_ms)) {
+            can_batch_flush();
+        }
+        if ((can_open_flags & CAN_OPEN_TIMESTAMP) && (sync_timer.read_ms() >= CAN_TIMESYNC_MS)) {
+            sync_timer.reset();
+            can_batch_flush();
+            can_send_timesync();
         }
     }
     return;
@@ -219,6 +322,16 @@ bool exec_cmd_bdm(packet_t *rx_packet, packet_t *tx_packet) {
                 return writeflash(&flash_type, start_addr, end_addr);
             }
             return false;
+        case cmd_bdm_write_flash_win:
+            if (rx_packet->data_len == 15) {
+                char flash_type = (char)rx_packet->data[0];
+                uint32_t start_addr = (uint32_t)rx_packet->data[6] << 24 | (uint32_t)rx_packet->data[7] << 16
+                                    | (uint32_t)rx_packet->data[8] << 8 | (uint32_t)rx_packet->data[9];
+                uint32_t end_addr = (uint32_t)rx_packet->data[0xd] | (uint32_t)rx_packet->data[10] << 24
+                                    | (uint32_t)rx_packet->data[0xb] << 16 | (uint32_t)rx_packet->data[0xc] << 8;
+                return writeflash_win(&flash_type, start_addr, end_addr, rx_packet->data[0xe]);
+            }
+            return false;
         case cmd_bdm_pinstate:
             uint8_t pin = PIN_PWR.read();
             return (pin == 1) && CombiSendReplyPacket(tx_packet, rx_packet, &pin, 1, cmd_term_ack, 1000);
@@ -227,29 +340,128 @@ bool exec_cmd_bdm(packet_t *rx_packet, packet_t *tx_packet) {
     return false;
 }
 
+// reads an 'len' byte id, LSB first
+uint32_t can_filter_id(uint8_t *data, uint8_t len) {
+    uint32_t id = 0;
+    for (uint8_t i = 0; i < len; i++) {
+        id |= (uint32_t)data[i] << (8 * i);
+    }
+    return id;
+}
+
+bool can_filter_cmd(uint8_t *data, uint16_t data_len) {
+    uint8_t op = *data++;
+    uint8_t len = (op == CAN_FILTER_EXT || op == CAN_FILTER_EXT_RANGE) ? 4 : 2;
+    uint8_t rec = (op == CAN_FILTER_STD_RANGE || op == CAN_FILTER_EXT_RANGE) ? 2 * len : len;
+    data_len--;
+    switch (op) {
+        case CAN_FILTER_CLEAR:
+            can_filter_clear();
+            return data_len == 0;
+        case CAN_FILTER_APPLY:
+            can_filter_apply();
+            return data_len == 0;
+        case CAN_FILTER_BYPASS:
+            can_use_filters(false);
+            return data_len == 0;
+        case CAN_FILTER_STD:
+        case CAN_FILTER_STD_RANGE:
+        case CAN_FILTER_EXT:
+        case CAN_FILTER_EXT_RANGE:
+            if (data_len == 0 || (data_len % rec) != 0) {
+                return false;
+            }
+            for (; data_len; data_len -= rec, data += rec) {
+                uint32_t first = can_filter_id(data, len);
+                uint32_t last = (rec > len) ? can_filter_id(data + len, len) : first;
+                bool ok = (op == CAN_FILTER_STD) ? can_filter_add(2, first)
+                        : (op == CAN_FILTER_EXT) ? can_filter_add_ext(2, first)
+                        : (op == CAN_FILTER_STD_RANGE) ? can_filter_add_range(2, first, last)
+                        : can_filter_add_ext_range(2, first, last);
+                if (!ok) {
+                    return false;
+                }
+            }
+            return true;
+    }
+    return false;
+}
+
+// GMLANLog sink, packs the records into cmd_can_log_data packets
+void can_log_sink(const uint8_t *record, uint16_t len) {
+    if (can_log_len && (record == NULL || can_log_len + len > CAN_LOG_SIZE)) {
+        packet_t combiPacket;
+        combiPacket.cmd_code = cmd_can_log_data;
+        combiPacket.data_len = can_log_len;
+        combiPacket.data = can_log_batch;
+        combiPacket.term = cmd_term_ack;
+        CombiSendPacket(&combiPacket, 0);
+        can_log_len = 0;
+    }
+    if (record != NULL) {
+        memcpy(can_log_batch + can_log_len, record, len);
+        can_log_len += len;
+    }
+}
+
+bool can_log_cmd(uint8_t *data, uint16_t data_len) {
+    switch (data[0]) {
+        case CAN_LOG_CLEAR:
+            return data_len == 1 && GMLANLogClear();
+        case CAN_LOG_IDENTIFIER:
+            return data_len == 4 && GMLANLogAddIdentifier(data[1], data[2] | (data[3] << 8));
+        case CAN_LOG_MEMORY:
+            return data_len == 8 && GMLANLogAddMemory(can_filter_id(data + 1, 4), data[5], data[6] | (data[7] << 8));
+        case CAN_LOG_START:
+            if (data_len != 2 && data_len != 6) {
+                return false;
+            }
+            can_log_len = 0;
+            return GMLANLogStart(data_len == 6 ? can_filter_id(data + 2, 2) : T8REQID,
+                                 data_len == 6 ? can_filter_id(data + 4, 2) : T8RESPID,
+                                 data[1] == CAN_LOG_LOCAL ? NULL : &can_log_sink);
+        case CAN_LOG_STOP:
+            GMLANLogStop();
+            return data_len == 1;
+    }
+    return false;
+}
+
 bool exec_cmd_can(packet_t *rx_packet, packet_t *tx_packet) {
     switch(rx_packet->cmd_code) {
         case cmd_can_open:
-            if (rx_packet->data_len == 1) {
-                if (*rx_packet->data != 0x1) {
+            if (rx_packet->data_len >= 1 && rx_packet->data_len <= 2) {
+                if ((*rx_packet->data & CAN_OPEN_ENABLE) == 0) {
+                    GMLANLogStop();
+                    GMLANEnd();
                     can_close();
-                    can.attach(NULL);
+                    can_filter_host = false;
                     //can_rx_thd.terminate();
                     //egt_thd.terminate();
                     return CombiSendReplyPacket(tx_packet, rx_packet, 0, 0, cmd_term_ack, 1000);
                 }
+                // hosts that only send the open byte get single cmd_can_frame packets
+                can_open_flags = *rx_packet->data & (CAN_OPEN_ENABLE | CAN_OPEN_BATCH | CAN_OPEN_TIMESTAMP);
+                can_flush_ms = CAN_BATCH_FLUSH_MS;
+                if (rx_packet->data_len == 2 && rx_packet->data[1] != 0) {
+                    can_flush_ms = rx_packet->data[1];
+                }
+                can_batch_len = 0;
                 can_open();
-                
-                can_add_filter(2, 0x645);         //645h - CIM
-                can_add_filter(2, 0x7E0);         //7E0h -
-                can_add_filter(2, 0x7E8);         //7E8h -
-                can_add_filter(2, 0x311);         //311h -
-                can_add_filter(2, 0x5E8);         //5E8h 
-                
-                can.attach(NULL);
+
+                if (can_filter_host) {
+                    can_filter_apply();
+                } else {
+                    can_filter_load(2, can_filter_T8);
+                }
+
                 //can.mode(CAN::LocalTest);
                 can_rx_thd.start(&can_read_thd);
                 egt_thd.start(&egt_read_thd);
+                if (rx_packet->data_len == 2) {
+                    // report the accepted flags
+                    return CombiSendReplyPacket(tx_packet, rx_packet, &can_open_flags, 1, cmd_term_ack, 1000);
+                }
                 return CombiSendReplyPacket(tx_packet, rx_packet, 0, 0, cmd_term_ack, 1000);
             }
         break;
@@ -258,10 +470,44 @@ bool exec_cmd_can(packet_t *rx_packet, packet_t *tx_packet) {
                 uint32_t bitrate = rx_packet->data[3] | (uint32_t)*rx_packet->data << 24 | (uint32_t)rx_packet->data[1] << 16 
                                 | (uint32_t)rx_packet->data[2] << 8;
                 can_configure(2, bitrate, false);
+                if (can_filter_host) {
+                    // can_configure() opens the acceptance filter, keep the host's filters
+                    can_filter_apply();
+                }
                 return CombiSendReplyPacket(tx_packet, rx_packet, (uint8_t *)0x0, 0, cmd_term_ack, 1000);
             }
             break;
         break;
+        case cmd_can_filter:
+            if (rx_packet->data_len >= 1) {
+                if (can_filter_cmd(rx_packet->data, rx_packet->data_len)) {
+                    // bypass hands the filters back to the default tables
+                    can_filter_host = (*rx_packet->data != CAN_FILTER_BYPASS);
+                    return CombiSendReplyPacket(tx_packet, rx_packet, 0, 0, cmd_term_ack, 1000);
+                }
+            }
+            break;
+        case cmd_can_log:
+            if (rx_packet->data_len >= 1 && can_log_cmd(rx_packet->data, rx_packet->data_len)) {
+                return CombiSendReplyPacket(tx_packet, rx_packet, 0, 0, cmd_term_ack, 1000);
+            }
+            break;
+        case cmd_can_status:
+            if (rx_packet->data_len == 0) {
+                can_health_t health;
+                can_get_health(health);
+                uint8_t status[CAN_STATUS_SIZE] = {health.state, health.tx_errors, health.rx_errors,
+                                                   health.tx_errors_peak, health.rx_errors_peak};
+                const uint32_t counts[] = {health.bus_errors, health.warnings, health.passive, health.bus_off,
+                                           health.tx_aborts, health.resets, health.hw_overruns, health.rx_overruns};
+                for (uint8_t i = 0; i < 8; i++) {
+                    for (uint8_t j = 0; j < 4; j++) {
+                        status[5 + 4 * i + j] = (counts[i] >> (8 * j)) & 0xFF;
+                    }
+                }
+                return CombiSendReplyPacket(tx_packet, rx_packet, status, CAN_STATUS_SIZE, cmd_term_ack, 1000);
+            }
+            break;
         case cmd_can_txframe:
             if (rx_packet->data_len != 15) {
                 return false;
@@ -331,22 +577,39 @@ bool CombiReceivePacket(packet_t *packet, uint32_t timeout) {
     if (!combi.readable()) {
         return false;
     }
+    return CombiReceivePacketInto(packet, data_buff, sizeof(data_buff));
+}
+
+// returns false with cmd_code 0 if no packet started within 'timeout' ms
+bool CombiReceivePacketInto(packet_t *packet, uint8_t *buffer, uint16_t buffer_len, uint32_t timeout) {
     bool state = false;
-    uint8_t buffer[3] = {0};
+    uint8_t header[3] = {0};
 
     //read cmd, size, 
-    state = combi.receive(buffer, 3);
+    state = combi.receive(header, 3, NULL, timeout);
     if (state == true) {
-        packet->cmd_code = buffer[0];
-        packet->data_len = (uint16_t)((buffer[1] & 0xffffU) << 8) | (uint16_t)buffer[2];
+        packet->cmd_code = header[0];
+        packet->data_len = (uint16_t)((header[1] & 0xffffU) << 8) | (uint16_t)header[2];
+    } else if (timeout != osWaitForever) {
+        packet->cmd_code = 0;
+        packet->data_len = 0;
+        return false;
     }
     if (packet->data_len > 0) {
-        state = combi.receive(data_buff, packet->data_len);
-        packet->data = data_buff;
+        if (packet->data_len > buffer_len) {
+            // drain what doesn't fit and fail
+            for (uint16_t cnt = 0; cnt < packet->data_len; cnt++) {
+                combi.receive(header, 1);
+            }
+            state = false;
+        } else {
+            state = combi.receive(buffer, packet->data_len) && state;
+        }
+        packet->data = buffer;
     }
     
-    state = combi.receive(buffer, 1);
-    packet->term = buffer[0];
+    state = combi.receive(header, 1) && state;
+    packet->term = header[0];
 
     if (packet->term != cmd_term_ack) {
         state = false;
@@ -380,7 +643,16 @@ bool CombiSendPacket(packet_t *packet, uint32_t timeout) {
         buffer[0] = packet->cmd_code;
         buffer[1] = (uint8_t)(packet->data_len >> 8);
         buffer[2] = (uint8_t)packet->data_len;
-        if (*(packet->data) != 0 && packet->data_len != 0) {
+        if (packet->data != 0 && packet->data_len != 0) {
+            if (packet->data_len > sizeof(buffer) - 4) {
+                // too big to copy, send header, data block and terminator as they are
+                // and keep the other senders out until the terminator is gone
+                combi_send_lock.lock();
+                bool state = combi.send(buffer, 3) && combi.send(packet->data, packet->data_len)
+                    && combi.send(&packet->term, 1);
+                combi_send_lock.unlock();
+                return state;
+            }
             data_ptr = packet->data;
             for (uint16_t cnt = 0; cnt < packet->data_len; cnt++) {
                 buffer[3 + cnt] = *data_ptr;
@@ -393,7 +665,9 @@ bool CombiSendPacket(packet_t *packet, uint32_t timeout) {
             buffer[3] = packet->term;
             size = 4;
         }
+        combi_send_lock.lock();
         combi.send((uint8_t *)buffer, size);
+        combi_send_lock.unlock();
         return true;
     }
   return false;
@@ -401,70 +675,87 @@ bool CombiSendPacket(packet_t *packet, uint32_t timeout) {
 
 bool readflash(LONG start_addr, LONG size) {
     bool status;
-    char result;
-    WORD curr_word;
-    WORD *buf_ptr;
     LONG curr_addr;
-    uint8_t flash_buf[32];
+    LONG flash_buf[0x40];
     packet_t tx_packet, rx_packet;
+#ifdef DEBUG
+    Timer read_timer;
+#endif
 
-    if ((size & 0xff) == 0) {
-        tx_packet.cmd_code = 0x4B;
-        tx_packet.data_len = 0x100;
-        tx_packet.data = flash_buf;
-        tx_packet.term = cmd_term_ack;
-        buf_ptr = (WORD *)flash_buf;
-        curr_addr = start_addr;
-        while (curr_addr < start_addr + size) {
-            status = CombiReceivePacket(&rx_packet,0);
-            if (((status != false) && (rx_packet.cmd_code == 0x4B)) && (rx_packet.term == cmd_term_nack)) {
-                return false;
-            }
-            if (curr_addr == start_addr) {
-                result = memread_word(&curr_word, &curr_addr);
-            } else {
-                result = memdump_word(&curr_word);
-            }
-            if (result != TERM_OK) {
-                return false;
-            }
-            swab(&curr_word);
-            *buf_ptr = curr_word;
-            buf_ptr = buf_ptr + 1;
-            curr_addr = curr_addr + 2;
-            if ((curr_addr - start_addr & 0xff) == 0) {
-                status = CombiSendPacket(&tx_packet, 1000);
-            if (status != true) {
-                return false;
-            }
-            buf_ptr = (WORD *)flash_buf;
-            }
+    if ((size & 0xff) != 0) {
+        return false;
+    }
+    tx_packet.cmd_code = cmd_bdm_read_flash;
+    tx_packet.data_len = 0x100;
+    tx_packet.data = (uint8_t *)flash_buf;
+    tx_packet.term = cmd_term_ack;
+
+    // setup start address, every memget_long() then overlaps the next DUMP.L
+    curr_addr = start_addr;
+    if (memread_long_cmd(&curr_addr) != TERM_OK) {
+        return false;
+    }
+#ifdef DEBUG
+    read_timer.start();
+#endif
+    status = true;
+    while (curr_addr < start_addr + size) {
+        // the host may abort, check once for every frame
+        if (CombiReceivePacket(&rx_packet, 0) && (rx_packet.cmd_code == cmd_bdm_read_flash)
+            && (rx_packet.term == cmd_term_nack)) {
+            status = false;
+            break;
+        }
+        for (uint8_t i = 0; (i < 0x40) && status; i++) {
+            status = memget_long(&flash_buf[i]) == TERM_OK;
+        }
+        if (!status) {
+            break;
+        }
+        // CPU32 is big endian, swap the whole frame in one go
+        for (uint8_t i = 0; i < 0x40; i++) {
+            flash_buf[i] = __REV(flash_buf[i]);
+        }
+        curr_addr += 0x100;
+        if (!CombiSendPacket(&tx_packet, 1000)) {
+            status = false;
+            break;
         }
-        status = true;
-    } else {
-        status = false;
     }
+    // the last memget_long() left a DUMP.L pending, finish it with an ordinary read
+    memread_long(flash_buf, &curr_addr);
+#ifdef DEBUG
+    read_timer.stop();
+    printf("readflash: %lu bytes/s\r\n", (LONG)((float)(curr_addr - start_addr) / read_timer.read()));
+#endif
     return status;
 }
 
+bool select_flash_funcs(const char *flash_type, bool (**reset_func)(void),
+                        bool (**flash_func)(const uint32_t*, uint16_t)) {
+    if (strncmp(flash_type, "29f010", 6) == 0 || strncmp(flash_type, "29f400", 6) == 0) {
+        *reset_func = &reset_am29;
+        *flash_func = &flash_am29;
+    } else if (strncmp(flash_type, "28f010", 6) == 0) {
+        *reset_func = &reset_am28;
+        *flash_func = &flash_am28;
+    } else {
+        return false;
+    }
+    return true;
+}
+
 bool writeflash(char *flash_type, LONG start_addr, LONG size) {
     packet_t tx_packet, rx_packet;
     bool status;
     char result;
     WORD curr_word;
     WORD *buf_ptr;
-    uint8_t flash_buf[32];
     uint32_t bytes_written;
     bool (*reset_func)(void);
     bool (*flash_func)(const uint32_t*, uint16_t);
 
-    if (strncmp(flash_type, "29f010", 6) == 0 || strncmp(flash_type, "29f400", 6) == 0) {
-        reset_func = &reset_am29;
-        flash_func = &flash_am29;
-    } else if (strncmp(flash_type, "28f010", 6) == 0) {
-        reset_func = &reset_am28;
-        flash_func = &flash_am28;
-    } else {
+    if (!select_flash_funcs(flash_type, &reset_func, &flash_func)) {
         return false;
     }
 
@@ -485,7 +776,6 @@ bool writeflash(char *flash_type, LONG start_addr, LONG size) {
     status = CombiSendPacket(&tx_packet,1000);
 
     if (status == true) {
-        rx_packet.data = flash_buf;
         bytes_written = 0;
         do {
             if (size <= bytes_written) {
@@ -501,7 +791,7 @@ bool writeflash(char *flash_type, LONG start_addr, LONG size) {
             (rx_packet.data_len != 0x100)) {
                 return false;
             }
-            buf_ptr = (WORD *)flash_buf;
+            buf_ptr = (WORD *)rx_packet.data;
             for (uint16_t byte_cnt = 0; byte_cnt < 0x100; byte_cnt = byte_cnt + 2) {
                 swab(buf_ptr);
                 curr_word = *buf_ptr;
@@ -522,6 +812,153 @@ bool writeflash(char *flash_type, LONG start_addr, LONG size) {
     return (reset_func() && status);
 }
 
+// shared between writeflash_win() and its USB receive thread
+static flash_slot_t flash_slots[WRITE_WIN_SLOTS];
+static Semaphore flash_slot_free(WRITE_WIN_SLOTS, WRITE_WIN_SLOTS);
+static Semaphore flash_slot_full(0, WRITE_WIN_SLOTS);
+static uint32_t flash_win_blocks;
+static volatile bool flash_win_error;
+static volatile bool flash_win_stop;
+
+void flash_win_rx_thd(void) {
+    packet_t rx_packet;
+    uint8_t slot = 0;
+    bool status;
+
+    for (uint32_t block = 0; block < flash_win_blocks; block++) {
+        flash_slot_free.acquire();
+        if (flash_win_stop) {
+            return;
+        }
+        // sequence byte and data are received straight into the slot, waking
+        // up now and then to see whether writeflash_win() gave up
+        do {
+            if (flash_win_stop) {
+                return;
+            }
+            status = CombiReceivePacketInto(&rx_packet, (uint8_t *)&flash_slots[slot], sizeof(flash_slot_t),
+                                            WRITE_WIN_POLL_MS);
+        } while (!status && rx_packet.cmd_code == 0);
+        if ((status != true) || (rx_packet.cmd_code != 'W') || (rx_packet.data_len != sizeof(flash_slot_t))
+            || (flash_slots[slot].seq != (uint8_t)block)) {
+            flash_win_error = true;
+            flash_slot_full.release();
+            return;
+        }
+        flash_slot_full.release();
+        slot = (slot + 1) % WRITE_WIN_SLOTS;
+    }
+}
+
+//
+// writeflash_win
+//
+// Like writeflash() but the host may keep up to 'window' blocks in flight.
+// A receive thread fills a ring of buffers while blocks are programmed, every
+// block is acknowledged with a 'W' packet: seq, program time in us and the
+// number of times programming had to wait for USB data so far.
+//
+bool writeflash_win(char *flash_type, LONG start_addr, LONG size, uint8_t window) {
+    packet_t tx_packet;
+    bool status;
+    uint8_t ack[7];
+    uint8_t slot = 0;
+    uint16_t stalls = 0;
+    Timer block_timer;
+    bool (*reset_func)(void);
+    bool (*flash_func)(const uint32_t*, uint16_t);
+
+    if (!select_flash_funcs(flash_type, &reset_func, &flash_func) || (size % WRITE_WIN_BLOCK) != 0) {
+        return false;
+    }
+    if (!reset_func()) {
+        return false;
+    }
+
+    uint32_t curr_addr = start_addr;
+    if (strncmp(flash_type, "29f010", 6) == 0) {
+        curr_addr = 0;
+    }
+
+    // all slots must be free before the receive thread runs
+    while (flash_slot_full.try_acquire());
+    while (flash_slot_free.try_acquire());
+    for (uint8_t i = 0; i < WRITE_WIN_SLOTS; i++) {
+        flash_slot_free.release();
+    }
+    flash_win_blocks = size / WRITE_WIN_BLOCK;
+    flash_win_error = false;
+    flash_win_stop = false;
+
+    // tell the host how many blocks it may send ahead
+    if (window == 0 || window > WRITE_WIN_SLOTS) {
+        window = WRITE_WIN_SLOTS;
+    }
+    tx_packet.cmd_code = 'W';
+    tx_packet.data_len = 1;
+    tx_packet.data = &window;
+    tx_packet.term = cmd_term_ack;
+    if (!CombiSendPacket(&tx_packet, 1000)) {
+        return false;
+    }
+
+    Thread flash_rx(osPriorityNormal, 1024);
+    flash_rx.start(&flash_win_rx_thd);
+
+    status = true;
+    tx_packet.data_len = sizeof(ack);
+    tx_packet.data = ack;
+    for (uint32_t block = 0; (block < flash_win_blocks) && status; block++) {
+        if (!flash_slot_full.try_acquire()) {
+            stalls++;
+            flash_slot_full.acquire();
+        }
+        if (flash_win_error) {
+            status = false;
+            break;
+        }
+        block_timer.reset();
+        block_timer.start();
+        uint8_t *data = flash_slots[slot].data;
+        for (uint16_t byte_cnt = 0; byte_cnt < WRITE_WIN_BLOCK; byte_cnt += 2) {
+            if (!flash_func(&curr_addr, (WORD)(data[byte_cnt] << 8 | data[byte_cnt + 1]))) {
+                status = false;
+                break;
+            }
+            curr_addr += 2;
+        }
+        block_timer.stop();
+        uint32_t prog_time = block_timer.read_us();
+        ack[0] = flash_slots[slot].seq;
+        ack[1] = (uint8_t)(prog_time >> 24);
+        ack[2] = (uint8_t)(prog_time >> 16);
+        ack[3] = (uint8_t)(prog_time >> 8);
+        ack[4] = (uint8_t)prog_time;
+        ack[5] = (uint8_t)(stalls >> 8);
+        ack[6] = (uint8_t)stalls;
+        tx_packet.term = status ? cmd_term_ack : cmd_term_nack;
+        status = CombiSendPacket(&tx_packet, 1000) && status;
+        slot = (slot + 1) % WRITE_WIN_SLOTS;
+        flash_slot_free.release();
+    }
+
+    if (status) {
+        flash_rx.join();
+        return reset_func();
+    }
+    // the host stops sending after the nack, let the receive thread notice
+    // that instead of killing it in the middle of a USB read, then swallow
+    // whatever blocks were still in flight
+    flash_win_stop = true;
+    flash_slot_free.release();
+    flash_rx.join();
+    packet_t rx_packet;
+    while (CombiReceivePacketInto(&rx_packet, (uint8_t *)&flash_slots[0], sizeof(flash_slot_t), WRITE_WIN_POLL_MS)
+           || rx_packet.cmd_code != 0);
+    reset_chip();
+    return false;
+}
+
 void swab(uint16_t *word) {
   uint16_t tmp;
   uint8_t tmp_byte;
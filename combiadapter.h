@@ -23,13 +23,20 @@ enum combi_command_t {
     cmd_bdm_erase_flash   = 0x4C,
     cmd_bdm_write_flash   = 0x4D,
     cmd_bdm_pinstate      = 0x4E,
+    cmd_bdm_write_flash_win = 0x4F,
     cmd_can_open          = 0x80,
     cmd_can_bitrate       = 0x81,
     cmd_can_frame         = 0x82,
     cmd_can_txframe       = 0x83,
+    cmd_can_frame_batch   = 0x84,
+    cmd_can_timesync      = 0x85,
+    cmd_can_filter        = 0x86,
+    cmd_can_log           = 0x87,
+    cmd_can_log_data      = 0x88,
     cmd_can_ecuconnect    = 0x89,
     cmd_can_readflash     = 0x8a,
     cmd_can_writeflash    = 0x8b,
+    cmd_can_status        = 0x8c,
     cmd_term_ack          = 0x00,
     cmd_term_nack         = 0xff
 };
@@ -49,6 +56,57 @@ struct combiCan_t {
 	uint8_t is_remote;
 };
 
+// cmd_can_open flags
+#define CAN_OPEN_ENABLE     0x01    // open (set) or close (clear) the CAN bus
+#define CAN_OPEN_BATCH      0x02    // deliver received frames in cmd_can_frame_batch packets
+#define CAN_OPEN_TIMESTAMP  0x04    // add the 32 bit receive time (us) to every frame
+
+// cmd_can_frame_batch record: header byte, 2 (11 bit) or 4 (29 bit) id bytes LSB first,
+// optional 4 byte timestamp LSB first, data
+#define CAN_BATCH_LEN_MASK  0x0F    // data length 0..8
+#define CAN_BATCH_TIMESTAMP 0x20    // record carries a timestamp
+#define CAN_BATCH_REMOTE    0x40    // remote frame
+#define CAN_BATCH_EXTENDED  0x80    // 29 bit identifier
+#define CAN_BATCH_SIZE      0xFC    // max. record bytes per packet
+#define CAN_BATCH_FLUSH_MS  2       // default flush deadline
+#define CAN_TIMESYNC_MS     1000    // cmd_can_timesync interval while timestamps are on
+
+// cmd_can_filter: op byte followed by its arguments, ids LSB first
+#define CAN_FILTER_CLEAR    0x00    // empty the filter set
+#define CAN_FILTER_STD      0x01    // n * 2 byte 11 bit id
+#define CAN_FILTER_STD_RANGE 0x02   // n * (2 byte first, 2 byte last) 11 bit id
+#define CAN_FILTER_EXT      0x03    // n * 4 byte 29 bit id
+#define CAN_FILTER_EXT_RANGE 0x04   // n * (4 byte first, 4 byte last) 29 bit id
+#define CAN_FILTER_APPLY    0x05    // load the filter set into the acceptance filter
+#define CAN_FILTER_BYPASS   0x06    // accept every frame, next open uses the default filters
+
+// cmd_can_log: op byte followed by its arguments, LSB first. The values arrive
+// in cmd_can_log_data packets holding GMLANLog records, see gmlanlog.h
+#define CAN_LOG_CLEAR       0x00    // empty the watch list
+#define CAN_LOG_IDENTIFIER  0x01    // 1 byte identifier, 2 byte period (ms)
+#define CAN_LOG_MEMORY      0x02    // 4 byte address, 1 byte size, 2 byte period (ms)
+#define CAN_LOG_START       0x03    // 1 byte sink, optionally 2 byte request and response ids
+#define CAN_LOG_STOP        0x04
+#define CAN_LOG_COMBI       0x00    // sink: cmd_can_log_data packets
+#define CAN_LOG_LOCAL       0x01    // sink: GMLANLOGFILE on the local file system
+#define CAN_LOG_SIZE        60      // max. record bytes per packet, sent in one go
+
+// cmd_can_status reply: state (CAN_STATE_*), TX and RX error counters, their highest
+// values, then 4 byte LSB first counts of bus errors, error warning, error passive,
+// bus off, aborted frames, controller resets and frames lost by the controller and
+// by the receive buffers, see can_health_t
+#define CAN_STATUS_SIZE     37
+
+// sliding window flash write, 'W' packets carry a sequence byte and one block
+#define WRITE_WIN_BLOCK     0x100   // bytes of flash data per block
+#define WRITE_WIN_SLOTS     4       // receive buffers, max. blocks in flight
+#define WRITE_WIN_POLL_MS   100     // receive thread checks for a stop this often
+
+struct flash_slot_t {
+    uint8_t seq;
+    uint8_t data[WRITE_WIN_BLOCK];
+};
+
 extern void combi_thread();
 
 #endif
\ No newline at end of file
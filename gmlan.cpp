@@ -1,7 +1,38 @@
 #include "gmlan.h"
 #include "interfaces.h"
 
-Timer   GMLANtimer;
+uint8_t GMLANnrc = 0;
+uint8_t GMLANpending = 0;
+
+bool GMLANfast = false;
+bool GMLANsilence = false;
+static uint32_t GMLANbitrate = 0;       // bit rate before switching to GMLANFASTBITRATE, 0 if not switched
+static bool GMLANsilenced = false;      // every node was told to stop its normal messages
+
+// Pacing controller state, see GMLANPaceStart()
+static uint32_t GMLANPaceMinGap;
+static uint32_t GMLANPaceBackoffs;
+static uint32_t GMLANPaceFastestAck;
+static uint32_t GMLANPaceErrors;
+static bool GMLANPacing = false;        // between GMLANPaceStart() and GMLANPaceReport()
+
+// Background TesterPresent sessions, see GMLANKeepAliveStart()
+struct GMLANKeepAlive_t {
+    volatile bool used;
+    uint32_t ReqID;
+    uint32_t RespID;
+    uint32_t interval_us;
+    bool functional;
+    uint32_t last;                      // can_time_us() of the last TesterPresent
+};
+static GMLANKeepAlive_t GMLANKeepAlives[GMLANKEEPALIVES];
+static Thread GMLANKeepAliveThread(osPriorityNormal, 1024);
+static bool GMLANKeepAliveRunning = false;
+
+// Open non-blocking sessions, see GMLANSessionOpen(). The main thread and the
+// GMLANLog thread both run sessions, whoever holds GMLANSessionLock polls them
+static GMLANSession_t *GMLANSessions[GMLANSESSIONS];
+static Mutex GMLANSessionLock;
 
 
 void GMLANTesterPresentAll()
@@ -14,11 +45,408 @@ void GMLANTesterPresentAll()
 void GMLANTesterPresent(uint32_t ReqID, uint32_t RespID)
 {
     char GMLANMsg[] = GMLANTesterPresentPhysical;
-    can_send_timeout(ReqID, GMLANMsg, 2, GMLANPTCT);
-    can_wait_timeout(RespID, GMLANMsg, 2, GMLANPTCT);
+    GMLANRequest(ReqID, RespID, GMLANMsg, 2, true);
     ACTIVITYLEDON;
 }
 
+//
+// GMLANReady
+//
+// Waits until the ECU answers a TesterPresent, for at most 'timeout' milliseconds.
+// Used where the ECU needs time to switch modes, so the next step starts as soon
+// as the ECU is listening again instead of after a fixed delay. Late answers to
+// the earlier polls are thrown away so the next request doesn't take them for
+// its own answer.
+//
+// return:    true if the ECU answered
+//
+bool GMLANReady(uint32_t ReqID, uint32_t RespID, uint16_t timeout)
+{
+    Timer ready;
+    ready.start();
+    bool result = false;
+    uint8_t polls = 0;
+    can_mailbox_open(RespID);
+    do {
+        char GMLANMsg[] = GMLANTesterPresentPhysical;
+        polls++;
+        if (can_send_timeout(ReqID, GMLANMsg, 2, GMLANPTCT)
+                && can_wait_timeout(RespID, GMLANMsg, 8, GMLANREADYPOLL)
+                && GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0x7E)
+            result = true;
+    } while (!result && ready.read_ms() < timeout);
+    CANMessage msg;
+    if (polls > 1)
+        while (can_mailbox_wait(RespID, msg, GMLANREADYPOLL))
+            ;
+    can_mailbox_close(RespID);
+    return result;
+}
+
+//
+// GMLANKeepAliveThd
+//
+// Sends each session a TesterPresent once its ids have been quiet for its interval.
+// The frame is queued, not waited for, so a foreground transfer is never held up.
+//
+static void GMLANKeepAliveThd()
+{
+    while (true) {
+        ThisThread::sleep_for(GMLANKEEPALIVETICK);
+        for (uint8_t n = 0; n < GMLANKEEPALIVES; n++) {
+            GMLANKeepAlive_t *ka = &GMLANKeepAlives[n];
+            if (!ka->used)
+                continue;
+            if (can_time_us() - ka->last < ka->interval_us)
+                continue;
+            // only queued if the ids are still quiet, a foreground request can't
+            // be followed by a TesterPresent in the middle of its frames
+            uint32_t ticket;
+            if (ka->functional) {
+                char GMLANMsg[] = GMLANTesterPresentFunctional;
+                ticket = can_tx_post_if_idle(CANMessage(GMLANALLNODES, GMLANMsg, 3), ka->RespID, ka->interval_us);
+            } else {
+                char GMLANMsg[] = GMLANTesterPresentPhysical;
+                const char GMLANReply[] = {0x01, 0x7E};
+                ticket = can_tx_post_if_idle(CANMessage(ka->ReqID, GMLANMsg, 2), ka->RespID, ka->interval_us,
+                                             GMLANReply, sizeof(GMLANReply));
+            }
+            if (!ticket)
+                continue;
+            ka->last = can_time_us();
+            ACTIVITYLEDON;
+        }
+    }
+}
+
+//
+// GMLANKeepAliveStart
+//
+// Keeps the ECU at ReqID/RespID in its diagnostic session until GMLANKeepAliveStop(),
+// with a physical TesterPresent to ReqID or a functional one to all nodes.
+//
+// inputs:    ids, interval in milliseconds, functional or physical
+// return:    false if all sessions are in use
+//
+bool GMLANKeepAliveStart(uint32_t ReqID, uint32_t RespID, uint16_t interval, bool functional)
+{
+    if (!GMLANKeepAliveRunning) {
+        GMLANKeepAliveThread.start(&GMLANKeepAliveThd);
+        GMLANKeepAliveRunning = true;
+    }
+    GMLANKeepAliveStop(ReqID);
+    for (uint8_t n = 0; n < GMLANKEEPALIVES; n++) {
+        GMLANKeepAlive_t *ka = &GMLANKeepAlives[n];
+        if (ka->used)
+            continue;
+        if (!can_watch(ReqID) || !can_watch(RespID)) {
+            can_unwatch(ReqID);
+            can_unwatch(RespID);
+            return false;
+        }
+        ka->ReqID = ReqID;
+        ka->RespID = RespID;
+        ka->interval_us = interval * 1000;
+        ka->functional = functional;
+        ka->last = can_time_us();
+        ka->used = true;
+        return true;
+    }
+    return false;
+}
+
+void GMLANKeepAliveStop(uint32_t ReqID)
+{
+    for (uint8_t n = 0; n < GMLANKEEPALIVES; n++) {
+        GMLANKeepAlive_t *ka = &GMLANKeepAlives[n];
+        if (ka->used && ka->ReqID == ReqID) {
+            ka->used = false;
+            can_unwatch(ka->ReqID);
+            can_unwatch(ka->RespID);
+        }
+    }
+}
+
+void GMLANKeepAliveStopAll()
+{
+    for (uint8_t n = 0; n < GMLANKEEPALIVES; n++) {
+        if (GMLANKeepAlives[n].used)
+            GMLANKeepAliveStop(GMLANKeepAlives[n].ReqID);
+    }
+}
+
+//
+// GMLANSessionOpen
+//
+// Sets up a session for the ECU that answers requests on 'ReqID' with 'RespID' and
+// adds it to the sessions GMLANSessionRun() and GMLANSessionService() move on.
+//
+// return:    false if GMLANSESSIONS sessions are open already or RespID can't
+//            have a mailbox
+//
+bool GMLANSessionOpen(GMLANSession_t *s, uint32_t ReqID, uint32_t RespID)
+{
+    GMLANSessionLock.lock();
+    uint8_t n = 0;
+    while (n < GMLANSESSIONS && GMLANSessions[n])
+        n++;
+    if (n == GMLANSESSIONS || !can_mailbox_open(RespID)) {
+        GMLANSessionLock.unlock();
+        return false;
+    }
+    memset(s, 0, sizeof(GMLANSession_t));
+    s->ReqID = ReqID;
+    s->RespID = RespID;
+    s->state = GMLAN_SESSION_IDLE;
+    GMLANSessions[n] = s;
+    GMLANSessionLock.unlock();
+    return true;
+}
+
+void GMLANSessionClose(GMLANSession_t *s)
+{
+    GMLANSessionLock.lock();
+    for (uint8_t n = 0; n < GMLANSESSIONS; n++) {
+        if (GMLANSessions[n] == s)
+            GMLANSessions[n] = NULL;
+    }
+    can_mailbox_close(s->RespID);
+    GMLANSessionLock.unlock();
+}
+
+//
+// GMLANSessionRequest
+//
+// Queues a single frame request, PCI byte first like the GMLAN... messages, and
+// returns straight away. Anything still in the mailbox is thrown away first so a
+// late reply to an earlier request can't be taken for the answer to this one.
+// With 'reply' false the request is done once it is on the bus.
+//
+// return:    false if the session is busy or the transmit queue is full
+//
+bool GMLANSessionRequest(GMLANSession_t *s, const char *frame, uint8_t length, bool reply)
+{
+    GMLANSessionLock.lock();
+    if (s->state == GMLAN_SESSION_WAITING || s->state == GMLAN_SESSION_RECEIVING) {
+        GMLANSessionLock.unlock();
+        return false;
+    }
+    can_mailbox_flush(s->RespID);
+    s->service = frame[1];
+    s->reply = reply;
+    s->nrc = 0;
+    s->pending = 0;
+    s->length = 0;
+    s->received = 0;
+    s->deadline = can_time_us() + GMLANPTCT * 1000;
+    s->ticket = can_tx_post(CANMessage(s->ReqID, frame, length));
+    s->state = s->ticket ? GMLAN_SESSION_WAITING : GMLAN_SESSION_FAILED;
+    GMLANSessionLock.unlock();
+    return s->ticket != 0;
+}
+
+//
+// GMLANSessionFrame
+//
+// Reassembles the response from its frames, answering a first frame with a flow
+// control, and decides what a complete response means for the request.
+//
+static void GMLANSessionFrame(GMLANSession_t *s, const CANMessage &msg)
+{
+    // Anything arriving while idle is a stale reply or the answer to a TesterPresent
+    if (s->state != GMLAN_SESSION_WAITING && s->state != GMLAN_SESSION_RECEIVING)
+        return;
+    const uint8_t *data = msg.data;
+    uint16_t copy;
+    switch (data[0] & 0xF0) {
+        case ISOTP_SINGLE_FRAME:
+            if (s->state != GMLAN_SESSION_WAITING || (data[0] & 0x0F) == 0 || (data[0] & 0x0F) >= msg.len)
+                return;
+            s->length = s->received = data[0] & 0x0F;
+            memcpy(s->response, data + 1, s->length);
+            break;
+        case ISOTP_FIRST_FRAME: {
+            if (s->state != GMLAN_SESSION_WAITING || msg.len < 8)
+                return;
+            s->length = ((data[0] & 0x0F) << 8) | data[1];
+            s->received = 6;
+            memcpy(s->response, data + 2, 6);
+            s->sequence = 1;
+            s->state = GMLAN_SESSION_RECEIVING;
+            s->deadline = can_time_us() + ISOTP_N_CR * 1000;
+            char flow[8] = {ISOTP_FLOW_CONTROL | ISOTP_FC_CTS, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+            can_tx_post(CANMessage(s->ReqID, flow, 8));
+            return;
+        }
+        case ISOTP_CONSECUTIVE_FRAME:
+            if (s->state != GMLAN_SESSION_RECEIVING || (data[0] & 0x0F) != s->sequence)
+                return;
+            // Only the first GMLANSESSIONMAX bytes of a longer response are kept
+            copy = (s->received < GMLANSESSIONMAX) ? GMLANSESSIONMAX - s->received : 0;
+            if (copy)
+                memcpy(s->response + s->received, data + 1, (copy < msg.len - 1) ? copy : msg.len - 1);
+            s->received += msg.len - 1;
+            s->sequence = (s->sequence + 1) & 0x0F;
+            s->deadline = can_time_us() + ISOTP_N_CR * 1000;
+            if (s->received < s->length)
+                return;
+            s->received = s->length;
+            break;
+        default:
+            return;
+    }
+    if (s->length >= 3 && s->response[0] == 0x7F && s->response[1] == s->service) {
+        if (s->response[2] == 0x78) {
+            s->pending++;
+            s->state = GMLAN_SESSION_WAITING;
+            s->deadline = can_time_us() + GMLANPTCTENHANCED * 1000;
+        } else {
+            s->nrc = s->response[2];
+            s->state = GMLAN_SESSION_FAILED;
+        }
+    } else if (s->response[0] == s->service + 0x40) {
+        s->state = GMLAN_SESSION_DONE;
+    } else {
+        s->state = GMLAN_SESSION_WAITING;       // not an answer to this request
+    }
+}
+
+//
+// GMLANSessionPoll
+//
+// Moves a session on as far as it can go without waiting: notices its request
+// going out, takes in the frames in its mailbox and gives up on an ECU that is
+// past its deadline.
+//
+// return:    the session's state, GMLAN_SESSION_...
+//
+uint8_t GMLANSessionPoll(GMLANSession_t *s)
+{
+    GMLANSessionLock.lock();
+    if (s->state == GMLAN_SESSION_WAITING && s->ticket) {
+        uint8_t sent = can_tx_status(s->ticket);
+        if (sent == CAN_TX_SENT) {
+            s->ticket = 0;
+            s->deadline = can_time_us() + GMLANPTCT * 1000;
+            if (!s->reply)
+                s->state = GMLAN_SESSION_DONE;
+        } else if (sent == CAN_TX_ABORTED) {
+            s->ticket = 0;
+            s->state = GMLAN_SESSION_FAILED;
+        }
+    }
+    CANMessage msg;
+    while (can_mailbox_wait(s->RespID, msg, 0))
+        GMLANSessionFrame(s, msg);
+    if ((s->state == GMLAN_SESSION_WAITING || s->state == GMLAN_SESSION_RECEIVING)
+            && (int32_t)(can_time_us() - s->deadline) >= 0) {
+        s->ticket = 0;
+        s->state = GMLAN_SESSION_FAILED;
+    }
+    uint8_t state = s->state;
+    GMLANSessionLock.unlock();
+    return state;
+}
+
+void GMLANSessionService()
+{
+    GMLANSessionLock.lock();
+    for (uint8_t n = 0; n < GMLANSESSIONS; n++) {
+        if (GMLANSessions[n])
+            GMLANSessionPoll(GMLANSessions[n]);
+    }
+    GMLANSessionLock.unlock();
+}
+
+//
+// GMLANSessionRun
+//
+// The event loop. Polls every open session, then sleeps until a frame arrives
+// for one of them or a deadline passes, until none of 'sessions' is waiting
+// any more. The sessions must have been opened. The lock
+// is only let go while sleeping, so two threads running sessions take turns.
+//
+// return:    true if all of 'sessions' got a positive response
+//
+bool GMLANSessionRun(GMLANSession_t *const *sessions, uint8_t count)
+{
+    while (true) {
+        GMLANSessionLock.lock();
+        GMLANSessionService();
+        bool busy = false;
+        bool result = true;
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t state = sessions[i]->state;
+            busy |= (state == GMLAN_SESSION_WAITING || state == GMLAN_SESSION_RECEIVING);
+            result &= (state == GMLAN_SESSION_DONE);
+        }
+        if (!busy) {
+            GMLANSessionLock.unlock();
+            return result;
+        }
+        uint32_t events = 0;
+        uint32_t now = can_time_us();
+        int32_t sleep = GMLANKEEPALIVETICK * 1000;
+        for (uint8_t n = 0; n < GMLANSESSIONS; n++) {
+            GMLANSession_t *s = GMLANSessions[n];
+            if (!s)
+                continue;
+            events |= can_mailbox_event(s->RespID);
+            int32_t due = sleep;
+            if (s->state == GMLAN_SESSION_WAITING || s->state == GMLAN_SESSION_RECEIVING)
+                due = s->ticket ? 1000 : (int32_t)(s->deadline - now);  // transmit completion doesn't wake us
+            if (due < sleep)
+                sleep = due;
+        }
+        GMLANSessionLock.unlock();
+        if (sleep <= 0)
+            continue;
+        if (events)
+            can_rx_event.wait_any(events, (sleep + 999) / 1000);
+        else
+            ThisThread::sleep_for((sleep + 999) / 1000);
+    }
+}
+
+//
+// GMLANRequest
+//
+// Sends a single frame request and waits for the answer, the blocking form of the
+// session functions used by the GMLAN services. The ECU's open session is used if
+// it has one, otherwise a temporary one. Other open sessions carry on meanwhile.
+// Negative responses are shown and left in GMLANnrc.
+//
+// inputs:    ids, the request frame and its length, whether an answer is expected
+//            and optionally where to copy the positive response (without PCI)
+// return:    true for a positive response, or for a request sent if 'reply' is false
+//
+bool GMLANRequest(uint32_t ReqID, uint32_t RespID, const char *frame, uint8_t length, bool reply, uint8_t *response, uint16_t size)
+{
+    GMLANSession_t temporary;
+    GMLANSession_t *s = NULL;
+    GMLANSessionLock.lock();
+    for (uint8_t n = 0; n < GMLANSESSIONS; n++) {
+        if (GMLANSessions[n] && GMLANSessions[n]->ReqID == ReqID && GMLANSessions[n]->RespID == RespID)
+            s = GMLANSessions[n];
+    }
+    GMLANSessionLock.unlock();
+    if (!s) {
+        if (!GMLANSessionOpen(&temporary, ReqID, RespID))
+            return false;
+        s = &temporary;
+    }
+    bool result = GMLANSessionRequest(s, frame, length, reply) && GMLANSessionRun(&s, 1);
+    GMLANnrc = s->nrc;
+    GMLANpending = s->pending;
+    if (s->nrc)
+        GMLANShowReturnCode(s->nrc);
+    if (result && response)
+        memcpy(response, s->response, (size < s->received) ? size : s->received);
+    if (s == &temporary)
+        GMLANSessionClose(s);
+    return result;
+}
+
 // All steps needed in preparation for using a bootloader ('Utility File' in GMLAN parlance)
 bool GMLANprogrammingSetupProcess(uint32_t ReqID, uint32_t RespID)
 {
@@ -28,99 +456,119 @@ bool GMLANprogrammingSetupProcess(uint32_t ReqID, uint32_t RespID)
         printf("Unable to start Diagnostic session\r\n");
         return false;
     }
+    float before = GMLANsilence ? can_bus_load(GMLANBUSLOADMS) : 0;
     printf("Disabling Normal Communincation Messages\r\n");
     if (!GMLANdisableNormalCommunication(ReqID, RespID)) {
         printf("Unable to tell T8 to disable normal communication messages\r\n");
         return false;
     }
+    if (GMLANsilence && !GMLANdisableNormalCommunicationAll(before))
+        return false;
     printf("Report Programmed State\r\n");
     if (!GMLANReportProgrammedState(ReqID, RespID)) {
         printf("Unable to determine ECU programmed state\r\n");
     }
-    printf("Requesting program mode\r\n");
-    if (!GMLANProgrammingMode(ReqID, RespID, GMLANRequestProgrammingNormal)) {
-        printf("Unable to request programming mode\r\n");
-        return false;
+    bool fast = false;
+    if (GMLANfast && can_get_bitrate() >= GMLANFASTBITRATE) {
+        printf("High speed programming is only for the single wire bus, using the normal speed\r\n");
+    } else if (GMLANfast) {
+        printf("Requesting high speed program mode\r\n");
+        fast = GMLANProgrammingMode(ReqID, RespID, GMLANRequestProgrammingFast);
+        if (!fast)
+            printf("High speed programming refused, using the normal speed\r\n");
+    }
+    if (!fast) {
+        printf("Requesting program mode\r\n");
+        if (!GMLANProgrammingMode(ReqID, RespID, GMLANRequestProgrammingNormal)) {
+            printf("Unable to request programming mode\r\n");
+            return false;
+        }
     }
     printf("Starting program session\r\n");
     if (!GMLANProgrammingMode(ReqID, RespID, GMLANEnableProgrammingMode)) {
         printf("Unable to start program session\r\n");
         return false;
     }
-    thread_sleep_for(500);   // was 5
+    if (fast) {
+        if (!GMLANbitrate)
+            GMLANbitrate = can_get_bitrate();
+        can_set_bitrate(GMLANFASTBITRATE);
+        printf("Switched to %lu Bit/s\r\n", can_get_bitrate());
+        if (!GMLANReady(ReqID, RespID, 500)) {
+            printf("No answer at the high speed bit rate\r\n");
+            GMLANRestoreBitrate();
+            return false;
+        }
+    } else {
+        GMLANReady(ReqID, RespID, 500);     // was a fixed 500 ms (and 5 before that)
+    }
     return true;
 }
 
 
 // All steps needed to transfer and start a bootloader ('Utility File' in GMLAN parlance)
-bool GMLANprogrammingUtilityFileProcess(uint32_t ReqID, uint32_t RespID, const uint8_t UtilityFile[])
+bool GMLANprogrammingUtilityFileProcess(uint32_t ReqID, uint32_t RespID, const uint8_t *UtilityFile, uint32_t length)
 {
-    uint16_t i = 0, j = 0, k = 0;
-    uint32_t StartAddress = 0x102400;
-    uint16_t txpnt = 0;
-    char iFrameNumber = 0x21;
-    char GMLANMsg[8];
+    static lzss_t lz;
+    static uint8_t block[GMLANTRANSFERMAX];
+    uint16_t size = GMLANUTILITYBLOCK;
+    uint16_t buffered = 0;          // bytes in 'block' that are decompressed but not sent yet
+    uint32_t sent = 0;
+    Timer phase;
+    uint32_t request_ms, transfer_ms, execute_ms;
 //
-    GMLANTesterPresent(ReqID, RespID);
-    GMLANtimer.start();
+    if (length < GMLANUTILITYHEADER) {
+        printf("The Bootloader is corrupt\r\n");
+        return false;
+    }
+    uint32_t ImageSize = (UtilityFile[0] << 24) | (UtilityFile[1] << 16) | (UtilityFile[2] << 8) | UtilityFile[3];
+    uint32_t LoadAddress = (UtilityFile[4] << 24) | (UtilityFile[5] << 16) | (UtilityFile[6] << 8) | UtilityFile[7];
+    uint32_t EntryPoint = (UtilityFile[8] << 24) | (UtilityFile[9] << 16) | (UtilityFile[10] << 8) | UtilityFile[11];
+    lzss_init(&lz, UtilityFile + GMLANUTILITYHEADER, length - GMLANUTILITYHEADER);
+//
+    phase.start();
     printf("Waiting for Permission to send bootloader\r\n");
-    thread_sleep_for(500);
-    if (!GMLANRequestDownload(ReqID, RespID, GMLANRequestDownloadModeNormal)) {
+    GMLANReady(ReqID, RespID, 500);
+    if (!GMLANRequestDownload(ReqID, RespID, GMLANRequestDownloadModeNormal, &size)) {
         printf("Unable to request Bootloader Upload\r\n");
         return false;
     }
-    printf("Sending Bootloader\r\n");
+    request_ms = phase.read_ms();
+    phase.reset();
+    printf("Sending Bootloader, 0x%04lX bytes to 0x%06lX\r\n", ImageSize, LoadAddress);
     printf("  0.00 %% complete.\r");
 //
-    for (i=0; i<0x46; i++) {
-        if (!GMLANDataTransferFirstFrame(ReqID, RespID, 0xF0, GMLANDOWNLOAD, StartAddress)) {
-            printf("Unable to start Bootloader Upload\r\n");
-            return false;
-        }
-        iFrameNumber = 0x21;
-        for (j=0; j < 0x22; j++) {
-            GMLANMsg[0] = iFrameNumber;
-            for (k=1; k<8; k++)
-                GMLANMsg[k] = UtilityFile[txpnt++];
-            if (!can_send_timeout(ReqID, GMLANMsg, 8, GMLANPTCT)) {
-                printf("Unable to send Bootloader\r\n");
+// Each block is decompressed just before it is sent
+    while (sent < ImageSize) {
+        uint16_t count = (ImageSize - sent < size) ? ImageSize - sent : size;
+        if (buffered < count) {
+            if (lzss_read(&lz, block + buffered, count - buffered) != count - buffered) {
+                printf("The Bootloader is corrupt\r\n");
                 return false;
             }
-            ++iFrameNumber &= 0x2F;
-            thread_sleep_for(2);     // was 2
+            buffered = count;
         }
-        if (!GMLANDataTransferBlockAcknowledge(RespID))
+        if (!GMLANTransferData(ReqID, RespID, GMLANDOWNLOAD, LoadAddress + sent, block, count)) {
+            printf("Unable to send Bootloader\r\n");
             return false;
-        if (GMLANtimer.read_ms() > 2000) {
-            GMLANTesterPresent(ReqID, RespID);
-            GMLANtimer.reset();
         }
-        StartAddress += 0xea;
-        printf("%6.2f\r", 100*(float)txpnt/(float)(16384+(70*4)) );
+        memmove(block, block + count, buffered - count);
+        buffered -= count;
+        sent += count;
+        printf("%6.2f\r", 100*(float)sent/(float)ImageSize );
     }
-    thread_sleep_for(1);
-    if (!GMLANDataTransferFirstFrame(ReqID, RespID, 0x0A, GMLANDOWNLOAD, StartAddress)) {
-        printf("Unable to finish Bootloader Upload\r\n");
-        return false;
-    }
-    iFrameNumber = 0x21;
-    GMLANMsg[0] = iFrameNumber;
-    for (k=0; k<7; k++) {
-        GMLANMsg[k+1] = UtilityFile[txpnt++];
-    }
-    if (!can_send_timeout(ReqID, GMLANMsg, 8, GMLANPTCT)) {
-        printf("Unable to finish sending Bootloader\r\n");
-        return false;
-    }
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
+    transfer_ms = phase.read_ms();
+    phase.reset();
     printf("%6.2f\r\n", (float)100 );
     printf("Starting the bootloader\r\n");
-    if (!GMLANDataTransfer(ReqID, RespID, 0x06, GMLANEXECUTE, 0x00102460)) {
+    if (!GMLANDataTransfer(ReqID, RespID, 0x06, GMLANEXECUTE, EntryPoint)) {
         printf("Unable to start the Bootloader\r\n");
         return false;
     }
-    thread_sleep_for(500);   // was 100
+    GMLANReady(ReqID, RespID, 500);     // was a fixed 500 ms (and 100 before that)
+    execute_ms = phase.read_ms();
+    printf("Bootloader request %lu ms, transfer %lu ms (0x%X byte blocks, %.1f KB/s), start %lu ms\r\n",
+           request_ms, transfer_ms, size, (float)ImageSize / 1.024 / (float)(transfer_ms ? transfer_ms : 1), execute_ms);
     return true;
 }
 
@@ -128,50 +576,48 @@ bool GMLANinitiateDiagnostic(uint32_t ReqID, uint32_t RespID, char level)
 {
     char GMLANMsg[] = GMLANinitiateDiagnosticOperation;
     GMLANMsg[2] = level;
-    if (!can_send_timeout(ReqID, GMLANMsg, 3, GMLANPTCT))
-        return false;
-    if (ReqID == T8USDTREQID) return true;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x10 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x10 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0x50) ? true : false;
+    return GMLANRequest(ReqID, RespID, GMLANMsg, 3, ReqID != T8USDTREQID);
 }
 
 
+//
+// GMLANdisableNormalCommunicationAll
+//
+// Tells every node on the bus to stop sending its normal messages so they don't
+// compete with the programming traffic, and keeps them quiet with a functional
+// TesterPresent until GMLANKeepAliveStop(GMLANALLNODES). The bus load after is
+// shown against 'before', measured before any node was told to be quiet.
+//
+// return:    false if the nodes can't be kept quiet, they start talking again
+//            after their TesterPresent timeout
+//
+bool GMLANdisableNormalCommunicationAll(float before)
+{
+    char GMLANMsg[] = GMLANdisableCommunicationFunctional;
+    printf("Disabling Normal Communication Messages of all nodes\r\n");
+    can_send_timeout(GMLANALLNODES, GMLANMsg, 3, GMLANPTCT);
+    GMLANsilenced = true;
+    ACTIVITYLEDON;
+    if (!GMLANKeepAliveStart(GMLANALLNODES, GMLANALLNODES, GMLANKEEPALIVEMS, true)) {
+        printf("Unable to keep all nodes quiet, no keep alive free\r\n");
+        return false;
+    }
+    float after = can_bus_load(GMLANBUSLOADMS);
+    printf("Bus load %.1f %% before, %.1f %% after\r\n", before, after);
+    return true;
+}
+
 bool GMLANdisableNormalCommunication(uint32_t ReqID, uint32_t RespID)
 {
     char GMLANMsg[] = GMLANdisableCommunication;
-    if (!can_send_timeout(ReqID, GMLANMsg, 2, GMLANPTCT))
-        return false;
-    if (ReqID == T8USDTREQID) return true;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x28 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x28 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0x68) ? true : false;
+    return GMLANRequest(ReqID, RespID, GMLANMsg, 2, ReqID != T8USDTREQID);
 }
 
 
 bool GMLANReportProgrammedState(uint32_t ReqID, uint32_t RespID)
 {
     char GMLANMsg[] = GMLANReportProgrammed;
-    if (!can_send_timeout(ReqID, GMLANMsg, 2, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0xA2 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0xA2 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x02 && GMLANMsg[1] == 0xE2) ? true : false;
+    return GMLANRequest(ReqID, RespID, GMLANMsg, 2, true);
 }
 
 
@@ -179,35 +625,18 @@ bool GMLANProgrammingMode(uint32_t ReqID, uint32_t RespID, char mode)
 {
     char GMLANMsg[] = GMLANProgramming;
     GMLANMsg[2] = mode;
-    if (!can_send_timeout(ReqID, GMLANMsg, 3, GMLANPTCT))
-        return false;
-    if (mode == GMLANEnableProgrammingMode)
-        return true;                            // No response expected when enabling program mode
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0xA5 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0xA5 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0xE5) ? true : false;
+    // No response expected when enabling program mode
+    return GMLANRequest(ReqID, RespID, GMLANMsg, 3, mode != GMLANEnableProgrammingMode);
 }
 
 bool GMLANSecurityAccessRequest(uint32_t ReqID, uint32_t RespID, char level, uint16_t& seed)
 {
     char GMLANMsg[] = GMLANSecurityAccessSeed;
     GMLANMsg[2] = level;
-    if (!can_send_timeout(ReqID, GMLANMsg, 3, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x27 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    seed = GMLANMsg[3] << 8 | GMLANMsg[4];
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x27 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x04 && GMLANMsg[1] == 0x67 && GMLANMsg[2] == level) ? true : false;
+    uint8_t response[4] = {0};
+    bool result = GMLANRequest(ReqID, RespID, GMLANMsg, 3, true, response, sizeof(response));
+    seed = response[2] << 8 | response[3];
+    return result && response[1] == level;
 }
 
 bool GMLANSecurityAccessSendKey(uint32_t ReqID, uint32_t RespID, char level, uint16_t key)
@@ -216,35 +645,35 @@ bool GMLANSecurityAccessSendKey(uint32_t ReqID, uint32_t RespID, char level, uin
     GMLANMsg[2] = level+1;
     GMLANMsg[3] = (key >> 8) & 0xFF;
     GMLANMsg[4] = key & 0xFF;
-    if (!can_send_timeout(ReqID, GMLANMsg, 5, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x27 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x27 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x02 && GMLANMsg[1] == 0x67 && GMLANMsg[2] == level+1) ? true : false;
+    uint8_t response[2] = {0};
+    return GMLANRequest(ReqID, RespID, GMLANMsg, 5, true, response, sizeof(response)) && response[1] == level+1;
 }
 
-bool GMLANRequestDownload(uint32_t ReqID, uint32_t RespID, char dataFormatIdentifier)
+//
+// GMLANRequestDownload
+//
+// Asks for a download session. With 'block', the data a TransferData may carry is
+// set from the ECU's limit if its reply has one, and left alone if it hasn't.
+//
+bool GMLANRequestDownload(uint32_t ReqID, uint32_t RespID, char dataFormatIdentifier, uint16_t *block)
 {
     char GMLANMsg[] = GMLANRequestDownloadMessage;
+    uint8_t reply[7] = {0};
     GMLANMsg[2] = dataFormatIdentifier;
-    if (!can_send_timeout(ReqID, GMLANMsg, 7, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x34 && GMLANMsg[3] == 0x78) {
-        printf("Waiting\r\n");
-        GMLANTesterPresent(T8REQID, T8RESPID);
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
+    bool result = GMLANRequest(ReqID, RespID, GMLANMsg, 7, true, reply, sizeof(reply));
+    if (GMLANpending)
+        printf("Waited for %d 'response pending' replies\r\n", GMLANpending);
+    uint8_t bytes = reply[1] >> 4;
+    if (result && block && bytes >= 1 && bytes <= 4) {
+        uint32_t limit = 0;
+        for (uint8_t i = 0; i < bytes; i++)
+            limit = (limit << 8) | reply[2 + i];
+        if (limit > 6 + 8) {
+            limit -= 6;                         // service id, function and address
+            *block = (limit < GMLANTRANSFERMAX) ? limit : GMLANTRANSFERMAX;
+        }
     }
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x34 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0x74) ? true : false;
+    return result;
 }
 
 
@@ -259,92 +688,182 @@ bool GMLANDataTransfer(uint32_t ReqID, uint32_t RespID, char length, char functi
     GMLANMsg[5] = (char) (address >> 8);
     GMLANMsg[6] = (char) (address);
     GMLANMsg[7] = 0xaa;
-    if (!can_send_timeout(ReqID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x36 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x36 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0x76) ? true : false;
+    return GMLANRequest(ReqID, RespID, GMLANMsg, 8, true);
 }
 
 
-bool GMLANDataTransferFirstFrame(uint32_t ReqID, uint32_t RespID, char length, char function, uint32_t address)
+//
+// GMLANPaceStart
+//
+// Starts a new pacing session at the conservative GMLANPACESTART gap.
+//
+void GMLANPaceStart()
 {
-    char GMLANMsg[8];
-    GMLANMsg[0] = 0x10;
-    GMLANMsg[1] = length;
-    GMLANMsg[2] = 0x36;
-    GMLANMsg[3] = function;
-    GMLANMsg[4] = (char) (address >> 24);
-    GMLANMsg[5] = (char) (address >> 16);
-    GMLANMsg[6] = (char) (address >> 8);
-    GMLANMsg[7] = (char) (address);
-    if (!can_send_timeout(ReqID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x36 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x36 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x30 && GMLANMsg[1] == 0x00 && GMLANMsg[2] == 0x00) ? true : false;
+    isotp_gap_us = GMLANPACESTART;
+    GMLANPaceMinGap = GMLANPACESTART;
+    GMLANPaceBackoffs = 0;
+    GMLANPaceFastestAck = 0xFFFFFFFF;
+    uint32_t status = can_get_status();
+    GMLANPaceErrors = ((status >> 16) & 0xFF) + (status >> 24) + can_hw_overruns;
+    GMLANPacing = true;
 }
 
+//
+// GMLANPaceReport
+//
+// Logs the gap the session settled on and ends the session, later ISO-TP sends
+// go back to the receiver's STmin alone.
+//
+void GMLANPaceReport()
+{
+    printf("Consecutive frame gap %lu us (shortest %lu us, %lu back-offs)\r\n", isotp_gap_us, GMLANPaceMinGap, GMLANPaceBackoffs);
+    isotp_gap_us = 0;
+    GMLANPacing = false;
+}
 
-bool GMLANDataTransferConsecutiveFrame(uint32_t ReqID, char framenumber, char data[8])
+//
+// GMLANPaceUpdate
+//
+// Adjusts the gap after an acknowledged block, 'ack_us' is how long the
+// acknowledge took. Blocks sent outside a pacing session, such as a utility
+// file upload, leave the gap alone.
+//
+static void GMLANPaceUpdate(uint32_t ack_us)
 {
-    char GMLANMsg[8];
-    GMLANMsg[0] = framenumber;
-    for (char k = 0; k < 7; k++ )
-        GMLANMsg[k+1] = data[k];
-    return (can_send_timeout(ReqID, GMLANMsg, 8, GMLANPTCT)) ? true : false;
+    if (!GMLANPacing)
+        return;
+    uint32_t status = can_get_status();
+    uint32_t errors = ((status >> 16) & 0xFF) + (status >> 24) + can_hw_overruns;
+    bool can_error = errors > GMLANPaceErrors;
+    GMLANPaceErrors = errors;
+    if (GMLANpending || can_error) {
+        isotp_gap_us *= 2;
+        if (isotp_gap_us < GMLANPACEBACKOFF)
+            isotp_gap_us = GMLANPACEBACKOFF;
+        if (isotp_gap_us > GMLANPACEMAX)
+            isotp_gap_us = GMLANPACEMAX;
+        GMLANPaceBackoffs++;
+        return;
+    }
+    if (ack_us < GMLANPaceFastestAck)
+        GMLANPaceFastestAck = ack_us;
+    if (ack_us <= GMLANPACESLOWACK * GMLANPaceFastestAck) {
+        isotp_gap_us -= isotp_gap_us / 8;
+        if (isotp_gap_us < 8)
+            isotp_gap_us = 0;
+        if (isotp_gap_us < GMLANPaceMinGap)
+            GMLANPaceMinGap = isotp_gap_us;
+    }
 }
 
-bool GMLANDataTransferBlockAcknowledge(uint32_t RespID)
+//
+// GMLANTransferData
+//
+// Sends a block of data with TransferData (0x36), segmented by the ISO-TP layer,
+// and waits for the ECU to acknowledge it. The consecutive frame gap is adjusted
+// after every acknowledged block. The acknowledge (0x76) doesn't echo the
+// address, so a block that is not acknowledged in time fails the transfer
+// rather than being sent again: a late acknowledge would pair every later block
+// with its predecessor's, and an upload would refuse the repeated block anyway.
+//
+bool GMLANTransferData(uint32_t ReqID, uint32_t RespID, char function, uint32_t address, const uint8_t *data, uint16_t length)
 {
-    char GMLANMsg[8];
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT)) {
-        printf("\r\nI did not receive a block acknowledge message\r\n");
+    static uint8_t GMLANMsg[6 + GMLANTRANSFERMAX];
+    uint8_t GMLANAck[8];
+    Timer ack;
+    if (length > GMLANTRANSFERMAX)
+        return false;
+    GMLANMsg[0] = 0x36;
+    GMLANMsg[1] = function;
+    GMLANMsg[2] = (uint8_t) (address >> 24);
+    GMLANMsg[3] = (uint8_t) (address >> 16);
+    GMLANMsg[4] = (uint8_t) (address >> 8);
+    GMLANMsg[5] = (uint8_t) (address);
+    memcpy(GMLANMsg + 6, data, length);
+    if (!isotp_send(ReqID, RespID, GMLANMsg, 6 + length)) {
+        if (isotp_nrc)
+            GMLANShowReturnCode(isotp_nrc);
         return false;
     }
-    if (GMLANMsg[0] != 0x01 && GMLANMsg[1] != 0x76) {
-        while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x36 && GMLANMsg[3] == 0x78) {
-            printf("\r\nI'm waiting for a block acknowledge message\r\n");
-            if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED)) {
-                printf("I did not receive a block acknowledge message after enhanced timeout\r\n");
-                return false;
-            }
-        }
-        if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x36 ) {
-            GMLANShowReturnCode(GMLANMsg[3]);
-            return false;
-        }
-        if (GMLANMsg[0] != 0x01 && GMLANMsg[1] != 0x76) {
-            printf("\r\nEXITING due to an unexpected CAN message\r\n");
-            return false;
-        }
+    ack.start();
+    if (!GMLANResponse(ReqID, RespID, 0x36, GMLANAck, sizeof(GMLANAck))) {
+        if (!GMLANnrc)
+            printf("\r\nI did not receive a block acknowledge message\r\n");
+        return false;
     }
+    GMLANPaceUpdate(ack.read_us());
     return true;
 }
 
+//
+// GMLANResponse
+//
+// Waits for the positive response to 'service', waiting longer while the ECU
+// replies 'response pending'. Negative responses are shown.
+//
+// return:    length of the response, 0 if there was no positive response
+//
+int32_t GMLANResponse(uint32_t ReqID, uint32_t RespID, uint8_t service, uint8_t *response, uint16_t size)
+{
+    GMLANnrc = 0;
+    GMLANpending = 0;
+    int32_t length = isotp_receive(ReqID, RespID, response, size, GMLANPTCT);
+    while (length >= 3 && response[0] == 0x7F && response[1] == service && response[2] == 0x78) {
+        GMLANpending++;
+        length = isotp_receive(ReqID, RespID, response, size, GMLANPTCTENHANCED);
+    }
+    if (length >= 3 && response[0] == 0x7F && response[1] == service) {
+        GMLANnrc = response[2];
+        GMLANShowReturnCode(response[2]);
+        return 0;
+    }
+    return (length > 0 && response[0] == service + 0x40) ? length : 0;
+}
+
+//
+// GMLANRestoreBitrate
+//
+// Goes back to the bit rate the bus had before GMLANprogrammingSetupProcess()
+// switched to the high speed programming mode, if it did.
+//
+void GMLANRestoreBitrate()
+{
+    if (GMLANbitrate) {
+        can_set_bitrate(GMLANbitrate);
+        printf("Switched back to %lu Bit/s\r\n", can_get_bitrate());
+        GMLANbitrate = 0;
+    }
+}
+
 bool GMLANReturnToNormalMode(uint32_t ReqID, uint32_t RespID)
 {
     char GMLANMsg[] = GMLANReturnToNormalModeMessage;
-    if (!can_send_timeout(ReqID, GMLANMsg, 2, GMLANPTCT))
-        return false;
-    if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCT))
-        return false;
-    while (GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x20 && GMLANMsg[3] == 0x78)
-        if (!can_wait_timeout(RespID, GMLANMsg, 8, GMLANPTCTENHANCED))
-            return false;
-    if ( GMLANMsg[0] == 0x03 && GMLANMsg[1] == 0x7F && GMLANMsg[2] == 0x20 )
-        GMLANShowReturnCode(GMLANMsg[3]);
-    return (GMLANMsg[0] == 0x01 && GMLANMsg[1] == 0x60) ? true : false;
+    bool result = GMLANRequest(ReqID, RespID, GMLANMsg, 2, true);
+    GMLANRestoreBitrate();                      // the ECU leaves the high speed mode with its programming session
+    return result;
+}
+
+//
+// GMLANEnd
+//
+// Stops every keep-alive, goes back to the bit rate the bus had before the high
+// speed programming mode and tells the nodes silenced by
+// GMLANdisableNormalCommunicationAll() to carry on, so nothing is left holding
+// an ECU in its programming session once the bus is given up. Call it before
+// can_close(), it only returns once the functional message has left the
+// controller.
+//
+void GMLANEnd()
+{
+    GMLANKeepAliveStopAll();
+    GMLANRestoreBitrate();
+    if (GMLANsilenced) {
+        char GMLANMsg[] = GMLANReturnToNormalModeFunctional;
+        uint32_t ticket = can_tx_post(CANMessage(GMLANALLNODES, GMLANMsg, 3));
+        if (!ticket || !can_tx_wait(ticket, GMLANPTCT))
+            printf("UH-OH! Could not tell the silenced nodes to Return To Normal Mode!!\r\n");
+        GMLANsilenced = false;
+    }
 }
 
 
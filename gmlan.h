@@ -10,6 +10,8 @@
 
 #include "common.h"
 #include "canutils.h"
+#include "isotp.h"
+#include "lzss.h"
 
 #define T8REQID 0x7E0
 #define T8RESPID 0x7E8
@@ -31,11 +33,79 @@
 extern void GMLANTesterPresentAll();
 extern void GMLANTesterPresent(uint32_t ReqID, uint32_t RespID);
 
+// Background TesterPresent for long running sessions, sent when nothing has been
+// sent to or received from the ECU for the session's interval. Replies to the
+// physical TesterPresent are dropped before anyone waiting for RespID sees them.
+#define GMLANKEEPALIVES 4               // sessions kept alive at the same time (recovery uses 3)
+#define GMLANKEEPALIVEMS 2000           // default interval in milliseconds
+#define GMLANKEEPALIVETICK 50           // how often sessions are checked, milliseconds
+// Readiness check used instead of fixed delays: TesterPresent is sent every
+// GMLANREADYPOLL milliseconds until the ECU answers or the timeout runs out
+#define GMLANREADYPOLL 50
+extern bool GMLANReady(uint32_t ReqID, uint32_t RespID, uint16_t timeout);
+extern bool GMLANKeepAliveStart(uint32_t ReqID, uint32_t RespID, uint16_t interval, bool functional);
+extern void GMLANKeepAliveStop(uint32_t ReqID);
+extern void GMLANKeepAliveStopAll();
+
+// Non-blocking sessions, one per ECU, each owning its request and response ids and
+// its timers. GMLANSessionPoll() moves a session on without ever waiting, so any
+// number of them can be in the middle of a request at once. GMLANSessionRun() is
+// the event loop: it sleeps on the sessions' CAN mailboxes and deadlines and polls
+// every open session until the ones it was given have finished. GMLANSessionService()
+// polls them all once, for long blocking jobs to call between their steps.
+// The session functions lock the open sessions, so threads can share them.
+// Sessions don't send TesterPresent of their own, GMLANKeepAliveStart() does that.
+#define GMLANSESSIONS 4                 // sessions open at the same time
+#define GMLANSESSIONMAX 64              // longest response a session keeps
+#define GMLAN_SESSION_IDLE 0            // nothing outstanding
+#define GMLAN_SESSION_WAITING 1         // request queued or sent, waiting for the response
+#define GMLAN_SESSION_RECEIVING 2       // first frame received, waiting for consecutive frames
+#define GMLAN_SESSION_DONE 3            // positive response in 'response'
+#define GMLAN_SESSION_FAILED 4          // negative response ('nrc'), not sent or no answer in time
+struct GMLANSession_t {
+    uint32_t ReqID;
+    uint32_t RespID;
+    uint8_t state;
+    uint8_t service;                    // service id of the outstanding request
+    bool reply;                         // false if the request is done once it is on the bus
+    uint32_t ticket;                    // can_tx_post() ticket of the request
+    uint32_t deadline;                  // can_time_us() when the ECU has taken too long
+    uint8_t nrc;                        // negative response code, 0 if none
+    uint8_t pending;                    // 'response pending' replies to the request
+    uint8_t sequence;                   // next consecutive frame sequence number
+    uint16_t length;                    // length of the response (without PCI)
+    uint16_t received;                  // bytes of it received so far
+    uint8_t response[GMLANSESSIONMAX];
+};
+bool GMLANSessionOpen(GMLANSession_t *s, uint32_t ReqID, uint32_t RespID);
+void GMLANSessionClose(GMLANSession_t *s);
+bool GMLANSessionRequest(GMLANSession_t *s, const char *frame, uint8_t length, bool reply);
+uint8_t GMLANSessionPoll(GMLANSession_t *s);
+void GMLANSessionService();
+bool GMLANSessionRun(GMLANSession_t *const *sessions, uint8_t count);
+// A single frame request run to completion on the ECU's session (a temporary one if
+// it has none open) while every other open session keeps going
+bool GMLANRequest(uint32_t ReqID, uint32_t RespID, const char *frame, uint8_t length, bool reply, uint8_t *response = NULL, uint16_t size = 0);
+
 // All steps needed in preparation for using a bootloader ('Utility File' in GMLAN parlance)
+// With GMLANfast set the ECU is asked for the high speed programming mode first and
+// the bus is switched to GMLANFASTBITRATE if it agrees, GMLANRestoreBitrate() switches
+// back to the bit rate the session started at. Only a single wire bus, running slower
+// than GMLANFASTBITRATE, is ever switched, the nodes on a faster bus stay where they are.
+#define GMLANFASTBITRATE 83333          // single wire GMLAN high speed mode
+extern bool GMLANfast;
+// With GMLANsilence set every node is told to stop its normal messages, see GMLANdisableNormalCommunicationAll()
+extern bool GMLANsilence;
 bool GMLANprogrammingSetupProcess(uint32_t ReqID, uint32_t RespID);
+void GMLANRestoreBitrate();
 
 // All steps needed to transfer and start a bootloader ('Utility File' in GMLAN parlance)
-bool GMLANprogrammingUtilityFileProcess(uint32_t ReqID, uint32_t RespID, const uint8_t UtilityFile[]);
+// A utility file starts with three big endian longs, the size of the bootloader,
+// its load address and its entry point, then the LZSS compressed bootloader.
+// 'length' is the size of the whole utility file.
+#define GMLANUTILITYHEADER 12
+#define GMLANUTILITYBLOCK 0xEA          // block size unless the ECU's RequestDownload reply gives one
+bool GMLANprogrammingUtilityFileProcess(uint32_t ReqID, uint32_t RespID, const uint8_t *UtilityFile, uint32_t length);
 
 
 // Start a Diagnostic Session
@@ -47,6 +117,10 @@ bool GMLANinitiateDiagnostic(uint32_t ReqID, uint32_t RespID, char level);
 // Tell T8 To disable normal communication messages
 #define GMLANdisableCommunication {0x01,0x28,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa}
 bool GMLANdisableNormalCommunication(uint32_t ReqID, uint32_t RespID);
+// The same for every node on the bus, they are kept quiet by a functional TesterPresent
+#define GMLANdisableCommunicationFunctional {0xFE,0x01,0x28,0xaa,0xaa,0xaa,0xaa,0xaa}
+#define GMLANBUSLOADMS 500              // how long the bus load is measured for
+bool GMLANdisableNormalCommunicationAll(float before);
 
 
 // Tell T8 To report programmed state
@@ -72,21 +146,42 @@ bool GMLANSecurityAccessSendKey(uint32_t ReqID, uint32_t RespID, char level, uin
 #define GMLANRequestDownloadModeEncrypted 0x01
 #define GMLANRequestDownloadModeCompressed 0x10
 #define GMLANRequestDownloadModeCompressedEncrypted 0x11
-bool GMLANRequestDownload(uint32_t ReqID, uint32_t RespID, char dataFormatIdentifier);
+// An ECU that has a limit may give it in its reply, as a lengthFormatIdentifier byte
+// followed by the longest TransferData request (service id and address included)
+bool GMLANRequestDownload(uint32_t ReqID, uint32_t RespID, char dataFormatIdentifier, uint16_t *block = NULL);
 
 // Data blocks are sent using this message type
-#define GMLANDataTransferMessage    {0x10,0xF0,0x36,0x00,0xCA,0xFE,0xBA,0xBE}
 #define GMLANDOWNLOAD 0x00
 #define GMLANEXECUTE  0x80
+#define GMLANTRANSFERMAX 0x400          // longest data block for GMLANTransferData
 bool GMLANDataTransfer(uint32_t ReqID, uint32_t RespID, char length, char function, uint32_t address);
-bool GMLANDataTransferFirstFrame(uint32_t ReqID, uint32_t RespID, char length, char function, uint32_t address);
-bool GMLANDataTransferConsecutiveFrame(uint32_t ReqID, char framenumber, char data[7]);
-bool GMLANDataTransferBlockAcknowledge(uint32_t RespID);
+bool GMLANTransferData(uint32_t ReqID, uint32_t RespID, char function, uint32_t address, const uint8_t *data, uint16_t length);
+
+// Wait for the (ISO-TP) response to a request
+int32_t GMLANResponse(uint32_t ReqID, uint32_t RespID, uint8_t service, uint8_t *response, uint16_t size);
+extern uint8_t GMLANnrc;                // negative response code of the last GMLANResponse, 0 if none
+extern uint8_t GMLANpending;            // 'response pending' replies to the last GMLANResponse
+
+// Adaptive pacing of the consecutive frames of GMLANTransferData blocks
+// The gap starts long enough for an ECU in a car, shrinks by 1/8 for every block
+// that is acknowledged promptly without CAN errors and doubles after a
+// 'response pending', a missed acknowledge or a CAN error
+#define GMLANPACESTART 1000             // microseconds between consecutive frames
+#define GMLANPACEBACKOFF 500            // least gap after backing off
+#define GMLANPACEMAX 4000
+#define GMLANPACESLOWACK 2              // acknowledges slower than twice the fastest one are not prompt
+void GMLANPaceStart();
+void GMLANPaceReport();
 
 // Tell T8 ECU to return to normal mode after FLASHing
 #define GMLANReturnToNormalModeMessage    {0x01,0x20,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa}
+#define GMLANReturnToNormalModeFunctional {0xFE,0x01,0x20,0xaa,0xaa,0xaa,0xaa,0xaa}
 bool GMLANReturnToNormalMode(uint32_t ReqID, uint32_t RespID);
 
+// Undoes whatever a programming session left behind: every keep-alive, the high
+// speed bit rate and the silenced nodes. Called when the bus is closed
+void GMLANEnd();
+
 
 // Show a description of GMLAN Return Codes when an error occurs
 void GMLANShowReturnCode(char returnCode);
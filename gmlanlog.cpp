@@ -0,0 +1,226 @@
+// gmlanlog.cpp - live data logging from a GMLAN ECU
+//
+// A thread of its own works through the watch list with a GMLAN session, see
+// GMLANSessionOpen(), so other sessions keep going while it waits.
+
+#include "gmlanlog.h"
+
+struct GMLANLogItem_t {
+    char frame[8];                      // the request, a single frame
+    uint8_t skip;                       // response bytes before the data
+    uint32_t period_us;
+    uint32_t next;                      // can_time_us() when it is due
+};
+
+static GMLANLogItem_t GMLANLogItems[GMLANLOGITEMS];
+static uint8_t GMLANLogCount = 0;
+static GMLANSession_t GMLANLogSession;
+static GMLANLogSink_t GMLANLogOutput = NULL;
+static FILE *GMLANLogFile = NULL;
+static uint8_t GMLANLogBuffer[0x100];   // records waiting to be written to GMLANLOGFILE
+static uint16_t GMLANLogBuffered = 0;
+static volatile bool GMLANLogRunning = false;
+static bool GMLANLogStarted = false;
+static Thread GMLANLogThread(osPriorityNormal, 1024);
+static Semaphore GMLANLogGo(0, 1);
+static Semaphore GMLANLogStopped(0, 1);
+
+bool GMLANLogClear()
+{
+    if (GMLANLogRunning)
+        return false;
+    GMLANLogCount = 0;
+    return true;
+}
+
+static GMLANLogItem_t *GMLANLogAdd(uint16_t period)
+{
+    if (GMLANLogRunning || GMLANLogCount >= GMLANLOGITEMS || !period)
+        return NULL;
+    GMLANLogItem_t *item = &GMLANLogItems[GMLANLogCount++];
+    memset(item->frame, 0xaa, sizeof(item->frame));
+    item->period_us = period * 1000;
+    return item;
+}
+
+//
+// GMLANLogAddIdentifier
+//
+// Adds a ReadDataByIdentifier item, read every 'period' milliseconds
+//
+bool GMLANLogAddIdentifier(uint8_t identifier, uint16_t period)
+{
+    GMLANLogItem_t *item = GMLANLogAdd(period);
+    if (!item)
+        return false;
+    item->frame[0] = 0x02;
+    item->frame[1] = 0x1A;
+    item->frame[2] = identifier;
+    item->skip = 2;                     // 0x5A, identifier
+    return true;
+}
+
+//
+// GMLANLogAddMemory
+//
+// Adds a ReadMemoryByAddress item for 'size' bytes at 'address', read every
+// 'period' milliseconds
+//
+bool GMLANLogAddMemory(uint32_t address, uint8_t size, uint16_t period)
+{
+    if (!size || size > GMLANLOGMAXDATA)
+        return false;
+    GMLANLogItem_t *item = GMLANLogAdd(period);
+    if (!item)
+        return false;
+    item->frame[0] = 0x07;
+    item->frame[1] = 0x23;
+    item->frame[2] = (char) (address >> 24);
+    item->frame[3] = (char) (address >> 16);
+    item->frame[4] = (char) (address >> 8);
+    item->frame[5] = (char) (address);
+    item->frame[6] = 0x00;
+    item->frame[7] = size;
+    item->skip = 5;                     // 0x63, address
+    return true;
+}
+
+//
+// GMLANLogToFile
+//
+// The sink used without one of the caller's, writes the records to GMLANLOGFILE
+// in blocks, LocalFileSystem is slow at small writes
+//
+static void GMLANLogToFile(const uint8_t *record, uint16_t length)
+{
+    if (GMLANLogBuffered && (!record || GMLANLogBuffered + length > sizeof(GMLANLogBuffer))) {
+        fwrite(GMLANLogBuffer, 1, GMLANLogBuffered, GMLANLogFile);
+        GMLANLogBuffered = 0;
+    }
+    if (record) {
+        memcpy(GMLANLogBuffer + GMLANLogBuffered, record, length);
+        GMLANLogBuffered += length;
+    }
+}
+
+static void GMLANLogRecord(uint8_t index, uint32_t stamp, const uint8_t *data, int32_t length)
+{
+    uint8_t record[GMLANLOG_RECORD + GMLANLOGMAXDATA];
+    if (length > GMLANLOGMAXDATA)
+        length = GMLANLOGMAXDATA;
+    record[0] = index;
+    for (uint8_t i = 0; i < 4; i++)
+        record[1 + i] = (stamp >> (8 * i)) & 0xFF;
+    if (length < 0) {
+        record[5] = GMLANLOG_FAILED;
+        length = 0;
+    } else {
+        record[5] = length;
+        memcpy(record + GMLANLOG_RECORD, data, length);
+    }
+    GMLANLogOutput(record, GMLANLOG_RECORD + length);
+}
+
+//
+// GMLANLogThd
+//
+// The scheduler. The item chosen is the one due soonest, counting an item as
+// due once it is less than half the average round trip away, so its response
+// arrives about when it is due. An item that has fallen more than a period
+// behind starts again from now rather than being read several times in a row.
+//
+static void GMLANLogThd()
+{
+    while (true) {
+        GMLANLogGo.acquire();
+        GMLANSession_t *s = &GMLANLogSession;
+        uint32_t rtt = 0;
+        Timer flush;
+        flush.start();
+        while (GMLANLogRunning) {
+            uint32_t now = can_time_us();
+            uint8_t index = 0;
+            int32_t due = 0;
+            for (uint8_t i = 0; i < GMLANLogCount; i++) {
+                int32_t left = (int32_t)(GMLANLogItems[i].next - now) - (int32_t)(rtt / 2);
+                if (i == 0 || left < due) {
+                    index = i;
+                    due = left;
+                }
+            }
+            if (flush.read_ms() >= GMLANLOGFLUSHMS) {
+                GMLANLogOutput(NULL, 0);
+                flush.reset();
+            }
+            if (due > 0) {
+                int32_t ms = (due + 999) / 1000;
+                ThisThread::sleep_for((ms < GMLANLOGFLUSHMS) ? ms : GMLANLOGFLUSHMS);
+                continue;
+            }
+            GMLANLogItem_t *item = &GMLANLogItems[index];
+            item->next += item->period_us;
+            if ((int32_t)(now - item->next) > 0)
+                item->next = now + item->period_us;
+            uint32_t sent = can_time_us();
+            bool ok = GMLANSessionRequest(s, item->frame, item->frame[0] + 1, true) && GMLANSessionRun(&s, 1);
+            uint32_t received = can_time_us();
+            if (ok) {
+                rtt = rtt ? (7 * rtt + received - sent) / 8 : received - sent;
+                GMLANLogRecord(index, sent + (received - sent) / 2, s->response + item->skip, (int32_t)s->received - item->skip);
+            } else {
+                GMLANLogRecord(index, sent + (received - sent) / 2, NULL, -1);
+            }
+        }
+        GMLANLogOutput(NULL, 0);
+        GMLANLogStopped.release();
+    }
+}
+
+//
+// GMLANLogStart
+//
+// Starts reading the watch list from the ECU on 'ReqID' and 'RespID'
+//
+// return:    false if it is already running, the watch list is empty or the
+//            ECU can't have a session
+//
+bool GMLANLogStart(uint32_t ReqID, uint32_t RespID, GMLANLogSink_t sink)
+{
+    if (GMLANLogRunning || !GMLANLogCount)
+        return false;
+    if (!GMLANSessionOpen(&GMLANLogSession, ReqID, RespID))
+        return false;
+    if (!sink) {
+        GMLANLogFile = fopen(GMLANLOGFILE, "w");
+        if (!GMLANLogFile) {
+            GMLANSessionClose(&GMLANLogSession);
+            return false;
+        }
+        GMLANLogBuffered = 0;
+        sink = &GMLANLogToFile;
+    }
+    GMLANLogOutput = sink;
+    uint32_t now = can_time_us();
+    for (uint8_t i = 0; i < GMLANLogCount; i++)
+        GMLANLogItems[i].next = now;
+    GMLANLogRunning = true;
+    if (!GMLANLogStarted) {
+        GMLANLogThread.start(&GMLANLogThd);
+        GMLANLogStarted = true;
+    }
+    GMLANLogGo.release();
+    return true;
+}
+
+void GMLANLogStop()
+{
+    if (!GMLANLogRunning)
+        return;
+    GMLANLogRunning = false;
+    GMLANLogStopped.acquire();
+    GMLANSessionClose(&GMLANLogSession);
+    if (GMLANLogFile) {
+        fclose(GMLANLogFile);
+        GMLANLogFile = NULL;
+    }
+}
@@ -0,0 +1,39 @@
+
+// gmlanlog.h - live data logging from a GMLAN ECU
+
+#ifndef __GMLANLOG_H__
+#define __GMLANLOG_H__
+
+#include "mbed.h"
+
+#include "common.h"
+#include "gmlan.h"
+
+// The watch list holds ReadDataByIdentifier and ReadMemoryByAddress items, each
+// read at its own rate. There is never more than one request outstanding: as
+// soon as a response arrives the most overdue item is asked for, or one that
+// will be due by the time its response arrives, so the ECU is never left idle
+// while something is due.
+#define GMLANLOGITEMS 32
+#define GMLANLOGMAXDATA 48              // most bytes an item may read
+#define GMLANLOGFLUSHMS 20              // longest time records are held back
+
+// Each value goes to the sink as a record: the item's number in the watch list,
+// a 4 byte timestamp in microseconds LSB first, a length byte and the data. The
+// timestamp is half way between request and response. A failed read has
+// GMLANLOG_FAILED set in the length byte and no data.
+#define GMLANLOG_RECORD 6               // record bytes before the data
+#define GMLANLOG_FAILED 0x80
+#define GMLANLOGFILE "/local/gmlanlog.bin"
+
+// Called with each record, and with NULL when the records held should be sent on
+typedef void (*GMLANLogSink_t)(const uint8_t *record, uint16_t length);
+
+bool GMLANLogClear();
+bool GMLANLogAddIdentifier(uint8_t identifier, uint16_t period);
+bool GMLANLogAddMemory(uint32_t address, uint8_t size, uint16_t period);
+// Without a sink the records are written to GMLANLOGFILE
+bool GMLANLogStart(uint32_t ReqID, uint32_t RespID, GMLANLogSink_t sink);
+void GMLANLogStop();
+
+#endif
@@ -0,0 +1,188 @@
+// isotp.cpp - ISO 15765-2 transport layer
+//
+// Messages of up to 7 bytes go in a single frame. Longer messages start with a
+// first frame and the rest follows in consecutive frames at the pace the
+// receiver asks for in its flow control frames (block size and STmin).
+// Received frames come from the CAN id's mailbox, see canutils. The caller keeps
+// the mailbox for the response id open for the whole conversation with the ECU.
+
+#include "isotp.h"
+#include "interfaces.h"
+
+uint8_t isotp_nrc = 0;
+uint32_t isotp_gap_us = 0;
+
+//
+// isotp_st_min_us
+//
+// Converts a flow control STmin byte to microseconds, reserved values are
+// treated as the longest separation time (127 ms).
+//
+static uint32_t isotp_st_min_us(uint8_t st_min)
+{
+    if (st_min <= 0x7F)
+        return st_min * 1000;
+    if (st_min >= 0xF1 && st_min <= 0xF9)
+        return (st_min - 0xF0) * 100;
+    return 0x7F * 1000;
+}
+
+//
+// isotp_send_frame
+//
+// Queues a frame. With a separation time it also waits until the frame is on
+// the bus and then for 'gap_us' so the next frame cannot follow too closely.
+//
+static bool isotp_send_frame(uint32_t id, uint8_t *frame, uint8_t len, uint32_t gap_us)
+{
+    if (gap_us == 0)
+        return can_send_timeout(id, (char *)frame, len, ISOTP_N_CR);
+    uint32_t ticket = can_tx_post(CANMessage(id, (char *)frame, len));
+    if (!ticket || !can_tx_wait(ticket, ISOTP_N_CR))
+        return false;
+    if (gap_us < 1000)
+        wait_us(gap_us);
+    else
+        thread_sleep_for(gap_us / 1000 + 1);            // a tick may end early, STmin is a minimum
+    return true;
+}
+
+//
+// isotp_wait_flow_control
+//
+// Waits for the receiver's flow control frame, accepting up to ISOTP_WFT_MAX WAITs.
+// A 'response pending' negative response restarts the wait with ISOTP_N_PENDING,
+// any other negative response is kept in isotp_nrc.
+//
+// return:    bool TRUE with the block size and separation time to use
+//
+static bool isotp_wait_flow_control(uint32_t RespID, uint8_t &block_size, uint32_t &gap_us)
+{
+    CANMessage msg;
+    uint32_t timeout = ISOTP_N_BS;
+    uint8_t waits = 0;
+    while (can_mailbox_wait(RespID, msg, timeout)) {
+        timeout = ISOTP_N_BS;
+        if ((msg.data[0] & 0xF0) == ISOTP_FLOW_CONTROL) {
+            switch (msg.data[0] & 0x0F) {
+                case ISOTP_FC_CTS:
+                    block_size = msg.data[1];
+                    gap_us = isotp_st_min_us(msg.data[2]);
+                    return true;
+                case ISOTP_FC_WAIT:
+                    if (++waits > ISOTP_WFT_MAX)
+                        return false;
+                    break;
+                default:                                // overflow or invalid
+                    return false;
+            }
+        } else if ((msg.data[0] & 0xF0) == ISOTP_SINGLE_FRAME && msg.data[1] == 0x7F) {
+            if (msg.data[3] != 0x78) {
+                isotp_nrc = msg.data[3];
+                return false;
+            }
+            timeout = ISOTP_N_PENDING;
+        }
+    }
+    return false;
+}
+
+//
+// isotp_send
+//
+// Sends a message, segmenting it when it does not fit in a single frame. Anything
+// left in RespID's mailbox is a late answer to an earlier request and is thrown
+// away first.
+//
+// inputs:    request id to send on, response id the flow control comes from,
+//            message and its length (up to ISOTP_MAX_LENGTH bytes)
+// return:    bool TRUE if the whole message was sent
+//
+bool isotp_send(uint32_t ReqID, uint32_t RespID, const uint8_t *data, uint16_t length)
+{
+    uint8_t frame[8];
+    isotp_nrc = 0;
+    if (length > ISOTP_MAX_LENGTH)
+        return false;
+    can_mailbox_flush(RespID);
+    if (length <= 7) {
+        frame[0] = ISOTP_SINGLE_FRAME | length;
+        memcpy(frame + 1, data, length);
+        return can_send_timeout(ReqID, (char *)frame, length + 1, ISOTP_N_CR);
+    }
+    frame[0] = ISOTP_FIRST_FRAME | (length >> 8);
+    frame[1] = length & 0xFF;
+    memcpy(frame + 2, data, 6);
+    if (!can_send_timeout(ReqID, (char *)frame, 8, ISOTP_N_CR))
+        return false;
+    uint16_t sent = 6;
+    uint8_t sequence = 1;
+    while (sent < length) {
+        uint8_t block_size;
+        uint32_t gap_us;
+        if (!isotp_wait_flow_control(RespID, block_size, gap_us))
+            return false;
+        if (gap_us < isotp_gap_us)
+            gap_us = isotp_gap_us;
+        // a block size of 0 means send everything without another flow control
+        for (uint16_t n = 0; sent < length && (block_size == 0 || n < block_size); n++) {
+            uint8_t chunk = (length - sent > 7) ? 7 : length - sent;
+            frame[0] = ISOTP_CONSECUTIVE_FRAME | (sequence++ & 0x0F);
+            memcpy(frame + 1, data + sent, chunk);
+            memset(frame + 1 + chunk, ISOTP_PADDING, 7 - chunk);
+            sent += chunk;
+            if (!isotp_send_frame(ReqID, frame, 8, (sent < length) ? gap_us : 0))
+                return false;
+        }
+    }
+    return true;
+}
+
+//
+// isotp_receive
+//
+// Waits for a message and reassembles it, sending a flow control frame that
+// lets the sender transmit all of its consecutive frames without a pause.
+//
+// inputs:    request id flow control frames are sent on, response id the message
+//            comes from, buffer and its size, time to wait for the first frame
+// return:    the message length, -1 on timeout, a lost frame, if the message
+//            doesn't fit in the buffer or if RespID has no open mailbox
+//
+int32_t isotp_receive(uint32_t ReqID, uint32_t RespID, uint8_t *buffer, uint16_t size, uint16_t timeout)
+{
+    CANMessage msg;
+    if (!can_mailbox_wait(RespID, msg, timeout))
+        return -1;
+    if ((msg.data[0] & 0xF0) == ISOTP_SINGLE_FRAME) {
+        uint8_t length = msg.data[0] & 0x0F;
+        if (length == 0 || length > 7 || length > size)
+            return -1;
+        memcpy(buffer, msg.data + 1, length);
+        return length;
+    }
+    if ((msg.data[0] & 0xF0) != ISOTP_FIRST_FRAME)
+        return -1;
+    uint16_t length = ((msg.data[0] & 0x0F) << 8) | msg.data[1];
+    uint8_t flow[8] = {ISOTP_FLOW_CONTROL | ISOTP_FC_CTS, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    if (length < 8 || length > size) {
+        flow[0] = ISOTP_FLOW_CONTROL | ISOTP_FC_OVERFLOW;
+        can_send_timeout(ReqID, (char *)flow, 8, ISOTP_N_CR);
+        return -1;
+    }
+    memcpy(buffer, msg.data + 2, 6);
+    if (!can_send_timeout(ReqID, (char *)flow, 8, ISOTP_N_CR))
+        return -1;
+    uint16_t received = 6;
+    uint8_t sequence = 1;
+    while (received < length) {
+        if (!can_mailbox_wait(RespID, msg, ISOTP_N_CR))
+            return -1;
+        if (msg.data[0] != (ISOTP_CONSECUTIVE_FRAME | (sequence++ & 0x0F)))
+            return -1;                                  // out of sequence, a frame was lost
+        uint8_t chunk = (length - received > 7) ? 7 : length - received;
+        memcpy(buffer + received, msg.data + 1, chunk);
+        received += chunk;
+    }
+    return length;
+}
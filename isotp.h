@@ -0,0 +1,41 @@
+// isotp.h - ISO 15765-2 transport layer, segmentation, reassembly and flow control
+
+#ifndef __ISOTP_H__
+#define __ISOTP_H__
+
+#include "mbed.h"
+
+#include "common.h"
+#include "canutils.h"
+
+// Protocol Control Information, high nibble of the first data byte
+#define ISOTP_SINGLE_FRAME      0x00
+#define ISOTP_FIRST_FRAME       0x10
+#define ISOTP_CONSECUTIVE_FRAME 0x20
+#define ISOTP_FLOW_CONTROL      0x30
+
+// Flow control flow status
+#define ISOTP_FC_CTS            0x00            // continue to send
+#define ISOTP_FC_WAIT           0x01
+#define ISOTP_FC_OVERFLOW       0x02
+
+#define ISOTP_MAX_LENGTH        0xFFF           // longest message a first frame can announce
+#define ISOTP_PADDING           0xAA            // fills unused bytes of the last consecutive frame
+#define ISOTP_WFT_MAX           10              // flow control WAITs accepted in a row
+
+#define ISOTP_N_BS              1000            // milliseconds to wait for a flow control
+#define ISOTP_N_CR              1000            // milliseconds to wait for a consecutive frame
+#define ISOTP_N_PENDING         5100            // milliseconds to wait after a 'response pending' reply
+
+// Negative response code from the last isotp_send that was answered with
+// a negative response instead of a flow control, 0 if there was none
+extern uint8_t isotp_nrc;
+
+// Least time in microseconds between the consecutive frames isotp_send sends,
+// used when it is longer than the receiver's STmin
+extern uint32_t isotp_gap_us;
+
+extern bool isotp_send(uint32_t ReqID, uint32_t RespID, const uint8_t *data, uint16_t length);
+extern int32_t isotp_receive(uint32_t ReqID, uint32_t RespID, uint8_t *buffer, uint16_t size, uint16_t timeout);
+
+#endif
@@ -0,0 +1,67 @@
+// lzss.cpp - incremental LZSS decoder
+//
+// Decompresses as many bytes as the caller asks for at a time, the window
+// holds the history matches copy from so the output does not have to be kept.
+
+#include "lzss.h"
+
+//
+// lzss_init
+//
+// Starts decompressing 'length' bytes of compressed data at 'src'.
+//
+void lzss_init(lzss_t *lz, const uint8_t *src, uint32_t length)
+{
+    lz->src = src;
+    lz->end = src + length;
+    lz->flags = 0;
+    lz->items = 0;
+    lz->offset = 0;
+    lz->length = 0;
+    lz->pos = 0;
+}
+
+//
+// lzss_read
+//
+// inputs:    decoder, buffer for the decompressed bytes and its size
+// return:    the number of bytes decompressed, less than 'size' only at the
+//            end of the data
+//
+uint16_t lzss_read(lzss_t *lz, uint8_t *dst, uint16_t size)
+{
+    uint16_t count = 0;
+    while (count < size) {
+        if (lz->length) {
+            uint8_t byte = lz->window[(lz->pos - lz->offset) & (LZSS_WINDOW - 1)];
+            lz->window[lz->pos] = byte;
+            lz->pos = (lz->pos + 1) & (LZSS_WINDOW - 1);
+            dst[count++] = byte;
+            lz->length--;
+            continue;
+        }
+        if (!lz->items) {
+            if (lz->src >= lz->end)
+                break;
+            lz->flags = *lz->src++;
+            lz->items = 8;
+        }
+        if (lz->src >= lz->end)
+            break;
+        if (lz->flags & 0x01) {
+            uint8_t byte = *lz->src++;
+            lz->window[lz->pos] = byte;
+            lz->pos = (lz->pos + 1) & (LZSS_WINDOW - 1);
+            dst[count++] = byte;
+        } else {
+            if (lz->end - lz->src < 2)
+                break;
+            lz->offset = (lz->src[0] | ((lz->src[1] >> LZSS_LENGTH_BITS) << 8)) + 1;
+            lz->length = (lz->src[1] & ((1 << LZSS_LENGTH_BITS) - 1)) + LZSS_MIN_MATCH;
+            lz->src += 2;
+        }
+        lz->flags >>= 1;
+        lz->items--;
+    }
+    return count;
+}
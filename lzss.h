@@ -0,0 +1,32 @@
+// lzss.h - incremental LZSS decoder for data compressed by tools/t8blobpack.py
+
+#ifndef __LZSS_H__
+#define __LZSS_H__
+
+#include "mbed.h"
+
+#include "common.h"
+
+// A flag byte comes before every 8 items, LSB first: a set bit is a literal
+// byte, a clear bit a 2 byte match of (offset - 1) and (length - LZSS_MIN_MATCH),
+// offset in the low 8 bits of the first byte and the top bits of the second.
+#define LZSS_OFFSET_BITS        10
+#define LZSS_LENGTH_BITS        6
+#define LZSS_MIN_MATCH          3
+#define LZSS_WINDOW             (1 << LZSS_OFFSET_BITS)
+
+typedef struct {
+    const uint8_t *src;
+    const uint8_t *end;
+    uint8_t flags;                              // flags of the current group of items
+    uint8_t items;                              // items left in the group
+    uint16_t offset;                            // of the match being copied
+    uint8_t length;                             // bytes of the match still to copy
+    uint16_t pos;                               // next byte in the window
+    uint8_t window[LZSS_WINDOW];                // the bytes decompressed last
+} lzss_t;
+
+extern void lzss_init(lzss_t *lz, const uint8_t *src, uint32_t length);
+extern uint16_t lzss_read(lzss_t *lz, uint8_t *dst, uint16_t size);
+
+#endif
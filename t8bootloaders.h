@@ -1,4790 +1,1554 @@
 #ifndef __T8BOOTLOADERS_H__
 #define __T8BOOTLOADERS_H__
 
-//0x77ED eor 0x4739 = 0x30D4 12,500 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x77,0xED,0x39,0x32,0x66,0x11,
-//0x6029 eor 0x4739 = 0x2710 10,000 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x60,0x29,0x39,0x32,0x66,0x11,
-//0x5A75 eor 0x4739 = 0x1D4C 7,500 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x5A,0x75,0x39,0x32,0x66,0x11,
-//0x54B1 eor 0x4739 = 0x1388 5,000 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x54,0xB1,0x39,0x32,0x66,0x11,
-//0x4EFD eor 0x4739 = 0x09C4 2,500 0.909 ms with 5.5 MHz Clock
-//    0x11,0x4E,0xFD,0x39,0x32,0x66,0x11,
+// Generated by tools/t8blobpack.py from tools/t8bootloaders_raw.h, do not edit.
+// LZSS compressed T8 bootloader utility files, see lzss.h
+
 #define T8_BOOTLOADER_PROG {\
-    0x77,0xD1,0x77,0x7D,0x1B,0x09,0x77,\
-    0xD1,0x77,0x7D,0x1B,0x7D,0x77,0x1D,\
-    0x39,0x1C,0x05,0x00,0x39,0x78,0x0B,\
-    0x61,0x05,0x80,0x39,0x78,0x0B,0x7D,\
-    0x05,0x80,0x39,0x78,0x1B,0x6D,0x05,\
-    0x00,0x39,0x78,0x0C,0x99,0x37,0x38,\
-    0x2A,0xA8,0x77,0x7D,0x3C,0xCC,0x7B,\
-    0x51,0x77,0x7D,0x3C,0xC1,0x2A,0xA8,\
-    0x77,0x7D,0x3C,0xC0,0x7B,0x51,0x77,\
-    0x7D,0x23,0x39,0x7B,0x51,0x77,0x7D,\
-    0x2C,0xC4,0x7B,0x51,0x77,0x7D,0x2C,\
-    0xC7,0x7B,0x51,0x77,0x7D,0x23,0x3D,\
-    0x7B,0x11,0x77,0x7D,0x23,0x3B,0x77,\
-    0x1D,0x17,0x93,0x09,0x4C,0x77,0x3E,\
-    0x88,0xBD,0x0F,0xDE,0x36,0x54,0x5D,\
-    0x11,0x47,0x29,0x5D,0x6E,0x35,0x38,\
-    0x7D,0x05,0x32,0xD0,0x39,0xD4,0x47,\
-    0x29,0x65,0x58,0x39,0xD4,0x47,0x29,\
-    0x65,0x2C,0x49,0x78,0x15,0x7E,0x03,\
-    0xEF,0xC9,0x28,0x22,0xD3,0x58,0x68,\
-    0x88,0xE9,0x09,0x80,0x39,0x78,0x43,\
-    0xBD,0x09,0x80,0x39,0x78,0x2E,0x3D,\
-    0x3D,0x38,0x2A,0xAD,0x77,0x7D,0x2C,\
-    0xC4,0x2A,0xAD,0x77,0x7D,0x2C,0xC7,\
-    0x11,0x54,0x77,0x7D,0x3C,0xC1,0x1D,\
-    0x14,0x77,0x7D,0x3C,0xCD,0x73,0x7A,\
-    0x10,0x6D,0x47,0xD9,0x73,0x51,0x77,\
-    0x7D,0x3C,0xCC,0x5F,0x68,0x77,0xBB,\
-    0x09,0x80,0x39,0x78,0x2B,0x5D,0x09,\
-    0x80,0x39,0x78,0x2B,0x29,0x57,0x00,\
-    0x39,0x78,0x6F,0x6C,0xF7,0x05,0x39,\
-    0x0D,0x10,0x63,0xF7,0x05,0x39,0x0E,\
-    0x10,0x7F,0xF7,0x05,0x39,0x0F,0x10,\
-    0x7B,0x27,0x27,0x00,0x36,0x43,0x36,\
-    0x2A,0x94,0x77,0x6C,0x47,0x29,0x45,\
-    0x76,0x17,0x77,0x54,0xC5,0x39,0x6A,\
-    0x77,0x7D,0x3B,0x27,0x59,0x78,0x64,\
-    0x91,0x47,0x3A,0x39,0x78,0x0B,0x73,\
-    0x27,0x3F,0x7B,0x51,0x77,0x7D,0x3B,\
-    0x27,0x77,0xD1,0x77,0x7D,0x74,0x79,\
-    0x16,0x54,0x77,0x7D,0x3B,0x24,0x16,\
-    0x54,0x77,0x7D,0x3B,0x21,0x49,0x6D,\
-    0x58,0x6D,0x37,0x35,0x16,0x68,0x39,\
-    0xD4,0x47,0x29,0x17,0x2C,0x4D,0xD1,\
-    0x47,0x3D,0x76,0x87,0x77,0x7D,0x0D,\
-    0x00,0x39,0x78,0x13,0x6D,0x21,0x6B,\
-    0x45,0x61,0x51,0x11,0x47,0x29,0x5D,\
-    0x6A,0x5F,0x11,0x47,0x29,0x5D,0x68,\
-    0x07,0x6D,0x77,0x2C,0x16,0x68,0x47,\
-    0x7E,0x0F,0xF9,0x16,0x68,0x39,0xD4,\
-    0x47,0x29,0x73,0x00,0x5D,0x6D,0x5F,\
-    0xBC,0x07,0x7D,0x25,0x2A,0x7D,0xBE,\
-    0x69,0xE7,0xC9,0x2B,0x23,0x3D,0x73,\
-    0x6D,0x10,0xB7,0x0D,0x00,0x39,0x78,\
-    0x13,0x6D,0x21,0x2F,0x49,0x6F,0x58,\
-    0x6D,0x37,0x38,0x16,0x68,0x39,0xD4,\
-    0x47,0x29,0x73,0x00,0x64,0xAD,0x47,\
-    0x29,0x5D,0x68,0x27,0xE2,0x54,0xC5,\
-    0x39,0x69,0x77,0x7D,0x3C,0xCC,0x19,\
-    0x2C,0x3D,0x7D,0x20,0x7D,0x73,0x51,\
-    0x77,0x7D,0x3C,0xC0,0x5F,0x54,0x3D,\
-    0x54,0x47,0x29,0x5D,0x68,0x11,0x59,\
-    0x68,0x00,0x39,0x78,0x0C,0x91,0x68,\
-    0x00,0x39,0x78,0x0B,0x69,0x68,0x00,\
-    0x39,0x78,0x0B,0x65,0x77,0x00,0x39,\
-    0x78,0x13,0x6F,0x0F,0xF9,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x73,0xC0,0x64,\
-    0xAD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x5D,0x68,0x64,0x91,0x47,0x38,0x39,\
-    0x78,0x0C,0x94,0x08,0xD6,0x39,0x78,\
-    0x39,0xD4,0x47,0x29,0x65,0x58,0x39,\
-    0xD4,0x47,0x29,0x65,0x2C,0x3D,0x54,\
-    0x47,0x29,0x42,0x91,0x10,0x6D,0x47,\
-    0x8B,0x73,0x51,0x77,0x7D,0x3B,0x35,\
-    0x5E,0x68,0x77,0xC5,0x0D,0x00,0x39,\
-    0x78,0x13,0x69,0x21,0x39,0x39,0xF6,\
-    0x39,0xD4,0x47,0x29,0x0A,0x28,0x39,\
-    0xD4,0x47,0x29,0x16,0x88,0x64,0x91,\
-    0x47,0x38,0x39,0x78,0x13,0x69,0x09,\
-    0x80,0x39,0x78,0x46,0x59,0x0F,0x57,\
-    0xC6,0x93,0x3F,0x03,0xB8,0xC5,0x49,\
-    0x6B,0x58,0x6D,0x37,0x27,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x17,0x2C,0x38,\
-    0x82,0x47,0x29,0x73,0x46,0x88,0x96,\
-    0x20,0x5B,0x71,0x06,0x88,0x8A,0x0F,\
-    0x57,0xC6,0x80,0x07,0x7F,0x68,0x39,\
-    0x49,0x65,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x59,0x29,0x08,0xD6,0x39,0x78,\
-    0x3D,0x43,0xB8,0xDE,0x5E,0x2A,0x0B,\
-    0x6D,0x39,0x39,0x43,0x78,0x05,0x6D,\
-    0x75,0x3E,0x29,0x5E,0x6F,0x87,0xFA,\
-    0x39,0x24,0xE8,0x6F,0xB9,0x9B,0x05,\
-    0x39,0x79,0x25,0x2A,0xF9,0x7C,0x5C,\
-    0x80,0x4D,0xEA,0x68,0x05,0x39,0x6B,\
-    0x08,0x9D,0x0F,0x57,0xC6,0xBC,0x07,\
-    0x7D,0x68,0x39,0x49,0x69,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x3D,0xC5,0x54,\
-    0xF9,0x39,0x78,0x13,0x6D,0x08,0xD6,\
-    0x39,0x78,0x3D,0x54,0x47,0x29,0x45,\
-    0x64,0x10,0x6D,0xB9,0x3D,0x19,0x51,\
-    0x77,0x7D,0x3B,0x29,0x89,0xD1,0x77,\
-    0x7D,0x2B,0x39,0x00,0x36,0x43,0x36,\
-    0x5D,0x68,0x8A,0x85,0x0D,0x00,0x39,\
-    0x78,0x13,0x69,0x20,0x39,0xC4,0xB6,\
-    0x3D,0x54,0x47,0x29,0x5D,0x68,0x11,\
-    0x6D,0xBA,0xED,0x77,0xD1,0x77,0x7D,\
-    0x75,0x59,0x77,0xD1,0x77,0x7D,0x1C,\
-    0xE9,0x59,0x68,0x8A,0xA9,0x6F,0x26,\
-    0x13,0x77,0x5B,0x72,0x69,0x26,0x1D,\
-    0x37,0x51,0x32,0x6F,0x66,0x13,0x37,\
-    0x39,0x33,0x09,0x4C,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x71,0x8F,0x74,0x71,\
-    0x6D,0x56,0x39,0x70,0x51,0x02,0x47,\
-    0x25,0x11,0x07,0x77,0x4D,0x65,0x56,\
-    0x39,0x4C,0x3D,0x38,0x21,0x3D,0x49,\
-    0x69,0x17,0x25,0x65,0x35,0x17,0x79,\
-    0x0B,0x6C,0x8B,0xBE,0x73,0xEE,0x10,\
-    0x67,0x14,0xBE,0x1B,0xEF,0x57,0x2A,\
-    0x5F,0xA9,0x6B,0x3D,0x59,0x6B,0xFB,\
-    0x6C,0x5D,0x78,0x5F,0x2C,0x9E,0xFF,\
-    0x21,0xB3,0x25,0xEA,0x37,0x39,0x09,\
-    0x7D,0xC9,0xED,0x22,0xCD,0x05,0x7D,\
-    0x7F,0x6B,0x47,0x39,0x5E,0x7A,0x07,\
-    0x6D,0x77,0x3F,0x15,0x68,0x57,0x2C,\
-    0x96,0xFF,0x1B,0x39,0xA4,0xAB,0x57,\
-    0xA8,0x6B,0x3D,0x07,0x6D,0x6B,0x26,\
-    0x17,0x77,0x51,0x32,0x6F,0x66,0x13,\
-    0x37,0x39,0x18,0x4B,0x16,0x39,0x96,\
-    0x77,0x6A,0x21,0x25,0x0A,0x94,0x77,\
-    0x6F,0x47,0x29,0x5D,0x7C,0x07,0x6D,\
-    0x57,0x16,0x39,0x63,0x44,0xAD,0x47,\
-    0x29,0x5D,0x60,0x7F,0x94,0x47,0x3C,\
-    0x39,0x78,0x13,0x61,0x09,0x4C,0x77,\
-    0x19,0x44,0x82,0x47,0x3F,0x39,0x78,\
-    0x13,0x65,0x4F,0xC0,0x39,0x6D,0x77,\
-    0x7D,0x23,0x35,0x00,0x36,0x43,0x36,\
-    0x7B,0x11,0x77,0x7D,0x23,0x2D,0x77,\
-    0x1D,0x57,0x11,0x47,0x29,0x5D,0x64,\
-    0x35,0x7D,0x05,0x11,0x39,0x69,0x35,\
-    0x45,0x47,0x3B,0x31,0xB8,0x77,0x69,\
-    0x4F,0xE9,0x39,0x68,0x7F,0xBD,0x47,\
-    0x3F,0x7B,0x11,0x77,0x7D,0x23,0x29,\
-    0x7B,0x51,0x77,0x7D,0x23,0x36,0x19,\
-    0x14,0x77,0x7D,0x23,0x21,0x29,0xD4,\
-    0x77,0x54,0x56,0x45,0x39,0x00,0x77,\
-    0x6C,0x56,0x45,0x39,0x1F,0x77,0x6F,\
-    0x56,0x45,0x39,0x05,0x77,0x6E,0x56,\
-    0x45,0x39,0x2F,0x77,0x69,0x05,0x00,\
-    0x39,0x78,0x13,0x70,0x09,0x4C,0x77,\
-    0x19,0x58,0x6A,0x79,0x16,0x39,0x62,\
-    0x7F,0x54,0x47,0x3B,0x39,0x78,0x13,\
-    0x67,0x21,0x39,0x39,0xBE,0x47,0x6A,\
-    0x05,0x39,0x89,0x14,0x75,0x6D,0x20,\
-    0x33,0x89,0x14,0x74,0x6D,0x20,0x75,\
-    0x59,0x68,0x77,0xAF,0x37,0x39,0x29,\
-    0x6F,0x3D,0x2D,0x20,0x39,0x39,0xD0,\
-    0x57,0x11,0x47,0x29,0x5D,0x40,0x66,\
-    0x3D,0x47,0x38,0x29,0xD4,0x77,0x12,\
-    0x56,0x79,0x39,0x6A,0x58,0x65,0x37,\
-    0x3A,0x16,0x68,0x39,0xD4,0x47,0x29,\
-    0x07,0xC0,0x05,0x6D,0x55,0x39,0x19,\
-    0x69,0x92,0xE5,0x87,0x05,0x39,0x6C,\
-    0x75,0x54,0x47,0xC2,0x39,0x78,0x13,\
-    0x67,0xC6,0x00,0x39,0x78,0x13,0x67,\
-    0x17,0xB6,0x59,0x68,0x77,0x17,0x37,\
-    0x39,0x29,0x6F,0x3D,0x2D,0x20,0x07,\
-    0x19,0x14,0x77,0x7D,0x23,0x11,0x39,\
-    0x78,0x77,0x2D,0x56,0x79,0x39,0x69,\
-    0x58,0x65,0x37,0x39,0x29,0x51,0x77,\
-    0x7D,0x23,0x30,0x00,0x36,0x43,0x36,\
-    0x16,0x68,0x39,0xD4,0x47,0x29,0x07,\
-    0xC0,0x05,0x6D,0x55,0x39,0x19,0x69,\
-    0x92,0xE5,0x87,0x05,0x39,0x6C,0x75,\
-    0x54,0x47,0xC2,0x39,0x78,0x13,0x67,\
-    0xC6,0x00,0x39,0x78,0x13,0x67,0x17,\
-    0xB6,0x59,0x5A,0x57,0x11,0x47,0x29,\
-    0x5D,0x40,0x77,0x7D,0x47,0x79,0x16,\
-    0x60,0x07,0x6C,0x68,0x39,0x77,0xD1,\
-    0x77,0x7D,0x79,0x91,0x4B,0x68,0x65,\
-    0x6D,0x67,0x38,0xDC,0xE0,0xB7,0x51,\
-    0x47,0x3D,0x3B,0x51,0x77,0x96,0x47,\
-    0x29,0x5D,0x62,0xF6,0x54,0x47,0x29,\
-    0x5D,0x62,0x27,0xE2,0x69,0x26,0x77,\
-    0x1D,0x39,0x1C,0x65,0x45,0x39,0x78,\
-    0x13,0x61,0x4F,0x10,0x39,0x6D,0x77,\
-    0x6C,0x20,0x39,0x38,0x2A,0x67,0x54,\
-    0x47,0x29,0x5D,0x67,0xC7,0x51,0x47,\
-    0x0D,0x5E,0x64,0xC7,0x51,0x47,0x0F,\
-    0x5E,0x68,0x77,0xFB,0x27,0x39,0x38,\
-    0x42,0x3D,0x54,0x47,0x29,0x5D,0x68,\
-    0x10,0x49,0x4F,0x80,0x39,0x6A,0x77,\
-    0x7D,0x23,0x33,0x2A,0x94,0x77,0x59,\
-    0x47,0x29,0x5D,0x40,0x7F,0xC4,0x47,\
-    0x3C,0x39,0x69,0x3F,0x15,0x45,0xBC,\
-    0x58,0x68,0x89,0xA5,0x1F,0xB6,0x59,\
-    0x68,0x77,0x93,0x0D,0x00,0x39,0x78,\
-    0x0C,0x98,0x20,0x0B,0x73,0x11,0x77,\
-    0x7D,0x23,0x2B,0x5E,0x42,0x7F,0xD4,\
-    0x47,0x3B,0x39,0x78,0x13,0x67,0x54,\
-    0xC5,0x39,0x5C,0x77,0x7D,0x23,0x11,\
-    0x31,0xC1,0x77,0x68,0x47,0x38,0x7B,\
-    0x11,0x77,0x7D,0x23,0x2B,0x71,0x10,\
-    0x74,0x6D,0x26,0x39,0xC7,0xE6,0x2F,\
-    0xE2,0x27,0x39,0x00,0x36,0x43,0x36,\
-    0x39,0xAC,0x47,0x54,0x47,0x29,0x5D,\
-    0x7A,0x25,0x2D,0x74,0xF9,0x39,0x78,\
-    0x13,0x7F,0xF7,0x45,0x3B,0xE8,0x14,\
-    0x6D,0x47,0x97,0x31,0xD1,0x77,0x6F,\
-    0x47,0x29,0x5D,0x62,0x64,0x91,0x47,\
-    0x0D,0x39,0x78,0x13,0x45,0x27,0x39,\
-    0x39,0xE2,0x3D,0x54,0x47,0x29,0x5D,\
-    0x68,0x10,0x49,0x4F,0x80,0x39,0x6A,\
-    0x77,0x7D,0x23,0x33,0x2A,0x94,0x77,\
-    0x5B,0x47,0x29,0x5D,0x40,0x7F,0xC4,\
-    0x47,0x3C,0x39,0x69,0x3F,0x15,0x45,\
-    0xBC,0x58,0x68,0x89,0x55,0x1F,0xB6,\
-    0x59,0x68,0x77,0x03,0x0D,0x00,0x39,\
-    0x78,0x0C,0x94,0x20,0x09,0x73,0x11,\
-    0x77,0x7D,0x23,0x2B,0x5E,0x40,0x7F,\
-    0xD4,0x47,0x3B,0x39,0x78,0x13,0x67,\
-    0x54,0xC5,0x39,0x5E,0x77,0x7D,0x23,\
-    0x11,0x31,0xC1,0x77,0x68,0x47,0x38,\
-    0x7B,0x11,0x77,0x7D,0x23,0x2B,0x71,\
-    0x10,0x74,0x6D,0x26,0x39,0xC4,0x96,\
-    0x2F,0xE2,0x27,0x0D,0x09,0x51,0x77,\
-    0x7D,0x23,0x2B,0x6B,0x28,0x44,0xAD,\
-    0x47,0x29,0x5D,0x7A,0xC7,0x11,0x45,\
-    0xB9,0x5A,0x48,0x7F,0xD4,0x47,0x3B,\
-    0x39,0x78,0x13,0x67,0x54,0xC5,0x39,\
-    0x5E,0x77,0x7D,0x23,0x11,0x7B,0x11,\
-    0x77,0x7D,0x23,0x2B,0x71,0x10,0x75,\
-    0x15,0x26,0x39,0xC4,0xA0,0x2F,0xE2,\
-    0x09,0x4C,0x77,0x19,0x16,0x6D,0xB9,\
-    0x93,0x77,0x1D,0x39,0x1C,0x77,0x00,\
-    0x39,0x78,0x13,0x65,0x14,0x79,0x5E,\
-    0x6E,0x47,0x51,0x45,0x2B,0x59,0x40,\
-    0x07,0x4D,0x97,0x80,0x39,0x78,0x1B,\
-    0x6D,0x64,0xF9,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x0B,0x7D,0x54,0xC5,0x39,\
-    0x69,0x77,0x7D,0x3B,0x35,0x31,0xD1,\
-    0x77,0x6B,0x47,0x29,0x5D,0x64,0x35,\
-    0x14,0x47,0x29,0x5D,0x78,0x47,0x51,\
-    0x44,0x39,0x77,0x1D,0x39,0x1C,0x77,\
-    0x00,0x39,0x78,0x13,0x65,0x1A,0x79,\
-    0x5F,0x60,0x3D,0x14,0x47,0x29,0x5D,\
-    0x7C,0x10,0x6B,0x77,0x05,0x3B,0x7A,\
-    0x17,0x57,0x67,0x45,0x39,0x78,0x13,\
-    0x61,0x4F,0xD1,0x39,0x6D,0x77,0x6F,\
-    0x4F,0xD1,0x39,0x6C,0x77,0x6F,0x54,\
-    0xC5,0x39,0x5C,0x77,0x7D,0x23,0x36,\
-    0x0A,0x94,0x75,0x13,0x47,0x29,0x5D,\
-    0x7A,0x7F,0x85,0x47,0x3C,0x39,0x69,\
-    0x64,0x91,0x47,0x38,0x39,0x78,0x0C,\
-    0x99,0x05,0x00,0x39,0x78,0x0C,0x98,\
-    0x77,0x05,0x38,0x68,0x39,0x18,0x09,\
-    0x6F,0xC6,0x90,0x58,0x60,0x68,0x3E,\
-    0x31,0x51,0x77,0x68,0x47,0x29,0x5D,\
-    0x66,0x11,0x65,0x77,0x05,0x3B,0x4A,\
-    0x17,0x6D,0x46,0x09,0x1B,0x14,0x77,\
-    0x7D,0x23,0x11,0x29,0x41,0x77,0x6C,\
-    0x0D,0x39,0x5E,0x7A,0xC7,0x51,0x47,\
-    0xB9,0x5E,0x6C,0x17,0x6D,0x46,0x2D,\
-    0x09,0x54,0x75,0x7F,0x27,0x39,0x38,\
-    0x78,0x7F,0x94,0x47,0x3A,0x39,0x78,\
-    0x13,0x63,0x5A,0x50,0x39,0x6A,0x88,\
-    0x91,0x5A,0x50,0x39,0x6B,0x88,0x90,\
-    0x5A,0x50,0x39,0x6C,0x88,0x93,0x5A,\
-    0x50,0x39,0x6D,0x88,0x92,0x79,0x00,\
-    0x39,0x78,0x13,0x65,0xF9,0x45,0x39,\
-    0x6E,0x14,0x6D,0x47,0xE1,0x09,0x54,\
-    0x88,0x97,0x97,0x7E,0x04,0x28,0x88,\
-    0x97,0x74,0xD7,0x00,0x36,0x43,0x36,\
-    0xC6,0x92,0x77,0x7D,0x3C,0xCF,0x31,\
-    0x51,0x77,0x69,0x47,0x29,0x5D,0x66,\
-    0x10,0x35,0x39,0x3F,0x49,0x68,0x47,\
-    0x54,0x47,0x29,0x42,0x9E,0x2B,0xED,\
-    0x1A,0xB9,0x56,0x20,0x58,0x6B,0x5B,\
-    0x00,0x39,0x78,0x13,0x70,0x35,0x3C,\
-    0x19,0x14,0x77,0x7D,0x3C,0xCF,0x13,\
-    0x14,0x77,0x7D,0x23,0x21,0x85,0x69,\
-    0x11,0x6B,0x3B,0x39,0x49,0x68,0x17,\
-    0x6B,0x37,0x39,0x29,0x6E,0x25,0x6B,\
-    0x57,0x0C,0x31,0x68,0xC6,0x5C,0x3F,\
-    0x39,0x19,0x6F,0x25,0x2D,0x39,0x39,\
-    0x07,0x68,0x07,0x6D,0x77,0x29,0x65,\
-    0xE8,0xC9,0xED,0x2A,0xEF,0x2A,0xAE,\
-    0x77,0x7D,0x23,0x24,0x15,0x77,0x54,\
-    0x83,0xB8,0xC5,0x39,0x78,0x0C,0x91,\
-    0x6D,0x45,0x39,0x78,0x03,0x4D,0x68,\
-    0x05,0x39,0x78,0x0C,0x91,0x68,0x34,\
-    0x71,0x01,0x77,0x6B,0x0F,0x57,0xC6,\
-    0x92,0x16,0x6D,0xBC,0x11,0x1A,0xA5,\
-    0x77,0x7D,0x3B,0x3D,0x49,0x68,0x47,\
-    0x43,0xB8,0xC3,0x1A,0xA8,0x77,0x7D,\
-    0x3B,0x31,0x2A,0x94,0x77,0x5B,0x47,\
-    0x29,0x5D,0x67,0x35,0x14,0x47,0x29,\
-    0x5D,0x7A,0x7F,0x94,0x47,0x3C,0x39,\
-    0x78,0x13,0x60,0x54,0xC5,0x39,0x69,\
-    0x77,0x7D,0x3C,0xC1,0x7B,0x51,0x77,\
-    0x7D,0x3C,0xC0,0x09,0x54,0x76,0x6D,\
-    0x08,0xD6,0x39,0x78,0x17,0x67,0x77,\
-    0x05,0x3A,0x68,0x17,0x69,0x77,0x05,\
-    0x3B,0x7A,0x59,0x72,0x6D,0x66,0x77,\
-    0x36,0x39,0x18,0x68,0x34,0x16,0x6F,\
-    0x5D,0x11,0x47,0x29,0x5D,0x64,0x7F,\
-    0x78,0x47,0x3F,0x00,0x36,0x43,0x36,\
-    0x5E,0x4C,0x49,0x54,0x47,0x29,0x5D,\
-    0x78,0x25,0x2A,0x74,0xFE,0x39,0x78,\
-    0x13,0x7D,0xF9,0x45,0x3A,0x48,0x12,\
-    0x7D,0x4F,0xAC,0x39,0x6E,0x35,0x14,\
-    0x47,0x29,0x5D,0x78,0x39,0xD4,0x47,\
-    0x29,0x62,0xB8,0x7F,0x78,0x47,0x3C,\
-    0x5E,0x68,0x76,0x7B,0x4F,0xAC,0x39,\
-    0x6D,0x7F,0xD4,0x47,0x3B,0x39,0x78,\
-    0x13,0x67,0x6D,0x45,0x39,0x78,0x13,\
-    0x45,0x57,0x2C,0x89,0x54,0x77,0x5B,\
-    0x25,0x27,0x5E,0x68,0x77,0xE5,0xF7,\
-    0x05,0x39,0x72,0x10,0x45,0xF7,0x05,\
-    0x39,0x48,0x10,0x6D,0x47,0x5F,0x89,\
-    0x54,0x77,0x59,0x20,0x39,0x39,0x00,\
-    0x17,0x6D,0x47,0xEB,0x89,0x54,0x77,\
-    0x56,0x20,0x39,0x39,0x18,0xC7,0x51,\
-    0x47,0x07,0x5E,0x68,0x77,0xF5,0x27,\
-    0x39,0x39,0xD6,0x49,0x54,0x47,0x29,\
-    0x5D,0x60,0xC9,0x11,0x47,0x3B,0x5E,\
-    0x6E,0x49,0x51,0x45,0x2B,0x59,0x46,\
-    0x65,0x40,0x47,0x38,0x49,0x68,0x67,\
-    0x6C,0xF7,0x85,0x39,0x68,0x77,0xDD,\
-    0x21,0x23,0x22,0x14,0x77,0x7C,0x47,\
-    0x3B,0x09,0x6F,0x25,0x2D,0x74,0xF9,\
-    0x39,0x78,0x13,0x65,0x39,0x39,0x27,\
-    0x69,0xF9,0x11,0x44,0x39,0x59,0x6C,\
-    0x49,0x51,0x45,0x08,0x59,0x68,0x77,\
-    0x13,0x26,0x39,0xC4,0x3A,0x59,0x6D,\
-    0x27,0x39,0x39,0x1C,0x16,0x6D,0xBA,\
-    0xBD,0x17,0x68,0x17,0x6D,0x47,0x53,\
-    0x58,0x68,0x8A,0xA3,0x69,0x39,0x59,\
-    0x68,0x77,0x0D,0x37,0x39,0x29,0x45,\
-    0x77,0x6C,0x35,0x29,0x8B,0xE8,0x11,\
-    0x67,0x09,0x80,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x44,0xAD,0x0D,0x39,0x5F,\
-    0x6E,0x49,0x51,0x45,0x2B,0x59,0x7A,\
-    0x44,0x91,0x47,0x3B,0x39,0x78,0x13,\
-    0x65,0x39,0x39,0x27,0x45,0x77,0x6C,\
-    0xC9,0x45,0x3A,0x68,0x17,0x43,0x77,\
-    0x00,0x39,0x78,0x13,0x65,0x14,0x79,\
-    0x5F,0x72,0x35,0x14,0x47,0x29,0x5D,\
-    0x78,0x3D,0x14,0x47,0x29,0x5D,0x7C,\
-    0x11,0x6B,0x79,0x05,0x3A,0x68,0x17,\
-    0x67,0x79,0x05,0x38,0x68,0x17,0x69,\
-    0x79,0x05,0x3B,0x7A,0x17,0x69,0x79,\
-    0x05,0x3B,0x79,0x58,0x6A,0x26,0x39,\
-    0xC3,0xE4,0x2F,0xE2,0x69,0x26,0x13,\
-    0x37,0x39,0x18,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x67,0x05,0xC6,0x96,0x77,\
-    0x6D,0x97,0x96,0x39,0x6C,0xC7,0xD1,\
-    0x47,0x34,0x39,0x68,0x24,0xAD,0x87,\
-    0x85,0x39,0x68,0x77,0x6C,0x09,0x4C,\
-    0x77,0x19,0x58,0x6A,0x68,0x3F,0x16,\
-    0x6D,0x5D,0x42,0x47,0x29,0x1B,0x47,\
-    0x77,0x79,0xFD,0xB8,0x5C,0x6C,0x07,\
-    0x92,0x27,0x79,0x47,0x68,0x57,0x28,\
-    0x6B,0x38,0xA5,0xED,0x93,0xE3,0x67,\
-    0x38,0xA9,0x6D,0x05,0x6E,0x85,0x39,\
-    0x73,0xEE,0x10,0x7D,0x3D,0xC6,0xE7,\
-    0xF8,0xC9,0xE8,0x21,0x3B,0x47,0x68,\
-    0x2F,0xE5,0x14,0xBF,0x5F,0x9A,0x3D,\
-    0x6C,0x20,0x2D,0x45,0x97,0x07,0x6D,\
-    0x57,0x29,0xE7,0xE8,0xC9,0xEB,0x21,\
-    0x3B,0x47,0x68,0x25,0xE5,0x14,0x38,\
-    0x5F,0x86,0x57,0x6A,0x6D,0x26,0x15,\
-    0x77,0x59,0x72,0x09,0x4C,0x77,0x19,\
-    0x58,0x6A,0x65,0x16,0x39,0x60,0x57,\
-    0x42,0x47,0x35,0x00,0x36,0x43,0x36,\
-    0x47,0x68,0xE7,0xEC,0x67,0x78,0x73,\
-    0xE8,0x10,0x49,0x65,0x39,0x31,0x68,\
-    0x77,0x6D,0x20,0x33,0x47,0x68,0x69,\
-    0x75,0x65,0x39,0x6A,0xE9,0x10,0x7F,\
-    0xA5,0xB0,0x49,0x68,0x67,0x75,0x99,\
-    0xB9,0x49,0x68,0x67,0x75,0x99,0xB9,\
-    0x6A,0xE9,0x11,0x9D,0x67,0x3E,0x17,\
-    0x77,0x39,0x18,0x09,0x48,0x71,0x8F,\
-    0x70,0x41,0x5D,0x16,0x39,0x77,0x6B,\
-    0x42,0x47,0x1A,0x13,0x07,0x77,0x49,\
-    0x63,0x56,0x39,0x40,0x35,0x7F,0x69,\
-    0x00,0x39,0x6A,0x76,0x2D,0x67,0x05,\
-    0xC6,0x96,0x77,0x6D,0x97,0xBE,0x89,\
-    0xD4,0x77,0x60,0x47,0x39,0x5B,0x68,\
-    0x77,0xBB,0x6F,0x40,0x39,0x6A,0x76,\
-    0x2D,0x57,0x00,0x39,0x78,0x13,0x4D,\
-    0x20,0x3D,0x47,0x9C,0x17,0x6F,0x39,\
-    0xC6,0x2B,0x44,0x77,0x6C,0x0D,0x39,\
-    0x5E,0x64,0xA5,0x51,0x47,0xEF,0x33,\
-    0x69,0x77,0x4C,0x27,0x39,0x39,0x6A,\
-    0xC5,0x6A,0x20,0x39,0x39,0xC0,0x58,\
-    0x66,0x61,0x45,0x39,0x78,0x13,0x4D,\
-    0x59,0x15,0x39,0x69,0x3D,0x7E,0x20,\
-    0x35,0xE7,0x54,0x77,0xBB,0x4D,0x3E,\
-    0x39,0x49,0x17,0x6D,0x47,0x3B,0x87,\
-    0x6D,0x11,0x2B,0x37,0x39,0x29,0x6E,\
-    0x58,0x6D,0x68,0x35,0x16,0x65,0x39,\
-    0xD4,0x47,0x29,0x0D,0x98,0x38,0x82,\
-    0x47,0x35,0x2B,0x7B,0x10,0x47,0x39,\
-    0x39,0x73,0x6E,0x10,0x49,0x57,0x0C,\
-    0x41,0x68,0x3D,0x6C,0x20,0x35,0xE9,\
-    0x54,0x77,0xBB,0x4D,0x39,0x39,0x49,\
-    0x17,0x6D,0x47,0x3B,0x22,0xE8,0x0F,\
-    0x6D,0x67,0x3E,0x00,0x36,0x43,0x36,\
-    0x6B,0x68,0x09,0x6D,0x59,0x39,0x85,\
-    0x6F,0x15,0xB1,0x53,0x85,0x39,0x69,\
-    0x65,0x79,0x59,0x2A,0x5E,0x64,0xA5,\
-    0x51,0x47,0xEF,0x33,0x69,0x77,0x4C,\
-    0x27,0x39,0x39,0x6A,0x07,0x6D,0x57,\
-    0x38,0x70,0x9C,0x7F,0x6F,0x0D,0x3E,\
-    0x5E,0x6C,0x07,0x99,0x27,0x3B,0x49,\
-    0x97,0x65,0x41,0x47,0x38,0x73,0x6F,\
-    0x10,0x61,0x95,0x05,0x39,0xBE,0x7D,\
-    0x6C,0x47,0x18,0x59,0x68,0x77,0x6F,\
-    0xF5,0x39,0x5F,0x68,0x88,0x0B,0x61,\
-    0x66,0x13,0x77,0x5B,0x72,0x69,0x26,\
-    0x1D,0x37,0x5F,0x32,0x6D,0x66,0x77,\
-    0x1D,0x58,0x6A,0x65,0x00,0x39,0x6A,\
-    0x76,0x2D,0x67,0x05,0xC6,0x96,0x77,\
-    0x6D,0x97,0xB8,0x89,0xD4,0x77,0x60,\
-    0x47,0x39,0x5A,0x6E,0x07,0x6D,0x27,\
-    0x39,0x39,0x04,0x57,0x14,0x47,0x3B,\
-    0x38,0x28,0x65,0x54,0x47,0x29,0x5D,\
-    0x48,0x10,0x69,0x37,0xCD,0x59,0x6A,\
-    0x07,0x92,0x59,0x11,0x39,0x69,0x3D,\
-    0x6C,0x20,0x35,0xE7,0x54,0x77,0xBB,\
-    0x4D,0x3E,0x39,0x49,0x17,0x6D,0x47,\
-    0x3B,0x87,0x68,0x10,0x51,0x59,0x29,\
-    0x73,0x69,0x10,0x61,0x99,0x05,0x39,\
-    0xBE,0x7D,0x6A,0x47,0x18,0x59,0x68,\
-    0x77,0x6F,0x37,0x39,0x29,0x6F,0x36,\
-    0x9D,0x4F,0x3B,0x73,0x69,0x10,0x69,\
-    0x37,0xCD,0x59,0x6A,0x07,0x92,0x59,\
-    0x11,0x39,0x69,0x3D,0x6C,0x20,0x35,\
-    0xE7,0x54,0x77,0xBB,0x4D,0x3E,0x39,\
-    0x49,0x17,0x6D,0x47,0x3B,0x87,0x68,\
-    0x11,0xA9,0x67,0x31,0x17,0x77,0x39,\
-    0x18,0x09,0x6F,0x00,0x36,0x43,0x36,\
-    0xC6,0xB0,0x58,0x6A,0x69,0x00,0x39,\
-    0x6A,0x76,0x2D,0x67,0x05,0xC6,0x96,\
-    0x77,0x6D,0x97,0xBE,0x89,0xD4,0x77,\
-    0x60,0x47,0x39,0x5B,0x68,0x77,0xF3,\
-    0x0F,0x57,0xC6,0x8F,0x3F,0x03,0xB8,\
-    0xC1,0x49,0x6E,0x58,0x6D,0x0F,0x41,\
-    0x39,0x95,0x16,0x6D,0xB9,0x0D,0x24,\
-    0x06,0x88,0x97,0xB8,0xC9,0x24,0x06,\
-    0x88,0x96,0xB8,0xC8,0x24,0x06,0x88,\
-    0x91,0xB8,0xCB,0x24,0x06,0x88,0x90,\
-    0xB8,0xCA,0x71,0x06,0x88,0x8B,0x0F,\
-    0x57,0xC6,0x90,0x07,0x6B,0x68,0x39,\
-    0x71,0x10,0x77,0x91,0x26,0x39,0xC7,\
-    0x60,0x6A,0x03,0xB8,0xC3,0xC6,0x84,\
-    0x6A,0x03,0xB8,0xC2,0xC6,0x85,0x6A,\
-    0x03,0xB8,0xC5,0xC6,0x86,0x6A,0x03,\
-    0xB8,0xC4,0xC6,0x87,0x3F,0x03,0xB8,\
-    0xDC,0x71,0x06,0x88,0x95,0x37,0x3F,\
-    0x16,0x68,0x3F,0x15,0x47,0xC2,0x58,\
-    0x68,0x8A,0xB1,0x5A,0x57,0xC6,0x92,\
-    0x88,0x85,0x5A,0x57,0xC6,0x93,0x88,\
-    0x84,0x5A,0x57,0xC6,0x94,0x88,0x87,\
-    0x5A,0x57,0xC6,0x95,0x88,0x86,0x08,\
-    0xD6,0x39,0x58,0x3D,0x43,0xB8,0xDE,\
-    0x5E,0x7C,0x3D,0x43,0xB8,0xDF,0x5E,\
-    0x66,0x3D,0x43,0xB8,0xDC,0x5F,0x66,\
-    0x17,0x6B,0x37,0x39,0x59,0x68,0x77,\
-    0xFD,0x37,0x39,0x59,0x68,0x77,0xE7,\
-    0x0F,0x57,0xC6,0xB7,0x3F,0x03,0xB8,\
-    0xD9,0x49,0x6B,0x58,0x6D,0x37,0x27,\
-    0x16,0x68,0x16,0x6D,0xBA,0xB5,0x76,\
-    0x87,0x77,0x7D,0x0D,0x17,0xC6,0xB7,\
-    0x10,0x2F,0x0D,0x17,0xC6,0x8A,0x10,\
-    0x51,0x67,0x17,0x00,0x36,0x43,0x36,\
-    0xC6,0x84,0x55,0x43,0xB8,0xC9,0x47,\
-    0x68,0xE7,0xEC,0x67,0x78,0x73,0xE8,\
-    0x10,0x49,0x65,0x39,0x31,0x68,0x77,\
-    0x6D,0x20,0x33,0x47,0x68,0x69,0x75,\
-    0x65,0x39,0x6A,0xE9,0x10,0x7F,0xA5,\
-    0xB0,0x49,0x68,0x67,0x75,0x99,0xB9,\
-    0x49,0x68,0x67,0x75,0x99,0xB9,0x6A,\
-    0xE9,0x11,0x9D,0x6A,0x7E,0xC6,0x9C,\
-    0x17,0x7F,0x68,0x17,0xC6,0x84,0x58,\
-    0x43,0xB8,0xC9,0x58,0x68,0x8B,0xF9,\
-    0x6A,0x79,0xC6,0x9C,0x27,0xE2,0x67,\
-    0x17,0xC6,0x80,0xE7,0xC3,0xB8,0xCD,\
-    0x7D,0xE8,0xE6,0xED,0x15,0xB9,0x2A,\
-    0xA8,0x77,0x7D,0x24,0xD9,0x49,0x69,\
-    0x59,0x72,0x09,0x67,0x77,0x1D,0x39,\
-    0x3B,0xB8,0xC9,0x16,0x65,0x58,0x61,\
-    0x65,0x00,0x39,0x6A,0x76,0x2D,0x67,\
-    0x05,0xC6,0x96,0x77,0x6D,0x97,0xB8,\
-    0x89,0xD4,0x77,0x60,0x47,0x39,0x5A,\
-    0x6E,0x07,0x6D,0x27,0x39,0x38,0x6A,\
-    0x3F,0x03,0xB8,0xCE,0x71,0x06,0x88,\
-    0x95,0x37,0x3C,0x16,0x68,0x07,0x61,\
-    0x68,0x39,0x58,0x68,0x8B,0xB7,0x08,\
-    0xD6,0x39,0x78,0x67,0x54,0x47,0x29,\
-    0x45,0x76,0x24,0x6D,0x21,0x39,0x39,\
-    0xBC,0x3D,0x54,0x47,0x29,0x45,0x75,\
-    0x10,0x6D,0x47,0xF3,0x73,0x46,0x88,\
-    0x9A,0x20,0x1D,0x29,0x51,0x77,0x7D,\
-    0x3B,0x23,0x89,0x46,0x88,0x97,0x21,\
-    0x21,0x29,0x51,0x77,0x7D,0x3B,0x22,\
-    0x89,0x46,0x88,0x96,0x21,0x35,0x2A,\
-    0x94,0x77,0x6C,0x47,0x29,0x5A,0x8A,\
-    0x17,0x6D,0x47,0x91,0x73,0x51,0x77,\
-    0x7D,0x23,0x19,0x00,0x36,0x43,0x36,\
-    0x5E,0x4E,0x05,0x6D,0x6D,0x45,0x39,\
-    0x78,0x0B,0x75,0x57,0x0C,0x21,0x68,\
-    0x7D,0x6D,0x47,0x18,0xE9,0x54,0x77,\
-    0x47,0x5C,0xB9,0x21,0x68,0x57,0x6C,\
-    0x15,0x39,0x4B,0x68,0x65,0x6D,0x67,\
-    0x38,0x62,0x28,0x1A,0x8F,0x05,0x00,\
-    0x39,0x78,0x14,0x8F,0x26,0x39,0xC4,\
-    0x06,0x5F,0x2D,0x0D,0xB5,0x5E,0x00,\
-    0x5D,0x11,0x47,0x29,0x42,0x94,0x5D,\
-    0xE1,0x7A,0x45,0x39,0x6D,0x88,0x99,\
-    0x6F,0x45,0x39,0x78,0x03,0x4D,0x68,\
-    0x34,0x16,0x64,0x58,0x51,0x47,0x29,\
-    0x45,0x70,0x3F,0x03,0xB8,0xCD,0x77,\
-    0xD1,0x77,0x7D,0x60,0x39,0x1A,0xA4,\
-    0x77,0x7D,0x3B,0x3D,0x49,0x68,0x47,\
-    0x43,0xB8,0xCD,0x1A,0xA8,0x77,0x7D,\
-    0x3B,0x31,0x76,0x87,0x77,0x7D,0x68,\
-    0x2C,0x16,0x51,0x77,0x7D,0x3B,0x3D,\
-    0x16,0x51,0x77,0x7D,0x3B,0x31,0x7B,\
-    0xCF,0x39,0xD4,0x47,0x29,0x73,0xC0,\
-    0x38,0x82,0x47,0x29,0x73,0x68,0x11,\
-    0x61,0x37,0x39,0x59,0x62,0x64,0x91,\
-    0x47,0x38,0x39,0x78,0x14,0x8F,0x37,\
-    0x38,0x11,0x37,0x5D,0x32,0x09,0x67,\
-    0x77,0x1D,0x39,0x3B,0xB8,0xC9,0x16,\
-    0x65,0x58,0x61,0x65,0x00,0x39,0x6A,\
-    0x76,0x2D,0x67,0x05,0xC6,0x96,0x77,\
-    0x6D,0x97,0xB8,0x89,0xD4,0x77,0x60,\
-    0x47,0x39,0x5A,0x6E,0x07,0x6D,0x27,\
-    0x39,0x39,0xDE,0x6A,0x11,0x47,0x38,\
-    0xC6,0x90,0x6A,0x11,0x47,0xC0,0xC6,\
-    0x91,0x67,0x54,0x47,0x29,0x5A,0x88,\
-    0xB7,0x54,0x47,0x29,0x5A,0x8A,0xB7,\
-    0x54,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x5A,0x89,0x6A,0x2D,0xB8,0xC3,0x73,\
-    0x51,0x77,0x7D,0x23,0x19,0x5E,0x48,\
-    0x05,0x6D,0x57,0x0F,0x21,0x90,0x7D,\
-    0x6D,0x47,0x18,0xE9,0x54,0x77,0x47,\
-    0x5A,0xB9,0x21,0x90,0x57,0x6C,0x15,\
-    0x39,0x4B,0x68,0x65,0x6D,0x67,0x38,\
-    0x6E,0x28,0x1A,0x8F,0x26,0x39,0xC5,\
-    0xEC,0x5D,0x2D,0x0D,0xB4,0x5E,0x36,\
-    0x5F,0x11,0x47,0x29,0x42,0x94,0x5F,\
-    0xE0,0x7A,0x45,0x39,0x6B,0x88,0x9B,\
-    0x6D,0x45,0x39,0x78,0x03,0x4D,0x68,\
-    0x35,0x16,0x65,0x3F,0x03,0xB8,0xC1,\
-    0x71,0x06,0x88,0x9B,0x09,0x80,0x39,\
-    0x78,0x50,0x6D,0x64,0xF4,0x39,0x78,\
-    0x0B,0x69,0x37,0x39,0x09,0x46,0x88,\
-    0x9B,0x64,0xF9,0x39,0x78,0x0B,0x65,\
-    0x08,0xD6,0x39,0x78,0x58,0x79,0x68,\
-    0x00,0x39,0x78,0x0B,0x69,0x68,0x00,\
-    0x39,0x78,0x0B,0x65,0x05,0x9E,0x77,\
-    0xD1,0x77,0x7D,0x0D,0x91,0x76,0x87,\
-    0x77,0x7D,0x0D,0x39,0x5E,0x6C,0x07,\
-    0x6D,0x27,0x3B,0x49,0x69,0x5F,0x32,\
-    0x6D,0x66,0x77,0x36,0x39,0x18,0x09,\
-    0x6F,0xC6,0x98,0x64,0x91,0x47,0x38,\
-    0x39,0x78,0x13,0x4D,0x5A,0x45,0x39,\
-    0x76,0x88,0x95,0x0F,0x57,0xC6,0x9F,\
-    0x3F,0x03,0xB8,0xC1,0x49,0x6B,0x58,\
-    0x6D,0x37,0x27,0x16,0x68,0x16,0x6D,\
-    0xBD,0xD9,0x76,0x87,0x77,0x7D,0x0D,\
-    0x17,0xC6,0x9F,0x10,0x67,0x54,0xC5,\
-    0x39,0x69,0x77,0x7D,0x23,0x19,0x59,\
-    0x2A,0x6A,0x11,0x47,0xA3,0xC6,0x90,\
-    0x3F,0x03,0xB8,0xCE,0x71,0x06,0x88,\
-    0x95,0x37,0x3D,0x00,0x36,0x43,0x36,\
-    0x16,0x68,0x3F,0x15,0x47,0xA3,0x58,\
-    0x68,0x8D,0xDF,0x08,0xD6,0x39,0x78,\
-    0x3D,0x43,0xB8,0xC3,0x5F,0x70,0x67,\
-    0x43,0xB8,0xC2,0x6A,0x68,0x11,0x7D,\
-    0x0D,0x17,0xC6,0x9F,0x10,0x67,0x54,\
-    0xC5,0x39,0x69,0x77,0x7D,0x23,0x19,\
-    0x59,0x6E,0x35,0x54,0x47,0x29,0x5D,\
-    0x48,0x39,0x33,0x09,0x4C,0x77,0x3E,\
-    0x88,0x95,0x0F,0xDE,0x3A,0x64,0x16,\
-    0x6D,0xB8,0x4F,0x58,0x68,0x8C,0xEB,\
-    0x6D,0x79,0x73,0xE5,0x10,0x61,0x75,\
-    0x00,0x39,0x78,0x13,0x65,0xF5,0x45,\
-    0x39,0x6C,0x13,0x6B,0x37,0x39,0x59,\
-    0x68,0x77,0xDD,0x64,0xF4,0x39,0x78,\
-    0x0C,0x91,0x7A,0x40,0x39,0x78,0x13,\
-    0x65,0xB8,0xC7,0x13,0x14,0x77,0x7D,\
-    0x23,0x11,0x25,0x7D,0x47,0x6C,0x97,\
-    0x05,0x39,0x96,0x6D,0xED,0x0D,0x00,\
-    0x39,0x78,0x13,0x4D,0x20,0x11,0x47,\
-    0x68,0x3D,0x03,0xB8,0xC7,0x5E,0x48,\
-    0x05,0x6D,0x55,0x3E,0x29,0x5D,0x6F,\
-    0x6D,0x4D,0x39,0x39,0x49,0xA7,0x51,\
-    0x47,0x13,0x22,0xE8,0x6F,0x6D,0x15,\
-    0x3E,0xF7,0x14,0x77,0x92,0xF9,0x57,\
-    0xC6,0x96,0x12,0x8D,0x6F,0x45,0x39,\
-    0x78,0x03,0x4D,0x68,0x05,0x39,0x78,\
-    0x0C,0x91,0x68,0x35,0x16,0x65,0x3F,\
-    0x03,0xB8,0xC7,0x77,0xD1,0x77,0x7D,\
-    0x60,0x39,0x1A,0xA4,0x77,0x7D,0x3B,\
-    0x3D,0x49,0x68,0x47,0x43,0xB8,0xC7,\
-    0x1A,0xA8,0x77,0x7D,0x3B,0x31,0x16,\
-    0x51,0x77,0x7D,0x3C,0xC5,0x16,0x51,\
-    0x77,0x7D,0x3B,0x3D,0x16,0x51,0x77,\
-    0x7D,0x3B,0x31,0x00,0x36,0x43,0x36,\
-    0x7B,0xCF,0x39,0xD4,0x47,0x29,0x73,\
-    0xC0,0x55,0x6D,0x5D,0xBF,0x76,0x87,\
-    0x77,0x4D,0x0D,0x38,0x5F,0x64,0x64,\
-    0x91,0x47,0x38,0x39,0x78,0x14,0x8C,\
-    0x37,0x38,0x59,0x6A,0x07,0x6D,0x6B,\
-    0x26,0x17,0x77,0x5F,0x32,0x6D,0x66,\
-    0x77,0x36,0x39,0x18,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x80,0x39,0x78,\
-    0x37,0x25,0x09,0x80,0x39,0x78,0x5B,\
-    0x41,0x09,0x80,0x39,0x78,0x5D,0x29,\
-    0x09,0x80,0x39,0x78,0x2B,0x5D,0x09,\
-    0x80,0x39,0x78,0x2B,0x29,0x15,0x80,\
-    0x39,0x78,0x1B,0x6D,0x09,0x4C,0x77,\
-    0x19,0x35,0x54,0x47,0x29,0x55,0x78,\
-    0x39,0xD4,0x47,0x29,0x07,0x00,0x39,\
-    0xD4,0x47,0x29,0x70,0x84,0x39,0xD4,\
-    0x47,0x29,0x1E,0xD8,0x39,0x18,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x65,0x56,\
-    0x39,0x6C,0x57,0x02,0x47,0x31,0x29,\
-    0x47,0x77,0x62,0x0D,0xB0,0x5E,0x66,\
-    0x3D,0x6D,0x20,0x33,0xE9,0x54,0x77,\
-    0x92,0x55,0xE1,0x73,0x68,0x11,0x9B,\
-    0x09,0x4C,0x19,0x07,0x77,0x69,0x57,\
-    0x16,0x39,0x63,0x3D,0xE5,0x20,0x37,\
-    0x73,0x68,0x10,0x67,0x97,0x05,0x39,\
-    0x97,0x35,0x75,0x0D,0x39,0x5F,0x9E,\
-    0x39,0x18,0x09,0x48,0x77,0x19,0x3F,\
-    0x8A,0x48,0x35,0x25,0x47,0x77,0x72,\
-    0x6F,0x56,0x39,0x48,0x7F,0x54,0x47,\
-    0x3D,0x39,0x78,0x1B,0x64,0x20,0x39,\
-    0x38,0x7C,0x55,0x11,0x47,0x29,0x7B,\
-    0x20,0x5D,0x24,0x37,0x39,0x29,0x6E,\
-    0x9E,0xE5,0x9C,0xF9,0x43,0x68,0x6D,\
-    0x40,0x47,0x3B,0x00,0x36,0x43,0x36,\
-    0x11,0x54,0x77,0x92,0xBC,0x39,0x19,\
-    0x6D,0x9E,0xE5,0x67,0x79,0x49,0x60,\
-    0x9E,0xE5,0x55,0x09,0x71,0x69,0xB7,\
-    0xD1,0x47,0x39,0x39,0x98,0xB5,0xD1,\
-    0xB8,0xC6,0xC6,0x67,0xF5,0xED,0x56,\
-    0xB8,0x71,0x69,0x59,0x51,0x47,0xC6,\
-    0xC2,0x6A,0xCD,0x11,0x47,0x37,0x5F,\
-    0x44,0x57,0x68,0xAE,0xB1,0x19,0x28,\
-    0xA6,0xAA,0x37,0x39,0x29,0x6E,0x9E,\
-    0xE5,0x94,0xF9,0x09,0x79,0xB7,0xD1,\
-    0x47,0x39,0x3E,0x97,0x9C,0xE5,0x75,\
-    0x29,0xF9,0xD4,0x77,0x6D,0xB8,0xD9,\
-    0xFB,0xD4,0x88,0x92,0x47,0x26,0xBB,\
-    0xE8,0x47,0xEC,0x67,0x3C,0xD0,0xE0,\
-    0x55,0x2D,0x45,0x48,0xC6,0x87,0x0F,\
-    0x6D,0x45,0x48,0xC6,0x98,0x0F,0x6D,\
-    0x37,0x31,0x2B,0x59,0x3F,0x6C,0x87,\
-    0x85,0x39,0x68,0x77,0x62,0x85,0x85,\
-    0xC6,0x97,0x88,0x9D,0xC5,0xB9,0x2A,\
-    0xE9,0x3F,0x6C,0x39,0x39,0x73,0x45,\
-    0x77,0x6B,0x20,0x11,0x1B,0x54,0x77,\
-    0x92,0xBC,0x3F,0x15,0x6D,0x9E,0xE3,\
-    0x67,0x7F,0xE8,0xAF,0xA6,0xAC,0x57,\
-    0x8D,0x41,0x68,0x57,0x6A,0x15,0x39,\
-    0x47,0x68,0x69,0x6D,0xF9,0x14,0x39,\
-    0x6E,0x12,0x85,0x67,0x3E,0x68,0x28,\
-    0x1B,0x4D,0x65,0x05,0x39,0x97,0x8C,\
-    0x6B,0x6B,0x3C,0xD0,0xE6,0x57,0x2B,\
-    0x96,0xFE,0xE8,0xA9,0x35,0x7D,0x67,\
-    0x3E,0x6B,0x68,0x09,0x6D,0x59,0x39,\
-    0x19,0x6F,0x26,0x2D,0x2A,0xD3,0x19,\
-    0x6D,0x9E,0xE5,0x67,0x79,0x49,0x64,\
-    0x9E,0xE5,0x55,0x09,0x71,0x69,0xB7,\
-    0xD1,0x47,0x39,0x00,0x36,0x43,0x36,\
-    0x39,0x98,0xB5,0xD1,0xB8,0xC6,0xC6,\
-    0x67,0xF5,0xED,0x56,0xB8,0x71,0x69,\
-    0x07,0x6C,0x27,0x3B,0x49,0x68,0x5F,\
-    0x72,0x6D,0x26,0x15,0x77,0x59,0x72,\
-    0x6F,0x66,0x13,0x37,0x39,0x18,0x09,\
-    0x48,0x77,0x3E,0x88,0x95,0x68,0x3F,\
-    0x25,0x46,0x77,0x66,0xFB,0x05,0x39,\
-    0x78,0x11,0x43,0x67,0x45,0x39,0x97,\
-    0x8D,0xCD,0x57,0x11,0x39,0x69,0x93,\
-    0xE5,0x87,0x85,0x39,0x68,0x77,0x6C,\
-    0x6A,0x79,0xC6,0x94,0x57,0x11,0x47,\
-    0xC6,0xC3,0xC8,0x7F,0xC5,0x47,0x3B,\
-    0x39,0x69,0x77,0x54,0x47,0x3B,0x39,\
-    0x78,0x14,0x85,0x27,0x39,0x38,0xF0,\
-    0xCB,0x51,0x47,0x28,0x5F,0x46,0x57,\
-    0x11,0x47,0xC6,0xC3,0xC8,0x67,0x45,\
-    0x47,0x38,0xDB,0xE0,0xB7,0xD1,0x47,\
-    0x39,0x39,0x69,0x5A,0x2D,0xB8,0xC5,\
-    0x19,0x14,0x77,0x92,0xBD,0x99,0x31,\
-    0xC0,0x77,0x6C,0x47,0x38,0x39,0x51,\
-    0x77,0x6C,0x47,0x29,0x5A,0x80,0x17,\
-    0x6D,0x46,0x5D,0x31,0x51,0x77,0x69,\
-    0x47,0x29,0x55,0x61,0x10,0x6D,0x46,\
-    0x61,0x16,0x65,0x58,0x61,0x68,0x3E,\
-    0x49,0x68,0x67,0x6B,0xAE,0xB1,0x19,\
-    0x28,0xA6,0x91,0x47,0xC6,0xC2,0x68,\
-    0x49,0x7D,0x89,0x85,0x39,0x68,0x77,\
-    0x92,0xAF,0xBE,0x49,0x6A,0xC7,0xEA,\
-    0x21,0x39,0x39,0xEE,0x59,0x51,0x47,\
-    0xC6,0xC2,0x6A,0x07,0x6D,0x57,0x3F,\
-    0xD0,0xE0,0x5D,0x2D,0x6F,0x74,0xE0,\
-    0x94,0x77,0x92,0xBC,0x3F,0x16,0x64,\
-    0x47,0x58,0x3F,0x39,0xD3,0xE0,0xB7,\
-    0xD1,0x47,0x39,0x00,0x36,0x43,0x36,\
-    0x3E,0x97,0x05,0x6A,0x85,0x39,0x16,\
-    0x69,0x47,0x58,0x3F,0x39,0xD3,0xE0,\
-    0xB7,0xD1,0x47,0x39,0x3E,0x97,0x91,\
-    0xE5,0x35,0x39,0x2B,0x68,0x58,0x6C,\
-    0x09,0x80,0x39,0x78,0x37,0xFD,0x39,\
-    0x39,0x27,0x68,0x38,0x82,0x47,0x35,\
-    0x87,0x14,0x77,0x92,0x20,0x39,0x39,\
-    0xAA,0x3D,0x6A,0x2C,0x39,0x39,0xD4,\
-    0x57,0x11,0x47,0x29,0x7B,0xC8,0x57,\
-    0x6A,0x97,0xB9,0x1B,0x68,0xA7,0xED,\
-    0x95,0xB9,0xDC,0xE0,0xA5,0xED,0x96,\
-    0xF8,0x13,0x38,0x3D,0xE0,0x20,0x39,\
-    0x39,0xF6,0x58,0x61,0x68,0x3E,0x77,\
-    0xFD,0x27,0xE2,0x27,0x39,0x39,0xFA,\
-    0x07,0x65,0xF7,0xBE,0x5F,0x68,0x77,\
-    0x1B,0x69,0x05,0x39,0x97,0x8C,0x6F,\
-    0x37,0x39,0x29,0x6E,0x9E,0xE5,0x6D,\
-    0x79,0x11,0x25,0xAE,0x91,0x47,0xC6,\
-    0xC2,0x6E,0x58,0x61,0x77,0x0C,0x41,\
-    0x68,0x9D,0xE5,0x87,0x85,0x39,0x68,\
-    0x70,0x92,0x35,0x3E,0xFB,0x68,0x58,\
-    0x6C,0x77,0x0C,0x41,0x68,0x9D,0xE5,\
-    0x87,0x85,0x39,0x68,0x70,0x92,0xA1,\
-    0xB1,0x4B,0x68,0x65,0x6D,0x68,0x38,\
-    0x77,0xD1,0x77,0x7D,0x07,0xA9,0x47,\
-    0x68,0x69,0x6D,0x08,0xD6,0x39,0x64,\
-    0xC9,0x11,0x47,0xC6,0x5E,0x5E,0x07,\
-    0x12,0x87,0x3E,0x17,0x68,0x57,0x11,\
-    0x47,0x29,0x7B,0x38,0x57,0x6A,0xAE,\
-    0xB1,0xE8,0xA8,0x5D,0x3D,0x0D,0xB4,\
-    0x5E,0x76,0x58,0x61,0x68,0x3E,0x77,\
-    0xFD,0x27,0xE2,0x27,0x2D,0x49,0x6E,\
-    0xC7,0xEA,0x21,0x37,0x2A,0xAE,0x77,\
-    0x7D,0x2B,0x31,0x00,0x36,0x43,0x36,\
-    0x39,0x51,0x77,0x69,0x47,0x29,0x5A,\
-    0x80,0x07,0x6D,0x77,0x00,0x39,0x97,\
-    0x8D,0xE7,0x6A,0x79,0xC6,0x94,0x07,\
-    0x92,0x4A,0xB9,0xF8,0x11,0x77,0x92,\
-    0xBD,0x9D,0x17,0x77,0x5F,0x32,0x6D,\
-    0x66,0x15,0x77,0x39,0x33,0x09,0x4C,\
-    0x77,0x19,0x39,0x3B,0x47,0x39,0x16,\
-    0x6F,0x58,0x6B,0x68,0x3C,0x25,0x46,\
-    0x77,0x66,0x6D,0x05,0x39,0x97,0x8C,\
-    0x6D,0x37,0x39,0x29,0x6E,0x9E,0xE5,\
-    0x67,0x79,0x49,0x6C,0x9E,0xE5,0x55,\
-    0x09,0x61,0x69,0xB7,0xD1,0x47,0x39,\
-    0x39,0x98,0xB5,0xD1,0xB8,0xC6,0xC6,\
-    0x67,0xF5,0xED,0x56,0xB8,0x61,0x69,\
-    0x59,0x51,0x47,0xC6,0xC2,0x6A,0x75,\
-    0x1D,0xB8,0xD6,0x41,0x68,0x07,0x6D,\
-    0x57,0x17,0x39,0x7B,0x65,0x5D,0x1F,\
-    0x38,0xF9,0xD4,0x77,0x6D,0x47,0x36,\
-    0xFB,0xD4,0x88,0x92,0xB8,0xC9,0xBB,\
-    0xE8,0x66,0xEC,0x1F,0x38,0x19,0x46,\
-    0x77,0x61,0xAC,0xB1,0x0B,0x58,0x0F,\
-    0x6D,0x87,0x85,0x39,0x68,0x88,0x8D,\
-    0x85,0x85,0xC6,0x97,0x77,0x72,0xC5,\
-    0xB9,0x08,0xE9,0x0F,0x6D,0x45,0x49,\
-    0xC6,0x87,0x0F,0x6D,0x45,0x49,0xC6,\
-    0x98,0x0F,0x6D,0x0D,0x17,0x39,0x7F,\
-    0x10,0x61,0x37,0x39,0x34,0xA8,0xF6,\
-    0x14,0x47,0xC6,0xC3,0xCA,0x17,0x67,\
-    0x37,0xC6,0x34,0xE8,0xB6,0x14,0x47,\
-    0xC6,0xC3,0xCA,0x5D,0x72,0x6B,0x26,\
-    0x17,0x77,0x39,0x33,0x09,0x4C,0x77,\
-    0x3E,0x77,0x6D,0x68,0x3E,0x16,0x6E,\
-    0x58,0x68,0x5B,0x17,0x39,0x63,0x5D,\
-    0x51,0x47,0xC6,0x00,0x36,0x43,0x36,\
-    0xC2,0x68,0x07,0x6D,0x57,0x3F,0xD0,\
-    0xE0,0x57,0x2D,0x37,0x31,0xD0,0xE0,\
-    0x65,0x5D,0x1F,0x38,0xF9,0xD4,0x77,\
-    0x6D,0x47,0xC9,0xFB,0xD4,0x88,0x92,\
-    0xB8,0x36,0xBB,0xE8,0x66,0xEC,0x1F,\
-    0x38,0x17,0x54,0x77,0x92,0xBC,0x3B,\
-    0x49,0x69,0x9E,0xE5,0x75,0x09,0x41,\
-    0x68,0xB7,0xD1,0x47,0x39,0x39,0x78,\
-    0xB5,0xD1,0xB8,0xC6,0xC6,0x87,0xF5,\
-    0xED,0x76,0xB8,0x41,0x68,0x07,0x6D,\
-    0x57,0x17,0x39,0x7B,0x65,0x5D,0x1F,\
-    0x38,0xF9,0xD4,0x77,0x6D,0x47,0x36,\
-    0xFB,0xD4,0x88,0x92,0xB8,0xC9,0xBB,\
-    0xE8,0x66,0xEC,0x1F,0x38,0x19,0x46,\
-    0x77,0x61,0xAC,0xB1,0x0B,0x58,0x0F,\
-    0x6D,0x87,0x85,0x39,0x68,0x88,0x8D,\
-    0x85,0x85,0xC6,0x97,0x77,0x72,0xC5,\
-    0xB9,0x08,0xE9,0x0F,0x6D,0x45,0x49,\
-    0xC6,0x87,0x0F,0x6D,0x45,0x49,0xC6,\
-    0x98,0x0F,0x6D,0x0D,0x17,0x39,0x7F,\
-    0x10,0x61,0x37,0x39,0x34,0xA8,0xF6,\
-    0x14,0x47,0xC6,0xC3,0xCA,0x17,0x67,\
-    0x37,0xC6,0x34,0xE8,0xB6,0x14,0x47,\
-    0xC6,0xC3,0xCA,0x5D,0x72,0x6B,0x26,\
-    0x17,0x77,0x39,0x33,0x09,0x4C,0x77,\
-    0x3E,0x88,0x95,0x0F,0xDE,0x06,0x6C,\
-    0x6A,0x11,0x47,0x39,0xC6,0x97,0x63,\
-    0x51,0x47,0x39,0x45,0x68,0x0D,0x6D,\
-    0x71,0x05,0x3E,0x97,0x49,0x51,0x40,\
-    0xC6,0x31,0x91,0x77,0x6C,0x47,0xC6,\
-    0xC3,0xE8,0x35,0x54,0x47,0xC6,0xC3,\
-    0xEE,0x7F,0x94,0x47,0x3D,0x39,0x97,\
-    0x8D,0xED,0x37,0x39,0x29,0x46,0x77,\
-    0x67,0xA8,0xB1,0x00,0x36,0x43,0x36,\
-    0x2B,0x51,0x77,0x92,0xBD,0xBE,0xF9,\
-    0xD4,0x77,0x6D,0x47,0xB9,0xFB,0xD4,\
-    0x88,0x92,0xB8,0x46,0xBB,0xE8,0x64,\
-    0xAC,0x47,0xC6,0xC3,0xEF,0x5D,0x11,\
-    0x47,0xC6,0xC3,0xE1,0x07,0x6D,0x57,\
-    0x17,0x39,0x60,0x9A,0xE5,0x55,0x2C,\
-    0xF9,0xD4,0x77,0x6D,0x47,0xF9,0xFB,\
-    0xD4,0x88,0x92,0xB8,0x06,0xBB,0xE8,\
-    0x6D,0xEC,0x37,0x39,0x29,0x46,0x77,\
-    0x66,0xA0,0xB1,0x2B,0x7D,0xB7,0xD1,\
-    0x47,0x39,0x39,0x50,0xB5,0xD1,0xB8,\
-    0xC6,0xC6,0xAF,0xF5,0xED,0x5D,0xB8,\
-    0x49,0x68,0x67,0x43,0x47,0x35,0x2B,\
-    0x7D,0xB7,0xD1,0x47,0x39,0x39,0x6F,\
-    0xB5,0xD1,0xB8,0xC6,0xC6,0x90,0xF5,\
-    0xED,0x5D,0xB8,0x2A,0x86,0x77,0x64,\
-    0x47,0xC6,0xC3,0xE0,0x07,0x6A,0x55,\
-    0x00,0x39,0x97,0x8D,0xEA,0x87,0x85,\
-    0x39,0x68,0x77,0x6A,0x85,0x85,0xC6,\
-    0x97,0x88,0x95,0xC5,0xB9,0x2A,0xA9,\
-    0x77,0x92,0xBD,0xBE,0x41,0x68,0x55,\
-    0x11,0x47,0xC6,0xC2,0x6A,0x55,0x51,\
-    0x47,0xC6,0xC2,0x68,0x57,0x69,0xAE,\
-    0xB1,0x13,0x28,0x75,0x58,0x47,0x36,\
-    0x21,0x69,0x57,0x20,0x96,0xF0,0x3B,\
-    0x38,0x88,0x82,0x67,0x3D,0x6B,0x68,\
-    0x0F,0x6D,0x5F,0x39,0x81,0x14,0x77,\
-    0x62,0x2A,0xE7,0x19,0x54,0x77,0x6D,\
-    0x40,0xC6,0xD2,0xE0,0x45,0x54,0x47,\
-    0xC6,0xC3,0xF8,0xB7,0xD1,0x47,0x39,\
-    0xC6,0x88,0xB5,0xD1,0xB8,0xC6,0x39,\
-    0x77,0xF5,0xED,0x74,0xF8,0x39,0x97,\
-    0x8D,0xFD,0x37,0x3E,0x0B,0x51,0x77,\
-    0x92,0xBD,0xA9,0x00,0x36,0x43,0x36,\
-    0xF9,0xD4,0x77,0x6D,0x47,0x3E,0xFB,\
-    0xD4,0x88,0x92,0xB8,0xC1,0xBB,0xE8,\
-    0x44,0xAC,0x47,0xC6,0xC3,0xF8,0x57,\
-    0x51,0x47,0x39,0x46,0x97,0x94,0xE5,\
-    0x75,0x00,0x39,0x97,0x8D,0xFF,0x87,\
-    0x85,0x39,0x68,0x88,0x93,0x85,0x85,\
-    0xC6,0x97,0x77,0x6C,0xC5,0xB9,0x0A,\
-    0xA9,0x77,0x92,0xBD,0xAB,0x41,0x68,\
-    0x5D,0x11,0x47,0x29,0x7B,0xF0,0x57,\
-    0x69,0x97,0xB9,0x1B,0x68,0xA7,0xED,\
-    0x95,0xB9,0xDC,0xE0,0xA5,0xED,0x4B,\
-    0x0C,0x39,0x66,0x6F,0x6F,0x21,0x25,\
-    0x73,0x46,0x88,0x92,0x20,0x35,0x0B,\
-    0x5D,0x6F,0x6D,0xFC,0x78,0x7F,0x29,\
-    0xB1,0x2C,0x27,0x33,0x03,0x5D,0x6F,\
-    0x6D,0x5A,0x45,0x39,0x69,0x88,0x92,\
-    0x67,0x3D,0x6B,0x68,0x0F,0x6D,0x5F,\
-    0x39,0x19,0x6C,0x2E,0x2D,0x2A,0xF9,\
-    0x49,0x68,0x47,0x6E,0xAC,0xB1,0x0B,\
-    0x51,0x77,0x92,0xBD,0xAD,0xF9,0xD4,\
-    0x77,0x6D,0xB8,0xD9,0xFB,0xD4,0x88,\
-    0x92,0x47,0x26,0xBB,0xE8,0x44,0xAC,\
-    0x47,0xC6,0xC3,0xFC,0x07,0x6A,0x75,\
-    0x00,0x39,0x97,0x8D,0xF9,0x87,0x85,\
-    0x39,0x68,0x77,0x6A,0x85,0x85,0xC6,\
-    0x97,0x88,0x95,0xC5,0xB9,0x0A,0xA9,\
-    0x77,0x92,0xBD,0xAD,0x19,0x54,0x77,\
-    0x6D,0x38,0xC6,0xDA,0xE0,0x45,0x54,\
-    0x47,0xC6,0xC3,0xFE,0xB7,0xD1,0x47,\
-    0x39,0xC6,0x96,0xB5,0xD1,0xB8,0xC6,\
-    0x39,0x69,0xF5,0xED,0x74,0xF8,0x39,\
-    0x97,0x8D,0xFB,0x67,0x45,0x39,0x97,\
-    0x8C,0x8D,0x37,0x3D,0xD0,0xE0,0x65,\
-    0x45,0x47,0x38,0x00,0x36,0x43,0x36,\
-    0xF9,0xD4,0x77,0x6D,0x47,0xC9,0xFB,\
-    0xD4,0x88,0x92,0xB8,0x36,0xBB,0xE8,\
-    0x66,0x2C,0x47,0x38,0x13,0x14,0x77,\
-    0x92,0xBC,0xDB,0x3B,0x3D,0x88,0x82,\
-    0x67,0x45,0x39,0x97,0x8C,0x8D,0x37,\
-    0x31,0x2B,0x40,0x77,0x6C,0x87,0x85,\
-    0x39,0x68,0x77,0x62,0x85,0x85,0xC6,\
-    0x97,0x88,0x9D,0xC5,0xB9,0x28,0x29,\
-    0x77,0x6C,0x37,0x39,0x09,0x6D,0x9C,\
-    0xE5,0x75,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0xB8,0xD9,0xFB,0xD4,0x88,0x92,0x47,\
-    0x26,0xBB,0xE8,0x4D,0xEC,0x45,0x6C,\
-    0xC6,0x87,0x75,0x38,0xB8,0xC9,0x39,\
-    0x11,0x37,0x6D,0x47,0xC6,0xC3,0xCA,\
-    0x0D,0x6D,0x6D,0x45,0x39,0x78,0x35,\
-    0xF5,0x67,0x3C,0xE9,0xE8,0x51,0x6D,\
-    0x97,0xB9,0xEF,0xE8,0x92,0xE5,0x91,\
-    0xB9,0x35,0x5D,0x77,0x62,0x7F,0x3B,\
-    0x5F,0x72,0x3D,0x6F,0x20,0x37,0x0F,\
-    0x5D,0x4F,0x6D,0x75,0x3A,0x84,0x29,\
-    0x31,0x2C,0x89,0x78,0x59,0x60,0x4B,\
-    0x58,0x7F,0x39,0x2D,0x54,0x77,0x6C,\
-    0x67,0x3C,0x6B,0x68,0x0D,0x6D,0x5D,\
-    0x39,0x19,0x6D,0x2E,0x2D,0x2A,0xFB,\
-    0x49,0x68,0x47,0x6A,0xAC,0xB1,0x0B,\
-    0x51,0x77,0x92,0xBD,0xA1,0xF9,0xD4,\
-    0x77,0x6D,0xB8,0xD9,0xFB,0xD4,0x88,\
-    0x92,0x47,0x26,0xBB,0xE8,0x44,0xAC,\
-    0x47,0xC6,0xC3,0xF0,0x07,0x6A,0x75,\
-    0x00,0x39,0x97,0x8D,0xF5,0x87,0x85,\
-    0x39,0x68,0x77,0x6A,0x85,0x85,0xC6,\
-    0x97,0x88,0x95,0xC5,0xB9,0x0A,0xA9,\
-    0x77,0x92,0xBD,0xA1,0x19,0x54,0x77,\
-    0x6D,0x38,0xC6,0x00,0x36,0x43,0x36,\
-    0xDA,0xE0,0x45,0x54,0x47,0xC6,0xC3,\
-    0xF2,0xB7,0xD1,0x47,0x39,0xC6,0x96,\
-    0xB5,0xD1,0xB8,0xC6,0x39,0x69,0xF5,\
-    0xED,0x74,0xF8,0x39,0x97,0x8D,0xF7,\
-    0x67,0x45,0x39,0x97,0x8C,0x9D,0x37,\
-    0x3D,0xD0,0xE0,0x65,0x45,0x47,0x38,\
-    0xF9,0xD4,0x77,0x6D,0x47,0xC9,0xFB,\
-    0xD4,0x88,0x92,0xB8,0x36,0xBB,0xE8,\
-    0x66,0x2C,0x47,0x38,0x13,0x14,0x77,\
-    0x92,0xBC,0xCB,0x3B,0x3D,0x88,0x82,\
-    0x67,0x45,0x39,0x97,0x8C,0x9D,0x37,\
-    0x31,0x2B,0x40,0x77,0x6C,0x87,0x85,\
-    0x39,0x68,0x77,0x62,0x85,0x85,0xC6,\
-    0x97,0x88,0x9D,0xC5,0xB9,0x28,0x29,\
-    0x77,0x6C,0x37,0x39,0x09,0x6E,0x9C,\
-    0xE5,0x75,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0xB8,0xD9,0xFB,0xD4,0x88,0x92,0x47,\
-    0x26,0xBB,0xE8,0x4D,0xEC,0x45,0x6C,\
-    0xC6,0x87,0x75,0x38,0xB8,0xC9,0x39,\
-    0x11,0xF7,0x6D,0x47,0xC6,0xC3,0xCA,\
-    0x09,0x6D,0x53,0x05,0x39,0x66,0x5D,\
-    0x11,0x47,0x29,0x7B,0x20,0x57,0x6A,\
-    0xAE,0xB1,0x25,0x5D,0x7F,0x6F,0xFB,\
-    0x3B,0x5E,0x64,0x57,0x6A,0xAE,0xB1,\
-    0x31,0x5D,0x77,0x6D,0x4F,0x3C,0x5E,\
-    0x4A,0x07,0x6C,0x68,0x39,0x49,0x60,\
-    0x58,0x6D,0x67,0x74,0x19,0x6F,0x9E,\
-    0xE5,0x96,0xF9,0x49,0x68,0x47,0x7D,\
-    0x68,0x39,0x16,0x6E,0x16,0x6D,0xBC,\
-    0x45,0x76,0x87,0x77,0x7D,0x27,0x27,\
-    0x7B,0xCF,0x07,0x65,0x68,0x39,0x19,\
-    0x25,0x57,0x6A,0xAE,0xB1,0xE8,0xA8,\
-    0x07,0x6D,0x77,0x29,0x16,0x68,0x58,\
-    0x6B,0x26,0x39,0x00,0x36,0x43,0x36,\
-    0xC2,0x34,0x38,0x82,0x47,0x29,0x19,\
-    0x6F,0x25,0x6D,0x39,0x39,0x27,0x68,\
-    0x57,0x6A,0x1C,0x79,0x54,0xF2,0x0B,\
-    0x6D,0x53,0x05,0x39,0x67,0x5D,0x11,\
-    0x47,0x29,0x7B,0xF0,0x57,0x6B,0x97,\
-    0xB9,0x13,0x68,0xA7,0xED,0x9D,0xB9,\
-    0xDC,0xE0,0xAD,0xED,0x59,0x0C,0x61,\
-    0x6A,0xC9,0x6F,0x20,0x19,0x87,0x54,\
-    0x77,0x63,0x20,0x23,0x49,0x69,0x58,\
-    0x6D,0x37,0x31,0x16,0x68,0x07,0x6D,\
-    0x77,0x0C,0x61,0x68,0x58,0x6D,0x68,\
-    0x3E,0x58,0x68,0x8D,0x0D,0x08,0xD6,\
-    0x39,0x78,0x57,0x6B,0x15,0x39,0x45,\
-    0x68,0x6B,0x6D,0x67,0x3F,0x60,0x28,\
-    0x1A,0xD1,0x77,0x05,0x3E,0x88,0xB7,\
-    0x14,0x47,0xC6,0xC3,0xEC,0xF7,0x11,\
-    0x45,0x59,0x0A,0xA8,0x77,0x92,0xBD,\
-    0xBD,0x19,0x14,0x77,0x92,0xBD,0xB9,\
-    0x49,0x6F,0x65,0x45,0x47,0x38,0xF9,\
-    0xD4,0x77,0x6D,0x47,0x36,0xFB,0xD4,\
-    0x88,0x92,0xB8,0xC9,0xBB,0xE8,0x66,\
-    0x2C,0x47,0x38,0x13,0x14,0x77,0x92,\
-    0xBD,0xBF,0x3B,0x7D,0x77,0x9E,0x45,\
-    0x2C,0x39,0x94,0x7F,0xB8,0x47,0x3F,\
-    0x31,0xBD,0x77,0x6A,0x4F,0x80,0x39,\
-    0x6C,0x77,0x92,0xBD,0xB9,0x31,0x91,\
-    0x77,0x69,0x47,0x29,0x55,0x61,0x53,\
-    0x72,0x61,0x26,0x11,0x77,0x5D,0x72,\
-    0x6B,0x26,0x17,0x77,0x5D,0x32,0x09,\
-    0x67,0x77,0x1D,0x39,0x1C,0x05,0x00,\
-    0x39,0x78,0x1B,0x65,0x67,0x45,0x39,\
-    0x78,0x1B,0x64,0x4F,0xA9,0x39,0x6F,\
-    0x7F,0xFD,0x47,0x3C,0x31,0xF8,0x77,\
-    0x6B,0x4F,0xA9,0x00,0x36,0x43,0x36,\
-    0x39,0x6C,0x55,0x11,0x47,0x29,0x07,\
-    0xF6,0xE8,0x91,0x47,0x39,0x39,0x60,\
-    0x57,0x22,0x67,0xE0,0x09,0xB1,0x16,\
-    0x6D,0xBC,0x25,0x69,0xE7,0x39,0x18,\
-    0x45,0x3A,0x39,0x6B,0x75,0x6D,0x09,\
-    0x48,0x77,0x19,0x58,0x6A,0x59,0x16,\
-    0x39,0x63,0x57,0x02,0x47,0x35,0x73,\
-    0x51,0x77,0x7D,0x2C,0xC7,0x5F,0x6E,\
-    0x07,0x6D,0x27,0x39,0x39,0x02,0x7F,\
-    0x54,0x47,0x3E,0x39,0x78,0x04,0x98,\
-    0x20,0x39,0x39,0x34,0x07,0x6D,0x57,\
-    0x3E,0x16,0x68,0x58,0x65,0x68,0x05,\
-    0x39,0x78,0x1B,0x4D,0x09,0x80,0x39,\
-    0x78,0x43,0x9D,0x89,0x45,0x39,0x97,\
-    0x44,0xAA,0x47,0x29,0x55,0x72,0x38,\
-    0x82,0x47,0x35,0x73,0x51,0x77,0x7D,\
-    0x2B,0x29,0x5E,0x62,0x64,0x91,0x47,\
-    0x38,0x39,0x78,0x04,0x9B,0x27,0x23,\
-    0x73,0x51,0x77,0x7D,0x24,0xC9,0x5E,\
-    0x62,0x64,0x91,0x47,0x3D,0x39,0x78,\
-    0x04,0x9B,0x27,0x31,0x2A,0x94,0x77,\
-    0x6E,0x47,0x29,0x4A,0x9E,0x7F,0xD4,\
-    0x47,0x3E,0x39,0x78,0x04,0x98,0x37,\
-    0x38,0x59,0x6A,0x07,0x6D,0x69,0x26,\
-    0x77,0x1D,0x58,0x6A,0x68,0x3F,0x27,\
-    0x47,0x77,0x62,0x67,0x56,0x39,0x78,\
-    0x55,0x11,0x47,0x29,0x7B,0xF0,0x07,\
-    0x6D,0x57,0x3E,0xE9,0xE8,0x55,0x6D,\
-    0x97,0xB9,0xEB,0xE8,0x92,0xE5,0x95,\
-    0xB9,0x17,0x69,0x4B,0x5C,0x3F,0x39,\
-    0x85,0x14,0x75,0x2C,0x21,0x37,0x7B,\
-    0x51,0x77,0x7D,0x2B,0x29,0x7B,0x51,\
-    0x77,0x7D,0x24,0xC9,0x59,0x76,0xCB,\
-    0x11,0x40,0xD9,0x00,0x36,0x43,0x36,\
-    0x5F,0x78,0x35,0x54,0x47,0x29,0x55,\
-    0x78,0x64,0x91,0x47,0x38,0x39,0x78,\
-    0x14,0x9D,0x27,0x31,0x2A,0x94,0x77,\
-    0x6C,0x47,0x29,0x55,0x78,0x58,0x65,\
-    0x37,0x39,0x29,0x59,0x0F,0x6B,0x68,\
-    0x39,0x77,0xD1,0x77,0x7D,0x05,0xC9,\
-    0x69,0xE7,0x7F,0x54,0x47,0x3C,0x39,\
-    0x78,0x04,0x98,0x20,0x71,0x47,0x68,\
-    0x45,0x54,0x47,0x29,0x55,0x72,0x10,\
-    0x45,0x6B,0x05,0x39,0x68,0x70,0xB9,\
-    0x67,0x45,0x39,0x78,0x1B,0x4D,0x65,\
-    0x45,0x39,0x78,0x13,0x45,0x54,0x89,\
-    0x41,0x68,0x0F,0x6D,0x67,0x3E,0x6B,\
-    0x28,0x09,0x6D,0x79,0x39,0x8B,0x2F,\
-    0x14,0x69,0xF9,0xBF,0x54,0x82,0x7F,\
-    0xD4,0x47,0x3C,0x39,0x78,0x04,0x98,\
-    0x37,0x39,0x09,0x69,0x58,0x6D,0x09,\
-    0x80,0x39,0x78,0x50,0xF5,0x1F,0xB6,\
-    0x15,0x77,0x59,0x72,0x09,0x4C,0x16,\
-    0x65,0x5D,0x02,0x47,0x35,0x29,0x45,\
-    0x77,0x6F,0xF7,0x05,0x39,0x56,0x11,\
-    0x65,0x05,0x40,0x39,0x78,0x13,0x7D,\
-    0x27,0x0B,0x2A,0xA8,0x77,0x7D,0x23,\
-    0x11,0x49,0x6C,0x58,0x6D,0x0F,0x54,\
-    0x39,0x6B,0x58,0x51,0x47,0x29,0x5D,\
-    0x41,0x39,0xD4,0x47,0x29,0x0D,0x98,\
-    0x07,0x6D,0x57,0x14,0x39,0x69,0x58,\
-    0x6D,0x37,0x39,0x29,0x7D,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x50,0x1D,0x08,\
-    0xD6,0x39,0x7C,0x5D,0x32,0x09,0x4C,\
-    0x77,0x19,0x39,0x18,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x4F,0x00,0x39,0x6D,\
-    0x77,0x7D,0x2B,0x21,0x5E,0x64,0x39,\
-    0xD4,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x70,0xE4,0x39,0xD4,0x47,0x29,0x70,\
-    0xC4,0x57,0x54,0x47,0x29,0x4A,0x90,\
-    0x10,0x45,0xF7,0x80,0x39,0x78,0x1B,\
-    0x6D,0x25,0x19,0x7B,0xD1,0x77,0x7D,\
-    0x34,0xC1,0x77,0xD1,0x77,0x7D,0x63,\
-    0x29,0x77,0xD1,0x77,0x7D,0x0E,0xD5,\
-    0x49,0x69,0x64,0xAD,0x47,0x29,0x52,\
-    0x95,0x64,0xAD,0x47,0x29,0x52,0x96,\
-    0x39,0x18,0x68,0x3E,0x2B,0x47,0x77,\
-    0x66,0x59,0x16,0x39,0x67,0x57,0x11,\
-    0x47,0x29,0x78,0x20,0x07,0x6D,0x57,\
-    0x38,0xE8,0xA8,0x65,0x7D,0xF5,0x05,\
-    0x39,0x97,0x10,0x7B,0x67,0x45,0x39,\
-    0x78,0x36,0x6D,0x37,0x39,0x29,0x69,\
-    0x36,0x9D,0x49,0x39,0x49,0x68,0x67,\
-    0x6A,0x96,0xF9,0x2B,0x78,0x69,0x6C,\
-    0x0D,0x38,0x52,0x46,0x3D,0x54,0x47,\
-    0x29,0x52,0x95,0x11,0x69,0x37,0xC6,\
-    0x59,0x4C,0x57,0x11,0x47,0x29,0x7B,\
-    0xF4,0x07,0x6D,0x57,0x3E,0xE9,0xE8,\
-    0x55,0x6D,0x97,0xB9,0xEB,0xE8,0x92,\
-    0xE5,0x95,0xB9,0xE8,0xA9,0x7B,0x3D,\
-    0x07,0x39,0x5E,0x6C,0x07,0x92,0x27,\
-    0x3B,0x19,0x6F,0x59,0x72,0x09,0x4C,\
-    0x77,0x19,0x88,0x6D,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0x38,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xB9,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x6F,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xB8,0xC6,0x97,0x88,0x92,0xB8,0xC6,\
-    0xC6,0xEA,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0xEE,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0x44,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0x00,0x36,0x43,0x36,\
-    0xBD,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0x47,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0x46,0xC6,\
-    0xC6,0x97,0x75,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x74,0x92,0xB8,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0x43,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0xB8,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0xB8,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x72,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0x41,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0x00,0x36,0x43,0x36,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x70,0x65,\
-    0xB8,0xC6,0x38,0x48,0x72,0x6D,0x07,\
-    0x39,0x31,0x69,0x77,0x6D,0x47,0x39,\
-    0x39,0x68,0x77,0x6D,0x44,0x28,0x3F,\
-    0x68,0x37,0x6C,0x4F,0x38,0x39,0x78,\
-    0x3E,0x8D,0x47,0x39,0x39,0x68,0x72,\
-    0x2C,0x43,0x39,0x79,0x68,0x7F,0x6C,\
-    0x47,0x39,0x39,0x68,0x77,0x6D,0x47,\
-    0x39,0x3F,0x29,0x74,0x6D,0x07,0x38,\
-    0x31,0x69,0x77,0x7D,0x0E,0xD9,0x39,\
-    0x68,0x77,0x6D,0x40,0xD1,0x3E,0x68,\
-    0x37,0x6C,0x4F,0x38,0x39,0x78,0x3E,\
-    0x8D,0x47,0x39,0x39,0x68,0x77,0x7C,\
-    0x4E,0x39,0x79,0x68,0x7F,0x6C,0x47,\
-    0x29,0x06,0x44,0x77,0x6D,0x47,0x39,\
-    0x39,0x68,0x77,0x6D,0x47,0x39,0x38,\
-    0x69,0x7F,0x6D,0x07,0x39,0x31,0x69,\
-    0x77,0x7D,0x78,0xC9,0x39,0x68,0x77,\
-    0x6D,0x46,0x39,0x39,0x68,0x77,0x6D,\
-    0x45,0x78,0x3B,0x68,0x37,0x6D,0x4F,\
-    0x38,0x39,0x78,0x48,0x41,0x47,0x39,\
-    0x39,0x68,0x75,0x6D,0x47,0x39,0x39,\
-    0x68,0x70,0x8D,0x46,0x39,0x79,0x68,\
-    0x7F,0x6C,0x47,0x29,0x06,0x44,0x77,\
-    0x6D,0x47,0x39,0x3A,0x68,0x77,0x6D,\
-    0x47,0x39,0x71,0x8F,0x78,0x61,0x6D,\
-    0x56,0x39,0x48,0x57,0x20,0x65,0x74,\
-    0x19,0xB1,0x57,0xB4,0x65,0x45,0x39,\
-    0x78,0x03,0x64,0x57,0x28,0x73,0x68,\
-    0x10,0x6D,0x47,0xFB,0x89,0x54,0x77,\
-    0x6C,0x20,0x3D,0x00,0x36,0x43,0x36,\
-    0x59,0x68,0x76,0xA3,0x57,0x2C,0xD1,\
-    0xE0,0xB7,0xD1,0x47,0x39,0x39,0x67,\
-    0x22,0xED,0x21,0x39,0x39,0xC0,0x6D,\
-    0x54,0x47,0x29,0x4D,0x62,0x67,0x78,\
-    0x87,0x85,0x39,0x68,0x77,0x62,0x35,\
-    0x39,0x2B,0x6D,0xC7,0xEC,0x21,0x39,\
-    0x39,0xE2,0x49,0x54,0x47,0x29,0x4D,\
-    0x66,0x4F,0x54,0x47,0x29,0x4D,0x64,\
-    0x07,0x6D,0x77,0x3E,0x11,0x28,0x07,\
-    0x6D,0x77,0x3D,0xA9,0xE4,0x28,0xED,\
-    0x24,0x3D,0x4B,0x6F,0x17,0x69,0x75,\
-    0x3D,0xAB,0x2F,0x0B,0x6D,0x7B,0x38,\
-    0x73,0xEE,0x10,0x49,0x68,0x3A,0x0F,\
-    0x54,0x88,0x92,0x67,0x45,0x39,0x78,\
-    0x1B,0x4D,0x96,0xF5,0x11,0x20,0x57,\
-    0x6B,0x97,0x7A,0x45,0x68,0x4B,0x6D,\
-    0x5E,0x8C,0x51,0x69,0x1F,0x6D,0x0D,\
-    0xBF,0x5F,0x86,0x51,0x72,0x99,0x78,\
-    0x0A,0xAF,0x77,0x7D,0x33,0x37,0x29,\
-    0x6D,0x25,0x6D,0x35,0x36,0xFB,0x68,\
-    0x64,0xAC,0x47,0x29,0x4D,0x62,0xCF,\
-    0x2A,0x21,0x2D,0x31,0x91,0x77,0x68,\
-    0x47,0x29,0x4A,0x9D,0x44,0xA9,0x47,\
-    0x29,0x55,0x72,0x35,0x7C,0x27,0x39,\
-    0x38,0x40,0x25,0x14,0x47,0x29,0x4D,\
-    0x78,0x17,0x6D,0x46,0x27,0x7B,0x79,\
-    0x17,0x6D,0x46,0x21,0x31,0x51,0x77,\
-    0x68,0x47,0x29,0x4A,0x9D,0x11,0x6D,\
-    0x46,0x35,0x29,0x7D,0xB7,0x51,0x47,\
-    0xC9,0x5F,0x68,0x77,0x1D,0x4F,0x2C,\
-    0x39,0x6B,0x11,0x6D,0x47,0x51,0x29,\
-    0x7D,0xB7,0xD1,0x47,0x39,0x39,0x6F,\
-    0x28,0xED,0x25,0x63,0x29,0x7D,0xB7,\
-    0xD1,0x47,0x39,0x00,0x36,0x43,0x36,\
-    0x39,0x6F,0x28,0xED,0x24,0x3D,0x43,\
-    0x6F,0x17,0x67,0x57,0x2C,0xF9,0xD4,\
-    0x77,0x6D,0x47,0x3E,0x13,0x68,0x4F,\
-    0x68,0x74,0xFC,0x39,0x78,0x03,0x61,\
-    0x39,0x39,0x07,0x6D,0x3D,0xEA,0x20,\
-    0x25,0x03,0x54,0x88,0x92,0x6F,0x45,\
-    0x39,0x78,0x1B,0x4D,0x67,0x3E,0xE9,\
-    0x2D,0x09,0x6D,0x79,0x39,0x20,0xDD,\
-    0x0F,0x6C,0x3F,0x39,0x73,0xEF,0x11,\
-    0x83,0x4F,0xC0,0x39,0x6D,0x77,0x7D,\
-    0x34,0xCC,0x0A,0xAC,0x77,0x7D,0x2B,\
-    0x23,0x7B,0x79,0x17,0x6D,0x47,0xAD,\
-    0x29,0x7D,0x9F,0xE5,0x87,0x85,0x39,\
-    0x68,0x77,0x62,0x14,0xB9,0x5F,0x68,\
-    0x77,0xE9,0x39,0x39,0x27,0x45,0x77,\
-    0x6C,0x57,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0x47,0x36,0xD8,0x20,0xA9,0x2D,0x74,\
-    0xFE,0x39,0x78,0x03,0x61,0xF9,0x45,\
-    0x3E,0xBD,0x15,0x09,0x39,0x3F,0x01,\
-    0x54,0x88,0x92,0x6F,0x45,0x39,0x78,\
-    0x1B,0x4D,0x67,0x3E,0xE9,0x2C,0x09,\
-    0x6D,0x79,0x39,0x20,0xDD,0x0F,0x6F,\
-    0x3F,0x39,0x73,0xEF,0x11,0x83,0x74,\
-    0xC5,0x39,0x6E,0x77,0x7D,0x33,0x37,\
-    0x47,0x69,0x64,0xAA,0x47,0x29,0x4D,\
-    0x62,0x5F,0x11,0x47,0x29,0x4D,0x68,\
-    0x07,0x6E,0xAE,0xB1,0x2B,0x7C,0xB7,\
-    0xD1,0x47,0x39,0x39,0x98,0xB5,0xD1,\
-    0xB8,0xC6,0xC6,0x67,0xF5,0xED,0x5F,\
-    0xB8,0x3B,0x7C,0x77,0x9D,0x05,0x15,\
-    0x39,0x69,0x35,0x41,0x47,0x3B,0x2A,\
-    0xAF,0x77,0x7D,0x33,0x22,0x7B,0x51,\
-    0x77,0x7D,0x33,0x23,0x2B,0xEF,0x67,\
-    0x78,0xAF,0xB1,0x00,0x36,0x43,0x36,\
-    0xF9,0xD4,0x77,0x6D,0x47,0x36,0x6E,\
-    0xE8,0x11,0x6D,0x46,0x35,0x1B,0x14,\
-    0x77,0x7D,0x33,0x2B,0x29,0x79,0x2A,\
-    0x6D,0x21,0x05,0x27,0x51,0x77,0x7D,\
-    0x33,0x20,0x5E,0x72,0x3D,0x54,0x47,\
-    0x29,0x4D,0x72,0x10,0x63,0x54,0xC5,\
-    0x39,0x49,0x77,0x7D,0x33,0x20,0x2B,\
-    0xD4,0x77,0x6F,0x27,0x27,0x73,0x6F,\
-    0x11,0x77,0x0D,0x00,0x39,0x78,0x03,\
-    0x77,0x21,0x2B,0x31,0xD1,0x77,0x6B,\
-    0x47,0x29,0x4A,0x9D,0x7F,0x94,0x47,\
-    0x3E,0x39,0x78,0x04,0x98,0x05,0x28,\
-    0x29,0x79,0x26,0x6D,0x21,0x77,0x27,\
-    0x51,0x77,0x7D,0x33,0x20,0x5E,0x44,\
-    0x3D,0x54,0x47,0x29,0x4D,0x72,0x10,\
-    0x4D,0x54,0xC5,0x39,0x49,0x77,0x7D,\
-    0x33,0x20,0x29,0x51,0x77,0x7D,0x33,\
-    0x2A,0x6B,0x68,0x05,0x62,0x85,0x39,\
-    0x2A,0xA9,0x77,0x7D,0x33,0x2A,0x2B,\
-    0xD4,0x77,0x69,0x27,0x27,0x73,0x6F,\
-    0x11,0x77,0x0D,0x00,0x39,0x78,0x03,\
-    0x77,0x21,0x2B,0x31,0xD1,0x77,0x6B,\
-    0x47,0x29,0x4A,0x9D,0x7F,0x94,0x47,\
-    0x3E,0x39,0x78,0x04,0x98,0x05,0x28,\
-    0x27,0x79,0xC9,0x51,0x47,0x3B,0x5F,\
-    0x54,0x64,0x80,0x47,0x38,0x39,0x78,\
-    0x03,0x7A,0x54,0xD4,0x39,0x6A,0x77,\
-    0x7D,0x33,0x21,0x47,0x69,0x64,0xAA,\
-    0x47,0x29,0x4D,0x7B,0x35,0x54,0x47,\
-    0x29,0x4D,0x71,0x64,0xAA,0x47,0x29,\
-    0x4D,0x7E,0x65,0xD1,0x47,0x3A,0x19,\
-    0x54,0x77,0x6D,0x4E,0xFD,0xE9,0xD1,\
-    0x77,0x7D,0x2B,0x39,0x1A,0xA8,0x77,\
-    0x7D,0x34,0xC1,0x00,0x36,0x43,0x36,\
-    0x59,0x42,0xC9,0x51,0x47,0x3D,0x5F,\
-    0x4C,0x35,0x54,0x47,0x29,0x4D,0x71,\
-    0x64,0x91,0x47,0x38,0x39,0x78,0x03,\
-    0x7B,0x55,0x85,0x39,0x6B,0x57,0x51,\
-    0x47,0x39,0x30,0xAC,0xA7,0xD4,0x47,\
-    0x29,0x55,0x68,0x54,0xAD,0x47,0x29,\
-    0x4A,0x90,0x5F,0x72,0x6D,0x26,0x15,\
-    0x77,0x59,0x72,0x6F,0x66,0x13,0x37,\
-    0x39,0x18,0x68,0x34,0x16,0x64,0x58,\
-    0x6A,0x6D,0x45,0x39,0x78,0x04,0x98,\
-    0x4F,0x2C,0x39,0x6F,0x10,0x67,0x0D,\
-    0x00,0x39,0x78,0x03,0x7F,0x20,0x39,\
-    0x3A,0x36,0x5F,0x11,0x47,0x29,0x4D,\
-    0x7A,0x67,0x79,0x1A,0x39,0x5F,0x5C,\
-    0x69,0x54,0x47,0x29,0x4D,0x71,0x10,\
-    0x77,0x0D,0x00,0x39,0x78,0x03,0x77,\
-    0x20,0x37,0x2A,0x94,0x77,0x4C,0x47,\
-    0x29,0x4D,0x71,0x6F,0xD1,0x47,0x3B,\
-    0x59,0x7E,0x3D,0x6A,0x21,0x2B,0x73,\
-    0x51,0x77,0x7D,0x33,0x23,0x5F,0x62,\
-    0x7F,0xF8,0x47,0x3F,0x31,0xBD,0x77,\
-    0x6A,0x05,0x2D,0x29,0x7C,0x22,0x6D,\
-    0x21,0x2B,0x73,0x51,0x77,0x7D,0x33,\
-    0x20,0x5F,0x62,0x7F,0xF8,0x47,0x3F,\
-    0x31,0xBD,0x77,0x6A,0x05,0x2D,0x29,\
-    0x7C,0x26,0x6D,0x21,0x7F,0x27,0x51,\
-    0x77,0x7D,0x33,0x20,0x5E,0x44,0x3D,\
-    0x54,0x47,0x29,0x4D,0x72,0x10,0x4D,\
-    0x54,0xC5,0x39,0x49,0x77,0x7D,0x33,\
-    0x20,0x29,0x51,0x77,0x7D,0x33,0x2A,\
-    0x6B,0x68,0x05,0x62,0x85,0x39,0x2A,\
-    0xA9,0x77,0x7D,0x33,0x2A,0x21,0xD4,\
-    0x77,0x69,0x27,0x2F,0x73,0x6F,0x11,\
-    0x7F,0x0D,0x00,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x03,0x77,0x21,0x33,0x31,\
-    0xFD,0x77,0x6B,0x4F,0xEC,0x39,0x6F,\
-    0x35,0x79,0x57,0x2D,0x60,0x68,0x11,\
-    0x7F,0x0D,0x00,0x39,0x78,0x03,0x74,\
-    0x21,0x33,0x31,0xFD,0x77,0x6B,0x4F,\
-    0xEC,0x39,0x6F,0x35,0x79,0x57,0x2D,\
-    0x66,0x68,0x11,0x6D,0x47,0x59,0x27,\
-    0x51,0x77,0x7D,0x33,0x20,0x5E,0x2C,\
-    0x3D,0x54,0x47,0x29,0x4D,0x72,0x10,\
-    0x55,0x57,0x00,0x39,0x78,0x03,0x75,\
-    0x35,0x3F,0xF9,0xD4,0x77,0x6D,0x47,\
-    0xC6,0xFB,0x14,0x77,0x92,0xC6,0xF8,\
-    0x2A,0xA8,0x77,0x7D,0x33,0x20,0x6B,\
-    0x51,0x77,0x7D,0x33,0x2F,0x29,0x51,\
-    0x77,0x7D,0x33,0x2A,0x6B,0x68,0x05,\
-    0x62,0x85,0x39,0x2A,0xA9,0x77,0x7D,\
-    0x33,0x2A,0x21,0xD4,0x77,0x6E,0x27,\
-    0x2F,0x73,0x6F,0x11,0x7F,0x0D,0x00,\
-    0x39,0x78,0x03,0x77,0x21,0x33,0x31,\
-    0xFD,0x77,0x6B,0x4F,0xEC,0x39,0x6F,\
-    0x35,0x79,0x57,0x2D,0x62,0x68,0x11,\
-    0x41,0x59,0x00,0x39,0x78,0x03,0x74,\
-    0x20,0x2B,0x73,0x51,0x77,0x7D,0x33,\
-    0x23,0x5E,0x6E,0x7F,0xB8,0x47,0x3F,\
-    0x59,0x78,0x3D,0x6A,0x21,0x2B,0x73,\
-    0x51,0x77,0x7D,0x33,0x23,0x5F,0x62,\
-    0x7F,0xF8,0x47,0x3F,0x31,0xBD,0x77,\
-    0x6A,0x05,0x2D,0x73,0x7C,0x11,0x6D,\
-    0x47,0xD7,0x07,0x51,0x77,0x7D,0x2B,\
-    0x23,0x2A,0xAF,0x77,0x7D,0x33,0x2D,\
-    0x87,0x54,0x77,0x6A,0x25,0x39,0x39,\
-    0x10,0x7F,0x78,0x47,0x3E,0x5F,0x68,\
-    0x77,0xBF,0x6D,0x45,0x39,0x78,0x03,\
-    0x6D,0x45,0x2C,0x00,0x36,0x43,0x36,\
-    0x39,0x67,0x07,0x6D,0x57,0x3E,0x2B,\
-    0x7D,0xB7,0xD1,0x47,0x39,0x39,0x6F,\
-    0xB5,0xD1,0xB8,0xC6,0xC6,0x90,0xF5,\
-    0xED,0x5D,0xB8,0x31,0xFD,0x77,0x6E,\
-    0x37,0x31,0x16,0x68,0x3F,0x00,0x47,\
-    0x38,0x77,0xD1,0x77,0x7D,0x72,0x29,\
-    0x69,0xE7,0x09,0x6D,0x59,0x00,0x39,\
-    0x78,0x03,0x79,0x0D,0xBE,0x5E,0x72,\
-    0x57,0x11,0x47,0x29,0x55,0x48,0x57,\
-    0x6A,0x97,0x05,0x39,0x97,0x09,0x6D,\
-    0x59,0x39,0x22,0xD8,0x0F,0x6D,0x3F,\
-    0x38,0x73,0xEF,0x11,0x81,0x54,0xC5,\
-    0x39,0x69,0x77,0x7D,0x33,0x22,0x7B,\
-    0x51,0x77,0x7D,0x33,0x23,0x21,0xD4,\
-    0x77,0x68,0x27,0x5B,0x31,0x7D,0x77,\
-    0x6A,0x21,0x65,0x13,0x14,0x77,0x7D,\
-    0x33,0x39,0x49,0x69,0x9E,0xE5,0x55,\
-    0x2C,0xF9,0xD4,0x77,0x6D,0x47,0xC9,\
-    0xFB,0xD4,0x88,0x92,0xB8,0x36,0xBB,\
-    0xE8,0x6D,0xEC,0x45,0x2C,0x39,0x98,\
-    0x6C,0x14,0x47,0x29,0x4D,0x7C,0x77,\
-    0x6C,0x39,0x3F,0x19,0x14,0x77,0x7D,\
-    0x2B,0x19,0x19,0x6F,0xA7,0x51,0x47,\
-    0xC6,0x47,0x68,0x69,0x6D,0x5C,0x89,\
-    0x41,0x68,0x0F,0x6F,0x0D,0xBE,0x5F,\
-    0x84,0x09,0x6B,0x54,0xFE,0x39,0x78,\
-    0x03,0x78,0x54,0xC5,0x39,0x69,0x77,\
-    0x7D,0x33,0x22,0x7B,0x51,0x77,0x7D,\
-    0x33,0x23,0x21,0xEF,0x67,0x79,0x10,\
-    0x39,0x5F,0x68,0x76,0x7D,0x0D,0x00,\
-    0x39,0x78,0x03,0x74,0x21,0x39,0x38,\
-    0x6E,0x58,0x6B,0x6D,0x45,0x39,0x78,\
-    0x03,0x6D,0x37,0x3B,0xD0,0xE0,0x65,\
-    0x78,0x87,0x85,0x00,0x36,0x43,0x36,\
-    0x39,0x68,0x77,0x9D,0x85,0x85,0xC6,\
-    0x97,0x88,0x62,0xC5,0xB9,0x23,0xE9,\
-    0x07,0x6D,0x57,0x00,0x39,0x78,0x03,\
-    0x7E,0x55,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0x47,0x36,0xFB,0xD4,0x88,0x92,0xB8,\
-    0xC9,0xBB,0xE8,0x6D,0xEC,0x5B,0x00,\
-    0x39,0x78,0x03,0x78,0x35,0x39,0x2B,\
-    0x6E,0x07,0x6D,0x57,0x00,0x39,0x78,\
-    0x03,0x79,0xD7,0xB8,0x66,0xE8,0x14,\
-    0x39,0x39,0x3E,0x19,0x14,0x77,0x7D,\
-    0x2B,0x19,0xE8,0xA9,0x57,0x6A,0x97,\
-    0x05,0x39,0x97,0x09,0x6D,0x59,0x39,\
-    0x22,0xD8,0x0F,0x6D,0x3F,0x38,0x73,\
-    0xEF,0x11,0x81,0x54,0xC5,0x39,0x69,\
-    0x77,0x7D,0x33,0x22,0x7B,0x51,0x77,\
-    0x7D,0x33,0x23,0x29,0x6E,0x29,0x6D,\
-    0x54,0xF9,0x39,0x78,0x03,0x78,0x59,\
-    0x00,0x39,0x78,0x03,0x7A,0xF9,0x00,\
-    0x39,0x78,0x03,0x7B,0x21,0x33,0x73,\
-    0x6F,0x10,0x6B,0x5F,0x85,0x39,0x60,\
-    0x17,0x09,0x5F,0x85,0x39,0x6F,0x17,\
-    0x33,0x37,0x31,0x16,0x68,0x3F,0x00,\
-    0x47,0x38,0x77,0xD1,0x77,0x7D,0x72,\
-    0x29,0x25,0x51,0x77,0x7D,0x33,0x2C,\
-    0x69,0xE7,0x67,0x54,0x47,0x29,0x4D,\
-    0x7C,0xE7,0x6B,0x39,0x39,0x27,0x68,\
-    0x3D,0xEA,0x20,0x19,0x19,0x14,0x77,\
-    0x7D,0x2B,0x19,0x49,0x68,0x67,0x6B,\
-    0x96,0xF9,0x19,0x6F,0xA7,0x51,0x47,\
-    0xC6,0x47,0x68,0x69,0x6D,0x5C,0x89,\
-    0x41,0x68,0x0F,0x6C,0x0D,0xBE,0x5F,\
-    0x84,0x64,0x91,0x47,0x38,0x39,0x78,\
-    0x03,0x76,0x05,0x00,0x39,0x78,0x03,\
-    0x77,0x5F,0x85,0x00,0x36,0x43,0x36,\
-    0x39,0x6D,0x35,0xD4,0x47,0x29,0x4A,\
-    0x90,0x5B,0x72,0x69,0x26,0x11,0x37,\
-    0x5D,0x32,0x09,0x4C,0x2B,0x51,0x77,\
-    0x7D,0x33,0x20,0x5E,0x78,0xC5,0x51,\
-    0x47,0xC6,0x5E,0x62,0x07,0x92,0x97,\
-    0x38,0x2A,0xA8,0x77,0x7D,0x33,0x20,\
-    0x58,0x68,0x8B,0x0B,0x09,0x4C,0x77,\
-    0x19,0x67,0x54,0x47,0x29,0x4D,0x73,\
-    0x24,0x6D,0x21,0x1F,0x2A,0x94,0x77,\
-    0x4C,0x47,0x29,0x4D,0x71,0x58,0x51,\
-    0x47,0x29,0x4D,0x68,0x07,0x6D,0x57,\
-    0x00,0x39,0x78,0x04,0x9B,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x72,0x09,0x7B,\
-    0x51,0x77,0x7D,0x33,0x22,0x69,0xE7,\
-    0x39,0x18,0x09,0x48,0x2A,0x94,0x77,\
-    0x6C,0x47,0x29,0x4D,0x72,0x39,0x18,\
-    0x09,0x48,0x7B,0x51,0x77,0x7D,0x33,\
-    0x30,0x49,0x69,0x64,0xAD,0x47,0x29,\
-    0x4D,0x62,0x35,0x14,0x47,0x29,0x4D,\
-    0x64,0x35,0x14,0x47,0x29,0x4D,0x66,\
-    0x44,0x91,0x47,0x38,0x39,0x78,0x03,\
-    0x7D,0x05,0x00,0x39,0x78,0x03,0x7F,\
-    0x54,0xF9,0x39,0x78,0x03,0x7E,0x05,\
-    0x00,0x39,0x78,0x03,0x79,0x05,0x00,\
-    0x39,0x78,0x03,0x78,0x05,0x00,0x39,\
-    0x78,0x03,0x7B,0x54,0xC5,0x39,0x97,\
-    0x77,0x7D,0x33,0x2E,0x7B,0x51,0x77,\
-    0x7D,0x33,0x21,0x7B,0x51,0x77,0x7D,\
-    0x33,0x20,0x19,0x14,0x77,0x7D,0x34,\
-    0xCC,0x31,0xB8,0x77,0x6A,0x4F,0xA9,\
-    0x39,0x6E,0x7F,0xFD,0x47,0x3C,0x31,\
-    0x91,0x77,0x68,0x47,0x29,0x55,0x70,\
-    0x35,0xD4,0x47,0x29,0x4A,0x90,0x39,\
-    0x18,0x09,0x48,0x00,0x36,0x43,0x36,\
-    0x77,0x19,0x39,0x1C,0x68,0x3E,0x09,\
-    0x47,0x77,0x67,0x79,0x16,0x39,0x66,\
-    0x3D,0x2D,0x20,0x3F,0x6A,0x28,0x10,\
-    0x7F,0x27,0x19,0x49,0x68,0x47,0x6A,\
-    0x68,0x39,0x77,0xD1,0x77,0x7D,0x25,\
-    0xC1,0x61,0xE7,0x17,0x7F,0x37,0x39,\
-    0x09,0x6F,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x24,0xAD,0x1F,0xB6,0x59,0x6A,\
-    0x07,0x6C,0x69,0x26,0x77,0x1D,0x39,\
-    0x1C,0x09,0x4C,0x77,0x19,0x58,0x6A,\
-    0x68,0x3F,0x16,0x6D,0x47,0x42,0x47,\
-    0x2B,0x17,0x47,0x77,0x79,0x6B,0x16,\
-    0x39,0x70,0x5D,0x42,0x47,0x25,0x73,\
-    0x28,0x10,0x6B,0x14,0x79,0x5E,0x7C,\
-    0x17,0x49,0x68,0x3C,0x16,0x6E,0x58,\
-    0x6A,0x09,0x80,0x39,0x78,0x14,0x39,\
-    0x08,0xD6,0x39,0x64,0x17,0x79,0x68,\
-    0x3C,0x16,0x6E,0x58,0x6A,0x09,0x80,\
-    0x39,0x78,0x23,0x55,0x08,0xD6,0x39,\
-    0x64,0x17,0x6F,0x37,0x38,0x13,0x77,\
-    0x5B,0x72,0x69,0x26,0x77,0x1D,0x39,\
-    0x1C,0x77,0x16,0x39,0x6E,0xC7,0x11,\
-    0x47,0x38,0x5F,0x60,0x39,0xD4,0x47,\
-    0x29,0x6D,0x14,0x17,0x6F,0x37,0x39,\
-    0x77,0x1D,0x39,0x1C,0x68,0x34,0x16,\
-    0x64,0x58,0x6A,0x6D,0x45,0x39,0x97,\
-    0x83,0x6D,0x0E,0xD4,0x39,0x72,0x7F,\
-    0x79,0x47,0x3E,0x5F,0x92,0x37,0xAD,\
-    0x47,0x45,0x3E,0x68,0x7F,0x79,0x47,\
-    0x3E,0x5E,0x6C,0x31,0xAD,0x27,0xD3,\
-    0x17,0x68,0x4C,0x11,0xC7,0x3C,0x39,\
-    0x70,0x4C,0x11,0x47,0x38,0x39,0x72,\
-    0x4C,0x11,0x58,0x29,0x39,0x74,0x35,\
-    0x40,0x47,0x27,0x00,0x36,0x43,0x36,\
-    0x31,0xBC,0x77,0x6A,0x01,0xFE,0x17,\
-    0x77,0x5F,0x32,0x6D,0x66,0x77,0x1D,\
-    0x3F,0x8A,0x48,0x39,0x15,0x51,0x77,\
-    0x7E,0x47,0x51,0x19,0x54,0x77,0x6D,\
-    0x46,0xCD,0x0B,0x54,0xC1,0x77,0x3F,\
-    0x93,0x43,0x3D,0x57,0x11,0x47,0x2A,\
-    0x39,0x68,0x55,0x11,0x47,0xC6,0xC3,\
-    0x68,0x64,0x28,0x47,0x6C,0x2A,0x2C,\
-    0x77,0x38,0x76,0x78,0x39,0x16,0x59,\
-    0x45,0x47,0x51,0xA7,0xEE,0xC9,0xED,\
-    0x22,0xD3,0x11,0x77,0x5D,0x72,0x6B,\
-    0x26,0x17,0x77,0x39,0x18,0x0F,0xDE,\
-    0x3E,0x64,0x09,0x6C,0x6B,0x00,0x39,\
-    0x7B,0x77,0x05,0x6F,0x45,0x39,0x7B,\
-    0x77,0x6D,0x6D,0x45,0x39,0x97,0x82,\
-    0x6D,0x6D,0x05,0x39,0x61,0xFE,0x05,\
-    0x26,0x39,0xC6,0x38,0x16,0xF5,0x67,\
-    0x74,0x2B,0x70,0x07,0x62,0x95,0x21,\
-    0xEB,0x70,0xA7,0x51,0x47,0xC6,0x73,\
-    0x68,0x11,0x99,0x37,0x38,0xA9,0x69,\
-    0x55,0x6D,0xF5,0x14,0x39,0x77,0x11,\
-    0x49,0x0D,0x2C,0x5F,0x48,0x67,0x54,\
-    0x47,0x29,0x45,0x50,0xC7,0x40,0x47,\
-    0x38,0x5F,0x7C,0x69,0x40,0x47,0x3B,\
-    0x5E,0x70,0xC9,0x51,0x47,0x38,0x5E,\
-    0x7A,0xC9,0x51,0x47,0x3A,0x5E,0x64,\
-    0x09,0x6C,0x65,0x15,0x39,0x00,0xE5,\
-    0xEB,0xF5,0xBC,0x5C,0xC6,0x57,0x6A,\
-    0x6D,0x26,0x15,0x77,0x59,0x72,0x6F,\
-    0x66,0x13,0x37,0x39,0x18,0x09,0x48,\
-    0x71,0x8F,0x48,0x61,0x3F,0x39,0x4D,\
-    0x47,0x01,0x17,0x6F,0x45,0x39,0x78,\
-    0x0B,0x55,0x6D,0x45,0x39,0x97,0x82,\
-    0x4D,0x5D,0xBA,0x00,0x36,0x43,0x36,\
-    0x43,0x76,0x0B,0xC7,0x5C,0x7F,0x39,\
-    0x69,0x09,0x6F,0x67,0x3C,0x6C,0x68,\
-    0x14,0x73,0x5C,0xBF,0x41,0x68,0x57,\
-    0x20,0x67,0x3E,0x6B,0x68,0x05,0x6D,\
-    0x55,0x39,0xE8,0xA9,0x67,0xEB,0x67,\
-    0x3E,0x6D,0x68,0x09,0x6D,0x59,0x39,\
-    0x87,0x6D,0x12,0x8F,0x5C,0x7B,0x39,\
-    0x76,0x6C,0x11,0x47,0xC6,0x39,0x77,\
-    0x16,0x6D,0xB9,0xA7,0x58,0x68,0x89,\
-    0x8B,0x5F,0xBA,0x58,0x68,0x88,0x49,\
-    0x69,0x39,0x87,0x54,0x77,0x6C,0x21,\
-    0x35,0x6B,0x6C,0x16,0x6D,0xB9,0xEB,\
-    0x81,0x54,0x77,0x6E,0x22,0x9D,0x19,\
-    0x6F,0x53,0x72,0x61,0x26,0x11,0x77,\
-    0x5D,0x72,0x6B,0x26,0x17,0x77,0x5F,\
-    0x32,0x6D,0x66,0x77,0x1D,0x39,0x1C,\
-    0x0F,0xDE,0x36,0x6C,0x6F,0x42,0x47,\
-    0x22,0x23,0x47,0x77,0x72,0x6D,0x45,\
-    0x39,0x97,0x82,0x4D,0x5D,0xBD,0x19,\
-    0x6C,0xC7,0x51,0x47,0xBD,0x5E,0x68,\
-    0x76,0x53,0xF7,0x05,0x39,0xE0,0x10,\
-    0x6D,0x47,0xC5,0x89,0x54,0x77,0xE1,\
-    0x20,0x39,0x39,0xE8,0xC7,0x51,0x47,\
-    0x99,0x5E,0x6C,0x17,0x6D,0x46,0x4B,\
-    0x17,0x51,0x77,0x7D,0x3B,0x15,0x19,\
-    0x6F,0x05,0x75,0xA5,0x91,0x22,0x28,\
-    0x77,0x6C,0x67,0x3E,0x7B,0x28,0x3F,\
-    0x2D,0x5C,0x79,0x39,0x6A,0x57,0x6A,\
-    0xA7,0xB1,0x22,0x28,0x77,0x6E,0x5C,\
-    0x7E,0x39,0x6C,0x59,0x54,0x47,0x29,\
-    0x45,0x58,0x57,0x6A,0x35,0x21,0xDB,\
-    0xC0,0x6C,0x2D,0x47,0x3C,0x19,0x6F,\
-    0x35,0x2D,0x0F,0x79,0x22,0x28,0x77,\
-    0x6B,0x67,0x3E,0x00,0x36,0x43,0x36,\
-    0xD9,0xE0,0x6C,0x2D,0x47,0x3E,0x22,\
-    0x2F,0x77,0x65,0x39,0x30,0x45,0x77,\
-    0x55,0x20,0x05,0x08,0x41,0x68,0x57,\
-    0x24,0x67,0x3E,0x6B,0x68,0x05,0x6D,\
-    0x55,0x39,0xE8,0xA9,0x35,0x7D,0x67,\
-    0x3E,0x6D,0x68,0x09,0x6D,0x59,0x39,\
-    0x87,0x6E,0x12,0x8F,0x27,0x39,0x39,\
-    0x96,0x59,0x54,0x47,0x29,0x45,0x4C,\
-    0x57,0x6A,0x35,0x21,0xDB,0xC0,0x6C,\
-    0x2D,0x47,0x38,0x19,0x6F,0x35,0x2D,\
-    0x0F,0x79,0x22,0x28,0x77,0x6F,0x67,\
-    0x3E,0xD9,0xE0,0x6C,0x2D,0x47,0x3A,\
-    0x22,0x2F,0x77,0x69,0x69,0x00,0x39,\
-    0x78,0x0B,0x45,0x67,0x3E,0x4B,0x70,\
-    0x95,0xC5,0x5C,0x79,0x39,0x6D,0x57,\
-    0x6A,0x05,0x79,0x71,0x28,0x6C,0x2D,\
-    0x47,0x3F,0x19,0x6F,0x97,0xE5,0x5C,\
-    0x79,0x39,0x6F,0x6C,0x2A,0x47,0x31,\
-    0x47,0x61,0x0B,0x72,0x65,0x74,0x7B,\
-    0x59,0x0F,0x6D,0x67,0x70,0x19,0x6F,\
-    0x25,0x6D,0x35,0x39,0x2B,0x68,0xA6,\
-    0xAC,0x05,0x29,0x19,0x6F,0x23,0x6D,\
-    0x39,0x39,0x27,0x68,0xC9,0x6B,0x22,\
-    0xDB,0x59,0x68,0x77,0xE7,0x79,0x00,\
-    0x39,0x78,0x0B,0x59,0x37,0x39,0x09,\
-    0x6F,0x97,0xED,0x5C,0x79,0x39,0x69,\
-    0x6C,0x2A,0x47,0x3B,0x45,0x6B,0x09,\
-    0x72,0x65,0x74,0x7B,0x59,0x1F,0x6D,\
-    0x67,0x70,0x19,0x6E,0x25,0x6D,0x35,\
-    0x39,0x2B,0x68,0xA6,0xAC,0x05,0x29,\
-    0x19,0x6E,0x23,0x6D,0x3B,0x39,0x25,\
-    0x68,0xCB,0x6A,0x22,0xDB,0x59,0x26,\
-    0x6C,0x28,0x47,0x38,0x73,0x6D,0x11,\
-    0x63,0x5C,0x45,0x00,0x36,0x43,0x36,\
-    0x39,0x6A,0x77,0x6F,0x5C,0x45,0x39,\
-    0xE0,0x77,0x6E,0x27,0x35,0x22,0x14,\
-    0x77,0x6F,0x47,0x3B,0x22,0x14,0x77,\
-    0x59,0x47,0x3A,0x47,0x77,0x35,0x40,\
-    0x47,0x3D,0x45,0x6D,0x57,0x6A,0x1C,\
-    0x39,0x5A,0x76,0x35,0x58,0x2F,0x39,\
-    0x19,0x25,0x57,0x6B,0x15,0x39,0x4B,\
-    0x68,0x65,0x6D,0x96,0xF8,0x7B,0x78,\
-    0x57,0x6B,0x13,0x39,0x45,0x68,0x6B,\
-    0x6D,0xFB,0x3E,0x5C,0x8A,0x55,0x20,\
-    0x59,0x20,0x45,0x67,0xA9,0x74,0x99,\
-    0x20,0xE5,0x54,0x77,0x92,0x0D,0x3F,\
-    0x5F,0x9C,0x0B,0x6C,0xDB,0x3E,0x22,\
-    0x2E,0x77,0x72,0x26,0x39,0xC5,0xCC,\
-    0x16,0x6D,0xBB,0xD5,0x23,0xD4,0x77,\
-    0xED,0x5C,0x7D,0x39,0x69,0x6C,0x28,\
-    0x47,0x3B,0x47,0x6B,0x0D,0x72,0x05,\
-    0x0C,0x41,0x68,0x57,0x20,0x67,0x3E,\
-    0x6B,0x68,0x05,0x6D,0x55,0x39,0xE8,\
-    0xA9,0x35,0x7D,0x67,0x3E,0x6D,0x68,\
-    0x09,0x6D,0x59,0x39,0x87,0x6D,0x12,\
-    0x8F,0x65,0x74,0x23,0x71,0x09,0x62,\
-    0x9D,0x20,0xE3,0x71,0xA9,0x51,0x47,\
-    0xC6,0x73,0x6F,0x11,0x99,0x39,0x38,\
-    0xA7,0x6D,0x6C,0x2A,0x47,0x26,0x2A,\
-    0xAC,0x77,0x7D,0x3B,0x01,0x58,0x68,\
-    0x8B,0xB3,0x6F,0x39,0x19,0x6C,0x5F,\
-    0x72,0x6D,0x26,0x15,0x77,0x59,0x72,\
-    0x6D,0x66,0x77,0x1D,0x3F,0x8A,0x58,\
-    0x25,0x13,0x47,0x77,0x49,0x69,0x16,\
-    0x39,0x40,0x0F,0x6D,0x61,0x45,0x39,\
-    0x78,0x0B,0x5B,0x05,0x6A,0x13,0x2D,\
-    0x07,0x73,0xF7,0xBE,0x5C,0x68,0x77,\
-    0xCF,0x6F,0x45,0x00,0x36,0x43,0x36,\
-    0x39,0x97,0x82,0x4D,0x5F,0x85,0x39,\
-    0xF8,0x0D,0x6C,0x0D,0x3E,0x5E,0x76,\
-    0x0F,0x6D,0x67,0x75,0x49,0x68,0x67,\
-    0x68,0x96,0xF9,0x29,0xFD,0x07,0x6D,\
-    0x57,0x24,0xE1,0x28,0x25,0x68,0x37,\
-    0x39,0x29,0x6D,0xC9,0xED,0x23,0xDF,\
-    0x0F,0xEC,0x5D,0x6A,0x15,0x3C,0x21,\
-    0x6D,0xCD,0x51,0x47,0x26,0x5D,0x56,\
-    0x09,0x72,0x37,0x39,0x29,0x6D,0xE7,\
-    0xEA,0x4F,0x39,0x39,0x68,0x10,0x7F,\
-    0x67,0x75,0x49,0x68,0x67,0x68,0x96,\
-    0xF9,0x7B,0x78,0x6F,0x68,0x15,0x3D,\
-    0x81,0x6F,0x13,0x73,0x67,0x75,0x49,\
-    0x68,0x67,0x69,0x96,0xF9,0x7B,0x78,\
-    0x57,0x21,0x57,0x3D,0x6B,0x68,0x05,\
-    0x6D,0x55,0x39,0xE8,0xA9,0x35,0x7D,\
-    0x13,0x3D,0x81,0x6F,0x12,0x8F,0x6D,\
-    0x75,0x21,0x75,0x0D,0x62,0x9F,0x24,\
-    0xE1,0x75,0xAD,0x51,0x47,0xC6,0x73,\
-    0x6D,0x11,0x99,0x3D,0x38,0xA3,0x6C,\
-    0x6E,0x28,0x47,0x26,0x58,0x68,0x8C,\
-    0xE5,0x39,0x39,0x58,0x68,0x8C,0xA3,\
-    0x27,0x39,0x38,0x50,0x5F,0x11,0x47,\
-    0xC6,0xCC,0x48,0x6F,0xD1,0x47,0xA9,\
-    0x43,0x69,0x0B,0x6D,0x35,0x27,0x19,\
-    0x24,0x07,0x6D,0x57,0x3C,0xE8,0xA8,\
-    0x67,0xF8,0x37,0x39,0x29,0x75,0xAB,\
-    0x2D,0x15,0x3C,0x83,0x69,0x14,0x87,\
-    0x71,0xBF,0x1F,0x64,0x57,0x2E,0x15,\
-    0xBA,0x23,0x78,0x0B,0x62,0x67,0x7A,\
-    0x6B,0xEB,0xAD,0x7D,0x67,0x7A,0x6B,\
-    0xEB,0xAD,0x7D,0x9B,0x05,0x39,0x97,\
-    0x3D,0x6B,0x21,0xD5,0x45,0x69,0xEB,\
-    0x68,0x5E,0x7F,0x00,0x36,0x43,0x36,\
-    0x39,0x77,0x16,0x6D,0xBC,0x15,0x58,\
-    0x68,0x8C,0x19,0x6D,0x3E,0x1F,0x54,\
-    0x77,0x7D,0x3B,0x01,0x4B,0x8A,0xAD,\
-    0xEC,0x67,0x7A,0x29,0xFC,0x25,0x69,\
-    0x37,0x3A,0xF9,0x6C,0xF7,0x51,0x47,\
-    0xA9,0x21,0xE8,0x07,0x73,0xF7,0xBC,\
-    0x5C,0x68,0x77,0x19,0x39,0x38,0x73,\
-    0x6D,0x10,0x73,0x7B,0x2A,0x19,0x24,\
-    0x07,0x6D,0x57,0x3E,0xE8,0xA8,0x67,\
-    0xF8,0x37,0x39,0x29,0x75,0xAB,0x2D,\
-    0x15,0x3E,0x49,0x68,0x67,0x6A,0xFD,\
-    0xB9,0x5D,0x8E,0x41,0xEB,0x65,0x3C,\
-    0x6B,0x69,0x69,0x6C,0xF5,0x05,0x39,\
-    0x77,0x13,0x0D,0x3B,0x26,0x1B,0x24,\
-    0x07,0x6D,0x57,0x38,0xA9,0xEE,0x7F,\
-    0x6D,0x47,0x39,0x5E,0x7A,0x57,0x21,\
-    0x37,0x39,0x29,0x69,0xA6,0xAD,0x05,\
-    0x29,0x27,0x69,0x25,0x6A,0xF9,0x3F,\
-    0x5D,0x56,0x57,0x24,0x37,0x39,0x29,\
-    0x6F,0xA6,0xAD,0x05,0x29,0x19,0x21,\
-    0x67,0x6A,0x15,0x39,0x4B,0x68,0x65,\
-    0x6D,0x96,0xF8,0x7B,0x78,0x23,0x6A,\
-    0xF9,0x3F,0x5C,0x8A,0x17,0x73,0x39,\
-    0x38,0x05,0x7B,0x05,0x73,0x67,0x75,\
-    0x49,0x68,0x67,0x6A,0x96,0xF9,0x29,\
-    0xFD,0x07,0x6D,0x57,0x24,0xE5,0x28,\
-    0x25,0x6A,0xF9,0x38,0x5A,0x82,0x41,\
-    0xEB,0x65,0x75,0x27,0x71,0x0B,0x62,\
-    0x99,0x20,0xE7,0x71,0xAB,0x51,0x47,\
-    0xC6,0x73,0x6E,0x11,0x99,0x3B,0x38,\
-    0xA5,0x6F,0x6E,0x2B,0x47,0x26,0x58,\
-    0x68,0x8D,0x8B,0x69,0x39,0x73,0x6F,\
-    0x11,0x65,0x37,0x27,0x89,0xED,0x12,\
-    0x6D,0xB8,0x13,0x00,0x36,0x43,0x36,\
-    0x19,0x6F,0x51,0x72,0x6F,0x26,0x13,\
-    0x77,0x5B,0x72,0x69,0x26,0x1F,0x37,\
-    0x5F,0x32,0x6D,0x66,0x77,0x1D,0x39,\
-    0x1C,0x0F,0xDE,0x3E,0x6C,0x6B,0x42,\
-    0x47,0x2E,0x13,0x14,0x77,0x92,0xB2,\
-    0x19,0x2A,0xBD,0x77,0x7D,0x3B,0x01,\
-    0x23,0xD4,0x77,0xF5,0x5C,0x7F,0x39,\
-    0x69,0xCB,0x51,0x47,0x3A,0x5F,0x68,\
-    0x77,0x13,0x69,0x00,0x39,0x78,0x0B,\
-    0x41,0x67,0x3E,0x4B,0x70,0x95,0xC5,\
-    0x5C,0x79,0x39,0x6A,0x57,0x6A,0x05,\
-    0x79,0x71,0x28,0x6C,0x2D,0x47,0x3A,\
-    0x19,0x6F,0x97,0xE5,0x5C,0x79,0x39,\
-    0x6C,0x6C,0x2A,0x47,0x3C,0x17,0x51,\
-    0x77,0x7D,0x3B,0x09,0x19,0x6F,0x05,\
-    0x75,0xA5,0x91,0x22,0x28,0x77,0x6B,\
-    0x67,0x3E,0x7B,0x28,0x3F,0x2D,0x5C,\
-    0x79,0x39,0x6F,0x57,0x6A,0xA7,0xB1,\
-    0x22,0x28,0x77,0x65,0x5C,0x7E,0x39,\
-    0x61,0x0D,0x72,0x65,0x74,0x7B,0x45,\
-    0x77,0x67,0x39,0x32,0x83,0x54,0x77,\
-    0x66,0x24,0x75,0x7B,0x59,0x0F,0x6D,\
-    0x67,0x70,0x19,0x6F,0x25,0x6D,0x35,\
-    0x39,0x2B,0x68,0xA6,0xAC,0x05,0x29,\
-    0x19,0x6F,0x23,0x6D,0x39,0x39,0x27,\
-    0x68,0xC9,0x68,0x22,0xDB,0x59,0x44,\
-    0x0D,0x72,0x05,0x14,0x39,0x6A,0x09,\
-    0x6E,0x67,0x3C,0x6E,0x68,0x14,0x73,\
-    0x05,0x0C,0x41,0x68,0x57,0x20,0x67,\
-    0x3E,0x6B,0x68,0x05,0x6D,0x55,0x39,\
-    0xE8,0xA9,0x35,0x7D,0x67,0x3E,0x6D,\
-    0x68,0x09,0x6D,0x59,0x39,0x87,0x6D,\
-    0x12,0x8F,0x65,0x74,0x27,0x71,0x0D,\
-    0x62,0x99,0x20,0x00,0x36,0x43,0x36,\
-    0xE7,0x71,0xAD,0x51,0x47,0xC6,0x73,\
-    0x6D,0x11,0x99,0x37,0x38,0xA9,0x6F,\
-    0x59,0x6D,0x5C,0x7E,0x39,0x77,0x16,\
-    0x6D,0xBE,0xEF,0x17,0x68,0x3D,0x6A,\
-    0x21,0x39,0x39,0xEE,0x16,0x6D,0xBE,\
-    0xBF,0x23,0xD4,0x77,0xED,0x5C,0x45,\
-    0x39,0xF0,0x77,0x6C,0x5C,0x7F,0x39,\
-    0x6A,0x09,0x6E,0x3B,0x26,0x7B,0x5D,\
-    0x0F,0x6D,0x67,0x74,0x19,0x6F,0x25,\
-    0x6D,0x35,0x39,0x2B,0x68,0xA6,0xAC,\
-    0x05,0x29,0x19,0x6F,0x23,0x6D,0x39,\
-    0x39,0x27,0x68,0xC9,0x6B,0x22,0xDB,\
-    0x1B,0x25,0x6B,0x74,0x39,0x36,0xE5,\
-    0x71,0xAB,0x74,0x99,0x05,0x39,0x97,\
-    0x3D,0x6A,0x21,0xCD,0x49,0x69,0xE7,\
-    0x6B,0x6B,0x39,0x22,0x2E,0x77,0x72,\
-    0x54,0xC5,0x39,0xF0,0x77,0x7D,0x3B,\
-    0x01,0x58,0x68,0x8E,0x1F,0x69,0x39,\
-    0x73,0x6F,0x11,0x4F,0x3B,0x39,0x25,\
-    0x51,0x77,0x92,0xB2,0x3D,0xD8,0x26,\
-    0x6B,0x54,0x47,0xC6,0xCC,0x6D,0xCB,\
-    0x14,0x47,0x29,0x45,0x5E,0x10,0x67,\
-    0x39,0x38,0x2A,0x94,0x77,0x6C,0x47,\
-    0x29,0x45,0x51,0x57,0x6A,0x6D,0x26,\
-    0x15,0x77,0x59,0x72,0x6D,0x66,0x77,\
-    0x1D,0x3F,0x8A,0x78,0x39,0x23,0x47,\
-    0x77,0x72,0x3B,0x39,0x4D,0x6B,0x01,\
-    0x6C,0x3F,0x46,0x63,0xEC,0x58,0x68,\
-    0x68,0x3D,0x58,0x68,0x8D,0x41,0x17,\
-    0xB6,0x17,0x68,0x3D,0x6A,0x21,0x01,\
-    0x73,0x6D,0x11,0x79,0x0F,0x41,0x3B,\
-    0xE0,0x58,0x51,0x47,0x29,0x6F,0xA8,\
-    0x16,0x6D,0xBB,0x07,0x17,0x68,0x27,\
-    0xE2,0x27,0x2B,0x00,0x36,0x43,0x36,\
-    0x71,0x10,0x75,0x59,0x68,0x05,0x39,\
-    0x78,0x23,0xE5,0x26,0x39,0xC5,0x42,\
-    0x59,0x6D,0x17,0xB6,0x73,0x6F,0x11,\
-    0x67,0x68,0x3C,0x58,0x68,0x89,0x45,\
-    0x69,0x39,0x61,0xE7,0xC9,0x6E,0x21,\
-    0x33,0x6B,0x6E,0x16,0x6D,0xBF,0xAF,\
-    0x85,0x6A,0x12,0xC7,0x67,0x3E,0x1D,\
-    0x77,0x51,0x72,0x6F,0x26,0x13,0x77,\
-    0x5B,0x72,0x69,0x26,0x77,0x1D,0x3F,\
-    0x8A,0x58,0x39,0x13,0x47,0x77,0x75,\
-    0x6F,0x16,0x39,0x74,0x59,0x42,0x47,\
-    0x19,0x1A,0xAC,0x77,0x7D,0x3B,0x19,\
-    0x1A,0xAF,0x77,0x7D,0x3B,0x1D,0x1A,\
-    0xAD,0x77,0x7D,0x3B,0x11,0x1A,0xAF,\
-    0x77,0x7D,0x3B,0x15,0x19,0x6D,0xA7,\
-    0xEA,0x14,0xB9,0x1A,0xA8,0x77,0x7D,\
-    0x3B,0x09,0x41,0x69,0x0D,0x6E,0x61,\
-    0x05,0x39,0x68,0x77,0xE1,0x05,0x9E,\
-    0x16,0x6B,0x16,0x6D,0xBE,0xB1,0x17,\
-    0x68,0x27,0xE2,0xF9,0x3C,0x5F,0x66,\
-    0x0B,0x6C,0x05,0x9E,0x58,0x68,0x88,\
-    0x59,0x69,0x39,0x61,0xE7,0x17,0x6F,\
-    0x3B,0x39,0x73,0x6F,0x11,0x45,0xFB,\
-    0x3D,0x5E,0xB0,0x58,0x54,0x47,0x29,\
-    0x45,0x40,0x58,0x54,0x47,0x29,0x45,\
-    0x48,0x16,0x6D,0xBC,0xBD,0x69,0xE7,\
-    0x59,0x6D,0x0D,0x3E,0x5F,0x64,0x07,\
-    0x6E,0x68,0x39,0x58,0x68,0x8A,0xED,\
-    0x69,0x39,0x61,0xE7,0x57,0x6A,0x61,\
-    0x26,0x11,0x77,0x5D,0x72,0x6B,0x26,\
-    0x17,0x77,0x39,0x18,0x68,0x3E,0x17,\
-    0x47,0x77,0x65,0x67,0x16,0x39,0x64,\
-    0x54,0xAA,0x47,0x29,0x45,0x44,0x54,\
-    0xAD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x45,0x58,0x3D,0x54,0x47,0x29,0x5A,\
-    0x90,0x11,0x75,0x26,0x39,0xC1,0xE4,\
-    0x59,0x6D,0x0D,0x3E,0x5F,0x62,0x64,\
-    0x91,0x47,0x38,0x39,0x78,0x14,0x95,\
-    0x27,0x3D,0x19,0x6F,0x17,0x7D,0x05,\
-    0x9E,0x71,0x10,0x77,0xCD,0x26,0x39,\
-    0xC1,0x9E,0x59,0x6D,0x67,0x3E,0x69,\
-    0xE7,0x59,0x72,0x09,0x4C,0x77,0x19,\
-    0x3F,0x8A,0x58,0x39,0x07,0x47,0x77,\
-    0x77,0x05,0x00,0x39,0x78,0x0B,0x54,\
-    0x74,0xFE,0x39,0x78,0x0B,0x59,0x0D,\
-    0x00,0x39,0x78,0x14,0x95,0x21,0x21,\
-    0x58,0x68,0x8F,0x2F,0x69,0x39,0x73,\
-    0x6F,0x11,0x67,0x54,0xC5,0x39,0x69,\
-    0x77,0x7D,0x24,0xC1,0x59,0x6C,0x57,\
-    0x6A,0x27,0x0F,0x4F,0x69,0x0F,0x6E,\
-    0x6D,0x05,0x39,0x68,0x77,0xE5,0x05,\
-    0x9E,0x16,0x6D,0x16,0x6D,0xBF,0x9D,\
-    0x17,0x68,0x27,0xE2,0xF9,0x3D,0x5F,\
-    0x78,0x0B,0x6C,0x37,0x38,0x16,0x68,\
-    0x16,0x6D,0xB9,0x77,0x17,0x68,0x2F,\
-    0xE2,0x27,0x3B,0x45,0x68,0x3D,0x6A,\
-    0x21,0x3D,0x85,0x6B,0x10,0xBB,0x67,\
-    0x3E,0x1F,0x77,0x5F,0x72,0x6D,0x26,\
-    0x15,0x77,0x59,0x72,0x09,0x4C,0x77,\
-    0x19,0x39,0x3B,0x47,0x39,0x16,0x6F,\
-    0x3D,0x54,0x47,0x29,0x5A,0x90,0x11,\
-    0x75,0x26,0x39,0xCE,0xB0,0x59,0x6D,\
-    0x0D,0x3E,0x5F,0x62,0x64,0x91,0x47,\
-    0x38,0x39,0x78,0x14,0x95,0x27,0x3D,\
-    0x19,0x6F,0x17,0x75,0x68,0x17,0x39,\
-    0x78,0x58,0x43,0x47,0x35,0x16,0x46,\
-    0x77,0x65,0x26,0x39,0xC7,0x18,0x59,\
-    0x6D,0x67,0x3E,0x00,0x36,0x43,0x36,\
-    0x76,0x87,0x77,0x61,0x69,0x26,0x77,\
-    0x36,0x39,0x18,0x57,0x00,0x39,0x78,\
-    0x0B,0x54,0x09,0x4C,0x77,0x19,0x39,\
-    0x1C,0x09,0x6F,0xC6,0x90,0x3F,0x8A,\
-    0x78,0x3D,0x45,0x6A,0x57,0x03,0x47,\
-    0x31,0x49,0x68,0x67,0x45,0x47,0x38,\
-    0x04,0x28,0x88,0x91,0x77,0x17,0xC6,\
-    0x94,0x96,0x25,0x7A,0x79,0xC6,0x94,\
-    0x57,0x03,0x47,0x31,0x49,0x68,0x67,\
-    0x45,0x47,0x3B,0x04,0x28,0x88,0x93,\
-    0x79,0x17,0xC6,0x94,0xF9,0x03,0xB8,\
-    0xC7,0x4D,0x68,0xC9,0x11,0x47,0x31,\
-    0x5B,0x68,0x76,0xD7,0x67,0x3E,0x89,\
-    0x14,0x77,0x65,0x25,0x39,0x39,0xD6,\
-    0x47,0x56,0x45,0x3F,0x77,0x93,0x77,\
-    0x6F,0x47,0x2B,0x39,0x4A,0x77,0x5B,\
-    0x47,0x73,0x39,0x34,0x77,0x03,0x47,\
-    0xB9,0x39,0xFA,0x77,0xC9,0x79,0x05,\
-    0x38,0x68,0xEC,0xA0,0x65,0x45,0x39,\
-    0x68,0xF7,0x6D,0x27,0x39,0x39,0xFC,\
-    0x49,0x51,0xB9,0x39,0x13,0x14,0x77,\
-    0x6D,0xC7,0x39,0x1B,0x14,0x77,0x69,\
-    0x47,0x39,0x59,0x68,0x77,0xED,0x79,\
-    0x05,0x3B,0x68,0x5D,0x11,0x47,0x39,\
-    0xB9,0x68,0x55,0x11,0x47,0x38,0x39,\
-    0x68,0x17,0x6D,0x47,0x55,0x07,0x54,\
-    0x73,0x6D,0x6D,0x45,0x39,0x69,0x77,\
-    0x6D,0x65,0x45,0x39,0x69,0xF7,0x6D,\
-    0x27,0x61,0x07,0x54,0x7F,0x6D,0x6D,\
-    0x45,0x39,0x69,0xF7,0x6D,0x65,0x45,\
-    0x39,0x6A,0x77,0x6D,0x27,0x7F,0x07,\
-    0x54,0x67,0x6D,0x6D,0x45,0x39,0x6A,\
-    0x77,0x6D,0x65,0x45,0x39,0x6A,0xF7,\
-    0x6D,0x27,0x0D,0x00,0x36,0x43,0x36,\
-    0x07,0x54,0x57,0x6D,0x6D,0x45,0x39,\
-    0x6A,0xF7,0x6D,0x65,0x45,0x39,0x6B,\
-    0x77,0x6D,0x27,0x1B,0x07,0x54,0x37,\
-    0x6D,0x6D,0x45,0x39,0x6B,0x77,0x6D,\
-    0x65,0x45,0x39,0x6B,0xF7,0x6D,0x27,\
-    0x29,0x07,0x54,0xF7,0x6D,0x6D,0x45,\
-    0x39,0x6B,0xF7,0x6D,0x65,0x45,0x39,\
-    0x6C,0x77,0x6D,0x74,0xC5,0x31,0x68,\
-    0x77,0x92,0xBF,0x39,0x3B,0x11,0xC8,\
-    0x92,0x47,0xC6,0xC1,0x68,0x44,0x91,\
-    0x65,0x05,0x39,0x97,0x8F,0x61,0x37,\
-    0x0F,0xB9,0x2F,0x44,0xAD,0x47,0xC6,\
-    0xC1,0x66,0x4D,0xD1,0xB8,0xC6,0x41,\
-    0x69,0xCF,0x51,0x47,0x38,0x5F,0x68,\
-    0x77,0xDF,0xFB,0x05,0x39,0x6A,0x11,\
-    0x6D,0x47,0x93,0x2A,0x94,0x77,0x38,\
-    0x47,0xC6,0xC3,0x4F,0x64,0x91,0x47,\
-    0x93,0x39,0x97,0x8D,0x4A,0x47,0x40,\
-    0x39,0x69,0x77,0x92,0xBF,0x37,0x4F,\
-    0x68,0x3D,0x14,0x47,0xC6,0xC1,0x64,\
-    0x1D,0x4B,0xFB,0x05,0x39,0x6A,0x11,\
-    0x4D,0x54,0xC5,0x39,0x3D,0x77,0x92,\
-    0xBD,0x1E,0x2A,0x94,0x77,0xC7,0x47,\
-    0xC6,0xC3,0x4F,0x57,0x6E,0x15,0xBA,\
-    0x89,0xD4,0x78,0x92,0xB8,0xC6,0x5C,\
-    0xBE,0x0B,0x6C,0x27,0xEB,0x3B,0x11,\
-    0x88,0x93,0x47,0xC6,0xC1,0x66,0x0F,\
-    0x6D,0x3D,0x39,0x82,0xA1,0x13,0x5B,\
-    0x0D,0x3D,0x5F,0x5A,0xCB,0x51,0x47,\
-    0x3B,0x5F,0x44,0x7B,0x38,0xB8,0xC6,\
-    0x5E,0x6C,0x0F,0x6C,0x27,0xD1,0x6D,\
-    0xE5,0x57,0x68,0x15,0xBC,0x89,0xD4,\
-    0x77,0x6D,0x46,0x39,0x5A,0xB2,0x0D,\
-    0x6D,0x54,0xC5,0x00,0x36,0x43,0x36,\
-    0x39,0x3D,0x77,0x92,0xBD,0x1E,0x2A,\
-    0x94,0x77,0xC7,0x47,0xC6,0xC3,0x4F,\
-    0x17,0xAB,0xFC,0xF0,0x5F,0x6E,0x0B,\
-    0x6D,0x27,0x39,0xC6,0x32,0x57,0x6F,\
-    0x15,0xBB,0x62,0xE8,0x12,0x6D,0xB8,\
-    0x69,0x45,0x69,0x17,0x6D,0xB8,0x73,\
-    0x3B,0x11,0x88,0x90,0x47,0xC6,0xC1,\
-    0x66,0x77,0x14,0x07,0x39,0x39,0x97,\
-    0x8F,0x6D,0x27,0x3B,0x45,0x69,0x57,\
-    0x03,0x47,0x35,0x28,0x2E,0x77,0x6F,\
-    0x0B,0xD7,0x19,0x94,0x88,0xB1,0x09,\
-    0x67,0x77,0x1D,0x39,0x1C,0x09,0x6F,\
-    0xC6,0x90,0x35,0x03,0xB8,0xC7,0x49,\
-    0x68,0x67,0x43,0x47,0x32,0x04,0x28,\
-    0x88,0x91,0x67,0x17,0xC6,0x94,0x95,\
-    0xE5,0x6A,0x79,0xC6,0x94,0x57,0x43,\
-    0xB8,0xC5,0x77,0x36,0x39,0x18,0x45,\
-    0x0D,0x77,0x19,0x39,0x3B,0xB8,0x49,\
-    0x71,0x8F,0x48,0x51,0x6D,0x57,0x39,\
-    0x60,0x5F,0x03,0x47,0x29,0x1F,0x06,\
-    0x77,0x79,0x39,0x39,0x41,0x69,0x57,\
-    0x51,0xB8,0x39,0x31,0x68,0xA7,0xE1,\
-    0x35,0x79,0x8B,0xE8,0x14,0x79,0x6A,\
-    0x75,0xC6,0x1C,0x75,0xC3,0x47,0x39,\
-    0x36,0x97,0x88,0x19,0x6F,0x57,0xC6,\
-    0x1C,0x49,0x51,0x67,0x39,0x73,0xFB,\
-    0x10,0x6D,0x46,0x2D,0x80,0x94,0x77,\
-    0x69,0x47,0x39,0x5D,0x68,0x76,0x67,\
-    0x67,0x35,0x45,0x57,0xBB,0xED,0x61,\
-    0x35,0xAF,0xEE,0x03,0x6D,0xF3,0x05,\
-    0x39,0xE8,0x13,0x7F,0x67,0x77,0x49,\
-    0x68,0x67,0x6F,0x96,0xF9,0x28,0x14,\
-    0x77,0x92,0xB8,0x41,0x6B,0x6A,0x17,\
-    0x85,0x37,0x27,0x00,0x36,0x43,0x36,\
-    0x89,0xFB,0x15,0x65,0x3D,0x27,0x49,\
-    0x8A,0xA6,0xFE,0x27,0x3D,0x13,0x7B,\
-    0x35,0xFE,0x33,0x39,0x8D,0x6D,0x13,\
-    0x75,0x67,0x77,0xE8,0xAE,0x07,0x6D,\
-    0x57,0x3B,0xE8,0xA8,0x07,0x6D,0x57,\
-    0x3B,0x28,0x1D,0x7F,0x6C,0xB8,0x41,\
-    0x6B,0x6A,0x17,0x89,0x68,0x35,0x58,\
-    0x68,0x77,0xAF,0x1F,0xB6,0x04,0x28,\
-    0x88,0x93,0x37,0x79,0xA9,0xEE,0x5A,\
-    0x2D,0xB8,0xC1,0x49,0x68,0x47,0x6A,\
-    0x68,0x39,0x49,0x28,0x58,0x6D,0x68,\
-    0x3A,0x49,0x68,0x47,0x43,0xB8,0xC7,\
-    0x16,0x68,0x3F,0x03,0xB8,0x41,0x58,\
-    0x68,0x77,0xD1,0x08,0xD6,0x39,0x7C,\
-    0x5F,0x6D,0x37,0x39,0x29,0x6D,0xC7,\
-    0xC3,0xB8,0xC1,0x5A,0x54,0x3D,0x69,\
-    0x21,0x01,0x4B,0x28,0xA1,0xEC,0x68,\
-    0x3A,0x58,0x68,0x77,0x17,0x1F,0xB6,\
-    0x04,0x28,0x88,0x93,0x37,0x39,0x09,\
-    0x6F,0x58,0x6D,0x37,0x79,0x16,0x68,\
-    0x58,0x6E,0x37,0x39,0x09,0x46,0x88,\
-    0x93,0x68,0x39,0x19,0x54,0x88,0x92,\
-    0xB8,0x41,0x71,0x1E,0x7F,0x2D,0x26,\
-    0x39,0x39,0x1E,0x38,0x82,0x47,0x2D,\
-    0x11,0x68,0x3D,0x2A,0x20,0x3F,0xB6,\
-    0x11,0x77,0x92,0xBF,0x39,0x1D,0x24,\
-    0x03,0x6D,0xF3,0x3C,0x5D,0x70,0xCF,\
-    0x51,0x47,0x38,0x5E,0x7A,0x07,0x6D,\
-    0x57,0x3B,0x2B,0x72,0xC5,0x58,0x4F,\
-    0x38,0x5E,0x6A,0x0F,0x6C,0x15,0x3B,\
-    0x59,0x8C,0x3D,0x2A,0x20,0x33,0x09,\
-    0x6F,0x31,0x2D,0x86,0x40,0x39,0x97,\
-    0x8F,0x6D,0x67,0x57,0x39,0x64,0x66,\
-    0x29,0x47,0x3B,0x00,0x36,0x43,0x36,\
-    0x75,0x86,0x4B,0x91,0xB8,0x71,0x77,\
-    0x36,0x39,0x18,0x09,0x6F,0xC6,0x90,\
-    0x57,0x51,0x47,0x3A,0xB9,0x68,0xB7,\
-    0xC3,0x47,0x31,0xE9,0xE8,0x5A,0x2D,\
-    0xB8,0xC5,0x09,0x54,0x76,0x6D,0x75,\
-    0x17,0xC6,0x94,0x94,0x05,0x09,0x67,\
-    0x77,0x1D,0x39,0x1C,0x09,0x6F,0xC6,\
-    0x90,0x3F,0x8A,0x48,0x3D,0x17,0x46,\
-    0x77,0x7D,0x3F,0x3B,0x15,0x46,0x77,\
-    0x79,0x9B,0xBE,0x0A,0x94,0x7F,0x6D,\
-    0x47,0xC6,0xC1,0x68,0x75,0x14,0xF8,\
-    0xC6,0x39,0x97,0x8F,0x6D,0x77,0x17,\
-    0x39,0x72,0xF6,0x14,0x47,0xC6,0xC1,\
-    0x68,0x44,0x91,0x67,0x32,0x39,0x97,\
-    0x8F,0x61,0x37,0x0B,0xB9,0x06,0x77,\
-    0x63,0x74,0xF9,0x39,0x97,0x8F,0x63,\
-    0x45,0x40,0xC6,0x93,0x77,0x92,0xBF,\
-    0x37,0x13,0x2F,0x55,0x03,0x47,0x31,\
-    0x82,0xAE,0x13,0x69,0x5D,0xE0,0x59,\
-    0x90,0x5D,0x2A,0x65,0x57,0x39,0x60,\
-    0x05,0x6D,0xFF,0x05,0x39,0x6A,0x11,\
-    0x6D,0x47,0x4F,0x39,0x11,0x77,0x6C,\
-    0x47,0xC6,0xC1,0x66,0x0D,0x6D,0x0D,\
-    0x40,0x39,0x97,0x8F,0x61,0x2D,0x1F,\
-    0x81,0x54,0x77,0x6F,0x21,0x19,0x2A,\
-    0x94,0x77,0x38,0x47,0xC6,0xC3,0x4F,\
-    0x64,0x91,0x47,0x93,0x39,0x97,0x8D,\
-    0x4A,0x67,0x3C,0x6B,0xED,0xC7,0xD1,\
-    0x47,0x39,0xC6,0x97,0x12,0xBB,0x3F,\
-    0x38,0x59,0xBA,0x75,0x14,0xB8,0xC7,\
-    0x39,0x97,0x8F,0x63,0x67,0x7E,0x24,\
-    0x38,0x88,0x92,0x67,0x7E,0x24,0x00,\
-    0x77,0x4D,0xB8,0xC6,0x82,0xAE,0x15,\
-    0x67,0x0D,0x2C,0x00,0x36,0x43,0x36,\
-    0x5F,0x6E,0x25,0xE0,0x15,0xB0,0x59,\
-    0x9A,0xCC,0xAB,0x22,0x3B,0x41,0x68,\
-    0x47,0x6C,0x15,0x78,0x89,0x14,0xCC,\
-    0xED,0x22,0x39,0xC6,0xE4,0x0F,0x6C,\
-    0x27,0x39,0xC6,0xEE,0x75,0x14,0xB8,\
-    0xC4,0x39,0x97,0x8F,0x63,0x47,0x40,\
-    0x79,0x68,0x77,0x92,0xBF,0x39,0x3B,\
-    0x11,0xA8,0x92,0x47,0xC6,0xC1,0x68,\
-    0x57,0x69,0x0B,0xD7,0x19,0x98,0x88,\
-    0x89,0x09,0x67,0x77,0x1D,0x75,0xE5,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x68,\
-    0x3E,0x39,0x14,0x70,0x6D,0x67,0x45,\
-    0x39,0x97,0x8D,0x6D,0x05,0x51,0x39,\
-    0x32,0x75,0x45,0x47,0xC1,0x39,0x3A,\
-    0x77,0x45,0x47,0x38,0x39,0x3A,0x46,\
-    0x11,0x60,0x29,0x39,0x32,0x66,0x11,\
-    0x47,0x79,0x39,0x3B,0x77,0x05,0x46,\
-    0x29,0x39,0x38,0x59,0x51,0x47,0x29,\
-    0x65,0x38,0x39,0x16,0x3F,0x38,0x3B,\
-    0x14,0x8F,0x92,0x69,0x26,0x77,0x1D,\
-    0x3F,0x8A,0x87,0xF9,0x77,0xD1,0x77,\
-    0x7D,0x63,0x65,0x19,0x77,0x55,0x72,\
-    0x67,0x66,0x1B,0x37,0x39,0x1E,0x0F,\
-    0xDE,0xF9,0xA8,0x75,0x14,0xB0,0xC6,\
-    0x39,0x97,0x8D,0x3D,0x09,0x80,0x39,\
-    0x78,0x43,0xC5,0x67,0x26,0x1B,0x77,\
-    0x57,0x32,0x65,0x66,0x77,0x1B,0x3F,\
-    0x8A,0x87,0xF9,0x7B,0xCF,0x39,0xD4,\
-    0x47,0x29,0x0F,0x04,0x2F,0xE2,0x67,\
-    0x26,0x1B,0x77,0x57,0x32,0x65,0x66,\
-    0x77,0x1B,0x3F,0x8A,0x87,0xF9,0x49,\
-    0x69,0x58,0x6D,0x09,0x80,0x39,0x78,\
-    0x41,0x01,0x1F,0xB6,0x19,0x77,0x55,\
-    0x72,0x67,0x66,0x00,0x36,0x43,0x36,\
-    0x1B,0x37,0x39,0x1E,0x09,0x48,0x71,\
-    0x8F,0xB7,0xAD,0x37,0x3B,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x0F,0x04,0x2F,\
-    0xE2,0x67,0x26,0x1B,0x77,0x57,0x32,\
-    0x65,0x66,0x77,0x1B,0x39,0x1C,0x0F,\
-    0xDE,0xF9,0xA8,0x07,0x6E,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x71,0x55,0x61,\
-    0xE7,0x57,0x72,0x65,0x26,0x19,0x37,\
-    0x55,0x32,0x09,0x4A,0x77,0x19,0x3F,\
-    0x8A,0x87,0xF9,0x49,0x6C,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x41,0x01,0x1F,\
-    0xB6,0x19,0x77,0x55,0x72,0x67,0x66,\
-    0x1B,0x37,0x39,0x1E,0x09,0x48,0x71,\
-    0x8F,0xB7,0xAD,0x37,0x3C,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x0F,0x04,0x2F,\
-    0xE2,0x67,0x26,0x1B,0x77,0x57,0x32,\
-    0x65,0x66,0x77,0x1B,0x39,0x1C,0x0F,\
-    0xDE,0xF9,0xA8,0x07,0x6B,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x71,0x55,0x61,\
-    0xE7,0x57,0x72,0x65,0x26,0x19,0x37,\
-    0x55,0x32,0x09,0x4A,0x77,0x19,0x3F,\
-    0x8A,0x87,0xF9,0x49,0x6F,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x41,0x01,0x1F,\
-    0xB6,0x19,0x77,0x55,0x72,0x67,0x66,\
-    0x1B,0x37,0x39,0x1E,0x09,0x48,0x71,\
-    0x8F,0xB7,0xAD,0x37,0x31,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x0F,0x04,0x2F,\
-    0xE2,0x67,0x26,0x1B,0x77,0x57,0x32,\
-    0x65,0x66,0x77,0x1B,0x39,0x1C,0x0F,\
-    0xDE,0xF9,0xA8,0x07,0x64,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x71,0x55,0x61,\
-    0xE7,0x57,0x72,0x65,0x26,0x19,0x37,\
-    0x55,0x32,0x09,0x4A,0x77,0x19,0x3F,\
-    0x8A,0x87,0xF9,0x00,0x36,0x43,0x36,\
-    0x49,0x62,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x41,0x01,0x1F,0xB6,0x19,0x77,\
-    0x55,0x72,0x67,0x66,0x1B,0x37,0x39,\
-    0x1E,0x09,0x48,0x71,0x8F,0xB7,0xAD,\
-    0x37,0x32,0x16,0x68,0x39,0xD4,0x47,\
-    0x29,0x0F,0x04,0x2F,0xE2,0x67,0x26,\
-    0x1B,0x77,0x57,0x32,0x65,0x66,0x77,\
-    0x1B,0x39,0x1C,0x0F,0xDE,0xF9,0xA8,\
-    0x07,0x61,0x68,0x39,0x77,0xD1,0x77,\
-    0x7D,0x71,0x55,0x61,0xE7,0x57,0x72,\
-    0x65,0x26,0x19,0x37,0x55,0x32,0x09,\
-    0x4A,0x77,0x19,0x3F,0x8A,0x87,0xF9,\
-    0x49,0x65,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x41,0x01,0x1F,0xB6,0x19,0x77,\
-    0x55,0x72,0x67,0x66,0x1B,0x37,0x39,\
-    0x1E,0x09,0x48,0x71,0x8F,0xB7,0xAD,\
-    0x37,0x37,0x16,0x68,0x39,0xD4,0x47,\
-    0x29,0x0F,0x04,0x2F,0xE2,0x67,0x26,\
-    0x1B,0x77,0x57,0x32,0x65,0x66,0x77,\
-    0x1B,0x39,0x1C,0x0F,0xDE,0xF9,0xA8,\
-    0x07,0x62,0x68,0x39,0x77,0xD1,0x77,\
-    0x7D,0x71,0x55,0x61,0xE7,0x57,0x72,\
-    0x65,0x26,0x19,0x37,0x55,0x32,0x09,\
-    0x4A,0x77,0x19,0x3F,0x8A,0x87,0xF9,\
-    0x49,0x78,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x41,0x01,0x1F,0xB6,0x19,0x77,\
-    0x55,0x72,0x67,0x66,0x1B,0x37,0x39,\
-    0x1E,0x09,0x48,0x71,0x8F,0xB7,0xAD,\
-    0x37,0x28,0x16,0x68,0x39,0xD4,0x47,\
-    0x29,0x0F,0x04,0x2F,0xE2,0x67,0x26,\
-    0x1B,0x77,0x57,0x32,0x65,0x66,0x77,\
-    0x1B,0x39,0x1C,0x0F,0xDE,0xF9,0xA8,\
-    0x07,0x7F,0x68,0x39,0x77,0xD1,0x77,\
-    0x7D,0x71,0x55,0x00,0x36,0x43,0x36,\
-    0x61,0xE7,0x57,0x72,0x65,0x26,0x19,\
-    0x37,0x55,0x32,0x09,0x4A,0x77,0x19,\
-    0x3F,0x8A,0x48,0x25,0x39,0x14,0x70,\
-    0x6D,0x6D,0x45,0x39,0x97,0x8D,0x6D,\
-    0x5C,0x45,0x39,0x3D,0x77,0x38,0x5C,\
-    0x45,0x39,0xC2,0x77,0x38,0x79,0x05,\
-    0x8F,0x72,0x44,0xAA,0x47,0x2A,0x39,\
-    0x16,0x4F,0x51,0xC7,0x39,0x43,0xC2,\
-    0x0B,0x38,0x6F,0x45,0x39,0x7B,0x77,\
-    0x6D,0x00,0xD5,0x39,0xD9,0x7F,0xFE,\
-    0x47,0x39,0x22,0x2E,0x77,0x38,0x5C,\
-    0x7C,0x39,0x3D,0x4E,0x2A,0x47,0x47,\
-    0x68,0xA4,0x88,0x83,0x39,0xC6,0x6A,\
-    0xEF,0x11,0x91,0x6F,0x26,0x13,0x77,\
-    0x5B,0x72,0x69,0x26,0x1F,0x37,0x5F,\
-    0x32,0x6D,0x66,0x77,0x1D,0x64,0x91,\
-    0x47,0x6C,0x39,0x97,0x8D,0x38,0x54,\
-    0xC5,0x39,0xC2,0x77,0x92,0xBD,0x6C,\
-    0x77,0x1D,0x39,0x1C,0x74,0xC5,0x8F,\
-    0x72,0x77,0x7E,0x47,0x47,0x77,0x1D,\
-    0x39,0x1C,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0x9D,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xA8,0x77,\
-    0x7D,0x1E,0xE1,0x39,0x78,0x2E,0x99,\
-    0x47,0x29,0x63,0x78,0x77,0x7D,0x1D,\
-    0x15,0x39,0x78,0x2D,0x25,0x47,0x29,\
-    0x63,0x0C,0x77,0x7D,0x1D,0xB9,0x39,\
-    0x78,0x2D,0xF1,0x47,0x29,0x63,0xD0,\
-    0x77,0x7D,0x1D,0xED,0x39,0x78,0x2D,\
-    0x9D,0x47,0x29,0x62,0x64,0x77,0x7D,\
-    0x1C,0x11,0x39,0x78,0x2C,0x29,0x47,\
-    0x29,0x62,0x08,0x77,0x7D,0x1C,0x45,\
-    0x39,0x78,0x2C,0xF5,0x47,0x29,0x62,\
-    0xDC,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x39,\
-    0x3B,0xB8,0xC1,0x00,0x36,0x43,0x36,\
-    0x71,0x8F,0x68,0x69,0x7D,0x17,0x39,\
-    0x62,0x41,0x51,0x47,0x39,0x83,0x14,\
-    0x77,0x64,0x22,0x3F,0x49,0x69,0x17,\
-    0x6D,0x47,0x95,0x19,0x14,0x77,0x7D,\
-    0x24,0x8D,0x49,0x68,0x47,0x68,0x6D,\
-    0x49,0x35,0x68,0x44,0x91,0xED,0x93,\
-    0x39,0x68,0x7D,0xC7,0x74,0xC5,0x6C,\
-    0x3D,0x77,0x6D,0x42,0x6D,0x0A,0x94,\
-    0xF7,0xED,0x47,0x39,0x33,0xC2,0x44,\
-    0x91,0xED,0x93,0x39,0x68,0x7D,0xC7,\
-    0x74,0xC5,0x6C,0x3D,0x77,0x6D,0x42,\
-    0x6D,0x03,0xD4,0x47,0x5D,0x6D,0x00,\
-    0x39,0x7B,0x77,0x05,0x35,0x93,0x41,\
-    0x3D,0x57,0x11,0x47,0x2A,0x39,0x68,\
-    0x55,0x11,0x47,0xC6,0xC3,0x68,0x47,\
-    0x51,0xF1,0x23,0x2A,0x2C,0x77,0x38,\
-    0x54,0x78,0x39,0x3D,0x46,0x2D,0x47,\
-    0x47,0x05,0x7D,0x49,0x51,0x47,0xB9,\
-    0xF7,0x2E,0x3D,0x2A,0x21,0x17,0x31,\
-    0x6E,0x77,0x68,0x20,0x37,0x73,0x2F,\
-    0x11,0x49,0x74,0xC5,0xC9,0x98,0x77,\
-    0x6D,0x4D,0x93,0x59,0x76,0x59,0x45,\
-    0x47,0x51,0xA7,0xED,0xC9,0xD1,0x47,\
-    0x92,0x90,0x38,0x12,0xAB,0x74,0xC5,\
-    0x89,0xD8,0x77,0x6D,0x4D,0x93,0x49,\
-    0x69,0x17,0x7D,0x37,0x39,0x59,0x64,\
-    0x47,0x6E,0x15,0x7A,0x6E,0x28,0x12,\
-    0x6D,0xB8,0x51,0x49,0x69,0x51,0x72,\
-    0x6F,0x26,0x13,0x77,0x5B,0x72,0x69,\
-    0x26,0x13,0x37,0x39,0x33,0x09,0x4C,\
-    0x77,0x19,0x39,0x3B,0xB8,0xC1,0x71,\
-    0x8F,0x68,0x71,0x65,0x17,0x39,0x60,\
-    0x5D,0x43,0x47,0x35,0x11,0x46,0x77,\
-    0x7D,0x71,0x05,0x00,0x36,0x43,0x36,\
-    0x39,0x68,0xCF,0xD4,0x47,0x29,0x5A,\
-    0xDC,0x12,0x61,0x67,0x38,0xE9,0xEC,\
-    0xC7,0xD4,0x47,0x29,0x5A,0xB0,0x14,\
-    0x6B,0x37,0x38,0x59,0x68,0x77,0xA3,\
-    0x6F,0x7D,0x1F,0x2D,0x57,0x28,0x67,\
-    0x38,0x6B,0xE8,0x95,0xE5,0x06,0xC9,\
-    0x33,0x96,0x5D,0x25,0x74,0xC5,0x93,\
-    0xC2,0x77,0x6D,0x4D,0x93,0x0A,0x94,\
-    0x22,0x38,0x47,0x39,0x3C,0x3C,0x44,\
-    0x91,0x67,0x19,0x39,0x68,0x7D,0xC7,\
-    0x3D,0x39,0x03,0x7B,0x44,0x91,0xE7,\
-    0x99,0x39,0x68,0x7D,0xC7,0x7F,0xBC,\
-    0x13,0x51,0x77,0x7E,0x47,0x51,0x41,\
-    0xC2,0x05,0x38,0x67,0x45,0x39,0x7B,\
-    0x77,0x6D,0x65,0x45,0x39,0x97,0x8D,\
-    0x6D,0x54,0x78,0x39,0x3D,0x64,0x29,\
-    0x47,0x6C,0x08,0x14,0xC1,0x77,0x47,\
-    0x47,0x05,0x7C,0x49,0x51,0x47,0xB9,\
-    0xF7,0x3B,0x47,0x51,0x47,0xB9,0xF9,\
-    0x2E,0xC7,0x2A,0x20,0x23,0x31,0x6E,\
-    0x77,0x68,0x20,0x3F,0x89,0x2F,0x11,\
-    0x55,0x27,0x37,0x17,0x40,0x77,0x05,\
-    0xD9,0xBC,0x49,0x2C,0xC7,0xEA,0x25,\
-    0xF1,0x59,0x4C,0x57,0x26,0x13,0xB2,\
-    0x88,0xA5,0x13,0x65,0x13,0xB5,0x0F,\
-    0x54,0x77,0x6D,0x27,0x21,0x0A,0x94,\
-    0xE7,0xFD,0x47,0x39,0x33,0xC2,0x44,\
-    0x91,0x47,0x39,0x39,0x68,0x7D,0xC7,\
-    0x37,0x39,0x59,0x48,0x07,0x6C,0x27,\
-    0x25,0x09,0x6B,0x25,0x2E,0x10,0x79,\
-    0x5C,0x68,0x88,0x1F,0x74,0xC5,0xA9,\
-    0xF8,0x77,0x6D,0x4D,0x93,0x0A,0x94,\
-    0x77,0x6D,0x47,0x39,0x33,0xC2,0x07,\
-    0x6C,0x61,0x26,0x00,0x36,0x43,0x36,\
-    0x11,0x77,0x5D,0x72,0x6B,0x26,0x17,\
-    0x77,0x51,0x32,0x6F,0x66,0x13,0x37,\
-    0x39,0x33,0x09,0x4C,0x77,0x19,0x58,\
-    0x60,0x67,0x16,0x39,0x64,0x05,0x6D,\
-    0x65,0x56,0x39,0x60,0x5D,0x2D,0x67,\
-    0x79,0xE8,0x87,0x77,0x7D,0x16,0xF0,\
-    0x39,0x76,0x64,0x91,0x47,0x6C,0x39,\
-    0x97,0x8D,0x38,0x54,0xC5,0x39,0xC2,\
-    0x77,0x92,0xBD,0x6C,0x0A,0x94,0xC1,\
-    0x77,0x47,0x2A,0x39,0x16,0x45,0x51,\
-    0x45,0x39,0x82,0x21,0x10,0x69,0x37,\
-    0x38,0x59,0x6E,0xCC,0xA5,0x22,0xED,\
-    0x49,0x68,0x5D,0x32,0x09,0x4C,0x77,\
-    0x19,0x58,0x60,0x68,0x3E,0x19,0x47,\
-    0x77,0x7D,0x79,0x05,0x3B,0x68,0x5D,\
-    0x11,0x47,0xC6,0xC3,0x68,0x6C,0x11,\
-    0x47,0x6C,0x39,0x3D,0x6C,0x11,0x47,\
-    0x93,0x39,0x3D,0x45,0x51,0xF1,0x23,\
-    0x0A,0xA9,0x77,0x7E,0x47,0x47,0x1B,\
-    0x07,0x77,0x61,0x67,0x79,0x09,0x54,\
-    0x88,0x92,0x16,0xF6,0x39,0x70,0x6C,\
-    0x11,0x47,0x6C,0x39,0x3D,0x6C,0x11,\
-    0x47,0x93,0x39,0x3D,0x44,0xAC,0x47,\
-    0x2A,0x39,0x16,0x49,0x51,0x45,0x39,\
-    0x89,0x31,0x10,0x69,0x37,0x38,0x59,\
-    0x70,0xC4,0xA5,0x24,0xE3,0x22,0x14,\
-    0x77,0x38,0x47,0x6C,0x22,0x14,0x77,\
-    0xC7,0x47,0x6C,0x0A,0xA9,0x77,0x7E,\
-    0x47,0x47,0x49,0x68,0x59,0x72,0x6D,\
-    0x66,0x77,0x1D,0x39,0x1C,0x68,0x3E,\
-    0x16,0x6E,0x4B,0x42,0x47,0x37,0x2A,\
-    0x94,0x77,0x38,0x47,0xC6,0xC3,0x3D,\
-    0x64,0x91,0x47,0x93,0x39,0x97,0x8D,\
-    0x38,0x74,0xC5,0x00,0x36,0x43,0x36,\
-    0x8F,0x72,0x77,0x7E,0x47,0x47,0x16,\
-    0x6E,0x16,0x6D,0xBA,0x0D,0x61,0xE7,\
-    0x59,0x6D,0x0D,0x3E,0x5F,0x4C,0x58,\
-    0x60,0x67,0x45,0x39,0x78,0x14,0xD9,\
-    0x37,0x39,0x09,0x6E,0x3C,0x9D,0x4B,\
-    0x39,0x19,0x05,0x77,0x69,0x0F,0x51,\
-    0xC6,0x96,0x58,0x78,0x26,0x39,0xC6,\
-    0x2A,0x59,0x6D,0x17,0xB6,0x13,0x37,\
-    0x57,0x6A,0x6B,0x26,0x17,0x77,0x39,\
-    0x18,0x09,0x48,0x71,0x8F,0x78,0x6D,\
-    0x69,0x16,0x39,0x7C,0x5D,0x42,0x47,\
-    0x21,0x11,0x47,0x77,0x71,0x0D,0xBE,\
-    0x5F,0x6C,0x07,0x6D,0x27,0x07,0x2A,\
-    0x94,0x77,0x38,0x47,0xC6,0xC3,0x3D,\
-    0x64,0x91,0x47,0x93,0x39,0x97,0x8D,\
-    0x38,0x74,0xC5,0x8F,0x72,0x77,0x7E,\
-    0x47,0x47,0x16,0x6C,0x58,0x68,0x68,\
-    0x3E,0x58,0x68,0x8A,0xF1,0x08,0xD6,\
-    0x39,0x64,0x5B,0x6D,0x0D,0x3F,0x5F,\
-    0x78,0x58,0x6A,0x68,0x3D,0x16,0x6D,\
-    0x16,0x6D,0xB9,0xA5,0x15,0x68,0x38,\
-    0x82,0x47,0x35,0x19,0x6E,0x5F,0x72,\
-    0x6D,0x26,0x15,0x77,0x59,0x72,0x09,\
-    0x4C,0x39,0x68,0x77,0x6D,0x47,0x39,\
-    0x79,0x68,0x77,0x6D,0x27,0x39,0x39,\
-    0x68,0xF7,0x6D,0x47,0x3B,0x39,0x68,\
-    0x77,0x69,0x47,0x39,0x39,0x6E,0x77,\
-    0x6D,0x47,0x31,0x39,0x68,0x77,0x61,\
-    0x47,0x39,0x39,0x78,0x77,0x6D,0x09,\
-    0x48,0x77,0x19,0x77,0x6D,0x47,0x39,\
-    0x39,0x68,0x77,0x6D,0x47,0x39,0x39,\
-    0x68,0x77,0x6D,0x47,0x39,0x39,0x68,\
-    0x77,0x6D,0x47,0x39,0x39,0x68,0x77,\
-    0x6D,0x43,0x4D,0x00,0x36,0x43,0x36,\
-    0x44,0x54,0x45,0x43,0x00,0x49,0x00} //16384
+    0x00,0x00,0x40,0x00,0x00,0x10,0x24,0x00,0x00,0x10,0x24,0x60,0xBF,0x77,0xD1,0x77,\
+    0x7D,0x1B,0x09,0x05,0x02,0x7D,0xFF,0x77,0x1D,0x39,0x1C,0x05,0x00,0x39,0x78,0xAF,\
+    0x0B,0x61,0x05,0x80,0x05,0x00,0x7D,0x05,0x01,0x1B,0xFD,0x6D,0x11,0x01,0x0C,0x99,\
+    0x37,0x38,0x2A,0xA8,0xBF,0x77,0x7D,0x3C,0xCC,0x7B,0x51,0x05,0x00,0xC1,0xDA,0x0B,\
+    0x02,0xC0,0x0B,0x01,0x23,0x39,0x05,0x01,0x2C,0xC4,0xBA,0x05,0x02,0xC7,0x11,0x02,\
+    0x3D,0x7B,0x11,0x05,0x00,0x3B,0xFF,0x77,0x1D,0x17,0x93,0x09,0x4C,0x77,0x3E,0xFF,\
+    0x88,0xBD,0x0F,0xDE,0x36,0x54,0x5D,0x11,0xFF,0x47,0x29,0x5D,0x6E,0x35,0x38,0x7D,\
+    0x05,0xFF,0x32,0xD0,0x39,0xD4,0x47,0x29,0x65,0x58,0xFE,0x05,0x02,0x2C,0x49,0x78,\
+    0x15,0x7E,0x03,0xEF,0xFF,0xC9,0x28,0x22,0xD3,0x58,0x68,0x88,0xE9,0xED,0x09,0x71,\
+    0x00,0x43,0xBD,0x05,0x01,0x2E,0x3D,0x3D,0xE7,0x38,0x2A,0xAD,0x59,0x01,0x05,0x02,\
+    0xC7,0x11,0x54,0xF6,0x77,0x01,0x1D,0x14,0x05,0x00,0xCD,0x73,0x7A,0x10,0xEF,0x6D,\
+    0x47,0xD9,0x73,0x89,0x01,0xCC,0x5F,0x68,0xDB,0x77,0xBB,0x2F,0x01,0x2B,0x5D,0x05,\
+    0x02,0x29,0x57,0xFE,0xAD,0x00,0x6F,0x6C,0xF7,0x05,0x39,0x0D,0x10,0xDD,0x63,0x05,\
+    0x00,0x0E,0x10,0x7F,0x05,0x00,0x0F,0x10,0xFF,0x7B,0x27,0x27,0x2A,0x94,0x77,0x6C,\
+    0x47,0xFF,0x29,0x45,0x76,0x17,0x77,0x54,0xC5,0x39,0xFF,0x6A,0x77,0x7D,0x3B,0x27,\
+    0x59,0x78,0x64,0x77,0x91,0x47,0x3A,0xE9,0x00,0x73,0x27,0x3F,0xB9,0x01,0xBB,0x3B,\
+    0x27,0x07,0x41,0x74,0x79,0x16,0x6B,0x00,0x3B,0xFD,0x24,0x05,0x02,0x21,0x49,0x6D,\
+    0x58,0x6D,0x37,0xF7,0x35,0x16,0x68,0xAD,0x01,0x17,0x2C,0x4D,0xD1,0x7F,0x47,0x3D,\
+    0x76,0x87,0x77,0x7D,0x0D,0x65,0x00,0x7F,0x13,0x6D,0x21,0x6B,0x45,0x61,0x51,0xD7,\
+    0x01,0xFB,0x6A,0x5F,0x05,0x01,0x68,0x07,0x6D,0x77,0x2C,0xBF,0x16,0x68,0x47,0x7E,\
+    0x0F,0xF9,0x2F,0x03,0x73,0xFF,0x00,0x5D,0x6D,0x5F,0xBC,0x07,0x7D,0x25,0xFF,0x2A,\
+    0x7D,0xBE,0x69,0xE7,0xC9,0x2B,0x23,0xDF,0x3D,0x73,0x6D,0x10,0xB7,0x3B,0x04,0x2F,\
+    0x49,0xB5,0x6F,0x59,0x00,0x38,0x29,0x05,0x64,0xAD,0x41,0x01,0x27,0xF5,0xE2,0x9B,\
+    0x00,0x69,0xD7,0x01,0x19,0x2C,0x3D,0x7D,0xFB,0x20,0x7D,0xE3,0x02,0xC0,0x5F,0x54,\
+    0x3D,0x54,0xAE,0x1D,0x01,0x11,0x59,0x68,0x8B,0x41,0x91,0x05,0x01,0x0B,0xAD,0x69,\
+    0x05,0x02,0x65,0x77,0x4D,0x01,0x6F,0x71,0x06,0xC0,0xF4,0x47,0x03,0xD7,0x00,0x38,\
+    0x29,0x00,0x94,0x08,0xD6,0x39,0x59,0x78,0x6D,0x49,0x47,0x01,0x42,0x91,0x3D,0x40,\
+    0x8B,0x59,0x01,0xBF,0x3B,0x35,0x5E,0x68,0x77,0xC5,0x8F,0x02,0x69,0x6F,0x21,0x39,\
+    0x39,0xF6,0x23,0x01,0x0A,0x28,0x05,0x01,0xDB,0x16,0x88,0x41,0x03,0x13,0x69,0x55,\
+    0x41,0x46,0x59,0xFF,0x0F,0x57,0xC6,0x93,0x3F,0x03,0xB8,0xC5,0x6B,0x49,0x6B,0xB3,\
+    0x00,0x27,0x0D,0x45,0x38,0x82,0x71,0x00,0xFF,0x46,0x88,0x96,0x20,0x5B,0x71,0x06,\
+    0x88,0xFD,0x8A,0x23,0x00,0x80,0x07,0x7F,0x68,0x39,0x49,0xB7,0x65,0x58,0x6D,0x35,\
+    0x01,0x59,0x29,0x7D,0x01,0x3D,0xFF,0x43,0xB8,0xDE,0x5E,0x2A,0x0B,0x6D,0x39,0xFF,\
+    0x39,0x43,0x78,0x05,0x6D,0x75,0x3E,0x29,0xFF,0x5E,0x6F,0x87,0xFA,0x39,0x24,0xE8,\
+    0x6F,0xFF,0xB9,0x9B,0x05,0x39,0x79,0x25,0x2A,0xF9,0xFF,0x7C,0x5C,0x80,0x4D,0xEA,\
+    0x68,0x05,0x39,0x47,0x6B,0x08,0x9D,0x41,0x00,0x2D,0x40,0x41,0x00,0x69,0x41,0x03,\
+    0x8F,0x3D,0xC5,0x54,0xF9,0x2B,0x41,0x47,0x02,0xB9,0x00,0x45,0xBF,0x64,0x10,0x6D,\
+    0xB9,0x3D,0x19,0xB9,0x01,0x29,0xFD,0x89,0xA9,0x40,0x2B,0x39,0x5D,0x68,0x8A,0x85,\
+    0xDE,0xBF,0x03,0x20,0x39,0xC4,0xB6,0x25,0x44,0x6D,0xBA,0xED,0xED,0xC7,0x41,0x75,\
+    0x59,0x05,0x01,0x1C,0xE9,0x59,0xFF,0x68,0x8A,0xA9,0x6F,0x26,0x13,0x77,0x5B,0xFF,\
+    0x72,0x69,0x26,0x1D,0x37,0x51,0x32,0x6F,0xDF,0x66,0x13,0x37,0x39,0x33,0x99,0x80,\
+    0x19,0x39,0xFF,0x1C,0x09,0x48,0x71,0x8F,0x74,0x71,0x6D,0xFF,0x56,0x39,0x70,0x51,\
+    0x02,0x47,0x25,0x11,0xFF,0x07,0x77,0x4D,0x65,0x56,0x39,0x4C,0x3D,0xFF,0x38,0x21,\
+    0x3D,0x49,0x69,0x17,0x25,0x65,0xFF,0x35,0x17,0x79,0x0B,0x6C,0x8B,0xBE,0x73,0xFF,\
+    0xEE,0x10,0x67,0x14,0xBE,0x1B,0xEF,0x57,0xFF,0x2A,0x5F,0xA9,0x6B,0x3D,0x59,0x6B,\
+    0xFB,0xFF,0x6C,0x5D,0x78,0x5F,0x2C,0x9E,0xFF,0x21,0xFF,0xB3,0x25,0xEA,0x37,0x39,\
+    0x09,0x7D,0xC9,0xFF,0xED,0x22,0xCD,0x05,0x7D,0x7F,0x6B,0x47,0xF7,0x39,0x5E,0x7A,\
+    0x03,0x80,0x3F,0x15,0x68,0x57,0xFF,0x2C,0x96,0xFF,0x1B,0x39,0xA4,0xAB,0x57,0xFF,\
+    0xA8,0x6B,0x3D,0x07,0x6D,0x6B,0x26,0x17,0xFD,0x77,0x77,0x04,0x18,0x4B,0x16,0x39,\
+    0x96,0x77,0x7F,0x6A,0x21,0x25,0x0A,0x94,0x77,0x6F,0xAD,0x00,0xFF,0x7C,0x07,0x6D,\
+    0x57,0x16,0x39,0x63,0x44,0xBE,0xB5,0x41,0x60,0x7F,0x94,0x47,0x3C,0xCB,0x00,0x61,\
+    0xDE,0x9B,0x01,0x44,0x82,0x47,0x3F,0x0B,0x00,0x65,0x4F,0xD7,0xC0,0x39,0x6D,0x4D,\
+    0xC0,0x35,0x53,0xC2,0x2D,0x77,0xFB,0x1D,0x57,0x69,0x81,0x64,0x35,0x7D,0x05,0x11,\
+    0xFF,0x39,0x69,0x35,0x45,0x47,0x3B,0x31,0xB8,0xFF,0x77,0x69,0x4F,0xE9,0x39,0x68,\
+    0x7F,0xBD,0x6B,0x47,0x3F,0x23,0x02,0x29,0x83,0xC2,0x36,0x19,0x29,0xC0,0xFF,0x23,\
+    0x21,0x29,0xD4,0x77,0x54,0x56,0x45,0xEF,0x39,0x00,0x77,0x6C,0x05,0x00,0x1F,0x77,\
+    0x6F,0xEE,0x05,0x00,0x05,0x77,0x6E,0x05,0x00,0x2F,0x77,0x69,0xF6,0xD7,0xC1,0x13,\
+    0x70,0x6B,0x01,0x58,0x6A,0x79,0x16,0xBF,0x39,0x62,0x7F,0x54,0x47,0x3B,0x11,0x00,\
+    0x67,0xFE,0x09,0x80,0xBE,0x47,0x6A,0x05,0x39,0x89,0x14,0xFF,0x75,0x6D,0x20,0x33,\
+    0x89,0x14,0x74,0x6D,0xFF,0x20,0x75,0x59,0x68,0x77,0xAF,0x37,0x39,0xFF,0x29,0x6F,\
+    0x3D,0x2D,0x20,0x39,0x39,0xD0,0xBE,0x83,0x02,0x40,0x66,0x3D,0x47,0x38,0x5F,0x00,\
+    0x12,0xFF,0x56,0x79,0x39,0x6A,0x58,0x65,0x37,0x3A,0xFE,0x15,0x83,0x07,0xC0,0x05,\
+    0x6D,0x55,0x39,0x19,0xFF,0x69,0x92,0xE5,0x87,0x05,0x39,0x6C,0x75,0xD7,0x54,0x47,\
+    0xC2,0x53,0x01,0xC6,0x6B,0x01,0x67,0x17,0xD5,0xB6,0x47,0x00,0x17,0x47,0x04,0x07,\
+    0xA1,0x02,0x11,0x39,0xD7,0x78,0x77,0x2D,0x41,0x00,0x69,0x41,0x00,0x39,0x29,0xEA,\
+    0xB9,0x01,0x30,0x47,0x22,0x5A,0x83,0x03,0x77,0x7D,0x47,0x7F,0x79,0x16,0x60,0x07,\
+    0x6C,0x68,0x39,0xEB,0x41,0xFF,0x79,0x91,0x4B,0x68,0x65,0x6D,0x67,0x38,0xFF,0xDC,\
+    0xE0,0xB7,0x51,0x47,0x3D,0x3B,0x51,0xDB,0x77,0x96,0x23,0x00,0x62,0xF6,0x15,0x81,\
+    0x62,0x27,0xFF,0xE2,0x69,0x26,0x77,0x1D,0x39,0x1C,0x65,0xED,0x45,0x61,0x41,0x4F,\
+    0x10,0x55,0x40,0x6C,0x20,0x39,0xF7,0x38,0x2A,0x67,0x1D,0x01,0x67,0xC7,0x51,0x47,\
+    0xD7,0x0D,0x5E,0x64,0x05,0x00,0x0F,0x11,0xC0,0xFB,0x27,0xF7,0x39,0x38,0x42,0x4B,\
+    0x83,0x10,0x49,0x4F,0x80,0xFB,0x39,0x6A,0x95,0x00,0x33,0x2A,0x94,0x77,0x59,0xF6,\
+    0x71,0x01,0x7F,0xC4,0xA3,0x40,0x69,0x3F,0x15,0x45,0xBF,0xBC,0x58,0x68,0x89,0xA5,\
+    0x1F,0xD1,0x01,0x93,0xBE,0x81,0x81,0x0C,0x98,0x20,0x0B,0x73,0x7F,0x41,0x2B,0x4F,\
+    0x5E,0x42,0x7F,0xD4,0x49,0x43,0xCB,0xC0,0x5C,0xE3,0x01,0xBF,0x31,0xC1,0x77,0x68,\
+    0x47,0x38,0x9D,0x42,0x2B,0xFF,0x71,0x10,0x74,0x6D,0x26,0x39,0xC7,0xE6,0x7F,0x2F,\
+    0xE2,0x27,0x39,0x39,0xAC,0x47,0x65,0x01,0xEF,0x7A,0x25,0x2D,0x74,0xE7,0x81,0x7F,\
+    0xF7,0x45,0xFF,0x3B,0xE8,0x14,0x6D,0x47,0x97,0x31,0xD1,0xAA,0x1B,0x82,0x62,0x83,\
+    0xC0,0x0D,0x17,0x00,0x45,0x29,0x00,0xE2,0xAA,0x8F,0x10,0x5B,0x8F,0x0E,0x55,0x8F,\
+    0x02,0x03,0x8F,0x02,0x94,0xAB,0x20,0x09,0x8F,0x04,0x40,0x8F,0x08,0x5E,0x8F,0x13,\
+    0xC4,0xED,0x96,0x8F,0x00,0x0D,0x09,0x7F,0x41,0x2B,0x6B,0x28,0xFE,0x8D,0x82,0x7A,\
+    0xC7,0x11,0x45,0xB9,0x5A,0x48,0xEC,0x3B,0x0D,0x35,0x05,0x75,0x15,0x35,0x00,0xA0,\
+    0x2F,0xE2,0x5E,0x3F,0x81,0x16,0x6D,0xB9,0x93,0x5B,0x41,0x77,0x9D,0x41,0xFF,0x65,\
+    0x14,0x79,0x5E,0x6E,0x47,0x51,0x45,0xBF,0x2B,0x59,0x40,0x07,0x4D,0x97,0xC5,0xC0,\
+    0x1B,0x5B,0x6D,0x64,0xDD,0x00,0x0B,0x7D,0x41,0x00,0x69,0xB9,0xC0,0xD5,0x35,0xDD,\
+    0x00,0x6B,0xC3,0x82,0x14,0x05,0x00,0x78,0x47,0xF7,0x51,0x44,0x39,0x3B,0x07,0x1A,\
+    0x79,0x5F,0x60,0xFD,0x3D,0x17,0x01,0x7C,0x10,0x6B,0x77,0x05,0x3B,0xAF,0x7A,0x17,\
+    0x57,0x67,0xAF,0x43,0xD1,0xAF,0x40,0x6F,0xEE,0x05,0x00,0x6C,0x77,0x6F,0x55,0x44,\
+    0x36,0x0A,0x94,0x9B,0x75,0x13,0xA7,0x01,0x7F,0x85,0x01,0x41,0x2B,0x40,0x38,0xFA,\
+    0xF5,0x00,0x99,0xD5,0x81,0x0C,0x98,0x77,0x05,0x38,0xFF,0x68,0x39,0x18,0x09,0x6F,\
+    0xC6,0x90,0x58,0xDF,0x60,0x68,0x3E,0x31,0x51,0xEF,0x00,0x29,0x5D,0xF7,0x66,0x11,\
+    0x65,0x53,0x00,0x4A,0x17,0x6D,0x46,0xFB,0x09,0x1B,0x7B,0x82,0x29,0x41,0x77,0x6C,\
+    0x0D,0xDC,0xB3,0xC0,0xF7,0x40,0xB9,0x5E,0x6C,0x17,0x00,0x2D,0x09,0x57,0x54,0x75,\
+    0x7F,0xFD,0x40,0x78,0x89,0xC0,0x3A,0x77,0x00,0x7F,0x63,0x5A,0x50,0x39,0x6A,0x88,\
+    0x91,0x05,0x00,0x77,0x6B,0x88,0x90,0x05,0x00,0x6C,0x88,0x93,0x05,0x00,0xEF,0x6D,\
+    0x88,0x92,0x79,0xAD,0x02,0xF9,0x45,0x39,0xFD,0x6E,0xAF,0x40,0xE1,0x09,0x54,0x88,\
+    0x97,0x97,0xFF,0x7E,0x04,0x28,0x88,0x97,0x74,0xD7,0xC6,0x5F,0x92,0x77,0x7D,0x3C,\
+    0xCF,0x71,0x00,0x69,0x71,0x01,0xBF,0x10,0x35,0x39,0x3F,0x49,0x68,0xE5,0x41,0x42,\
+    0xFF,0x9E,0x2B,0xED,0x1A,0xB9,0x56,0x20,0x58,0xDB,0x6B,0x5B,0x77,0xC2,0x35,0x3C,\
+    0xFF,0x81,0x3C,0xCF,0xFD,0x13,0xA7,0xC2,0x85,0x69,0x11,0x6B,0x3B,0x39,0xEF,0x49,\
+    0x68,0x17,0x6B,0x05,0xC0,0x6E,0x25,0x6B,0xFF,0x57,0x0C,0x31,0x68,0xC6,0x5C,0x3F,\
+    0x39,0xFF,0x19,0x6F,0x25,0x2D,0x39,0x39,0x07,0x68,0xFF,0x07,0x6D,0x77,0x29,0x65,\
+    0xE8,0xC9,0xED,0xEF,0x2A,0xEF,0x2A,0xAE,0x2F,0x00,0x24,0x15,0x77,0x6F,0x54,0x83,\
+    0xB8,0xC5,0xE9,0x00,0x91,0x6D,0x1F,0x40,0xEF,0x03,0x4D,0x68,0x05,0x0B,0x01,0x68,\
+    0x34,0x71,0xFF,0x01,0x77,0x6B,0x0F,0x57,0xC6,0x92,0x16,0x5F,0x6D,0xBC,0x11,0x1A,\
+    0xA5,0x6D,0x40,0x3D,0x7D,0x00,0x5F,0x43,0xB8,0xC3,0x1A,0xA8,0x0B,0x00,0x31,0x33,\
+    0x84,0x55,0x67,0x79,0x42,0x7A,0xE3,0x00,0x3C,0x89,0x00,0x60,0x97,0x43,0xF7,0x3C,\
+    0xC1,0x7B,0xFD,0x40,0x3C,0xC0,0x09,0x54,0xFF,0x76,0x6D,0x08,0xD6,0x39,0x78,0x17,\
+    0x67,0xBF,0x77,0x05,0x3A,0x68,0x17,0x69,0x85,0x41,0x59,0xFF,0x72,0x6D,0x66,0x77,\
+    0x36,0x39,0x18,0x68,0xEF,0x34,0x16,0x6F,0x5D,0x77,0xC1,0x64,0x7F,0x78,0xDF,0x47,\
+    0x3F,0x5E,0x4C,0x49,0x93,0x81,0x78,0x25,0xF7,0x2A,0x74,0xFE,0x47,0x00,0x7D,0xF9,\
+    0x45,0x3A,0x7F,0x48,0x12,0x7D,0x4F,0xAC,0x39,0x6E,0xD9,0x43,0xF6,0xC5,0xC1,0x62,\
+    0xB8,0x29,0x00,0x3C,0x5E,0x68,0x76,0xE5,0x7B,0x17,0x00,0x6D,0x4B,0x85,0xB3,0x01,\
+    0x13,0x45,0x57,0x7F,0x2C,0x89,0x54,0x77,0x5B,0x25,0x27,0x71,0xC0,0x7F,0xE5,0xF7,\
+    0x05,0x39,0x72,0x10,0x45,0x05,0x00,0xDF,0x48,0x10,0x6D,0x47,0x5F,0x17,0x00,0x59,\
+    0x20,0x7F,0x39,0x39,0x00,0x17,0x6D,0x47,0xEB,0x0B,0x00,0x55,0x56,0x0B,0x00,0x18,\
+    0xA3,0x40,0x07,0x29,0x00,0xF5,0x0B,0xC0,0xFD,0xD6,0x77,0x02,0x60,0xC9,0x11,0x47,\
+    0x3B,0x5E,0xFB,0x6E,0x49,0x69,0x81,0x46,0x65,0x40,0x47,0x38,0xFF,0x49,0x68,0x67,\
+    0x6C,0xF7,0x85,0x39,0x68,0xFF,0x77,0xDD,0x21,0x23,0x22,0x14,0x77,0x7C,0xE7,0x47,\
+    0x3B,0x09,0x3D,0x40,0x59,0xC2,0x65,0x39,0x39,0xFF,0x27,0x69,0xF9,0x11,0x44,0x39,\
+    0x59,0x6C,0xEA,0x2F,0x00,0x08,0x23,0xC0,0x13,0xBD,0x80,0x3A,0x59,0x6D,0xFE,0x4D,\
+    0x00,0x1C,0x16,0x6D,0xBA,0xBD,0x17,0x68,0xFE,0x6B,0x00,0x53,0x58,0x68,0x8A,0xA3,\
+    0x69,0x39,0xFA,0x1D,0x00,0x0D,0x85,0x40,0x45,0x77,0x6C,0x35,0x29,0xDF,0x8B,0xE8,\
+    0x11,0x67,0x09,0xC3,0x80,0x44,0xAD,0x77,0x0D,0x39,0x5F,0x6B,0x03,0x7A,0x44,0x91,\
+    0xC5,0x02,0xAC,0x53,0x01,0x23,0x00,0xC9,0x45,0x25,0x40,0x43,0xF9,0x85,0x5F,0xB9,\
+    0x72,0xFB,0x03,0xC3,0x83,0x11,0x6B,0x79,0x43,0x41,0x67,0x9D,0x79,0x8D,0x80,0x17,\
+    0x69,0x79,0xCF,0x81,0x05,0x01,0x79,0xFF,0x58,0x6A,0x26,0x39,0xC3,0xE4,0x2F,0xE2,\
+    0xEF,0x69,0x26,0x13,0x37,0xA5,0x80,0x48,0x77,0x19,0xFF,0x39,0x1C,0x67,0x05,0xC6,\
+    0x96,0x77,0x6D,0xFF,0x97,0x96,0x39,0x6C,0xC7,0xD1,0x47,0x34,0x5F,0x39,0x68,0x24,\
+    0xAD,0x87,0xCB,0x01,0x6C,0x5F,0xC1,0xFF,0x58,0x6A,0x68,0x3F,0x16,0x6D,0x5D,0x42,\
+    0xFF,0x47,0x29,0x1B,0x47,0x77,0x79,0xFD,0xB8,0xFF,0x5C,0x6C,0x07,0x92,0x27,0x79,\
+    0x47,0x68,0xFF,0x57,0x28,0x6B,0x38,0xA5,0xED,0x93,0xE3,0xFF,0x67,0x38,0xA9,0x6D,\
+    0x05,0x6E,0x85,0x39,0xFF,0x73,0xEE,0x10,0x7D,0x3D,0xC6,0xE7,0xF8,0xFF,0xC9,0xE8,\
+    0x21,0x3B,0x47,0x68,0x2F,0xE5,0xFF,0x14,0xBF,0x5F,0x9A,0x3D,0x6C,0x20,0x2D,0xFF,\
+    0x45,0x97,0x07,0x6D,0x57,0x29,0xE7,0xE8,0xFB,0xC9,0xEB,0x17,0x01,0x25,0xE5,0x14,\
+    0x38,0x5F,0xFF,0x86,0x57,0x6A,0x6D,0x26,0x15,0x77,0x59,0xFD,0x72,0x5F,0x03,0x65,\
+    0x16,0x39,0x60,0x57,0x42,0xFF,0x47,0x35,0x47,0x68,0xE7,0xEC,0x67,0x78,0xFF,0x73,\
+    0xE8,0x10,0x49,0x65,0x39,0x31,0x68,0xFF,0x77,0x6D,0x20,0x33,0x47,0x68,0x69,0x75,\
+    0xFF,0x65,0x39,0x6A,0xE9,0x10,0x7F,0xA5,0xB0,0xEE,0x61,0x40,0x75,0x99,0xB9,0x05,\
+    0x03,0x6A,0xE9,0x11,0xDF,0x9D,0x67,0x3E,0x17,0x77,0xBF,0x01,0x71,0x8F,0xFF,0x70,\
+    0x41,0x5D,0x16,0x39,0x77,0x6B,0x42,0xFF,0x47,0x1A,0x13,0x07,0x77,0x49,0x63,0x56,\
+    0xFF,0x39,0x40,0x35,0x7F,0x69,0x00,0x39,0x6A,0xFB,0x76,0x2D,0xD7,0x04,0xBE,0x89,\
+    0xD4,0x77,0x60,0xFF,0x47,0x39,0x5B,0x68,0x77,0xBB,0x6F,0x40,0xFA,0x17,0x01,0x57,\
+    0x31,0x41,0x4D,0x20,0x3D,0x47,0x9C,0xBF,0x17,0x6F,0x39,0xC6,0x2B,0x44,0x89,0xC2,\
+    0x64,0xFF,0xA5,0x51,0x47,0xEF,0x33,0x69,0x77,0x4C,0xEE,0x97,0x40,0x6A,0xC5,0x6A,\
+    0xF7,0x40,0xC0,0x58,0x66,0xFD,0x61,0x2D,0x81,0x4D,0x59,0x15,0x39,0x69,0x3D,0xFF,\
+    0x7E,0x20,0x35,0xE7,0x54,0x77,0xBB,0x4D,0xF7,0x3E,0x39,0x49,0xAF,0x40,0x3B,0x87,\
+    0x6D,0x11,0xFD,0x2B,0x2F,0xC1,0x58,0x6D,0x68,0x35,0x16,0x65,0xFE,0x6F,0x81,0x0D,\
+    0x98,0x38,0x82,0x47,0x35,0x2B,0xFF,0x7B,0x10,0x47,0x39,0x39,0x73,0x6E,0x10,0xDF,\
+    0x49,0x57,0x0C,0x41,0x68,0x01,0x40,0x35,0xE9,0xFA,0x35,0x01,0x39,0x35,0x03,0x22,\
+    0xE8,0x0F,0x6D,0x67,0xFF,0x3E,0x6B,0x68,0x09,0x6D,0x59,0x39,0x85,0xFF,0x6F,0x15,\
+    0xB1,0x53,0x85,0x39,0x69,0x65,0xE7,0x79,0x59,0x2A,0x7D,0x0B,0x31,0x40,0x38,0x70,\
+    0x9C,0xFF,0x7F,0x6F,0x0D,0x3E,0x5E,0x6C,0x07,0x99,0xFF,0x27,0x3B,0x49,0x97,0x65,\
+    0x41,0x47,0x38,0xFF,0x73,0x6F,0x10,0x61,0x95,0x05,0x39,0xBE,0xEF,0x7D,0x6C,0x47,\
+    0x18,0x27,0x80,0x6F,0xF5,0x39,0xFF,0x5F,0x68,0x88,0x0B,0x61,0x66,0x13,0x77,0xFF,\
+    0x5B,0x72,0x69,0x26,0x1D,0x37,0x5F,0x32,0xD2,0x29,0xC0,0x1D,0x4F,0x40,0xFB,0x09,\
+    0xB8,0xFB,0x03,0x5A,0x6E,0xFD,0x07,0x6F,0x81,0x04,0x57,0x14,0x47,0x3B,0x38,0xFB,\
+    0x28,0x65,0xC3,0x81,0x48,0x10,0x69,0x37,0xCD,0x3F,0x59,0x6A,0x07,0x92,0x59,0x11,\
+    0xDD,0x00,0xA7,0x00,0xFE,0xDD,0x0A,0x68,0x10,0x51,0x59,0x29,0x73,0x69,0x97,0x10,\
+    0x61,0x99,0x71,0x01,0x6A,0x71,0x03,0xEF,0x00,0x6F,0xCF,0x36,0x9D,0x4F,0x3B,0x17,\
+    0x00,0x3B,0x1A,0x11,0xA9,0xFB,0x67,0x31,0x9D,0x42,0x6F,0xC6,0xB0,0x58,0x6A,0xFE,\
+    0x8B,0x54,0xF3,0x0F,0x57,0xC6,0x8F,0x3F,0x03,0xF7,0xB8,0xC1,0x49,0x43,0x40,0x0F,\
+    0x41,0x39,0x95,0xFF,0x16,0x6D,0xB9,0x0D,0x24,0x06,0x88,0x97,0xBB,0xB8,0xC9,0x05,\
+    0x00,0x96,0xB8,0xC8,0x05,0x00,0x91,0xFB,0xB8,0xCB,0x05,0x00,0x90,0xB8,0xCA,0x71,\
+    0x06,0xFB,0x88,0x8B,0x2F,0x00,0x90,0x07,0x6B,0x68,0x39,0xFF,0x71,0x10,0x77,0x91,\
+    0x26,0x39,0xC7,0x60,0xBF,0x6A,0x03,0xB8,0xC3,0xC6,0x84,0x05,0x00,0xC2,0xBB,0xC6,\
+    0x85,0x05,0x00,0xC5,0xC6,0x86,0x05,0x00,0xC4,0xEB,0xC6,0x87,0x53,0x00,0xDC,0x2F,\
+    0x00,0x95,0x37,0x3F,0xBF,0x16,0x68,0x3F,0x15,0x47,0xC2,0x59,0xC0,0xB1,0xBF,0x5A,\
+    0x57,0xC6,0x92,0x88,0x85,0x05,0x00,0x93,0xBB,0x88,0x84,0x05,0x00,0x94,0x88,0x87,\
+    0x05,0x00,0x95,0xFF,0x88,0x86,0x08,0xD6,0x39,0x58,0x3D,0x43,0xEF,0xB8,0xDE,0x5E,\
+    0x7C,0x05,0x00,0xDF,0x5E,0x66,0x7E,0x05,0x00,0xDC,0x5F,0x66,0x17,0x6B,0x37,0x89,\
+    0xC1,0xD5,0xFD,0x05,0x02,0xE7,0x77,0x00,0xB7,0x53,0x00,0xD9,0x49,0x7F,0x6B,0x58,\
+    0x6D,0x37,0x27,0x16,0x68,0xB3,0xC0,0xFF,0xB5,0x76,0x87,0x77,0x7D,0x0D,0x17,0xC6,\
+    0xF7,0xB7,0x10,0x2F,0x05,0x00,0x8A,0x10,0x51,0x67,0x7F,0x17,0xC6,0x84,0x55,0x43,\
+    0xB8,0xC9,0xC3,0xAB,0x7F,0x6A,0x7E,0xC6,0x9C,0x17,0x7F,0x68,0x3B,0x00,0xFD,0x58,\
+    0x3B,0x00,0x58,0x68,0x8B,0xF9,0x6A,0x79,0xEF,0xC6,0x9C,0x27,0xE2,0x4D,0x00,0x80,\
+    0xE7,0xC3,0xFF,0xB8,0xCD,0x7D,0xE8,0xE6,0xED,0x15,0xB9,0xFF,0x2A,0xA8,0x77,0x7D,\
+    0x24,0xD9,0x49,0x69,0xFE,0x2F,0xC0,0x67,0x77,0x1D,0x39,0x3B,0xB8,0xC9,0x6F,0x16,\
+    0x65,0x58,0x61,0xE5,0x57,0x38,0x6A,0xAD,0x00,0xFD,0xCE,0x01,0x42,0x3C,0x16,0x68,\
+    0x07,0x61,0x68,0xB5,0x39,0x59,0x00,0xB7,0xE9,0x00,0x78,0x67,0xF7,0x40,0x45,0xFF,\
+    0x76,0x24,0x6D,0x21,0x39,0x39,0xBC,0x3D,0xFE,0x0B,0x01,0x75,0x10,0x6D,0x47,0xF3,\
+    0x73,0x46,0xFF,0x88,0x9A,0x20,0x1D,0x29,0x51,0x77,0x7D,0xFF,0x3B,0x23,0x89,0x46,\
+    0x88,0x97,0x21,0x21,0xFA,0x0B,0x02,0x22,0x0B,0x00,0x96,0x21,0x35,0x2A,0x94,0xBF,\
+    0x77,0x6C,0x47,0x29,0x5A,0x8A,0xD9,0x40,0x91,0xFD,0x73,0x17,0x00,0x23,0x19,0x5E,\
+    0x4E,0x05,0x6D,0xFD,0x6D,0x17,0xC0,0x0B,0x75,0x57,0x0C,0x21,0x68,0xEF,0x7D,0x6D,\
+    0x47,0x18,0xE1,0x80,0x47,0x5C,0xB9,0xFF,0x21,0x68,0x57,0x6C,0x15,0x39,0x4B,0x68,\
+    0xFF,0x65,0x6D,0x67,0x38,0x62,0x28,0x1A,0x8F,0xFD,0x05,0x65,0xC0,0x14,0x8F,0x26,\
+    0x39,0xC4,0x06,0xFF,0x5F,0x2D,0x0D,0xB5,0x5E,0x00,0x5D,0x11,0xFF,0x47,0x29,0x42,\
+    0x94,0x5D,0xE1,0x7A,0x45,0xDF,0x39,0x6D,0x88,0x99,0x6F,0x41,0x00,0x03,0x4D,0xBF,\
+    0x68,0x34,0x16,0x64,0x58,0x51,0x89,0x00,0x70,0xFE,0xB3,0x00,0xCD,0x77,0xD1,0x77,\
+    0x7D,0x60,0x39,0xFB,0x1A,0xA4,0x7D,0x00,0x3D,0x49,0x68,0x47,0x43,0xB7,0xB8,0xCD,\
+    0x1A,0xFB,0x00,0x3B,0x31,0x6D,0x41,0x68,0xEB,0x2C,0x16,0x95,0x01,0x3D,0x05,0x02,\
+    0x31,0x7B,0xCF,0xF6,0x71,0xC1,0x73,0xC0,0x71,0xC0,0x29,0x73,0x68,0x11,0x7D,0x61,\
+    0xA9,0x40,0x62,0x64,0x91,0x47,0x38,0x71,0x01,0xBF,0x37,0x38,0x11,0x37,0x5D,0x32,\
+    0x2B,0x63,0x39,0x7F,0xDE,0x6A,0x11,0x47,0x38,0xC6,0x90,0x05,0x00,0x77,0xC0,0xC6,\
+    0x91,0x1F,0x41,0x5A,0x88,0xB7,0x05,0x01,0x7D,0x8A,0x05,0x02,0x89,0x6A,0x2D,0xB8,\
+    0xC3,0xF5,0x04,0x7F,0x48,0x05,0x6D,0x57,0x0F,0x21,0x90,0xEF,0x05,0xAF,0x5A,0xB9,\
+    0x21,0x90,0xEF,0x07,0x6E,0xEF,0x00,0x26,0xFF,0x39,0xC5,0xEC,0x5D,0x2D,0x0D,0xB4,\
+    0x5E,0xDB,0x36,0x5F,0xE9,0x02,0x5F,0xE0,0xE9,0x00,0x6B,0x88,0x39,0x9B,0x2B,0x41,\
+    0xE9,0x00,0x35,0x16,0x65,0xED,0x81,0x97,0x40,0xFF,0x9B,0x09,0x80,0x39,0x78,0x50,\
+    0x6D,0x64,0xFD,0xF4,0x43,0x40,0x69,0x37,0x39,0x09,0x46,0x88,0xD7,0x9B,0x64,0xF9,\
+    0x0B,0x00,0x65,0xA3,0x41,0x58,0x79,0xED,0x68,0x37,0x40,0x0B,0x69,0x05,0x02,0x65,\
+    0x05,0x9E,0x76,0x13,0x41,0x0D,0x91,0x6F,0x82,0x39,0x5E,0x6C,0xB3,0x00,0x57,0x3B,\
+    0x49,0x69,0xE9,0xC2,0x36,0x5F,0xC2,0x98,0xF5,0x03,0xFF,0x13,0x4D,0x5A,0x45,0x39,\
+    0x76,0x88,0x95,0xB2,0xAB,0x80,0x9F,0x53,0xC2,0xAB,0x86,0xBD,0xD9,0xAB,0x84,0x9F,\
+    0xBF,0x10,0x67,0x54,0xC5,0x39,0x69,0xCB,0x01,0x59,0x5D,0x2A,0xEF,0x00,0xA3,0xC6,\
+    0x90,0x27,0x86,0x3D,0x29,0xC2,0x9F,0xA3,0x58,0x68,0x8D,0xDF,0x83,0x01,0x05,0xC0,\
+    0xC3,0xFF,0x5F,0x70,0x67,0x43,0xB8,0xC2,0x6A,0x68,0xED,0x11,0x3B,0x0D,0x6E,0x35,\
+    0x19,0x40,0x5D,0x48,0x39,0xDF,0x33,0x09,0x4C,0x77,0x3E,0x71,0x00,0xDE,0x3A,0xFF,\
+    0x64,0x16,0x6D,0xB8,0x4F,0x58,0x68,0x8C,0xFF,0xEB,0x6D,0x79,0x73,0xE5,0x10,0x61,\
+    0x75,0xFE,0xB9,0x00,0x13,0x65,0xF5,0x45,0x39,0x6C,0x13,0x7A,0x47,0xC3,0xDD,0xE9,\
+    0x01,0x0C,0x91,0x7A,0x40,0x17,0x01,0xEF,0xB8,0xC7,0x13,0x14,0x47,0x00,0x11,0x25,\
+    0x7D,0xFF,0x47,0x6C,0x97,0x05,0x39,0x96,0x6D,0xED,0xFD,0x0D,0x2F,0x01,0x4D,0x20,\
+    0x11,0x47,0x68,0x3D,0xF7,0x03,0xB8,0xC7,0x67,0x41,0x55,0x3E,0x29,0x5D,0xFF,0x6F,\
+    0x6D,0x4D,0x39,0x39,0x49,0xA7,0x51,0xFF,0x47,0x13,0x22,0xE8,0x6F,0x6D,0x15,0x3E,\
+    0xFF,0xF7,0x14,0x77,0x92,0xF9,0x57,0xC6,0x96,0x4B,0x12,0x8D,0x39,0x84,0x05,0x53,\
+    0x01,0x55,0x44,0xC7,0x39,0x8E,0xD9,0xC7,0x39,0x83,0x2D,0x81,0x3C,0xC5,0x39,0x91,\
+    0x55,0x6D,0xFB,0x5D,0xBF,0x19,0x40,0x4D,0x0D,0x38,0x5F,0x64,0xFE,0x39,0x84,0x8C,\
+    0x37,0x38,0x59,0x6A,0x07,0x6D,0xEF,0x6B,0x26,0x17,0x77,0x61,0x46,0x48,0x77,0x19,\
+    0xDB,0x39,0x1C,0xAF,0x41,0x37,0x25,0x05,0x01,0x5B,0x41,0xB6,0x05,0x01,0x5D,0x29,\
+    0x05,0x01,0x2B,0x5D,0x05,0x02,0x29,0xAD,0x15,0x05,0x00,0x1B,0x6D,0x0D,0x40,0x19,\
+    0x19,0x41,0x55,0x6D,0x78,0x5F,0x01,0x07,0x00,0x05,0x01,0x70,0x84,0x05,0x01,0xFB,\
+    0x1E,0xD8,0x47,0x05,0x65,0x56,0x39,0x6C,0x57,0xFF,0x02,0x47,0x31,0x29,0x47,0x77,\
+    0x62,0x0D,0x7F,0xB0,0x5E,0x66,0x3D,0x6D,0x20,0x33,0x4B,0x80,0xF7,0x92,0x55,0xE1,\
+    0xC3,0x80,0x9B,0x09,0x4C,0x19,0xFF,0x07,0x77,0x69,0x57,0x16,0x39,0x63,0x3D,0x7F,\
+    0xE5,0x20,0x37,0x73,0x68,0x10,0x67,0x1F,0x40,0x7F,0x97,0x35,0x75,0x0D,0x39,0x5F,\
+    0x9E,0x41,0x03,0xFF,0x3F,0x8A,0x48,0x35,0x25,0x47,0x77,0x72,0xFF,0x6F,0x56,0x39,\
+    0x48,0x7F,0x54,0x47,0x3D,0x7E,0x77,0x00,0x64,0x20,0x39,0x38,0x7C,0x55,0x6F,0x80,\
+    0xFF,0x7B,0x20,0x5D,0x24,0x37,0x39,0x29,0x6E,0xFF,0x9E,0xE5,0x9C,0xF9,0x43,0x68,\
+    0x6D,0x40,0xF7,0x47,0x3B,0x11,0x59,0x00,0xBC,0x39,0x19,0x6D,0xFF,0x9E,0xE5,0x67,\
+    0x79,0x49,0x60,0x9E,0xE5,0xFF,0x55,0x09,0x71,0x69,0xB7,0xD1,0x47,0x39,0xFF,0x39,\
+    0x98,0xB5,0xD1,0xB8,0xC6,0xC6,0x67,0xFF,0xF5,0xED,0x56,0xB8,0x71,0x69,0x59,0x51,\
+    0xFF,0x47,0xC6,0xC2,0x6A,0xCD,0x11,0x47,0x37,0xFF,0x5F,0x44,0x57,0x68,0xAE,0xB1,\
+    0x19,0x28,0x7B,0xA6,0xAA,0x47,0x03,0x94,0xF9,0x09,0x79,0x2F,0x01,0xFF,0x3E,0x97,\
+    0x9C,0xE5,0x75,0x29,0xF9,0xD4,0xFF,0x77,0x6D,0xB8,0xD9,0xFB,0xD4,0x88,0x92,0xFF,\
+    0x47,0x26,0xBB,0xE8,0x47,0xEC,0x67,0x3C,0xFF,0xD0,0xE0,0x55,0x2D,0x45,0x48,0xC6,\
+    0x87,0xFB,0x0F,0x6D,0x05,0x00,0x98,0x0F,0x6D,0x37,0x31,0xFF,0x2B,0x59,0x3F,0x6C,\
+    0x87,0x85,0x39,0x68,0xFF,0x77,0x62,0x85,0x85,0xC6,0x97,0x88,0x9D,0xFF,0xC5,0xB9,\
+    0x2A,0xE9,0x3F,0x6C,0x39,0x39,0x7F,0x73,0x45,0x77,0x6B,0x20,0x11,0x1B,0x8F,0x01,\
+    0xFF,0x3F,0x15,0x6D,0x9E,0xE3,0x67,0x7F,0xE8,0xFF,0xAF,0xA6,0xAC,0x57,0x8D,0x41,\
+    0x68,0x57,0xFF,0x6A,0x15,0x39,0x47,0x68,0x69,0x6D,0xF9,0xFF,0x14,0x39,0x6E,0x12,\
+    0x85,0x67,0x3E,0x68,0xEF,0x28,0x1B,0x4D,0x65,0xF5,0x00,0x8C,0x6B,0x6B,0xFF,0x3C,\
+    0xD0,0xE6,0x57,0x2B,0x96,0xFE,0xE8,0xFF,0xA9,0x35,0x7D,0x67,0x3E,0x6B,0x68,0x09,\
+    0xFF,0x6D,0x59,0x39,0x19,0x6F,0x26,0x2D,0x2A,0xB5,0xD3,0xD1,0x04,0x64,0xD1,0x15,\
+    0x07,0x6C,0x23,0xC0,0x68,0xFF,0x5F,0x72,0x6D,0x26,0x15,0x77,0x59,0x72,0xCF,0x6F,\
+    0x66,0x13,0x37,0x3D,0x42,0xAB,0x80,0x68,0x3F,0xDF,0x25,0x46,0x77,0x66,0xFB,0x39,\
+    0x80,0x11,0x43,0xFF,0x67,0x45,0x39,0x97,0x8D,0xCD,0x57,0x11,0xEF,0x39,0x69,0x93,\
+    0xE5,0xB3,0x02,0x6C,0x6A,0x79,0xFF,0xC6,0x94,0x57,0x11,0x47,0xC6,0xC3,0xC8,0xAF,\
+    0x7F,0xC5,0x47,0x3B,0xED,0x80,0x54,0x05,0x00,0x78,0xFF,0x14,0x85,0x27,0x39,0x38,\
+    0xF0,0xCB,0x51,0xEF,0x47,0x28,0x5F,0x46,0x1D,0x03,0x67,0x45,0x47,0xF7,0x38,0xDB,\
+    0xE0,0x77,0x02,0x69,0x5A,0x2D,0xB8,0xFB,0xC5,0x19,0x99,0x80,0xBD,0x99,0x31,0xC0,\
+    0x77,0xF5,0x6C,0x45,0x80,0x51,0x05,0x00,0x29,0x5A,0x80,0x17,0x7F,0x6D,0x46,0x5D,\
+    0x31,0x51,0x77,0x69,0x0F,0x80,0xFF,0x61,0x10,0x6D,0x46,0x61,0x16,0x65,0x58,0x7F,\
+    0x61,0x68,0x3E,0x49,0x68,0x67,0x6B,0x61,0x42,0xBD,0x91,0x73,0x40,0x68,0x49,0x7D,\
+    0x89,0x77,0x01,0x92,0xFF,0xAF,0xBE,0x49,0x6A,0xC7,0xEA,0x21,0x39,0xFB,0x39,0xEE,\
+    0x8B,0x43,0x07,0x6D,0x57,0x3F,0xD0,0x7F,0xE0,0x5D,0x2D,0x6F,0x74,0xE0,0x94,0x31,\
+    0x41,0x7F,0x16,0x64,0x47,0x58,0x3F,0x39,0xD3,0x71,0x02,0xFF,0x3E,0x97,0x05,0x6A,\
+    0x85,0x39,0x16,0x69,0xFE,0x11,0x09,0x91,0xE5,0x35,0x39,0x2B,0x68,0x58,0xFD,0x6C,\
+    0xA5,0x82,0xFD,0x39,0x39,0x27,0x68,0x38,0xEF,0x82,0x47,0x35,0x87,0x95,0x00,0x20,\
+    0x39,0x39,0x7F,0xAA,0x3D,0x6A,0x2C,0x39,0x39,0xD4,0xB9,0x00,0xFF,0x29,0x7B,0xC8,\
+    0x57,0x6A,0x97,0xB9,0x1B,0xFF,0x68,0xA7,0xED,0x95,0xB9,0xDC,0xE0,0xA5,0x7F,0xED,\
+    0x96,0xF8,0x13,0x38,0x3D,0xE0,0x23,0x00,0xFD,0xF6,0x9B,0x01,0x77,0xFD,0x27,0xE2,\
+    0x27,0x39,0xFF,0x39,0xFA,0x07,0x65,0xF7,0xBE,0x5F,0x68,0xD7,0x77,0x1B,0x69,0x85,\
+    0x41,0x6F,0x09,0x83,0x6D,0x79,0xF7,0x11,0x25,0xAE,0xB3,0x01,0x6E,0x58,0x61,0x77,\
+    0xEF,0x0C,0x41,0x68,0x9D,0x31,0x42,0x70,0x92,0x35,0xF3,0x3E,0xFB,0x77,0x00,0x11,\
+    0x09,0xA1,0xB1,0x4B,0x68,0x6F,0x65,0x6D,0x68,0x38,0x8F,0xC1,0x07,0xA9,0xD9,0x41,\
+    0xDF,0x08,0xD6,0x39,0x64,0xC9,0x37,0x40,0x5E,0x5E,0xBF,0x07,0x12,0x87,0x3E,0x17,\
+    0x68,0x89,0x02,0x38,0xFF,0x57,0x6A,0xAE,0xB1,0xE8,0xA8,0x5D,0x3D,0xEF,0x0D,0xB4,\
+    0x5E,0x76,0x7D,0x06,0x2D,0x49,0x6E,0xFE,0x07,0x40,0x37,0x2A,0xAE,0x77,0x7D,0x2B,\
+    0x31,0xFC,0x49,0x40,0x3D,0x40,0x5A,0x80,0x07,0x6D,0x77,0x00,0xFA,0xA9,0x40,0xE7,\
+    0x9D,0x41,0x07,0x92,0x4A,0xB9,0xF8,0xF5,0x11,0x6D,0x40,0x9D,0xA1,0xC3,0x15,0x77,\
+    0x39,0x33,0xFE,0x77,0xC1,0x39,0x3B,0x47,0x39,0x16,0x6F,0x58,0x57,0x6B,0x68,0x3C,\
+    0xDF,0x41,0x6D,0xB9,0x01,0x6D,0xB9,0x03,0xAA,0x27,0x80,0x6C,0x27,0x81,0x61,0x27,\
+    0x8E,0x61,0xF9,0x84,0x75,0xDF,0x1D,0xB8,0xD6,0x41,0x68,0x73,0x40,0x17,0x39,0xDF,\
+    0x7B,0x65,0x5D,0x1F,0x38,0xE7,0x81,0x47,0x36,0xFE,0xE7,0x81,0xB8,0xC9,0xBB,0xE8,\
+    0x66,0xEC,0x1F,0xFF,0x38,0x19,0x46,0x77,0x61,0xAC,0xB1,0x0B,0xB7,0x58,0x0F,0x6D,\
+    0xE3,0x01,0x88,0x8D,0xDB,0x81,0x77,0x5F,0x72,0xC5,0xB9,0x08,0xE9,0xF9,0x80,0x49,\
+    0xFF,0x82,0xFD,0x49,0xFF,0x81,0x0D,0x17,0x39,0x7F,0x10,0x61,0xBF,0x37,0x39,0x34,\
+    0xA8,0xF6,0x14,0x27,0x80,0xCA,0x7F,0x17,0x67,0x37,0xC6,0x34,0xE8,0xB6,0x0B,0x02,\
+    0xDF,0x5D,0x72,0x6B,0x26,0x17,0xAD,0x03,0x3E,0x77,0xFF,0x6D,0x68,0x3E,0x16,0x6E,\
+    0x58,0x68,0x5B,0x8F,0x17,0x39,0x63,0x5D,0x83,0x01,0x7D,0x01,0xF1,0x40,0x57,0x5F,\
+    0x2D,0x37,0x31,0xD0,0xE0,0x83,0x06,0xC9,0x83,0x02,0xF5,0x36,0x83,0x03,0x17,0x3B,\
+    0xC1,0x3B,0x49,0x69,0x9E,0x5F,0xE5,0x75,0x09,0x41,0x68,0xCB,0x02,0x78,0xCB,0x02,\
+    0x9F,0x87,0xF5,0xED,0x76,0xB8,0xBF,0x3F,0xBF,0x29,0x88,0xFF,0x95,0x0F,0xDE,0x06,\
+    0x6C,0x6A,0x11,0x47,0xFF,0x39,0xC6,0x97,0x63,0x51,0x47,0x39,0x45,0xFF,0x68,0x0D,\
+    0x6D,0x71,0x05,0x3E,0x97,0x49,0xDF,0x51,0x40,0xC6,0x31,0x91,0xFF,0x80,0xC6,0xC3,\
+    0xF7,0xE8,0x35,0x54,0x05,0x00,0xEE,0x7F,0x94,0x47,0xF5,0x3D,0xBB,0x40,0xED,0x8B,\
+    0x40,0x46,0x77,0x67,0xA8,0x57,0xB1,0x2B,0x51,0xBB,0x40,0xBE,0xA1,0x02,0xB9,0xA1,\
+    0x02,0xDF,0x46,0xBB,0xE8,0x64,0xAC,0x29,0x00,0xEF,0x5D,0xFA,0x59,0xC1,0xE1,0xC5,\
+    0x02,0x60,0x9A,0xE5,0x55,0x2C,0xFA,0x23,0x02,0xF9,0x23,0x02,0x06,0xBB,0xE8,0x6D,\
+    0xEC,0xBE,0x41,0x02,0x66,0xA0,0xB1,0x2B,0x7D,0xFB,0x02,0x50,0xBE,0xFB,0x02,0xAF,\
+    0xF5,0xED,0x5D,0xB8,0x53,0xC0,0x43,0xAB,0x47,0x35,0x17,0x04,0x6F,0x17,0x02,0x90,\
+    0x17,0x01,0x2A,0xF7,0x86,0x77,0x64,0x53,0x00,0xE0,0x07,0x6A,0x55,0xEA,0x3F,0x81,\
+    0xEA,0xE3,0xC2,0x6A,0xFB,0x01,0x88,0x95,0xC5,0x77,0xB9,0x2A,0xA9,0x89,0x01,0x41,\
+    0x68,0x55,0x77,0x00,0xF7,0xC2,0x6A,0x55,0x85,0x42,0x57,0x69,0xAE,0xB1,0xFF,0x13,\
+    0x28,0x75,0x58,0x47,0x36,0x21,0x69,0xFF,0x57,0x20,0x96,0xF0,0x3B,0x38,0x88,0x82,\
+    0xFF,0x67,0x3D,0x6B,0x68,0x0F,0x6D,0x5F,0x39,0xFF,0x81,0x14,0x77,0x62,0x2A,0xE7,\
+    0x19,0x54,0x7F,0x77,0x6D,0x40,0xC6,0xD2,0xE0,0x45,0xDD,0x01,0xED,0xF8,0x71,0x01,\
+    0xC6,0x88,0x71,0x01,0x39,0x77,0xF5,0xF7,0xED,0x74,0xF8,0x65,0x00,0xFD,0x37,0x3E,\
+    0x0B,0xEA,0xE3,0x01,0xA9,0xBF,0x02,0x3E,0xBF,0x02,0xC1,0xBB,0xE8,0xED,0x44,0xE3,\
+    0x01,0xF8,0x57,0x2B,0x40,0x46,0x97,0x94,0xAB,0xE5,0x75,0x8F,0x01,0xFF,0x8B,0x42,\
+    0x93,0x8B,0x42,0x6C,0x77,0xC5,0xB9,0x0A,0x8F,0x01,0xAB,0x41,0x68,0x07,0x40,0xDF,\
+    0x29,0x7B,0xF0,0x57,0x69,0xA7,0xC9,0x4B,0x0C,0xFF,0x39,0x66,0x6F,0x6F,0x21,0x25,\
+    0x73,0x46,0xFF,0x88,0x92,0x20,0x35,0x0B,0x5D,0x6F,0x6D,0xFF,0xFC,0x78,0x7F,0x29,\
+    0xB1,0x2C,0x27,0x33,0xFD,0x03,0x0B,0x00,0x5A,0x45,0x39,0x69,0x88,0x92,0xFE,0xA7,\
+    0x05,0x19,0x6C,0x2E,0x2D,0x2A,0xF9,0x49,0xA7,0x68,0x47,0x6E,0xF1,0x40,0x89,0x01,\
+    0xAD,0x89,0x01,0xB8,0xED,0xD9,0x89,0x01,0x47,0x26,0x89,0x04,0xFC,0x07,0x6A,0xD2,\
+    0x83,0x02,0xF9,0x13,0x4B,0x83,0x02,0xAD,0xE3,0x01,0x38,0xC6,0x55,0xDA,0xE3,0x03,\
+    0xFE,0xE3,0x02,0x96,0xE3,0x02,0x69,0xE3,0x04,0x77,0xFB,0x67,0x45,0x5F,0xC0,0x8D,\
+    0x37,0x3D,0xAB,0x80,0xFB,0x45,0x47,0xAB,0x8D,0x2C,0x47,0x38,0x13,0x14,0xCE,0xAB,\
+    0x80,0xDB,0x3B,0x3D,0x3D,0x40,0x29,0x03,0x31,0x2B,0xD7,0x40,0x77,0x6C,0x6B,0x02,\
+    0x62,0x6B,0x02,0x9D,0xC5,0xFF,0xB9,0x28,0x29,0x77,0x6C,0x37,0x39,0x09,0xCF,0x6D,\
+    0x9C,0xE5,0x75,0xEB,0x42,0xA1,0x07,0x4D,0xEC,0xFF,0x45,0x6C,0xC6,0x87,0x75,0x38,\
+    0xB8,0xC9,0xEF,0x39,0x11,0x37,0x6D,0x7B,0x81,0x0D,0x6D,0x6D,0xFF,0x45,0x39,0x78,\
+    0x35,0xF5,0x67,0x3C,0xE9,0xFF,0xE8,0x51,0x6D,0x97,0xB9,0xEF,0xE8,0x92,0xFF,0xE5,\
+    0x91,0xB9,0x35,0x5D,0x77,0x62,0x7F,0xFF,0x3B,0x5F,0x72,0x3D,0x6F,0x20,0x37,0x0F,\
+    0xFF,0x5D,0x4F,0x6D,0x75,0x3A,0x84,0x29,0x31,0xFF,0x2C,0x89,0x78,0x59,0x60,0x4B,\
+    0x58,0x7F,0xFF,0x39,0x2D,0x54,0x77,0x6C,0x67,0x3C,0x6B,0x5E,0x99,0x80,0x5D,0x39,\
+    0x19,0x6D,0x13,0x40,0xFB,0x13,0x40,0x55,0x6A,0x13,0x44,0xA1,0x13,0x50,0xF0,0x13,\
+    0x44,0xF5,0x13,0x50,0x55,0xA1,0x13,0x4A,0xF2,0x13,0x50,0xF7,0xE9,0x02,0x9D,0x13,\
+    0x5C,0x55,0xCB,0x13,0x46,0x9D,0x13,0x58,0x6E,0x13,0x5B,0xF7,0x13,0x42,0xBF,0x09,\
+    0x6D,0x53,0x05,0x39,0x66,0x2D,0x82,0x20,0xFF,0x57,0x6A,0xAE,0xB1,0x25,0x5D,0x7F,\
+    0x6F,0xEF,0xFB,0x3B,0x5E,0x64,0x0B,0x01,0x31,0x5D,0x77,0xFF,0x6D,0x4F,0x3C,0x5E,\
+    0x4A,0x07,0x6C,0x68,0xFF,0x39,0x49,0x60,0x58,0x6D,0x67,0x74,0x19,0xEF,0x6F,0x9E,\
+    0xE5,0x96,0x15,0x81,0x7D,0x68,0x39,0xFF,0x16,0x6E,0x16,0x6D,0xBC,0x45,0x76,0x87,\
+    0xFF,0x77,0x7D,0x27,0x27,0x7B,0xCF,0x07,0x65,0xEF,0x68,0x39,0x19,0x25,0x35,0x01,\
+    0xE8,0xA8,0x07,0xFF,0x6D,0x77,0x29,0x16,0x68,0x58,0x6B,0x26,0xFF,0x39,0xC2,0x34,\
+    0x38,0x82,0x47,0x29,0x19,0xFF,0x6F,0x25,0x6D,0x39,0x39,0x27,0x68,0x57,0xBF,0x6A,\
+    0x1C,0x79,0x54,0xF2,0x0B,0x71,0x01,0x67,0x5E,0x9F,0x84,0x6B,0x97,0xB9,0x13,0x9F,\
+    0x80,0x9D,0x9F,0x80,0xFF,0xAD,0xED,0x59,0x0C,0x61,0x6A,0xC9,0x6F,0xFF,0x20,0x19,\
+    0x87,0x54,0x77,0x63,0x20,0x23,0xFF,0x49,0x69,0x58,0x6D,0x37,0x31,0x16,0x68,0xFE,\
+    0x4D,0x00,0x0C,0x61,0x68,0x58,0x6D,0x68,0x3E,0xFF,0x58,0x68,0x8D,0x0D,0x08,0xD6,\
+    0x39,0x78,0xFF,0x57,0x6B,0x15,0x39,0x45,0x68,0x6B,0x6D,0xFF,0x67,0x3F,0x60,0x28,\
+    0x1A,0xD1,0x77,0x05,0xEF,0x3E,0x88,0xB7,0x14,0xCB,0x00,0xEC,0xF7,0x11,0x6F,0x45,\
+    0x59,0x0A,0xA8,0x67,0x40,0xBD,0x19,0x25,0x40,0xAF,0xBD,0xB9,0x49,0x6F,0x43,0x46,\
+    0x36,0x43,0x42,0xC9,0xFE,0x43,0x47,0xBD,0xBF,0x3B,0x7D,0x77,0x9E,0x45,0xFF,0x2C,\
+    0x39,0x94,0x7F,0xB8,0x47,0x3F,0x31,0x7F,0xBD,0x77,0x6A,0x4F,0x80,0x39,0x6C,0x35,\
+    0x01,0xFF,0x31,0x91,0x77,0x69,0x47,0x29,0x55,0x61,0xFF,0x53,0x72,0x61,0x26,0x11,\
+    0x77,0x5D,0x72,0xFF,0x6B,0x26,0x17,0x77,0x5D,0x32,0x09,0x67,0xFF,0x77,0x1D,0x39,\
+    0x1C,0x05,0x00,0x39,0x78,0xFB,0x1B,0x65,0x79,0x40,0x78,0x1B,0x64,0x4F,0xA9,0xFF,\
+    0x39,0x6F,0x7F,0xFD,0x47,0x3C,0x31,0xF8,0xDB,0x77,0x6B,0x0B,0x00,0x6C,0x55,0xD1,\
+    0x00,0x07,0xF6,0xFF,0xE8,0x91,0x47,0x39,0x39,0x60,0x57,0x22,0xEF,0x67,0xE0,0x09,\
+    0xB1,0x1F,0x40,0x25,0x69,0xE7,0xFF,0x39,0x18,0x45,0x3A,0x39,0x6B,0x75,0x6D,0xFF,\
+    0x09,0x48,0x77,0x19,0x58,0x6A,0x59,0x16,0xFF,0x39,0x63,0x57,0x02,0x47,0x35,0x73,\
+    0x51,0xFF,0x77,0x7D,0x2C,0xC7,0x5F,0x6E,0x07,0x6D,0xFF,0x27,0x39,0x39,0x02,0x7F,\
+    0x54,0x47,0x3E,0xFF,0x39,0x78,0x04,0x98,0x20,0x39,0x39,0x34,0xEF,0x07,0x6D,0x57,\
+    0x3E,0x3D,0x40,0x65,0x68,0x05,0xFE,0x65,0x00,0x4D,0x09,0x80,0x39,0x78,0x43,0x9D,\
+    0x2D,0x89,0xEB,0x40,0x44,0xAA,0x95,0x00,0x72,0x4F,0x40,0x3B,0x02,0xFF,0x2B,0x29,\
+    0x5E,0x62,0x64,0x91,0x47,0x38,0x6E,0x35,0x00,0x9B,0x27,0x23,0x11,0x01,0x24,0xC9,\
+    0x11,0x02,0xFD,0x3D,0x11,0x02,0x31,0x2A,0x94,0x77,0x6E,0x47,0xDF,0x29,0x4A,0x9E,\
+    0x7F,0xD4,0x59,0x03,0x37,0x38,0xFF,0x59,0x6A,0x07,0x6D,0x69,0x26,0x77,0x1D,0xFF,\
+    0x58,0x6A,0x68,0x3F,0x27,0x47,0x77,0x62,0x6F,0x67,0x56,0x39,0x78,0xB3,0x01,0x7B,\
+    0xF0,0x71,0x01,0xD7,0xE9,0xE8,0x55,0x11,0xC0,0xEB,0x11,0xC0,0x95,0xB9,0xFF,0x17,\
+    0x69,0x4B,0x5C,0x3F,0x39,0x85,0x14,0x9F,0x75,0x2C,0x21,0x37,0x7B,0x6B,0x02,0x05,\
+    0x01,0x24,0xFF,0xC9,0x59,0x76,0xCB,0x11,0x40,0xD9,0x5F,0xD7,0x78,0x35,0x54,0x89,\
+    0x00,0x78,0x7D,0x03,0x14,0x9D,0xFA,0x6B,0x02,0x6C,0x11,0x01,0x58,0x65,0x37,0x39,\
+    0x29,0xFF,0x59,0x0F,0x6B,0x68,0x39,0x77,0xD1,0x77,0x5F,0x7D,0x05,0xC9,0x69,0xE7,\
+    0xD7,0x00,0x3C,0xD7,0x02,0xE7,0x71,0x47,0x68,0xF3,0x80,0xBF,0x00,0x10,0x45,0x6B,\
+    0xDF,0x05,0x39,0x68,0x70,0xB9,0x43,0x42,0x4D,0x65,0xFE,0x05,0x00,0x13,0x45,0x54,\
+    0x89,0x41,0x68,0x0F,0xFF,0x6D,0x67,0x3E,0x6B,0x28,0x09,0x6D,0x79,0xFF,0x39,0x8B,\
+    0x2F,0x14,0x69,0xF9,0xBF,0x54,0xC1,0x82,0xB9,0x00,0x3B,0x02,0xC9,0x80,0x09,0x80,\
+    0x07,0x41,0x50,0xF5,0xFF,0x1F,0xB6,0x15,0x77,0x59,0x72,0x09,0x4C,0xF7,0x16,0x65,\
+    0x5D,0x43,0x40,0x29,0x45,0x77,0x6F,0xFF,0xF7,0x05,0x39,0x56,0x11,0x65,0x05,0x40,\
+    0xFE,0x47,0x00,0x7D,0x27,0x0B,0x2A,0xA8,0x77,0x7D,0xFF,0x23,0x11,0x49,0x6C,0x58,\
+    0x6D,0x0F,0x54,0xFF,0x39,0x6B,0x58,0x51,0x47,0x29,0x5D,0x41,0xBF,0x39,0xD4,0x47,\
+    0x29,0x0D,0x98,0xE3,0x00,0x14,0x5D,0x39,0x51,0x81,0x39,0x29,0x7D,0x4D,0x04,0x1D,\
+    0x4B,0x80,0x7D,0x7C,0xD9,0x40,0x4C,0x77,0x19,0x39,0x18,0x9D,0x41,0xBF,0x39,0x1C,\
+    0x4F,0x00,0x39,0x6D,0xEF,0x00,0x21,0xDB,0x5E,0x64,0x35,0x01,0x70,0xE4,0x05,0x02,\
+    0xC4,0x57,0xBE,0xB9,0x00,0x4A,0x90,0x10,0x45,0xF7,0x35,0x00,0x1B,0x6F,0x6D,0x25,\
+    0x19,0x7B,0xDD,0x00,0x34,0xC1,0xE3,0x01,0xFB,0x63,0x29,0x05,0x01,0x0E,0xD5,0x49,\
+    0x69,0x64,0xDF,0xAD,0x47,0x29,0x52,0x95,0x05,0x02,0x96,0x39,0x7F,0x18,0x68,0x3E,\
+    0x2B,0x47,0x77,0x66,0xEB,0x40,0xDB,0x67,0x57,0x61,0x40,0x78,0x20,0x7D,0x00,0x38,\
+    0xE8,0xFF,0xA8,0x65,0x7D,0xF5,0x05,0x39,0x97,0x10,0xF5,0x7B,0xFB,0x01,0x36,0x89,\
+    0x01,0x69,0x36,0x9D,0x49,0xFF,0x39,0x49,0x68,0x67,0x6A,0x96,0xF9,0x2B,0xFF,0x78,\
+    0x69,0x6C,0x0D,0x38,0x52,0x46,0x3D,0xFE,0x6B,0x00,0x52,0x95,0x11,0x69,0x37,0xC6,\
+    0x59,0xED,0x4C,0x3B,0x01,0x7B,0xF4,0x9D,0x4D,0xE8,0xA9,0x7B,0xFF,0x3D,0x07,0x39,\
+    0x5E,0x6C,0x07,0x92,0x27,0xF7,0x3B,0x19,0x6F,0x0D,0x41,0x77,0x19,0x88,0x6D,0xBB,\
+    0xB8,0xC6,0xFB,0xC0,0x92,0xB8,0x38,0x05,0x02,0xC6,0xA9,0xB9,0x05,0x02,0x0B,0x00,\
+    0x6F,0x17,0x04,0xB8,0x17,0x03,0xC6,0xD5,0xEA,0x17,0x04,0xEE,0x17,0x03,0x44,0x1D,\
+    0x03,0xC6,0xBD,0xA6,0x2F,0x05,0x92,0x47,0x11,0x04,0x05,0x13,0x46,0x05,0x00,0x75,\
+    0x94,0x1D,0x16,0x05,0x07,0x74,0x1D,0x16,0x43,0x3B,0x1E,0x05,0x21,0x72,0xFA,0x23,\
+    0x1C,0x41,0x53,0x30,0x70,0x65,0xB8,0xC6,0x38,0xFF,0x48,0x72,0x6D,0x07,0x39,0x31,\
+    0x69,0x77,0xFD,0x6D,0xC5,0xC0,0x68,0x77,0x6D,0x44,0x28,0x3F,0x6F,0x68,0x37,0x6C,\
+    0x4F,0xE7,0x80,0x3E,0x8D,0x11,0x01,0xFF,0x72,0x2C,0x43,0x39,0x79,0x68,0x7F,0x6C,\
+    0xFE,0x1D,0x03,0x47,0x39,0x3F,0x29,0x74,0x6D,0x07,0xDD,0x38,0x2F,0x00,0x7D,0x0E,\
+    0xD9,0x11,0x01,0x40,0xD1,0xDD,0x3E,0x2F,0x0A,0x77,0x7C,0x4E,0x2F,0x03,0x29,0x06,\
+    0x7D,0x44,0x53,0x05,0x47,0x39,0x38,0x69,0x7F,0x65,0x03,0xD7,0x7D,0x78,0xC9,0x11,\
+    0x01,0x46,0x17,0x02,0x45,0x78,0x6F,0x3B,0x68,0x37,0x6D,0x3B,0x01,0x48,0x41,0x29,\
+    0x01,0x5D,0x75,0x2F,0x02,0x70,0x8D,0x46,0x41,0x0A,0x3A,0x41,0x02,0xFF,0x71,0x8F,\
+    0x78,0x61,0x6D,0x56,0x39,0x48,0xFF,0x57,0x20,0x65,0x74,0x19,0xB1,0x57,0xB4,0xFE,\
+    0x47,0xC1,0x03,0x64,0x57,0x28,0x73,0x68,0x10,0xFF,0x6D,0x47,0xFB,0x89,0x54,0x77,\
+    0x6C,0x20,0xFF,0x3D,0x59,0x68,0x76,0xA3,0x57,0x2C,0xD1,0xF7,0xE0,0xB7,0xD1,0x47,\
+    0x00,0x67,0x22,0xED,0x21,0xEF,0x39,0x39,0xC0,0x6D,0x5D,0x80,0x4D,0x62,0x67,0xF7,\
+    0x78,0x87,0x85,0x71,0x00,0x62,0x35,0x39,0x2B,0xB7,0x6D,0xC7,0xEC,0x17,0x00,0xE2,\
+    0x49,0x17,0x01,0x66,0xFD,0x4F,0x05,0x01,0x64,0x07,0x6D,0x77,0x3E,0x11,0xFD,0x28,\
+    0x05,0x00,0x3D,0xA9,0xE4,0x28,0xED,0x24,0xFF,0x3D,0x4B,0x6F,0x17,0x69,0x75,0x3D,\
+    0xAB,0xFF,0x2F,0x0B,0x6D,0x7B,0x38,0x73,0xEE,0x10,0x7F,0x49,0x68,0x3A,0x0F,0x54,\
+    0x88,0x92,0xBF,0xC3,0xFF,0x96,0xF5,0x11,0x20,0x57,0x6B,0x97,0x7A,0xFF,0x45,0x68,\
+    0x4B,0x6D,0x5E,0x8C,0x51,0x69,0xFF,0x1F,0x6D,0x0D,0xBF,0x5F,0x86,0x51,0x72,0xFF,\
+    0x99,0x78,0x0A,0xAF,0x77,0x7D,0x33,0x37,0xFF,0x29,0x6D,0x25,0x6D,0x35,0x36,0xFB,\
+    0x68,0xFB,0x64,0xAC,0x77,0x01,0xCF,0x2A,0x21,0x2D,0x31,0xF7,0x91,0x77,0x68,0x4D,\
+    0xC0,0x9D,0x44,0xA9,0x47,0xFF,0x29,0x55,0x72,0x35,0x7C,0x27,0x39,0x38,0xF7,0x40,\
+    0x25,0x14,0x1D,0x00,0x78,0x17,0x6D,0x46,0x77,0x27,0x7B,0x79,0x05,0x00,0x21,0x31,\
+    0x51,0x23,0x03,0xFF,0x11,0x6D,0x46,0x35,0x29,0x7D,0xB7,0x51,0xFF,0x47,0xC9,0x5F,\
+    0x68,0x77,0x1D,0x4F,0x2C,0x3F,0x39,0x6B,0x11,0x6D,0x47,0x51,0x11,0x00,0xD1,0x01,\
+    0xDF,0x6F,0x28,0xED,0x25,0x63,0x0B,0x07,0x24,0x3D,0xFF,0x43,0x6F,0x17,0x67,0x57,\
+    0x2C,0xF9,0xD4,0xFE,0x1F,0x40,0x3E,0x13,0x68,0x4F,0x68,0x74,0xFC,0xFE,0x13,0x40,\
+    0x61,0x39,0x39,0x07,0x6D,0x3D,0xEA,0xD7,0x20,0x25,0x03,0xB3,0x00,0x6F,0xB3,0x02,\
+    0x67,0x3E,0xFF,0xE9,0x2D,0x09,0x6D,0x79,0x39,0x20,0xDD,0xFF,0x0F,0x6C,0x3F,0x39,\
+    0x73,0xEF,0x11,0x83,0x7B,0x4F,0xC0,0xF5,0xC1,0x34,0xCC,0x0A,0xAC,0xFB,0xC0,0xFD,\
+    0x23,0x83,0x01,0x47,0xAD,0x29,0x7D,0x9F,0xE5,0xF6,0x25,0x43,0x14,0xB9,0x7D,0x00,\
+    0xE9,0x39,0x39,0x27,0xF7,0x45,0x77,0x6C,0x5F,0x04,0x36,0xD8,0x20,0xA9,0xF7,0x2D,\
+    0x74,0xFE,0x5F,0x01,0xF9,0x45,0x3E,0xBD,0x5F,0x15,0x09,0x39,0x3F,0x01,0x5F,0x09,\
+    0x2C,0x5F,0x04,0xBD,0x6F,0x5F,0x03,0x74,0xC5,0x39,0x6E,0x0D,0x41,0x47,0xD7,0x69,\
+    0x64,0xAA,0x07,0x41,0x5F,0xD7,0xC0,0x4D,0x68,0xBF,0x07,0x6E,0xAE,0xB1,0x2B,0x7C,\
+    0xBF,0x02,0x98,0xFB,0xB5,0xD1,0x81,0x80,0x67,0xF5,0xED,0x5F,0xB8,0xFF,0x3B,0x7C,\
+    0x77,0x9D,0x05,0x15,0x39,0x69,0xDF,0x35,0x41,0x47,0x3B,0x2A,0x43,0x41,0x22,0x7B,\
+    0xFD,0x51,0x05,0x00,0x23,0x2B,0xEF,0x67,0x78,0xAF,0x6D,0xB1,0x7D,0x03,0x6E,0xE8,\
+    0x19,0x41,0x1B,0x14,0x17,0x00,0xFF,0x2B,0x29,0x79,0x2A,0x6D,0x21,0x05,0x27,0xDE,\
+    0x23,0x01,0x20,0x5E,0x72,0x3D,0xC1,0x41,0x72,0x10,0xDF,0x63,0x54,0xC5,0x39,0x49,\
+    0x11,0x01,0x2B,0xD4,0xFF,0x77,0x6F,0x27,0x27,0x73,0x6F,0x11,0x77,0xFB,0x0D,0x00,\
+    0xAD,0x00,0x77,0x21,0x2B,0x31,0xD1,0xFB,0x77,0x6B,0x5B,0x41,0x7F,0x94,0x47,0x3E,\
+    0x39,0xFF,0x78,0x04,0x98,0x05,0x28,0x29,0x79,0x26,0x57,0x6D,0x21,0x77,0x41,0x04,\
+    0x44,0x41,0x04,0x4D,0x41,0x05,0xFD,0x29,0x17,0x01,0x2A,0x6B,0x68,0x05,0x62,0x85,\
+    0xA7,0x39,0x2A,0xA9,0x0B,0x01,0x53,0x00,0x69,0x53,0x1D,0x27,0xFF,0x79,0xC9,0x51,\
+    0x47,0x3B,0x5F,0x54,0x64,0xFB,0x80,0x47,0xCF,0x80,0x03,0x7A,0x54,0xD4,0x39,0xB5,\
+    0x6A,0x3B,0x00,0x21,0x01,0x44,0x7B,0x35,0x65,0x01,0x71,0xFE,0x0B,0x02,0x7E,0x65,\
+    0xD1,0x47,0x3A,0x19,0x54,0xBF,0x77,0x6D,0x4E,0xFD,0xE9,0xD1,0x7F,0x40,0x39,0xBB,\
+    0x1A,0xA8,0x8B,0x40,0xC1,0x59,0x42,0x41,0x00,0x3D,0xEB,0x5F,0x4C,0x29,0x04,0x91,\
+    0x47,0x02,0x7B,0x55,0x85,0xFF,0x39,0x6B,0x57,0x51,0x47,0x39,0x30,0xAC,0xBB,0xA7,\
+    0xD4,0x3F,0x80,0x68,0x54,0xAD,0x77,0x00,0x90,0xFF,0x5F,0x72,0x6D,0x26,0x15,0x77,\
+    0x59,0x72,0xFF,0x6F,0x66,0x13,0x37,0x39,0x18,0x68,0x34,0xDF,0x16,0x64,0x58,0x6A,\
+    0x6D,0x8B,0x40,0x04,0x98,0xEE,0x33,0x80,0x6F,0x10,0x67,0xA7,0x02,0x7F,0x20,0x39,\
+    0xFB,0x3A,0x36,0x79,0x42,0x7A,0x67,0x79,0x1A,0x39,0xD7,0x5F,0x5C,0x69,0x59,0x02,\
+    0x10,0xC5,0x04,0x20,0x37,0xEF,0x2A,0x94,0x77,0x4C,0x11,0x01,0x6F,0xD1,0x47,0xFF,\
+    0x3B,0x59,0x7E,0x3D,0x6A,0x21,0x2B,0x73,0xFE,0x79,0x42,0x5F,0x62,0x7F,0xF8,0x47,\
+    0x3F,0x31,0xFF,0xBD,0x77,0x6A,0x05,0x2D,0x29,0x7C,0x22,0xA5,0x6D,0x17,0x04,0x20,\
+    0x17,0x0B,0x43,0x40,0x7F,0x43,0x67,0x21,0xEA,0x43,0x41,0x2F,0x43,0x40,0x7F,0x43,\
+    0x44,0x33,0x31,0xFD,0xFF,0x77,0x6B,0x4F,0xEC,0x39,0x6F,0x35,0x79,0xAF,0x57,0x2D,\
+    0x60,0x68,0x17,0x04,0x74,0x17,0x0B,0x66,0xD5,0x68,0xFF,0x80,0x59,0x65,0x04,0x2C,\
+    0x65,0x04,0x55,0x57,0xEE,0x29,0x01,0x75,0x35,0x3F,0x1B,0x82,0xC6,0xFB,0x14,0xDF,\
+    0x77,0x92,0xC6,0xF8,0x2A,0x43,0x40,0x33,0x20,0xD5,0x6B,0x29,0x01,0x2F,0x7D,0x12,\
+    0x6E,0x7D,0x17,0x62,0x68,0xD7,0x11,0x41,0x59,0x7D,0x02,0x20,0x01,0x44,0x5E,0x6E,\
+    0xBF,0x7F,0xB8,0x47,0x3F,0x59,0x78,0x13,0x53,0x73,0x6D,0x7C,0x95,0x00,0xD7,0x07,\
+    0x17,0x00,0x2B,0x23,0xB1,0x82,0xFF,0x2D,0x87,0x54,0x77,0x6A,0x25,0x39,0x39,0x5F,\
+    0x10,0x7F,0x78,0x47,0x3E,0x3B,0xC0,0xBF,0x8B,0x41,0xFF,0x03,0x6D,0x45,0x2C,0x39,\
+    0x67,0x07,0x6D,0xE7,0x57,0x3E,0x2B,0xB3,0xC4,0xF3,0x82,0x90,0xF5,0xED,0xFB,0x5D,\
+    0xB8,0x7D,0x00,0x6E,0x37,0x31,0x16,0x68,0xDF,0x3F,0x00,0x47,0x38,0x77,0x03,0x80,\
+    0x72,0x29,0xEF,0x69,0xE7,0x09,0x6D,0x83,0x02,0x79,0x0D,0xBE,0xF7,0x5E,0x72,0x57,\
+    0xB5,0x40,0x55,0x48,0x57,0x6A,0xEF,0x97,0x05,0x39,0x97,0x17,0x00,0x39,0x22,0xD8,\
+    0xAF,0x0F,0x6D,0x3F,0x38,0x59,0xC0,0x81,0x61,0x40,0x69,0xFC,0x23,0xC7,0xD7,0x00,\
+    0x68,0x27,0x5B,0x31,0x7D,0x77,0xEF,0x6A,0x21,0x65,0x13,0x1D,0xC1,0x39,0x49,0x69,\
+    0xF7,0x9E,0xE5,0x55,0xB3,0xC3,0xC9,0xFB,0xD4,0x88,0x7F,0x92,0xB8,0x36,0xBB,0xE8,\
+    0x6D,0xEC,0x89,0x00,0xF7,0x98,0x6C,0x14,0x3D,0x40,0x7C,0x77,0x6C,0x39,0xFB,0x3F,\
+    0x19,0x29,0x00,0x2B,0x19,0x19,0x6F,0xA7,0xFF,0x51,0x47,0xC6,0x47,0x68,0x69,0x6D,\
+    0x5C,0xFF,0x89,0x41,0x68,0x0F,0x6F,0x0D,0xBE,0x5F,0xAF,0x84,0x09,0x6B,0x54,0xE3,\
+    0xC1,0x78,0x65,0x0C,0xEF,0xFF,0x67,0x79,0x10,0x39,0x5F,0x68,0x76,0x7D,0xBE,0xA3,\
+    0x44,0x39,0x38,0x6E,0x58,0x6B,0xE3,0x03,0x37,0xFF,0x3B,0xD0,0xE0,0x65,0x78,0x87,\
+    0x85,0x39,0xFF,0x68,0x77,0x9D,0x85,0x85,0xC6,0x97,0x88,0x9F,0x62,0xC5,0xB9,0x23,\
+    0xE9,0xF5,0x00,0x29,0x01,0x7E,0xAA,0x89,0x04,0x36,0x89,0x02,0xC9,0x89,0x01,0x5B,\
+    0x17,0x01,0x78,0xEF,0x35,0x39,0x2B,0x6E,0x23,0x04,0x79,0xD7,0xB8,0xBF,0x66,0xE8,\
+    0x14,0x39,0x39,0x3E,0x95,0x03,0xE8,0xFD,0xA9,0xF5,0x1F,0x29,0x6E,0x29,0x6D,0x54,\
+    0xF9,0xEC,0x47,0x01,0x31,0x42,0x7A,0xF9,0x05,0x01,0x7B,0x21,0x33,0xFF,0x73,0x6F,\
+    0x10,0x6B,0x5F,0x85,0x39,0x60,0xBB,0x17,0x09,0x05,0x00,0x6F,0x17,0x33,0x61,0x4B,\
+    0x25,0xDE,0x3B,0x01,0x2C,0x69,0xE7,0x67,0x45,0x81,0x7C,0xE7,0xFF,0x6B,0x39,0x39,\
+    0x27,0x68,0x3D,0xEA,0x20,0xFD,0x19,0x77,0x03,0x49,0x68,0x67,0x6B,0x96,0xF9,0x32,\
+    0x13,0x4C,0x6C,0x13,0x41,0x89,0xC4,0x76,0x05,0x39,0x82,0x59,0x00,0xFB,0x6D,0x35,\
+    0x89,0xC0,0x4A,0x90,0x5B,0x72,0x69,0xFF,0x26,0x11,0x37,0x5D,0x32,0x09,0x4C,0x2B,\
+    0xF6,0x9F,0x83,0x78,0xC5,0x3B,0x00,0x5E,0x62,0x07,0x92,0xFB,0x97,0x38,0x8D,0x83,\
+    0x58,0x68,0x8B,0x0B,0x09,0xF7,0x4C,0x77,0x19,0x71,0x02,0x73,0x24,0x6D,0x21,0xAD,\
+    0x1F,0x71,0xC5,0x58,0x51,0x05,0x00,0x68,0x01,0x43,0x04,0xD7,0x9B,0x68,0x39,0xA1,\
+    0x02,0x09,0xDD,0x02,0x22,0x69,0x5F,0xE7,0x39,0x18,0x09,0x48,0x29,0x00,0x6C,0xED,\
+    0x81,0xBC,0x0B,0x01,0x17,0x02,0x30,0x49,0x69,0x64,0xFB,0xC0,0x4D,0x6B,0x62,0x35,\
+    0xC7,0x41,0x64,0x05,0x02,0x66,0x44,0x9B,0x03,0x55,0x7D,0x9B,0x02,0x7F,0x13,0x42,\
+    0x7E,0x0B,0x02,0x79,0x05,0x02,0x55,0x78,0x05,0x02,0x7B,0x3D,0x40,0x97,0x41,0x00,\
+    0x2E,0x47,0x02,0xF5,0x21,0x05,0x02,0x20,0xF5,0x01,0x34,0xCC,0x31,0xB8,0xFF,0x77,\
+    0x6A,0x4F,0xA9,0x39,0x6E,0x7F,0xFD,0xBF,0x47,0x3C,0x31,0x91,0x77,0x68,0x75,0x80,\
+    0x70,0xFC,0xDD,0x03,0x77,0x01,0x77,0x19,0x39,0x1C,0x68,0x3E,0xFF,0x09,0x47,0x77,\
+    0x67,0x79,0x16,0x39,0x66,0xFF,0x3D,0x2D,0x20,0x3F,0x6A,0x28,0x10,0x7F,0xED,0x27,\
+    0x2B,0x40,0x47,0x6A,0xB3,0x03,0x25,0xC1,0x61,0xFF,0xE7,0x17,0x7F,0x37,0x39,0x09,\
+    0x6F,0x58,0xFF,0x6D,0x09,0x80,0x39,0x78,0x24,0xAD,0x1F,0xFF,0xB6,0x59,0x6A,0x07,\
+    0x6C,0x69,0x26,0x77,0xF7,0x1D,0x39,0x1C,0xFB,0x01,0x58,0x6A,0x68,0x3F,0xFF,0x16,\
+    0x6D,0x47,0x42,0x47,0x2B,0x17,0x47,0xFF,0x77,0x79,0x6B,0x16,0x39,0x70,0x5D,0x42,\
+    0xFF,0x47,0x25,0x73,0x28,0x10,0x6B,0x14,0x79,0xFF,0x5E,0x7C,0x17,0x49,0x68,0x3C,\
+    0x16,0x6E,0xFB,0x58,0x6A,0x3B,0x01,0x14,0x39,0x08,0xD6,0x39,0xB7,0x64,0x17,0x79,\
+    0x11,0x07,0x23,0x55,0x11,0x02,0x6F,0xCF,0x37,0x38,0x13,0x77,0x6D,0x41,0x53,0x01,\
+    0x77,0x16,0xFF,0x39,0x6E,0xC7,0x11,0x47,0x38,0x5F,0x60,0xAD,0x39,0xA7,0x00,0x6D,\
+    0x14,0x1D,0x00,0x39,0x17,0x01,0x68,0xDF,0x34,0x16,0x64,0x58,0x6A,0x93,0x80,0x97,\
+    0x83,0x7F,0x6D,0x0E,0xD4,0x39,0x72,0x7F,0x79,0x89,0xC0,0x7F,0x92,0x37,0xAD,0x47,\
+    0x45,0x3E,0x68,0x0B,0x01,0xFF,0x5E,0x6C,0x31,0xAD,0x27,0xD3,0x17,0x68,0x7F,0x4C,\
+    0x11,0xC7,0x3C,0x39,0x70,0x4C,0x41,0x00,0xFF,0x39,0x72,0x4C,0x11,0x58,0x29,0x39,\
+    0x74,0xFF,0x35,0x40,0x47,0x27,0x31,0xBC,0x77,0x6A,0xFF,0x01,0xFE,0x17,0x77,0x5F,\
+    0x32,0x6D,0x66,0xFF,0x77,0x1D,0x3F,0x8A,0x48,0x39,0x15,0x51,0xFF,0x77,0x7E,0x47,\
+    0x51,0x19,0x54,0x77,0x6D,0xFF,0x46,0xCD,0x0B,0x54,0xC1,0x77,0x3F,0x93,0xFB,0x43,\
+    0x3D,0x95,0xC0,0x2A,0x39,0x68,0x55,0x11,0xFF,0x47,0xC6,0xC3,0x68,0x64,0x28,0x47,\
+    0x6C,0xFF,0x2A,0x2C,0x77,0x38,0x76,0x78,0x39,0x16,0xFF,0x59,0x45,0x47,0x51,0xA7,\
+    0xEE,0xC9,0xED,0xFF,0x22,0xD3,0x11,0x77,0x5D,0x72,0x6B,0x26,0xFF,0x17,0x77,0x39,\
+    0x18,0x0F,0xDE,0x3E,0x64,0xFF,0x09,0x6C,0x6B,0x00,0x39,0x7B,0x77,0x05,0xEB,0x6F,\
+    0x45,0x05,0x00,0x6D,0x9B,0x01,0x82,0x6D,0x6D,0xFF,0x05,0x39,0x61,0xFE,0x05,0x26,\
+    0x39,0xC6,0xFF,0x38,0x16,0xF5,0x67,0x74,0x2B,0x70,0x07,0xDF,0x62,0x95,0x21,0xEB,\
+    0x70,0x75,0x81,0x73,0x68,0xFF,0x11,0x99,0x37,0x38,0xA9,0x69,0x55,0x6D,0xFF,0xF5,\
+    0x14,0x39,0x77,0x11,0x49,0x0D,0x2C,0x7B,0x5F,0x48,0x39,0x81,0x45,0x50,0xC7,0x40,\
+    0xEF,0x00,0xFF,0x7C,0x69,0x40,0x47,0x3B,0x5E,0x70,0xC9,0xDF,0x51,0x47,0x38,0x5E,\
+    0x7A,0x05,0x00,0x3A,0x5E,0xFE,0x5F,0x00,0x65,0x15,0x39,0x00,0xE5,0xEB,0xF5,0xFF,\
+    0xBC,0x5C,0xC6,0x57,0x6A,0x6D,0x26,0x15,0x7F,0x77,0x59,0x72,0x6F,0x66,0x13,0x37,\
+    0xBB,0x41,0xFF,0x71,0x8F,0x48,0x61,0x3F,0x39,0x4D,0x47,0xBB,0x01,0x17,0x7D,0x00,\
+    0x78,0x0B,0x55,0x7D,0x02,0x4D,0xFF,0x5D,0xBA,0x43,0x76,0x0B,0xC7,0x5C,0x7F,0xFF,\
+    0x39,0x69,0x09,0x6F,0x67,0x3C,0x6C,0x68,0xFF,0x14,0x73,0x5C,0xBF,0x41,0x68,0x57,\
+    0x20,0xFF,0x67,0x3E,0x6B,0x68,0x05,0x6D,0x55,0x39,0xFF,0xE8,0xA9,0x67,0xEB,0x67,\
+    0x3E,0x6D,0x68,0xFE,0x7D,0xC1,0x87,0x6D,0x12,0x8F,0x5C,0x7B,0x39,0xFB,0x76,0x6C,\
+    0xEF,0x00,0x39,0x77,0x16,0x6D,0xB9,0xFF,0xA7,0x58,0x68,0x89,0x8B,0x5F,0xBA,0x58,\
+    0xFF,0x68,0x88,0x49,0x69,0x39,0x87,0x54,0x77,0xDF,0x6C,0x21,0x35,0x6B,0x6C,0x17,\
+    0x00,0xEB,0x81,0xFF,0x54,0x77,0x6E,0x22,0x9D,0x19,0x6F,0x53,0xE7,0x72,0x61,0x26,\
+    0x01,0x45,0x49,0x43,0x39,0x1C,0x0F,0xFF,0xDE,0x36,0x6C,0x6F,0x42,0x47,0x22,0x23,\
+    0xF7,0x47,0x77,0x72,0x83,0x04,0xBD,0x19,0x6C,0xC7,0xFF,0x51,0x47,0xBD,0x5E,0x68,\
+    0x76,0x53,0xF7,0xFF,0x05,0x39,0xE0,0x10,0x6D,0x47,0xC5,0x89,0x7F,0x54,0x77,0xE1,\
+    0x20,0x39,0x39,0xE8,0x17,0x00,0xFF,0x99,0x5E,0x6C,0x17,0x6D,0x46,0x4B,0x17,0xFE,\
+    0xA5,0x80,0x3B,0x15,0x19,0x6F,0x05,0x75,0xA5,0xFF,0x91,0x22,0x28,0x77,0x6C,0x67,\
+    0x3E,0x7B,0xFF,0x28,0x3F,0x2D,0x5C,0x79,0x39,0x6A,0x57,0xF7,0x6A,0xA7,0xB1,0x11,\
+    0x00,0x6E,0x5C,0x7E,0x39,0xFB,0x6C,0x59,0x1F,0x41,0x58,0x57,0x6A,0x35,0x21,0xFF,\
+    0xDB,0xC0,0x6C,0x2D,0x47,0x3C,0x19,0x6F,0xEF,0x35,0x2D,0x0F,0x79,0x1D,0x00,0x6B,\
+    0x67,0x3E,0xFB,0xD9,0xE0,0x11,0x00,0x3E,0x22,0x2F,0x77,0x65,0xFF,0x39,0x30,0x45,\
+    0x77,0x55,0x20,0x05,0x08,0xDA,0xE9,0x00,0x24,0xE9,0x07,0x35,0x7D,0xE9,0x06,0x6E,\
+    0x12,0x5F,0x8F,0x27,0x39,0x39,0x96,0x4D,0x02,0x4C,0x4D,0x06,0xD5,0x38,0x4D,0x06,\
+    0x6F,0x4D,0x04,0x3A,0x4D,0x00,0x69,0x69,0xFE,0x53,0xC0,0x0B,0x45,0x67,0x3E,0x4B,\
+    0x70,0x95,0xFD,0xC5,0x8F,0x00,0x6D,0x57,0x6A,0x05,0x79,0x71,0x7D,0x28,0x1D,0x00,\
+    0x3F,0x19,0x6F,0x97,0xE5,0x11,0x00,0xFF,0x6F,0x6C,0x2A,0x47,0x31,0x47,0x61,0x0B,\
+    0xFF,0x72,0x65,0x74,0x7B,0x59,0x0F,0x6D,0x67,0xFF,0x70,0x19,0x6F,0x25,0x6D,0x35,\
+    0x39,0x2B,0xFF,0x68,0xA6,0xAC,0x05,0x29,0x19,0x6F,0x23,0xFF,0x6D,0x39,0x39,0x27,\
+    0x68,0xC9,0x6B,0x22,0xBF,0xDB,0x59,0x68,0x77,0xE7,0x79,0x4D,0x01,0x59,0xD6,0x41,\
+    0xC1,0x97,0xED,0x3B,0x00,0x69,0x3B,0x00,0x3B,0x45,0xAB,0x6B,0x09,0x3B,0x02,0x1F,\
+    0x3B,0x01,0x6E,0x3B,0x08,0x6E,0xFF,0x23,0x6D,0x3B,0x39,0x25,0x68,0xCB,0x6A,0xFE,\
+    0x3B,0x00,0x26,0x6C,0x28,0x47,0x38,0x73,0x6D,0xFF,0x11,0x63,0x5C,0x45,0x39,0x6A,\
+    0x77,0x6F,0xFE,0x05,0x00,0xE0,0x77,0x6E,0x27,0x35,0x22,0x14,0xEF,0x77,0x6F,0x47,\
+    0x3B,0x05,0x00,0x59,0x47,0x3A,0xDB,0x47,0x77,0xDB,0x80,0x3D,0x45,0xA1,0x00,0x1C,\
+    0x39,0xFF,0x5A,0x76,0x35,0x58,0x2F,0x39,0x19,0x25,0xFF,0x57,0x6B,0x15,0x39,0x4B,\
+    0x68,0x65,0x6D,0xFF,0x96,0xF8,0x7B,0x78,0x57,0x6B,0x13,0x39,0xFF,0x45,0x68,0x6B,\
+    0x6D,0xFB,0x3E,0x5C,0x8A,0xFF,0x55,0x20,0x59,0x20,0x45,0x67,0xA9,0x74,0xFF,0x99,\
+    0x20,0xE5,0x54,0x77,0x92,0x0D,0x3F,0xFF,0x5F,0x9C,0x0B,0x6C,0xDB,0x3E,0x22,0x2E,\
+    0xFF,0x77,0x72,0x26,0x39,0xC5,0xCC,0x16,0x6D,0xFF,0xBB,0xD5,0x23,0xD4,0x77,0xED,\
+    0x5C,0x7D,0xFE,0xA1,0x00,0x28,0x47,0x3B,0x47,0x6B,0x0D,0x72,0xE3,0x05,0x0C,0x39,\
+    0x8B,0x4F,0x48,0x39,0x80,0x65,0x74,0x23,0xFF,0x71,0x09,0x62,0x9D,0x20,0xE3,0x71,\
+    0xA9,0xFE,0xDB,0x81,0x6F,0x11,0x99,0x39,0x38,0xA7,0x6D,0xEE,0xDD,0x00,0x26,0x2A,\
+    0xAC,0xD9,0x40,0x01,0x58,0x68,0xFF,0x8B,0xB3,0x6F,0x39,0x19,0x6C,0x5F,0x72,0xFC,\
+    0xB7,0x83,0x77,0xC3,0x58,0x25,0x13,0x47,0x77,0x49,0x7F,0x69,0x16,0x39,0x40,0x0F,\
+    0x6D,0x61,0xB7,0x81,0xFF,0x5B,0x05,0x6A,0x13,0x2D,0x07,0x73,0xF7,0x9F,0xBE,0x5C,\
+    0x68,0x77,0xCF,0xC9,0x80,0x3F,0x80,0x5F,0xFF,0x85,0x39,0xF8,0x0D,0x6C,0x0D,0x3E,\
+    0x5E,0xFD,0x76,0x5B,0x40,0x75,0x49,0x68,0x67,0x68,0x96,0xFF,0xF9,0x29,0xFD,0x07,\
+    0x6D,0x57,0x24,0xE1,0xFF,0x28,0x25,0x68,0x37,0x39,0x29,0x6D,0xC9,0xFF,0xED,0x23,\
+    0xDF,0x0F,0xEC,0x5D,0x6A,0x15,0xFF,0x3C,0x21,0x6D,0xCD,0x51,0x47,0x26,0x5D,0xF7,\
+    0x56,0x09,0x72,0x17,0x01,0xE7,0xEA,0x4F,0x39,0xEF,0x39,0x68,0x10,0x7F,0x35,0x05,\
+    0x7B,0x78,0x6F,0x7F,0x68,0x15,0x3D,0x81,0x6F,0x13,0x73,0x11,0x02,0xBD,0x69,0x11,\
+    0x01,0x57,0x21,0x57,0x3D,0xD1,0x07,0x13,0xFE,0x1D,0x00,0x12,0x8F,0x6D,0x75,0x21,\
+    0x75,0x0D,0xBF,0x62,0x9F,0x24,0xE1,0x75,0xAD,0xCB,0x01,0x6D,0xFF,0x11,0x99,0x3D,\
+    0x38,0xA3,0x6C,0x6E,0x28,0xFF,0x47,0x26,0x58,0x68,0x8C,0xE5,0x39,0x39,0x7E,0x05,\
+    0x00,0xA3,0x27,0x39,0x38,0x50,0x5F,0x29,0xC0,0xFF,0xCC,0x48,0x6F,0xD1,0x47,0xA9,\
+    0x43,0x69,0xBF,0x0B,0x6D,0x35,0x27,0x19,0x24,0x95,0x00,0x3C,0xEF,0xE8,0xA8,0x67,\
+    0xF8,0x7D,0x00,0x75,0xAB,0x2D,0xFF,0x15,0x3C,0x83,0x69,0x14,0x87,0x71,0xBF,0xFF,\
+    0x1F,0x64,0x57,0x2E,0x15,0xBA,0x23,0x78,0xFF,0x0B,0x62,0x67,0x7A,0x6B,0xEB,0xAD,\
+    0x7D,0xFE,0x05,0x03,0x9B,0x05,0x39,0x97,0x3D,0x6B,0x21,0x7F,0xD5,0x45,0x69,0xEB,\
+    0x68,0x5E,0x7F,0x71,0xC1,0xFB,0xBC,0x15,0x59,0x00,0x19,0x6D,0x3E,0x1F,0x54,0xFE,\
+    0x31,0x41,0x4B,0x8A,0xAD,0xEC,0x67,0x7A,0x29,0xFF,0xFC,0x25,0x69,0x37,0x3A,0xF9,\
+    0x6C,0xF7,0x5F,0x51,0x47,0xA9,0x21,0xE8,0x19,0x40,0xBC,0x19,0x40,0x7B,0x19,0x39,\
+    0x09,0x80,0x10,0x73,0x7B,0x2A,0x71,0x02,0xF5,0x3E,0x71,0x08,0x3E,0xD7,0x00,0x6A,\
+    0xFD,0xB9,0x5D,0xFF,0x8E,0x41,0xEB,0x65,0x3C,0x6B,0x69,0x69,0xFF,0x6C,0xF5,0x05,\
+    0x39,0x77,0x13,0x0D,0x3B,0xFB,0x26,0x1B,0x29,0x01,0x38,0xA9,0xEE,0x7F,0x6D,0xBF,\
+    0x47,0x39,0x5E,0x7A,0x57,0x21,0x2F,0x00,0x69,0xFF,0xA6,0xAD,0x05,0x29,0x27,0x69,\
+    0x25,0x6A,0xBF,0xF9,0x3F,0x5D,0x56,0x57,0x24,0x11,0x00,0x6F,0x5E,0x11,0x01,0x19,\
+    0x21,0x67,0x6A,0x33,0x87,0x23,0x1D,0x00,0xFF,0x5C,0x8A,0x17,0x73,0x39,0x38,0x05,\
+    0x7B,0xB5,0x05,0x37,0x43,0x6A,0x7F,0x45,0xE5,0x28,0x3B,0x00,0x38,0xFB,0x5A,0x82,\
+    0x6B,0x00,0x75,0x27,0x71,0x0B,0x62,0xDF,0x99,0x20,0xE7,0x71,0xAB,0x31,0x41,0x6E,\
+    0x11,0x7F,0x99,0x3B,0x38,0xA5,0x6F,0x6E,0x2B,0x31,0x41,0xEF,0x8D,0x8B,0x69,0x39,\
+    0x0F,0x80,0x65,0x37,0x27,0xFF,0x89,0xED,0x12,0x6D,0xB8,0x13,0x19,0x6F,0xFF,0x51,\
+    0x72,0x6F,0x26,0x13,0x77,0x5B,0x72,0xBF,0x69,0x26,0x1F,0x37,0x5F,0x32,0x09,0x81,\
+    0x39,0xFF,0x1C,0x0F,0xDE,0x3E,0x6C,0x6B,0x42,0x47,0xFF,0x2E,0x13,0x14,0x77,0x92,\
+    0xB2,0x19,0x2A,0xF9,0xBD,0x01,0x41,0x81,0x80,0xF5,0x5C,0x7F,0x39,0x69,0xFF,0xCB,\
+    0x51,0x47,0x3A,0x5F,0x68,0x77,0x13,0xAA,0x89,0xC2,0x41,0x89,0xC6,0x6A,0x89,0xC6,\
+    0x3A,0x89,0xC4,0x6C,0xEE,0x6F,0x80,0x3C,0x17,0x51,0x3B,0x00,0x09,0x19,0x6F,0xEF,\
+    0x05,0x75,0xA5,0x91,0xCB,0xC0,0x6B,0x67,0x3E,0xEF,0x7B,0x28,0x3F,0x2D,0xA7,0xC1,\
+    0x57,0x6A,0xA7,0xFD,0xB1,0x11,0x00,0x65,0x5C,0x7E,0x39,0x61,0x0D,0xFE,0x71,0xC1,\
+    0x45,0x77,0x67,0x39,0x32,0x83,0x54,0xAF,0x77,0x66,0x24,0x75,0xB9,0xD8,0x68,0x7D,\
+    0xC0,0x44,0xFE,0xFF,0x80,0x14,0x39,0x6A,0x09,0x6E,0x67,0x3C,0xEF,0x6E,0x68,0x14,\
+    0x73,0x0B,0xDD,0x27,0x71,0x0D,0xFC,0x0D,0x42,0x3F,0x85,0x37,0x38,0xA9,0x6F,0x59,\
+    0x6D,0xFC,0x77,0x00,0xE5,0x40,0xBE,0xEF,0x17,0x68,0x3D,0x6A,0xAF,0x21,0x39,0x39,\
+    0xEE,0x0B,0x00,0xBF,0x65,0xC2,0x45,0xCF,0x39,0xF0,0x77,0x6C,0xE9,0x00,0x5F,0x00,\
+    0x3B,0x26,0xEB,0x7B,0x5D,0x89,0x00,0x74,0x89,0x12,0x6B,0x22,0xDB,0xFF,0x1B,0x25,\
+    0x6B,0x74,0x39,0x36,0xE5,0x71,0xF7,0xAB,0x74,0x99,0x3F,0x81,0x6A,0x21,0xCD,0x49,\
+    0xDF,0x69,0xE7,0x6B,0x6B,0x39,0xB9,0xC1,0x54,0xC5,0xEC,0x47,0x00,0x6B,0xC2,0x8E,\
+    0x1F,0x73,0x42,0x4F,0x3B,0x39,0xFB,0x25,0x51,0x4F,0x40,0x3D,0xD8,0x26,0x6B,0x54,\
+    0xFE,0xAB,0x80,0x6D,0xCB,0x14,0x47,0x29,0x45,0x5E,0xFF,0x10,0x67,0x39,0x38,0x2A,\
+    0x94,0x77,0x6C,0xEE,0x0B,0x00,0x51,0x57,0x6A,0x8F,0xC9,0x78,0x39,0x23,0xFF,0x47,\
+    0x77,0x72,0x3B,0x39,0x4D,0x6B,0x01,0xFF,0x6C,0x3F,0x46,0x63,0xEC,0x58,0x68,0x68,\
+    0x5D,0x3D,0xC1,0x40,0x41,0x17,0xB6,0xB3,0x02,0x01,0xCB,0x00,0xFF,0x79,0x0F,0x41,\
+    0x3B,0xE0,0x58,0x51,0x47,0xFF,0x29,0x6F,0xA8,0x16,0x6D,0xBB,0x07,0x17,0xFF,0x68,\
+    0x27,0xE2,0x27,0x2B,0x71,0x10,0x75,0xFF,0x59,0x68,0x05,0x39,0x78,0x23,0xE5,0x26,\
+    0x7F,0x39,0xC5,0x42,0x59,0x6D,0x17,0xB6,0x7D,0x00,0xFF,0x67,0x68,0x3C,0x58,0x68,\
+    0x89,0x45,0x69,0xFF,0x39,0x61,0xE7,0xC9,0x6E,0x21,0x33,0x6B,0xFF,0x6E,0x16,0x6D,\
+    0xBF,0xAF,0x85,0x6A,0x12,0x9F,0xC7,0x67,0x3E,0x1D,0x77,0x03,0x87,0x77,0x01,0x58,\
+    0xFF,0x39,0x13,0x47,0x77,0x75,0x6F,0x16,0x39,0x7F,0x74,0x59,0x42,0x47,0x19,0x1A,\
+    0xAC,0xC5,0x00,0x77,0x19,0x1A,0xAF,0x05,0x00,0x1D,0x1A,0xAD,0x05,0x00,0xFD,0x11,\
+    0x0B,0x02,0x15,0x19,0x6D,0xA7,0xEA,0x14,0xF7,0xB9,0x1A,0xA8,0xDF,0x41,0x41,0x69,\
+    0x0D,0x6E,0xFF,0x61,0x05,0x39,0x68,0x77,0xE1,0x05,0x9E,0xEB,0x16,0x6B,0x49,0x40,\
+    0xB1,0x89,0x01,0xF9,0x3C,0x5F,0xFF,0x66,0x0B,0x6C,0x05,0x9E,0x58,0x68,0x88,0xDD,\
+    0x59,0x77,0x01,0x17,0x6F,0x3B,0x07,0x41,0x45,0xFB,0x5F,0x3D,0x5E,0xB0,0x58,0x54,\
+    0xEF,0x00,0x40,0x05,0x02,0xFD,0x48,0x6B,0xC0,0xBD,0x69,0xE7,0x59,0x6D,0x0D,0xBF,\
+    0x3E,0x5F,0x64,0x07,0x6E,0x68,0xD1,0xC0,0x8A,0xFD,0xED,0x2F,0x01,0x57,0x6A,0x61,\
+    0x26,0x11,0x77,0xFF,0x5D,0x72,0x6B,0x26,0x17,0x77,0x39,0x18,0xFF,0x68,0x3E,0x17,\
+    0x47,0x77,0x65,0x67,0x16,0xEF,0x39,0x64,0x54,0xAA,0x35,0x00,0x44,0x54,0xAD,0xF6,\
+    0x05,0x00,0x58,0x3D,0x41,0x00,0x5A,0x90,0x11,0x75,0xEF,0x26,0x39,0xC1,0xE4,0x41,\
+    0x02,0x62,0x64,0x91,0xFF,0x47,0x38,0x39,0x78,0x14,0x95,0x27,0x3D,0xFF,0x19,0x6F,\
+    0x17,0x7D,0x05,0x9E,0x71,0x10,0xFB,0x77,0xCD,0x1D,0x00,0x9E,0x59,0x6D,0x67,0x3E,\
+    0xBE,0x65,0x00,0x72,0x09,0x4C,0x77,0x19,0xE3,0x01,0x07,0xEF,0x47,0x77,0x77,0x05,\
+    0xC3,0x81,0x54,0x74,0xFE,0xF6,0x05,0x00,0x59,0x0D,0x0B,0x00,0x14,0x95,0x21,0x21,\
+    0xAF,0x58,0x68,0x8F,0x2F,0xAF,0x42,0x67,0xC1,0x40,0x69,0xFF,0x77,0x7D,0x24,0xC1,\
+    0x59,0x6C,0x57,0x6A,0x7F,0x27,0x0F,0x4F,0x69,0x0F,0x6E,0x6D,0xE3,0x01,0xD5,0xE5,\
+    0xE3,0x00,0x6D,0x3D,0x40,0x9D,0xE3,0x02,0x3D,0x5F,0xFF,0x78,0x0B,0x6C,0x37,0x38,\
+    0x16,0x68,0x16,0xFF,0x6D,0xB9,0x77,0x17,0x68,0x2F,0xE2,0x27,0xFB,0x3B,0x45,0x9D,\
+    0x41,0x3D,0x85,0x6B,0x10,0xBB,0x3F,0x67,0x3E,0x1F,0x77,0x5F,0x72,0xD3,0x43,0x77,\
+    0x01,0xBF,0x39,0x3B,0x47,0x39,0x16,0x6F,0xB3,0x07,0xCE,0xFD,0xB0,0xB3,0x10,0x75,\
+    0x68,0x17,0x39,0x78,0x58,0xFF,0x43,0x47,0x35,0x16,0x46,0x77,0x65,0x26,0xF7,0x39,\
+    0xC7,0x18,0xB9,0x01,0x76,0x87,0x77,0x61,0x9E,0x9D,0x40,0x36,0x39,0x18,0x57,0xB3,\
+    0x02,0x4D,0x02,0x1C,0xEF,0x09,0x6F,0xC6,0x90,0x27,0x80,0x3D,0x45,0x6A,0xFF,0x57,\
+    0x03,0x47,0x31,0x49,0x68,0x67,0x45,0xFF,0x47,0x38,0x04,0x28,0x88,0x91,0x77,0x17,\
+    0xFF,0xC6,0x94,0x96,0x25,0x7A,0x79,0xC6,0x94,0xDA,0x17,0x06,0x3B,0x17,0x00,0x93,\
+    0x79,0x17,0x00,0xF9,0x03,0xFF,0xB8,0xC7,0x4D,0x68,0xC9,0x11,0x47,0x31,0xFF,0x5B,\
+    0x68,0x76,0xD7,0x67,0x3E,0x89,0x14,0xFF,0x77,0x65,0x25,0x39,0x39,0xD6,0x47,0x56,\
+    0xFF,0x45,0x3F,0x77,0x93,0x77,0x6F,0x47,0x2B,0xFF,0x39,0x4A,0x77,0x5B,0x47,0x73,\
+    0x39,0x34,0xFF,0x77,0x03,0x47,0xB9,0x39,0xFA,0x77,0xC9,0xFF,0x79,0x05,0x38,0x68,\
+    0xEC,0xA0,0x65,0x45,0xFF,0x39,0x68,0xF7,0x6D,0x27,0x39,0x39,0xFC,0xFF,0x49,0x51,\
+    0xB9,0x39,0x13,0x14,0x77,0x6D,0xFF,0xC7,0x39,0x1B,0x14,0x77,0x69,0x47,0x39,0xFF,\
+    0x59,0x68,0x77,0xED,0x79,0x05,0x3B,0x68,0xFF,0x5D,0x11,0x47,0x39,0xB9,0x68,0x55,\
+    0x11,0xFE,0xCB,0x00,0x68,0x17,0x6D,0x47,0x55,0x07,0x54,0xAF,0x73,0x6D,0x6D,0x45,\
+    0x43,0x40,0x6D,0x3B,0x00,0x69,0x5E,0x3B,0x00,0x61,0x07,0x54,0x7F,0x11,0x02,0xF7,\
+    0x11,0x01,0xFF,0x6A,0x77,0x6D,0x27,0x7F,0x07,0x54,0x67,0xF0,0x11,0x01,0x0B,0x00,\
+    0x11,0x01,0x23,0x00,0x0D,0x07,0x54,0x57,0xF4,0x11,0x02,0x23,0x02,0x6B,0x23,0x00,\
+    0x1B,0x07,0x54,0x37,0xF0,0x11,0x01,0x0B,0x00,0x11,0x01,0x23,0x00,0x29,0x07,0x54,\
+    0xF7,0xFC,0x11,0x02,0x23,0x02,0x6C,0x77,0x6D,0x74,0xC5,0x31,0xFF,0x68,0x77,0x92,\
+    0xBF,0x39,0x3B,0x11,0xC8,0xFF,0x92,0x47,0xC6,0xC1,0x68,0x44,0x91,0x65,0xFE,0x8F,\
+    0xC0,0x8F,0x61,0x37,0x0F,0xB9,0x2F,0x44,0xFD,0xAD,0x11,0x00,0x66,0x4D,0xD1,0xB8,\
+    0xC6,0x41,0xFF,0x69,0xCF,0x51,0x47,0x38,0x5F,0x68,0x77,0xFF,0xDF,0xFB,0x05,0x39,\
+    0x6A,0x11,0x6D,0x47,0x7D,0x93,0x77,0xC0,0x38,0x47,0xC6,0xC3,0x4F,0x7F,0x40,0x7F,\
+    0x93,0x39,0x97,0x8D,0x4A,0x47,0x40,0xAD,0x00,0x7F,0x92,0xBF,0x37,0x4F,0x68,0x3D,\
+    0x14,0x35,0x00,0xD7,0x64,0x1D,0x4B,0x29,0x02,0x4D,0x09,0x80,0x3D,0x77,0xD7,0x92,\
+    0xBD,0x1E,0x2F,0x00,0xC7,0x2F,0x01,0x57,0x6E,0xFF,0x15,0xBA,0x89,0xD4,0x78,0x92,\
+    0xB8,0xC6,0xFF,0x5C,0xBE,0x0B,0x6C,0x27,0xEB,0x3B,0x11,0xFB,0x88,0x93,0x65,0x01,\
+    0x0F,0x6D,0x3D,0x39,0x82,0xFF,0xA1,0x13,0x5B,0x0D,0x3D,0x5F,0x5A,0xCB,0xFF,0x51,\
+    0x47,0x3B,0x5F,0x44,0x7B,0x38,0xB8,0xFF,0xC6,0x5E,0x6C,0x0F,0x6C,0x27,0xD1,0x6D,\
+    0xFF,0xE5,0x57,0x68,0x15,0xBC,0x89,0xD4,0x77,0x7F,0x6D,0x46,0x39,0x5A,0xB2,0x0D,\
+    0x6D,0x53,0x0D,0x7F,0x17,0xAB,0xFC,0xF0,0x5F,0x6E,0x0B,0x61,0x40,0xFF,0xC6,0x32,\
+    0x57,0x6F,0x15,0xBB,0x62,0xE8,0xFF,0x12,0x6D,0xB8,0x69,0x45,0x69,0x17,0x6D,0xEB,\
+    0xB8,0x73,0x5F,0x00,0x90,0x5F,0x01,0x77,0x14,0x07,0xD5,0x39,0xD7,0x00,0x6D,0x63,\
+    0x80,0x69,0xD9,0x40,0x35,0x28,0xFF,0x2E,0x77,0x6F,0x0B,0xD7,0x19,0x94,0x88,0x5F,\
+    0xB1,0x09,0x67,0x77,0x1D,0x0F,0x83,0x35,0xDF,0x40,0xAE,0xF1,0x40,0x43,0x47,0x32,\
+    0x09,0x81,0x67,0xF1,0x40,0x95,0xBB,0xE5,0x6A,0x09,0x81,0x43,0xB8,0xC5,0x3F,0x81,\
+    0x45,0xFD,0x0D,0x87,0x81,0xB8,0x49,0x71,0x8F,0x48,0x51,0xFF,0x6D,0x57,0x39,0x60,\
+    0x5F,0x03,0x47,0x29,0xFF,0x1F,0x06,0x77,0x79,0x39,0x39,0x41,0x69,0xFF,0x57,0x51,\
+    0xB8,0x39,0x31,0x68,0xA7,0xE1,0xFF,0x35,0x79,0x8B,0xE8,0x14,0x79,0x6A,0x75,0xFF,\
+    0xC6,0x1C,0x75,0xC3,0x47,0x39,0x36,0x97,0xFF,0x88,0x19,0x6F,0x57,0xC6,0x1C,0x49,\
+    0x51,0xFF,0x67,0x39,0x73,0xFB,0x10,0x6D,0x46,0x2D,0xFB,0x80,0x94,0xF7,0x41,0x5D,\
+    0x68,0x76,0x67,0x67,0xFF,0x35,0x45,0x57,0xBB,0xED,0x61,0x35,0xAF,0xFF,0xEE,0x03,\
+    0x6D,0xF3,0x05,0x39,0xE8,0x13,0xF7,0x7F,0x67,0x77,0x7D,0x00,0x6F,0x96,0xF9,0x28,\
+    0xFF,0x14,0x77,0x92,0xB8,0x41,0x6B,0x6A,0x17,0xFF,0x85,0x37,0x27,0x89,0xFB,0x15,\
+    0x65,0x3D,0xFF,0x27,0x49,0x8A,0xA6,0xFE,0x27,0x3D,0x13,0xFF,0x7B,0x35,0xFE,0x33,\
+    0x39,0x8D,0x6D,0x13,0xFF,0x75,0x67,0x77,0xE8,0xAE,0x07,0x6D,0x57,0xF7,0x3B,0xE8,\
+    0xA8,0x05,0x01,0x28,0x1D,0x7F,0x6C,0xFE,0x2F,0x02,0x89,0x68,0x35,0x58,0x68,0x77,\
+    0xAF,0xFB,0x1F,0xB6,0xB1,0x81,0x37,0x79,0xA9,0xEE,0x5A,0xFF,0x2D,0xB8,0xC1,0x49,\
+    0x68,0x47,0x6A,0x68,0x7F,0x39,0x49,0x28,0x58,0x6D,0x68,0x3A,0x0B,0x00,0xFF,0x43,\
+    0xB8,0xC7,0x16,0x68,0x3F,0x03,0xB8,0xFD,0x41,0x29,0x00,0xD1,0x08,0xD6,0x39,0x7C,\
+    0x5F,0xFF,0x6D,0x37,0x39,0x29,0x6D,0xC7,0xC3,0xB8,0xFF,0xC1,0x5A,0x54,0x3D,0x69,\
+    0x21,0x01,0x4B,0x5F,0x28,0xA1,0xEC,0x68,0x3A,0x1D,0x00,0x17,0x47,0x04,0xFF,0x39,\
+    0x09,0x6F,0x58,0x6D,0x37,0x79,0x16,0xF7,0x68,0x58,0x6E,0x0B,0x00,0x46,0x88,0x93,\
+    0x68,0xEF,0x39,0x19,0x54,0x88,0xA1,0x00,0x71,0x1E,0x7F,0xFF,0x2D,0x26,0x39,0x39,\
+    0x1E,0x38,0x82,0x47,0xFF,0x2D,0x11,0x68,0x3D,0x2A,0x20,0x3F,0xB6,0xED,0x11,0x4B,\
+    0x81,0x1D,0x24,0xD1,0x00,0x3C,0x5D,0x70,0xF6,0x33,0x81,0x5E,0x7A,0xA1,0x01,0x2B,\
+    0x72,0xC5,0x58,0xFF,0x4F,0x38,0x5E,0x6A,0x0F,0x6C,0x15,0x3B,0xFB,0x59,0x8C,0x29,\
+    0x00,0x33,0x09,0x6F,0x31,0x2D,0xFB,0x86,0x40,0x91,0x41,0x67,0x57,0x39,0x64,0x66,\
+    0xFF,0x29,0x47,0x3B,0x75,0x86,0x4B,0x91,0xB8,0xF9,0x71,0x67,0x41,0x8B,0x41,0x57,\
+    0x51,0x47,0x3A,0xB9,0x7F,0x68,0xB7,0xC3,0x47,0x31,0xE9,0xE8,0xC5,0x00,0xBF,0xC5,\
+    0x09,0x54,0x76,0x6D,0x75,0x91,0x40,0x94,0xFD,0x05,0xAF,0x47,0x3F,0x8A,0x48,0x3D,\
+    0x17,0x46,0xFF,0x77,0x7D,0x3F,0x3B,0x15,0x46,0x77,0x79,0xBF,0x9B,0xBE,0x0A,0x94,\
+    0x7F,0x6D,0xC3,0x81,0x75,0xF7,0x14,0xF8,0xC6,0x59,0x01,0x77,0x17,0x39,0x72,0xD9,\
+    0xF6,0x8D,0x81,0xD5,0x80,0x67,0x32,0xD5,0x82,0x0B,0xB9,0xDF,0x06,0x77,0x63,0x74,\
+    0xF9,0x0B,0x00,0x63,0x45,0x77,0x40,0xC6,0x93,0xB1,0x81,0x13,0x2F,0x55,0xE9,0xC0,\
+    0xFF,0x82,0xAE,0x13,0x69,0x5D,0xE0,0x59,0x90,0x77,0x5D,0x2A,0x65,0xD9,0x40,0x05,\
+    0x6D,0xFF,0xE7,0x83,0xDF,0x4F,0x39,0x11,0x77,0x6C,0x3F,0x81,0x0D,0x6D,0xFD,0x0D,\
+    0xAD,0x01,0x61,0x2D,0x1F,0x81,0x54,0x77,0xF7,0x6F,0x21,0x19,0xFF,0x8D,0x67,0x3C,\
+    0x6B,0xED,0xFF,0xC7,0xD1,0x47,0x39,0xC6,0x97,0x12,0xBB,0xFF,0x3F,0x38,0x59,0xBA,\
+    0x75,0x14,0xB8,0xC7,0x7E,0x65,0x01,0x67,0x7E,0x24,0x38,0x88,0x92,0x05,0x00,0xFF,\
+    0x00,0x77,0x4D,0xB8,0xC6,0x82,0xAE,0x15,0xFF,0x67,0x0D,0x2C,0x5F,0x6E,0x25,0xE0,\
+    0x15,0xFF,0xB0,0x59,0x9A,0xCC,0xAB,0x22,0x3B,0x41,0xFF,0x68,0x47,0x6C,0x15,0x78,\
+    0x89,0x14,0xCC,0xDF,0xED,0x22,0x39,0xC6,0xE4,0xED,0x80,0x39,0xC6,0x75,0xEE,0x3B,\
+    0x00,0xC4,0x3B,0x01,0x47,0x40,0x79,0x9B,0xC4,0xED,0xA8,0x9B,0xC2,0x57,0x69,0xB1,\
+    0x80,0x98,0x88,0x89,0xDE,0x01,0x41,0x75,0xE5,0x09,0x48,0x8D,0x80,0x1C,0x68,0x7F,\
+    0x3E,0x39,0x14,0x70,0x6D,0x67,0x45,0x83,0x00,0xFF,0x6D,0x05,0x51,0x39,0x32,0x75,\
+    0x45,0x47,0xFF,0xC1,0x39,0x3A,0x77,0x45,0x47,0x38,0x39,0xFF,0x3A,0x46,0x11,0x60,\
+    0x29,0x39,0x32,0x66,0xFF,0x11,0x47,0x79,0x39,0x3B,0x77,0x05,0x46,0xFF,0x29,0x39,\
+    0x38,0x59,0x51,0x47,0x29,0x65,0xFF,0x38,0x39,0x16,0x3F,0x38,0x3B,0x14,0x8F,0xFF,\
+    0x92,0x69,0x26,0x77,0x1D,0x3F,0x8A,0x87,0xFF,0xF9,0x77,0xD1,0x77,0x7D,0x63,0x65,\
+    0x19,0xFF,0x77,0x55,0x72,0x67,0x66,0x1B,0x37,0x39,0xFF,0x1E,0x0F,0xDE,0xF9,0xA8,\
+    0x75,0x14,0xB0,0xFE,0x43,0x40,0x8D,0x3D,0x09,0x80,0x39,0x78,0x43,0xFF,0xC5,0x67,\
+    0x26,0x1B,0x77,0x57,0x32,0x65,0xF7,0x66,0x77,0x1B,0x2F,0x01,0x7B,0xCF,0x39,0xD4,\
+    0xBF,0x47,0x29,0x0F,0x04,0x2F,0xE2,0x17,0x0B,0x49,0xF7,0x69,0x58,0x6D,0x2F,0x01,\
+    0x41,0x01,0x1F,0xB6,0xFE,0x4D,0x07,0x09,0x48,0x71,0x8F,0xB7,0xAD,0x37,0xB7,0x3B,\
+    0x16,0x68,0x35,0x0F,0x39,0x1C,0x6B,0x01,0x07,0xF7,0x6E,0x68,0x39,0x83,0x01,0x71,\
+    0x55,0x61,0xE7,0xFF,0x57,0x72,0x65,0x26,0x19,0x37,0x55,0x32,0xAF,0x09,0x4A,0x77,\
+    0x19,0x53,0x02,0x6C,0x53,0x18,0x3C,0xA2,0x53,0x18,0x6B,0x53,0x18,0xCF,0x80,0x53,\
+    0x16,0x31,0x53,0x18,0x64,0xAA,0x53,0x18,0x62,0x53,0x18,0x32,0x53,0x18,0x61,0x53,\
+    0x18,0x65,0xAA,0x53,0x18,0x37,0x53,0x18,0x62,0x53,0x18,0x78,0x53,0x18,0x28,0x5A,\
+    0x53,0x18,0x7F,0x53,0x15,0x48,0x25,0x81,0x81,0x6D,0x81,0x82,0xBF,0x5C,0x45,0x39,\
+    0x3D,0x77,0x38,0x05,0x00,0xC2,0xFF,0x77,0x38,0x79,0x05,0x8F,0x72,0x44,0xAA,0xFF,\
+    0x47,0x2A,0x39,0x16,0x4F,0x51,0xC7,0x39,0xFF,0x43,0xC2,0x0B,0x38,0x6F,0x45,0x39,\
+    0x7B,0xFF,0x77,0x6D,0x00,0xD5,0x39,0xD9,0x7F,0xFE,0xEF,0x47,0x39,0x22,0x2E,0x29,\
+    0x00,0x7C,0x39,0x3D,0xFF,0x4E,0x2A,0x47,0x47,0x68,0xA4,0x88,0x83,0xFF,0x39,0xC6,\
+    0x6A,0xEF,0x11,0x91,0x6F,0x26,0xFF,0x13,0x77,0x5B,0x72,0x69,0x26,0x1F,0x37,0xBF,\
+    0x5F,0x32,0x6D,0x66,0x77,0x1D,0x5F,0xC0,0x6C,0xEE,0x59,0x00,0x38,0x54,0xC5,0x53,\
+    0x00,0x92,0xBD,0x6C,0xFE,0xFB,0xC1,0x74,0xC5,0x8F,0x72,0x77,0x7E,0x47,0xFD,0x47,\
+    0x0B,0x01,0x47,0x29,0x60,0xF8,0x77,0x7D,0x3F,0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x0B,\
+    0x3F,0x0B,0x3F,0xA4,0x0B,0x3F,0x0B,0x2E,0x9D,0x47,0x3F,0x0B,0x3A,0xA8,0x0B,0x00,\
+    0xE1,0xFE,0x0B,0x00,0x99,0x47,0x29,0x63,0x78,0x77,0x7D,0xBF,0x1D,0x15,0x39,0x78,\
+    0x2D,0x25,0x0B,0x00,0x0C,0xAA,0x0B,0x00,0xB9,0x0B,0x00,0xF1,0x0B,0x00,0xD0,0x0B,\
+    0x00,0xED,0xFE,0x0B,0x00,0x9D,0x47,0x29,0x62,0x64,0x77,0x7D,0xBF,0x1C,0x11,0x39,\
+    0x78,0x2C,0x29,0x0B,0x00,0x08,0x2A,0x0B,0x00,0x45,0x0B,0x00,0xF5,0x0B,0x00,0xDC,\
+    0x8F,0x3F,0x0B,0x3F,0x80,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,\
+    0x3F,0x0B,0x21,0x39,0xFF,0x3B,0xB8,0xC1,0x71,0x8F,0x68,0x69,0x7D,0xFF,0x17,0x39,\
+    0x62,0x41,0x51,0x47,0x39,0x83,0xFF,0x14,0x77,0x64,0x22,0x3F,0x49,0x69,0x17,0xFF,\
+    0x6D,0x47,0x95,0x19,0x14,0x77,0x7D,0x24,0xFF,0x8D,0x49,0x68,0x47,0x68,0x6D,0x49,\
+    0x35,0xFF,0x68,0x44,0x91,0xED,0x93,0x39,0x68,0x7D,0xFF,0xC7,0x74,0xC5,0x6C,0x3D,\
+    0x77,0x6D,0x42,0xFF,0x6D,0x0A,0x94,0xF7,0xED,0x47,0x39,0x33,0xFD,0xC2,0x17,0x0D,\
+    0x03,0xD4,0x47,0x5D,0x6D,0x00,0xFF,0x39,0x7B,0x77,0x05,0x35,0x93,0x41,0x3D,0xFF,\
+    0x57,0x11,0x47,0x2A,0x39,0x68,0x55,0x11,0xFF,0x47,0xC6,0xC3,0x68,0x47,0x51,0xF1,\
+    0x23,0xFF,0x2A,0x2C,0x77,0x38,0x54,0x78,0x39,0x3D,0xFF,0x46,0x2D,0x47,0x47,0x05,\
+    0x7D,0x49,0x51,0xFF,0x47,0xB9,0xF7,0x2E,0x3D,0x2A,0x21,0x17,0xFF,0x31,0x6E,0x77,\
+    0x68,0x20,0x37,0x73,0x2F,0xFF,0x11,0x49,0x74,0xC5,0xC9,0x98,0x77,0x6D,0xFF,0x4D,\
+    0x93,0x59,0x76,0x59,0x45,0x47,0x51,0xFF,0xA7,0xED,0xC9,0xD1,0x47,0x92,0x90,0x38,\
+    0x3F,0x12,0xAB,0x74,0xC5,0x89,0xD8,0x17,0x01,0x9B,0x00,0xFF,0x7D,0x37,0x39,0x59,\
+    0x64,0x47,0x6E,0x15,0xFF,0x7A,0x6E,0x28,0x12,0x6D,0xB8,0x51,0x49,0xFF,0x69,0x51,\
+    0x72,0x6F,0x26,0x13,0x77,0x5B,0xFF,0x72,0x69,0x26,0x13,0x37,0x39,0x33,0x09,0xF7,\
+    0x4C,0x77,0x19,0xD7,0x04,0x71,0x65,0x17,0x39,0xFF,0x60,0x5D,0x43,0x47,0x35,0x11,\
+    0x46,0x77,0xFF,0x7D,0x71,0x05,0x39,0x68,0xCF,0xD4,0x47,0xFF,0x29,0x5A,0xDC,0x12,\
+    0x61,0x67,0x38,0xE9,0xFB,0xEC,0xC7,0x0B,0x01,0xB0,0x14,0x6B,0x37,0x38,0xFF,0x59,\
+    0x68,0x77,0xA3,0x6F,0x7D,0x1F,0x2D,0xFF,0x57,0x28,0x67,0x38,0x6B,0xE8,0x95,0xE5,\
+    0xFF,0x06,0xC9,0x33,0x96,0x5D,0x25,0x74,0xC5,0xFB,0x93,0xC2,0x71,0x01,0x0A,0x94,\
+    0x22,0x38,0x47,0x7F,0x39,0x3C,0x3C,0x44,0x91,0x67,0x19,0xE9,0x01,0xFF,0x3D,0x39,\
+    0x03,0x7B,0x44,0x91,0xE7,0x99,0xFE,0x0B,0x01,0x7F,0xBC,0x13,0x51,0x77,0x7E,0x47,\
+    0x7F,0x51,0x41,0xC2,0x05,0x38,0x67,0x45,0xF5,0x00,0x7F,0x6D,0x65,0x45,0x39,0x97,\
+    0x8D,0x6D,0xE3,0x01,0xFF,0x64,0x29,0x47,0x6C,0x08,0x14,0xC1,0x77,0xDA,0xE9,0x00,\
+    0x7C,0xE9,0x02,0x3B,0x47,0x05,0x00,0xF9,0x2E,0xEF,0xC7,0x2A,0x20,0x23,0xEF,0x02,\
+    0x3F,0x89,0x2F,0xFF,0x11,0x55,0x27,0x37,0x17,0x40,0x77,0x05,0xFF,0xD9,0xBC,0x49,\
+    0x2C,0xC7,0xEA,0x25,0xF1,0xFF,0x59,0x4C,0x57,0x26,0x13,0xB2,0x88,0xA5,0xFF,0x13,\
+    0x65,0x13,0xB5,0x0F,0x54,0x77,0x6D,0xBF,0x27,0x21,0x0A,0x94,0xE7,0xFD,0x67,0x43,\
+    0x47,0xF9,0x39,0x71,0x01,0xFB,0x00,0x48,0x07,0x6C,0x27,0x25,0xFF,0x09,0x6B,0x25,\
+    0x2E,0x10,0x79,0x5C,0x68,0xBF,0x88,0x1F,0x74,0xC5,0xA9,0xF8,0xA7,0x03,0x77,0xFD,\
+    0x6D,0x29,0x01,0x07,0x6C,0x61,0x26,0x11,0x77,0xFF,0x5D,0x72,0x6B,0x26,0x17,0x77,\
+    0x51,0x32,0xFB,0x6F,0x66,0x13,0x45,0x58,0x60,0x67,0x16,0x39,0xDF,0x64,0x05,0x6D,\
+    0x65,0x56,0x13,0x40,0x2D,0x67,0xFF,0x79,0xE8,0x87,0x77,0x7D,0x16,0xF0,0x39,0xDF,\
+    0x76,0x64,0x91,0x47,0x6C,0xB3,0x00,0x38,0x54,0xFF,0xC5,0x39,0xC2,0x77,0x92,0xBD,\
+    0x6C,0x0A,0xFD,0x94,0xB3,0x00,0x2A,0x39,0x16,0x45,0x51,0x45,0xDF,0x39,0x82,0x21,\
+    0x10,0x69,0x1F,0x40,0x6E,0xCC,0x7F,0xA5,0x22,0xED,0x49,0x68,0x5D,0x32,0x47,0x03,\
+    0xFF,0x68,0x3E,0x19,0x47,0x77,0x7D,0x79,0x05,0xB7,0x3B,0x68,0x5D,0xD9,0x42,0x6C,\
+    0x11,0x41,0x00,0x3D,0xDE,0x05,0x00,0x93,0x39,0x3D,0x45,0xE5,0x40,0x0A,0xA9,0xFE,\
+    0x13,0x40,0x47,0x1B,0x07,0x77,0x61,0x67,0x79,0xFF,0x09,0x54,0x88,0x92,0x16,0xF6,\
+    0x39,0x70,0xD6,0x23,0x09,0x44,0xAC,0x5F,0x01,0x49,0x5F,0x00,0x89,0x31,0xFE,0x5F,\
+    0x02,0x70,0xC4,0xA5,0x24,0xE3,0x22,0x14,0xEF,0x77,0x38,0x47,0x6C,0x05,0x00,0xC7,\
+    0x47,0x6C,0xFE,0x41,0x03,0x49,0x68,0x59,0x72,0x6D,0x66,0x77,0xFF,0x1D,0x39,0x1C,\
+    0x68,0x3E,0x16,0x6E,0x4B,0xDF,0x42,0x47,0x37,0x2A,0x94,0x23,0x00,0xC6,0xC3,0xF5,\
+    0x3D,0xB3,0x00,0x93,0xB3,0x01,0x74,0xC5,0x8F,0x72,0xFE,0x29,0x01,0x16,0x6E,0x16,\
+    0x6D,0xBA,0x0D,0x61,0x7F,0xE7,0x59,0x6D,0x0D,0x3E,0x5F,0x4C,0xE9,0x00,0xFF,0x45,\
+    0x39,0x78,0x14,0xD9,0x37,0x39,0x09,0xFF,0x6E,0x3C,0x9D,0x4B,0x39,0x19,0x05,0x77,\
+    0xFF,0x69,0x0F,0x51,0xC6,0x96,0x58,0x78,0x26,0xFF,0x39,0xC6,0x2A,0x59,0x6D,0x17,\
+    0xB6,0x13,0xF7,0x37,0x57,0x6A,0x1F,0x41,0x39,0x18,0x09,0x48,0xFF,0x71,0x8F,0x78,\
+    0x6D,0x69,0x16,0x39,0x7C,0xFF,0x5D,0x42,0x47,0x21,0x11,0x47,0x77,0x71,0xFF,0x0D,\
+    0xBE,0x5F,0x6C,0x07,0x6D,0x27,0x07,0xFE,0x6B,0x16,0x6C,0x58,0x68,0x68,0x3E,0x58,\
+    0x68,0xFF,0x8A,0xF1,0x08,0xD6,0x39,0x64,0x5B,0x6D,0xFF,0x0D,0x3F,0x5F,0x78,0x58,\
+    0x6A,0x68,0x3D,0xFF,0x16,0x6D,0x16,0x6D,0xB9,0xA5,0x15,0x68,0xFF,0x38,0x82,0x47,\
+    0x35,0x19,0x6E,0x5F,0x72,0xFF,0x6D,0x26,0x15,0x77,0x59,0x72,0x09,0x4C,0xAB,0x39,\
+    0x68,0x97,0x41,0x79,0x05,0x00,0x27,0xC1,0x40,0xF7,0x57,0x6D,0x47,0x3B,0x11,0x00,\
+    0x69,0xCD,0x40,0x6E,0x17,0x00,0xF5,0x31,0x0B,0x00,0x61,0x0B,0x00,0x78,0x77,0x6D,\
+    0x09,0xC7,0x48,0x77,0x19,0x29,0x01,0x2F,0x03,0x05,0x0D,0x43,0x4D,0x0F,0x44,0x54,\
+    0x45,0x43}
 
-//0x77ED eor 0x4739 = 0x30D4 12,500 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x77,0xED,0x39,0x32,0x66,0x11,
-//0x6029 eor 0x4739 = 0x2710 10,000 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x60,0x29,0x39,0x32,0x66,0x11,
-//0x5A75 eor 0x4739 = 0x1D4C 7,500 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x5A,0x75,0x39,0x32,0x66,0x11,
-//0x54B1 eor 0x4739 = 0x1388 5,000 4.5454 ms with 5.5 MHz Clock
-//    0x11,0x54,0xB1,0x39,0x32,0x66,0x11,
-//0x4EFD eor 0x4739 = 0x09C4 2,500 0.909 ms with 5.5 MHz Clock
-//    0x11,0x4E,0xFD,0x39,0x32,0x66,0x11,
 #define T8_BOOTLOADER_DUMP {\
-    0x77,0xD1,0x77,0x7D,0x1B,0x09,0x77,\
-    0xD1,0x77,0x7D,0x1B,0x7D,0x77,0x1D,\
-    0x39,0x1C,0x05,0x00,0x39,0x78,0x0B,\
-    0x61,0x05,0x80,0x39,0x78,0x0B,0x7D,\
-    0x05,0x80,0x39,0x78,0x1B,0x6D,0x05,\
-    0x00,0x39,0x78,0x0C,0x99,0x37,0x38,\
-    0x2A,0xA8,0x77,0x7D,0x3C,0xCC,0x7B,\
-    0x51,0x77,0x7D,0x3C,0xC1,0x2A,0xA8,\
-    0x77,0x7D,0x3C,0xC0,0x7B,0x51,0x77,\
-    0x7D,0x23,0x39,0x7B,0x51,0x77,0x7D,\
-    0x2C,0xC4,0x7B,0x51,0x77,0x7D,0x2C,\
-    0xC7,0x7B,0x51,0x77,0x7D,0x23,0x3D,\
-    0x7B,0x11,0x77,0x7D,0x23,0x3B,0x77,\
-    0x1D,0x17,0x93,0x09,0x4C,0x77,0x3E,\
-    0x88,0xBD,0x0F,0xDE,0x36,0x54,0x5D,\
-    0x11,0x47,0x29,0x5D,0x6E,0x35,0x38,\
-    0x7D,0x05,0x32,0xD0,0x39,0xD4,0x47,\
-    0x29,0x65,0x58,0x39,0xD4,0x47,0x29,\
-    0x65,0x2C,0x49,0x78,0x15,0x7E,0x03,\
-    0xEF,0xC9,0x28,0x22,0xD3,0x58,0x68,\
-    0x88,0xE9,0x09,0x80,0x39,0x78,0x43,\
-    0xBD,0x09,0x80,0x39,0x78,0x2E,0x3D,\
-    0x3D,0x38,0x2A,0xAD,0x77,0x7D,0x2C,\
-    0xC4,0x2A,0xAD,0x77,0x7D,0x2C,0xC7,\
-    0x11,0x54,0x77,0x7D,0x3C,0xC1,0x1D,\
-    0x14,0x77,0x7D,0x3C,0xCD,0x73,0x7A,\
-    0x10,0x6D,0x47,0xD9,0x73,0x51,0x77,\
-    0x7D,0x3C,0xCC,0x5F,0x68,0x77,0xBB,\
-    0x09,0x80,0x39,0x78,0x2B,0x5D,0x09,\
-    0x80,0x39,0x78,0x2B,0x29,0x57,0x00,\
-    0x39,0x78,0x6F,0x6C,0xF7,0x05,0x39,\
-    0x0D,0x10,0x63,0xF7,0x05,0x39,0x0E,\
-    0x10,0x7F,0xF7,0x05,0x39,0x0F,0x10,\
-    0x7B,0x27,0x27,0x00,0x36,0x43,0x36,\
-    0x2A,0x94,0x77,0x6C,0x47,0x29,0x45,\
-    0x76,0x17,0x77,0x54,0xC5,0x39,0x6A,\
-    0x77,0x7D,0x3B,0x27,0x59,0x78,0x64,\
-    0x91,0x47,0x3A,0x39,0x78,0x0B,0x73,\
-    0x27,0x3F,0x7B,0x51,0x77,0x7D,0x3B,\
-    0x27,0x77,0xD1,0x77,0x7D,0x74,0x79,\
-    0x16,0x54,0x77,0x7D,0x3B,0x24,0x16,\
-    0x54,0x77,0x7D,0x3B,0x21,0x49,0x6D,\
-    0x58,0x6D,0x37,0x35,0x16,0x68,0x39,\
-    0xD4,0x47,0x29,0x17,0x2C,0x4D,0xD1,\
-    0x47,0x3D,0x76,0x87,0x77,0x7D,0x0D,\
-    0x00,0x39,0x78,0x13,0x6D,0x21,0x6B,\
-    0x45,0x61,0x51,0x11,0x47,0x29,0x5D,\
-    0x6A,0x5F,0x11,0x47,0x29,0x5D,0x68,\
-    0x07,0x6D,0x77,0x2C,0x16,0x68,0x47,\
-    0x7E,0x0F,0xF9,0x16,0x68,0x39,0xD4,\
-    0x47,0x29,0x73,0x00,0x5D,0x6D,0x5F,\
-    0xBC,0x07,0x7D,0x25,0x2A,0x7D,0xBE,\
-    0x69,0xE7,0xC9,0x2B,0x23,0x3D,0x73,\
-    0x6D,0x10,0xB7,0x0D,0x00,0x39,0x78,\
-    0x13,0x6D,0x21,0x2F,0x49,0x6F,0x58,\
-    0x6D,0x37,0x38,0x16,0x68,0x39,0xD4,\
-    0x47,0x29,0x73,0x00,0x64,0xAD,0x47,\
-    0x29,0x5D,0x68,0x27,0xE2,0x54,0xC5,\
-    0x39,0x69,0x77,0x7D,0x3C,0xCC,0x19,\
-    0x2C,0x3D,0x7D,0x20,0x7D,0x73,0x51,\
-    0x77,0x7D,0x3C,0xC0,0x5F,0x54,0x3D,\
-    0x54,0x47,0x29,0x5D,0x68,0x11,0x59,\
-    0x68,0x00,0x39,0x78,0x0C,0x91,0x68,\
-    0x00,0x39,0x78,0x0B,0x69,0x68,0x00,\
-    0x39,0x78,0x0B,0x65,0x77,0x00,0x39,\
-    0x78,0x13,0x6F,0x0F,0xF9,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x73,0xC0,0x64,\
-    0xAD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x5D,0x68,0x64,0x91,0x47,0x38,0x39,\
-    0x78,0x0C,0x94,0x08,0xD6,0x39,0x78,\
-    0x39,0xD4,0x47,0x29,0x65,0x58,0x39,\
-    0xD4,0x47,0x29,0x65,0x2C,0x3D,0x54,\
-    0x47,0x29,0x42,0x91,0x10,0x6D,0x47,\
-    0x8B,0x73,0x51,0x77,0x7D,0x3B,0x35,\
-    0x5E,0x68,0x77,0xC5,0x0D,0x00,0x39,\
-    0x78,0x13,0x69,0x21,0x39,0x39,0xF6,\
-    0x39,0xD4,0x47,0x29,0x0A,0x28,0x39,\
-    0xD4,0x47,0x29,0x16,0x88,0x64,0x91,\
-    0x47,0x38,0x39,0x78,0x13,0x69,0x09,\
-    0x80,0x39,0x78,0x46,0x59,0x0F,0x57,\
-    0xC6,0x93,0x3F,0x03,0xB8,0xC5,0x49,\
-    0x6B,0x58,0x6D,0x37,0x27,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x17,0x2C,0x38,\
-    0x82,0x47,0x29,0x73,0x46,0x88,0x96,\
-    0x20,0x5B,0x71,0x06,0x88,0x8A,0x0F,\
-    0x57,0xC6,0x80,0x07,0x7F,0x68,0x39,\
-    0x49,0x65,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x59,0x29,0x08,0xD6,0x39,0x78,\
-    0x3D,0x43,0xB8,0xDE,0x5E,0x2A,0x0B,\
-    0x6D,0x39,0x39,0x43,0x78,0x05,0x6D,\
-    0x75,0x3E,0x29,0x5E,0x6F,0x87,0xFA,\
-    0x39,0x24,0xE8,0x6F,0xB9,0x9B,0x05,\
-    0x39,0x79,0x25,0x2A,0xF9,0x7C,0x5C,\
-    0x80,0x4D,0xEA,0x68,0x05,0x39,0x6B,\
-    0x08,0x9D,0x0F,0x57,0xC6,0xBC,0x07,\
-    0x7D,0x68,0x39,0x49,0x69,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x3D,0xC5,0x54,\
-    0xF9,0x39,0x78,0x13,0x6D,0x08,0xD6,\
-    0x39,0x78,0x3D,0x54,0x47,0x29,0x45,\
-    0x64,0x10,0x6D,0xB9,0x3D,0x19,0x51,\
-    0x77,0x7D,0x3B,0x29,0x89,0xD1,0x77,\
-    0x7D,0x2B,0x39,0x00,0x36,0x43,0x36,\
-    0x5D,0x68,0x8A,0x85,0x0D,0x00,0x39,\
-    0x78,0x13,0x69,0x20,0x39,0xC4,0xB6,\
-    0x3D,0x54,0x47,0x29,0x5D,0x68,0x11,\
-    0x6D,0xBA,0xED,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0xD1,0x77,0x7D,0x1C,\
-    0xE9,0x59,0x68,0x8A,0xA9,0x6F,0x26,\
-    0x13,0x77,0x5B,0x72,0x69,0x26,0x1D,\
-    0x37,0x51,0x32,0x6F,0x66,0x13,0x37,\
-    0x39,0x33,0x09,0x4C,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x71,0x8F,0x74,0x71,\
-    0x6D,0x56,0x39,0x70,0x51,0x02,0x47,\
-    0x25,0x11,0x07,0x77,0x4D,0x65,0x56,\
-    0x39,0x4C,0x3D,0x38,0x21,0x3D,0x49,\
-    0x69,0x17,0x25,0x65,0x35,0x17,0x79,\
-    0x0B,0x6C,0x8B,0xBE,0x73,0xEE,0x10,\
-    0x67,0x14,0xBE,0x1B,0xEF,0x57,0x2A,\
-    0x5F,0xA9,0x6B,0x3D,0x59,0x6B,0xFB,\
-    0x6C,0x5D,0x78,0x5F,0x2C,0x9E,0xFF,\
-    0x21,0xB3,0x25,0xEA,0x37,0x39,0x09,\
-    0x7D,0xC9,0xED,0x22,0xCD,0x05,0x7D,\
-    0x7F,0x6B,0x47,0x39,0x5E,0x7A,0x07,\
-    0x6D,0x77,0x3F,0x15,0x68,0x57,0x2C,\
-    0x96,0xFF,0x1B,0x39,0xA4,0xAB,0x57,\
-    0xA8,0x6B,0x3D,0x07,0x6D,0x6B,0x26,\
-    0x17,0x77,0x51,0x32,0x6F,0x66,0x13,\
-    0x37,0x39,0x18,0x4B,0x16,0x39,0x96,\
-    0x77,0x6A,0x21,0x25,0x0A,0x94,0x77,\
-    0x6F,0x47,0x29,0x5D,0x7C,0x07,0x6D,\
-    0x57,0x16,0x39,0x63,0x44,0xAD,0x47,\
-    0x29,0x5D,0x60,0x7F,0x94,0x47,0x3C,\
-    0x39,0x78,0x13,0x61,0x09,0x4C,0x77,\
-    0x19,0x44,0x82,0x47,0x3F,0x39,0x78,\
-    0x13,0x65,0x4F,0xC0,0x39,0x6D,0x77,\
-    0x7D,0x23,0x35,0x00,0x36,0x43,0x36,\
-    0x7B,0x11,0x77,0x7D,0x23,0x2D,0x77,\
-    0x1D,0x57,0x11,0x47,0x29,0x5D,0x64,\
-    0x35,0x7D,0x05,0x11,0x39,0x69,0x35,\
-    0x45,0x47,0x3B,0x31,0xB8,0x77,0x69,\
-    0x4F,0xE9,0x39,0x68,0x7F,0xBD,0x47,\
-    0x3F,0x7B,0x11,0x77,0x7D,0x23,0x29,\
-    0x7B,0x51,0x77,0x7D,0x23,0x36,0x19,\
-    0x14,0x77,0x7D,0x23,0x21,0x29,0xD4,\
-    0x77,0x54,0x56,0x45,0x39,0x00,0x77,\
-    0x6C,0x56,0x45,0x39,0x1F,0x77,0x6F,\
-    0x56,0x45,0x39,0x05,0x77,0x6E,0x56,\
-    0x45,0x39,0x2F,0x77,0x69,0x05,0x00,\
-    0x39,0x78,0x13,0x70,0x09,0x4C,0x77,\
-    0x19,0x58,0x6A,0x79,0x16,0x39,0x62,\
-    0x7F,0x54,0x47,0x3B,0x39,0x78,0x13,\
-    0x67,0x09,0x48,0x77,0x19,0x47,0x6A,\
-    0x05,0x39,0x89,0x14,0x75,0x6D,0x20,\
-    0x33,0x89,0x14,0x74,0x6D,0x20,0x75,\
-    0x59,0x68,0x77,0xAF,0x37,0x39,0x29,\
-    0x6F,0x3D,0x2D,0x20,0x39,0x39,0xD0,\
-    0x57,0x11,0x47,0x29,0x5D,0x40,0x66,\
-    0x3D,0x47,0x38,0x29,0xD4,0x77,0x12,\
-    0x56,0x79,0x39,0x6A,0x58,0x65,0x37,\
-    0x3A,0x16,0x68,0x39,0xD4,0x47,0x29,\
-    0x07,0xC0,0x05,0x6D,0x55,0x39,0x19,\
-    0x69,0x92,0xE5,0x87,0x05,0x39,0x6C,\
-    0x75,0x54,0x47,0xC2,0x39,0x78,0x13,\
-    0x67,0xC6,0x00,0x39,0x78,0x13,0x67,\
-    0x17,0xB6,0x59,0x68,0x77,0x17,0x37,\
-    0x39,0x29,0x6F,0x3D,0x2D,0x20,0x07,\
-    0x19,0x14,0x77,0x7D,0x23,0x11,0x39,\
-    0x78,0x77,0x2D,0x56,0x79,0x39,0x69,\
-    0x58,0x65,0x37,0x39,0x29,0x51,0x77,\
-    0x7D,0x23,0x30,0x00,0x36,0x43,0x36,\
-    0x16,0x68,0x39,0xD4,0x47,0x29,0x07,\
-    0xC0,0x05,0x6D,0x55,0x39,0x19,0x69,\
-    0x92,0xE5,0x87,0x05,0x39,0x6C,0x75,\
-    0x54,0x47,0xC2,0x39,0x78,0x13,0x67,\
-    0xC6,0x00,0x39,0x78,0x13,0x67,0x17,\
-    0xB6,0x59,0x5A,0x57,0x11,0x47,0x29,\
-    0x5D,0x40,0x77,0x7D,0x47,0x79,0x16,\
-    0x60,0x07,0x6C,0x68,0x39,0x77,0xD1,\
-    0x77,0x7D,0x79,0x91,0x4B,0x68,0x65,\
-    0x6D,0x67,0x38,0xDC,0xE0,0xB7,0x51,\
-    0x47,0x3D,0x3B,0x51,0x77,0x96,0x47,\
-    0x29,0x5D,0x62,0xF6,0x54,0x47,0x29,\
-    0x5D,0x62,0x27,0xE2,0x69,0x26,0x77,\
-    0x1D,0x39,0x1C,0x65,0x45,0x39,0x78,\
-    0x13,0x61,0x4F,0x10,0x39,0x6D,0x77,\
-    0x6C,0x20,0x39,0x38,0x2A,0x67,0x54,\
-    0x47,0x29,0x5D,0x67,0xC7,0x51,0x47,\
-    0x0D,0x5E,0x64,0xC7,0x51,0x47,0x0F,\
-    0x5E,0x68,0x77,0xFB,0x27,0x39,0x38,\
-    0x42,0x3D,0x54,0x47,0x29,0x5D,0x68,\
-    0x10,0x49,0x4F,0x80,0x39,0x6A,0x77,\
-    0x7D,0x23,0x33,0x2A,0x94,0x77,0x59,\
-    0x47,0x29,0x5D,0x40,0x7F,0xC4,0x47,\
-    0x3C,0x39,0x69,0x3F,0x15,0x45,0xBC,\
-    0x58,0x68,0x89,0xA5,0x1F,0xB6,0x59,\
-    0x68,0x77,0x93,0x0D,0x00,0x39,0x78,\
-    0x0C,0x98,0x20,0x0B,0x73,0x11,0x77,\
-    0x7D,0x23,0x2B,0x5E,0x42,0x7F,0xD4,\
-    0x47,0x3B,0x39,0x78,0x13,0x67,0x54,\
-    0xC5,0x39,0x5C,0x77,0x7D,0x23,0x11,\
-    0x31,0xC1,0x77,0x68,0x47,0x38,0x7B,\
-    0x11,0x77,0x7D,0x23,0x2B,0x71,0x10,\
-    0x74,0x6D,0x26,0x39,0xC7,0xE6,0x2F,\
-    0xE2,0x27,0x39,0x00,0x36,0x43,0x36,\
-    0x39,0xAC,0x47,0x54,0x47,0x29,0x5D,\
-    0x7A,0x25,0x2D,0x74,0xF9,0x39,0x78,\
-    0x13,0x7F,0xF7,0x45,0x3B,0xE8,0x14,\
-    0x6D,0x47,0x97,0x31,0xD1,0x77,0x6F,\
-    0x47,0x29,0x5D,0x62,0x64,0x91,0x47,\
-    0x0D,0x39,0x78,0x13,0x45,0x27,0x39,\
-    0x39,0xE2,0x3D,0x54,0x47,0x29,0x5D,\
-    0x68,0x10,0x49,0x4F,0x80,0x39,0x6A,\
-    0x77,0x7D,0x23,0x33,0x2A,0x94,0x77,\
-    0x5B,0x47,0x29,0x5D,0x40,0x7F,0xC4,\
-    0x47,0x3C,0x39,0x69,0x3F,0x15,0x45,\
-    0xBC,0x58,0x68,0x89,0x55,0x1F,0xB6,\
-    0x59,0x68,0x77,0x03,0x0D,0x00,0x39,\
-    0x78,0x0C,0x94,0x20,0x09,0x73,0x11,\
-    0x77,0x7D,0x23,0x2B,0x5E,0x40,0x7F,\
-    0xD4,0x47,0x3B,0x39,0x78,0x13,0x67,\
-    0x54,0xC5,0x39,0x5E,0x77,0x7D,0x23,\
-    0x11,0x31,0xC1,0x77,0x68,0x47,0x38,\
-    0x7B,0x11,0x77,0x7D,0x23,0x2B,0x71,\
-    0x10,0x74,0x6D,0x26,0x39,0xC4,0x96,\
-    0x2F,0xE2,0x27,0x0D,0x09,0x51,0x77,\
-    0x7D,0x23,0x2B,0x6B,0x28,0x44,0xAD,\
-    0x47,0x29,0x5D,0x7A,0xC7,0x11,0x45,\
-    0xB9,0x5A,0x48,0x7F,0xD4,0x47,0x3B,\
-    0x39,0x78,0x13,0x67,0x54,0xC5,0x39,\
-    0x5E,0x77,0x7D,0x23,0x11,0x7B,0x11,\
-    0x77,0x7D,0x23,0x2B,0x71,0x10,0x75,\
-    0x15,0x26,0x39,0xC4,0xA0,0x2F,0xE2,\
-    0x09,0x4C,0x77,0x19,0x16,0x6D,0xB9,\
-    0x93,0x77,0x1D,0x39,0x1C,0x77,0x00,\
-    0x39,0x78,0x13,0x65,0x14,0x79,0x5E,\
-    0x6E,0x47,0x51,0x45,0x2B,0x59,0x40,\
-    0x07,0x4D,0x97,0x80,0x39,0x78,0x1B,\
-    0x6D,0x64,0xF9,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x0B,0x7D,0x54,0xC5,0x39,\
-    0x69,0x77,0x7D,0x3B,0x35,0x31,0xD1,\
-    0x77,0x6B,0x47,0x29,0x5D,0x64,0x35,\
-    0x14,0x47,0x29,0x5D,0x78,0x47,0x51,\
-    0x44,0x39,0x77,0x1D,0x39,0x1C,0x77,\
-    0x00,0x39,0x78,0x13,0x65,0x1A,0x79,\
-    0x5F,0x60,0x3D,0x14,0x47,0x29,0x5D,\
-    0x7C,0x10,0x6B,0x77,0x05,0x3B,0x7A,\
-    0x17,0x57,0x67,0x45,0x39,0x78,0x13,\
-    0x61,0x4F,0xD1,0x39,0x6D,0x77,0x6F,\
-    0x4F,0xD1,0x39,0x6C,0x77,0x6F,0x54,\
-    0xC5,0x39,0x5C,0x77,0x7D,0x23,0x36,\
-    0x0A,0x94,0x75,0x13,0x47,0x29,0x5D,\
-    0x7A,0x7F,0x85,0x47,0x3C,0x39,0x69,\
-    0x64,0x91,0x47,0x38,0x39,0x78,0x0C,\
-    0x99,0x05,0x00,0x39,0x78,0x0C,0x98,\
-    0x77,0x05,0x38,0x68,0x39,0x18,0x09,\
-    0x6F,0xC6,0x90,0x58,0x60,0x68,0x3E,\
-    0x16,0x63,0x55,0x11,0x47,0x29,0x5D,\
-    0x40,0x55,0x44,0x47,0x3B,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x1F,0x29,0x09,0x6D,0x39,\
-    0xBB,0x0A,0xAF,0x77,0x7D,0x23,0x31,\
-    0x47,0x69,0x25,0x2A,0x55,0x22,0x22,\
-    0xE9,0x0F,0x6D,0x4B,0x7E,0x39,0xE9,\
-    0x1A,0x9F,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x09,0x48,\
-    0x77,0x19,0x39,0x1C,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x00,0x36,0x43,0x36,\
-    0x77,0x19,0x39,0x1C,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x09,0x48,\
-    0x77,0x19,0x39,0x1C,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x09,0x48,\
-    0x77,0x19,0x39,0x1C,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x09,0x48,\
-    0x77,0x19,0x39,0x1C,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x09,0x48,\
-    0x77,0x19,0x39,0x1C,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x09,0x48,0x77,0x19,0x39,\
-    0x1C,0x09,0x48,0x77,0x19,0x39,0x1C,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x77,\
-    0x05,0x3A,0xE8,0x39,0x1C,0x09,0x48,\
-    0x1F,0x37,0x59,0x72,0x6D,0x66,0x77,\
-    0x36,0x39,0x18,0x68,0x34,0x16,0x6F,\
-    0x5D,0x11,0x47,0x29,0x5D,0x64,0x7F,\
-    0x78,0x47,0x3F,0x00,0x36,0x43,0x36,\
-    0x5E,0x4C,0x49,0x54,0x47,0x29,0x5D,\
-    0x78,0x25,0x2A,0x74,0xFE,0x39,0x78,\
-    0x13,0x7D,0xF9,0x45,0x3A,0x48,0x12,\
-    0x7D,0x4F,0xAC,0x39,0x6E,0x35,0x14,\
-    0x47,0x29,0x5D,0x78,0x39,0xD4,0x47,\
-    0x29,0x62,0xB8,0x7F,0x78,0x47,0x3C,\
-    0x5E,0x68,0x76,0x7B,0x4F,0xAC,0x39,\
-    0x6D,0x7F,0xD4,0x47,0x3B,0x39,0x78,\
-    0x13,0x67,0x6D,0x45,0x39,0x78,0x13,\
-    0x45,0x57,0x2C,0x89,0x54,0x77,0x4C,\
-    0x25,0x27,0x5E,0x68,0x77,0xE5,0xF7,\
-    0x05,0x39,0x72,0x10,0x45,0xF7,0x05,\
-    0x39,0x48,0x10,0x6D,0x47,0x5F,0x89,\
-    0x54,0x77,0x59,0x20,0x39,0x39,0x00,\
-    0x17,0x6D,0x47,0xEB,0x89,0x54,0x77,\
-    0x56,0x20,0x39,0x39,0x18,0xC7,0x51,\
-    0x47,0x07,0x5E,0x68,0x77,0xF5,0x27,\
-    0x39,0x39,0xD6,0x49,0x54,0x47,0x29,\
-    0x5D,0x60,0xC9,0x11,0x47,0x3B,0x5E,\
-    0x6E,0x49,0x51,0x45,0x2B,0x59,0x46,\
-    0x65,0x40,0x47,0x38,0x49,0x68,0x67,\
-    0x6C,0xF7,0x85,0x39,0x68,0x77,0xDD,\
-    0x21,0x23,0x22,0x14,0x77,0x7C,0x47,\
-    0x3B,0x09,0x6F,0x25,0x2D,0x74,0xF9,\
-    0x39,0x78,0x13,0x65,0x39,0x39,0x27,\
-    0x69,0xF9,0x11,0x44,0x39,0x59,0x6C,\
-    0x49,0x51,0x45,0x08,0x59,0x68,0x77,\
-    0x13,0x26,0x39,0xC4,0x3A,0x59,0x6D,\
-    0x27,0x39,0x39,0x1C,0x16,0x6D,0xBA,\
-    0xBD,0x17,0x68,0x17,0x6D,0x47,0x53,\
-    0x58,0x68,0x8A,0xA3,0x69,0x39,0x59,\
-    0x68,0x77,0x0D,0x37,0x39,0x29,0x45,\
-    0x77,0x6C,0x35,0x29,0x8B,0xE8,0x11,\
-    0x67,0x09,0x80,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x44,0xAD,0x0D,0x39,0x5F,\
-    0x6E,0x49,0x51,0x45,0x2B,0x59,0x7A,\
-    0x44,0x91,0x47,0x3B,0x39,0x78,0x13,\
-    0x65,0x39,0x39,0x27,0x45,0x77,0x6C,\
-    0xC9,0x45,0x3A,0x68,0x17,0x43,0x77,\
-    0x00,0x39,0x78,0x13,0x65,0x14,0x79,\
-    0x5F,0x72,0x35,0x14,0x47,0x29,0x5D,\
-    0x78,0x3D,0x14,0x47,0x29,0x5D,0x7C,\
-    0x11,0x6B,0x79,0x05,0x3A,0x68,0x17,\
-    0x67,0x79,0x05,0x38,0x68,0x17,0x69,\
-    0x79,0x05,0x3B,0x7A,0x17,0x69,0x79,\
-    0x05,0x3B,0x79,0x58,0x6A,0x26,0x39,\
-    0xC3,0xE4,0x2F,0xE2,0x69,0x26,0x13,\
-    0x37,0x39,0x18,0x09,0x48,0x77,0x19,\
-    0x39,0x1C,0x67,0x05,0xC6,0x96,0x77,\
-    0x6D,0x97,0x96,0x39,0x6C,0xC7,0xD1,\
-    0x47,0x34,0x39,0x68,0x24,0xAD,0x87,\
-    0x85,0x39,0x68,0x77,0x6C,0x09,0x4C,\
-    0x77,0x19,0x58,0x6A,0x68,0x3F,0x16,\
-    0x6D,0x5D,0x42,0x47,0x29,0x1B,0x47,\
-    0x77,0x79,0xFD,0xB8,0x5C,0x6C,0x07,\
-    0x92,0x27,0x79,0x47,0x68,0x57,0x28,\
-    0x6B,0x38,0xA5,0xED,0x93,0xE3,0x67,\
-    0x38,0xA9,0x6D,0x05,0x6E,0x85,0x39,\
-    0x73,0xEE,0x10,0x7D,0x3D,0xC6,0xE7,\
-    0xF8,0xC9,0xE8,0x21,0x3B,0x47,0x68,\
-    0x2F,0xE5,0x14,0xBF,0x5F,0x9A,0x3D,\
-    0x6C,0x20,0x2D,0x45,0x97,0x07,0x6D,\
-    0x57,0x29,0xE7,0xE8,0xC9,0xEB,0x21,\
-    0x3B,0x47,0x68,0x25,0xE5,0x14,0x38,\
-    0x5F,0x86,0x57,0x6A,0x6D,0x26,0x15,\
-    0x77,0x59,0x72,0x09,0x4C,0x77,0x19,\
-    0x58,0x6A,0x65,0x16,0x39,0x60,0x57,\
-    0x42,0x47,0x35,0x00,0x36,0x43,0x36,\
-    0x47,0x68,0xE7,0xEC,0x67,0x78,0x73,\
-    0xE8,0x10,0x49,0x65,0x39,0x31,0x68,\
-    0x77,0x6D,0x20,0x33,0x47,0x68,0x69,\
-    0x75,0x65,0x39,0x6A,0xE9,0x10,0x7F,\
-    0xA5,0xB0,0x49,0x68,0x67,0x75,0x99,\
-    0xB9,0x49,0x68,0x67,0x75,0x99,0xB9,\
-    0x6A,0xE9,0x11,0x9D,0x67,0x3E,0x17,\
-    0x77,0x39,0x18,0x09,0x48,0x71,0x8F,\
-    0x70,0x41,0x5D,0x16,0x39,0x77,0x6B,\
-    0x42,0x47,0x1A,0x13,0x07,0x77,0x49,\
-    0x63,0x56,0x39,0x40,0x35,0x7F,0x69,\
-    0x00,0x39,0x6A,0x76,0x2D,0x67,0x05,\
-    0xC6,0x96,0x77,0x6D,0x97,0xBE,0x89,\
-    0xD4,0x77,0x60,0x47,0x39,0x5B,0x68,\
-    0x77,0xBB,0x6F,0x40,0x39,0x6A,0x76,\
-    0x2D,0x57,0x00,0x39,0x78,0x13,0x4D,\
-    0x20,0x3D,0x47,0x9C,0x17,0x6F,0x39,\
-    0xC6,0x2B,0x44,0x77,0x6C,0x0D,0x39,\
-    0x5E,0x64,0xA5,0x51,0x47,0xEF,0x33,\
-    0x69,0x77,0x4C,0x27,0x39,0x39,0x6A,\
-    0xC5,0x6A,0x20,0x39,0x39,0xC0,0x58,\
-    0x66,0x61,0x45,0x39,0x78,0x13,0x4D,\
-    0x59,0x15,0x39,0x69,0x3D,0x7E,0x20,\
-    0x35,0xE7,0x54,0x77,0xBB,0x4D,0x3E,\
-    0x39,0x49,0x17,0x6D,0x47,0x3B,0x87,\
-    0x6D,0x11,0x2B,0x37,0x39,0x29,0x6E,\
-    0x58,0x6D,0x68,0x35,0x16,0x65,0x39,\
-    0xD4,0x47,0x29,0x0D,0x98,0x38,0x82,\
-    0x47,0x35,0x2B,0x7B,0x10,0x47,0x39,\
-    0x39,0x73,0x6E,0x10,0x49,0x57,0x0C,\
-    0x41,0x68,0x3D,0x6C,0x20,0x35,0xE9,\
-    0x54,0x77,0xBB,0x4D,0x39,0x39,0x49,\
-    0x17,0x6D,0x47,0x3B,0x22,0xE8,0x0F,\
-    0x6D,0x67,0x3E,0x00,0x36,0x43,0x36,\
-    0x6B,0x68,0x09,0x6D,0x59,0x39,0x85,\
-    0x6F,0x15,0xB1,0x53,0x85,0x39,0x69,\
-    0x65,0x79,0x59,0x2A,0x5E,0x64,0xA5,\
-    0x51,0x47,0xEF,0x33,0x69,0x77,0x4C,\
-    0x27,0x39,0x39,0x6A,0x07,0x6D,0x57,\
-    0x38,0x70,0x9C,0x7F,0x6F,0x0D,0x3E,\
-    0x5E,0x6C,0x07,0x99,0x27,0x3B,0x49,\
-    0x97,0x65,0x41,0x47,0x38,0x73,0x6F,\
-    0x10,0x61,0x95,0x05,0x39,0xBE,0x7D,\
-    0x6C,0x47,0x18,0x59,0x68,0x77,0x6F,\
-    0xF5,0x39,0x5F,0x68,0x88,0x0B,0x61,\
-    0x66,0x13,0x77,0x5B,0x72,0x69,0x26,\
-    0x1D,0x37,0x5F,0x32,0x6D,0x66,0x77,\
-    0x1D,0x58,0x6A,0x65,0x00,0x39,0x6A,\
-    0x76,0x2D,0x67,0x05,0xC6,0x96,0x77,\
-    0x6D,0x97,0xB8,0x89,0xD4,0x77,0x60,\
-    0x47,0x39,0x5A,0x6E,0x07,0x6D,0x27,\
-    0x39,0x39,0x04,0x57,0x14,0x47,0x3B,\
-    0x38,0x28,0x65,0x54,0x47,0x29,0x5D,\
-    0x48,0x10,0x69,0x37,0xCD,0x59,0x6A,\
-    0x07,0x92,0x59,0x11,0x39,0x69,0x3D,\
-    0x6C,0x20,0x35,0xE7,0x54,0x77,0xBB,\
-    0x4D,0x3E,0x39,0x49,0x17,0x6D,0x47,\
-    0x3B,0x87,0x68,0x10,0x51,0x59,0x29,\
-    0x73,0x69,0x10,0x61,0x99,0x05,0x39,\
-    0xBE,0x7D,0x6A,0x47,0x18,0x59,0x68,\
-    0x77,0x6F,0x37,0x39,0x29,0x6F,0x36,\
-    0x9D,0x4F,0x3B,0x73,0x69,0x10,0x69,\
-    0x37,0xCD,0x59,0x6A,0x07,0x92,0x59,\
-    0x11,0x39,0x69,0x3D,0x6C,0x20,0x35,\
-    0xE7,0x54,0x77,0xBB,0x4D,0x3E,0x39,\
-    0x49,0x17,0x6D,0x47,0x3B,0x87,0x68,\
-    0x11,0xA9,0x67,0x31,0x17,0x77,0x39,\
-    0x18,0x09,0x6F,0x00,0x36,0x43,0x36,\
-    0xC6,0xB0,0x58,0x6A,0x69,0x00,0x39,\
-    0x6A,0x76,0x2D,0x67,0x05,0xC6,0x96,\
-    0x77,0x6D,0x97,0xBE,0x89,0xD4,0x77,\
-    0x60,0x47,0x39,0x5B,0x68,0x77,0xF3,\
-    0x0F,0x57,0xC6,0x8F,0x3F,0x03,0xB8,\
-    0xC1,0x49,0x6E,0x58,0x6D,0x0F,0x41,\
-    0x39,0x95,0x16,0x6D,0xB9,0x0D,0x24,\
-    0x06,0x88,0x97,0xB8,0xC9,0x24,0x06,\
-    0x88,0x96,0xB8,0xC8,0x24,0x06,0x88,\
-    0x91,0xB8,0xCB,0x24,0x06,0x88,0x90,\
-    0xB8,0xCA,0x71,0x06,0x88,0x8B,0x0F,\
-    0x57,0xC6,0x90,0x07,0x6B,0x68,0x39,\
-    0x71,0x10,0x77,0x91,0x26,0x39,0xC7,\
-    0x60,0x6A,0x03,0xB8,0xC3,0xC6,0x84,\
-    0x6A,0x03,0xB8,0xC2,0xC6,0x85,0x6A,\
-    0x03,0xB8,0xC5,0xC6,0x86,0x6A,0x03,\
-    0xB8,0xC4,0xC6,0x87,0x3F,0x03,0xB8,\
-    0xDC,0x71,0x06,0x88,0x95,0x37,0x3F,\
-    0x16,0x68,0x3F,0x15,0x47,0xC2,0x58,\
-    0x68,0x8A,0xB1,0x5A,0x57,0xC6,0x92,\
-    0x88,0x85,0x5A,0x57,0xC6,0x93,0x88,\
-    0x84,0x5A,0x57,0xC6,0x94,0x88,0x87,\
-    0x5A,0x57,0xC6,0x95,0x88,0x86,0x08,\
-    0xD6,0x39,0x58,0x3D,0x43,0xB8,0xDE,\
-    0x5E,0x7C,0x3D,0x43,0xB8,0xDF,0x5E,\
-    0x66,0x3D,0x43,0xB8,0xDC,0x5F,0x66,\
-    0x17,0x6B,0x37,0x39,0x59,0x68,0x77,\
-    0xFD,0x37,0x39,0x59,0x68,0x77,0xE7,\
-    0x0F,0x57,0xC6,0xB7,0x3F,0x03,0xB8,\
-    0xD9,0x49,0x6B,0x58,0x6D,0x37,0x27,\
-    0x16,0x68,0x16,0x6D,0xBA,0xB5,0x76,\
-    0x87,0x77,0x7D,0x0D,0x17,0xC6,0xB7,\
-    0x10,0x2F,0x0D,0x17,0xC6,0x8A,0x10,\
-    0x51,0x67,0x17,0x00,0x36,0x43,0x36,\
-    0xC6,0x84,0x55,0x43,0xB8,0xC9,0x47,\
-    0x68,0xE7,0xEC,0x67,0x78,0x73,0xE8,\
-    0x10,0x49,0x65,0x39,0x31,0x68,0x77,\
-    0x6D,0x20,0x33,0x47,0x68,0x69,0x75,\
-    0x65,0x39,0x6A,0xE9,0x10,0x7F,0xA5,\
-    0xB0,0x49,0x68,0x67,0x75,0x99,0xB9,\
-    0x49,0x68,0x67,0x75,0x99,0xB9,0x6A,\
-    0xE9,0x11,0x9D,0x6A,0x7E,0xC6,0x9C,\
-    0x17,0x7F,0x68,0x17,0xC6,0x84,0x58,\
-    0x43,0xB8,0xC9,0x58,0x68,0x8B,0xF9,\
-    0x6A,0x79,0xC6,0x9C,0x27,0xE2,0x67,\
-    0x17,0xC6,0x80,0xE7,0xC3,0xB8,0xCD,\
-    0x7D,0xE8,0xE6,0xED,0x15,0xB9,0x2A,\
-    0xA8,0x77,0x7D,0x24,0xD9,0x49,0x69,\
-    0x59,0x72,0x09,0x67,0x77,0x1D,0x39,\
-    0x3B,0xB8,0xC9,0x16,0x65,0x58,0x61,\
-    0x65,0x00,0x39,0x6A,0x76,0x2D,0x67,\
-    0x05,0xC6,0x96,0x77,0x6D,0x97,0xB8,\
-    0x89,0xD4,0x77,0x60,0x47,0x39,0x5A,\
-    0x6E,0x07,0x6D,0x27,0x39,0x38,0x6A,\
-    0x3F,0x03,0xB8,0xCE,0x71,0x06,0x88,\
-    0x95,0x37,0x3C,0x16,0x68,0x07,0x61,\
-    0x68,0x39,0x58,0x68,0x8B,0xB7,0x08,\
-    0xD6,0x39,0x78,0x67,0x54,0x47,0x29,\
-    0x45,0x76,0x24,0x6D,0x21,0x39,0x39,\
-    0xBC,0x3D,0x54,0x47,0x29,0x45,0x75,\
-    0x10,0x6D,0x47,0xF3,0x73,0x46,0x88,\
-    0x9A,0x20,0x1D,0x29,0x51,0x77,0x7D,\
-    0x3B,0x23,0x89,0x46,0x88,0x97,0x21,\
-    0x21,0x29,0x51,0x77,0x7D,0x3B,0x22,\
-    0x89,0x46,0x88,0x96,0x21,0x35,0x2A,\
-    0x94,0x77,0x6C,0x47,0x29,0x5A,0x8A,\
-    0x17,0x6D,0x47,0x91,0x73,0x51,0x77,\
-    0x7D,0x23,0x19,0x00,0x36,0x43,0x36,\
-    0x5E,0x4E,0x05,0x6D,0x6D,0x45,0x39,\
-    0x78,0x0B,0x75,0x57,0x0C,0x21,0x68,\
-    0x7D,0x6D,0x47,0x18,0xE9,0x54,0x77,\
-    0x47,0x5C,0xB9,0x21,0x68,0x57,0x6C,\
-    0x15,0x39,0x4B,0x68,0x65,0x6D,0x67,\
-    0x38,0x62,0x28,0x1A,0x8F,0x05,0x00,\
-    0x39,0x78,0x14,0x8F,0x26,0x39,0xC4,\
-    0x06,0x5F,0x2D,0x0D,0xB5,0x5E,0x00,\
-    0x5D,0x11,0x47,0x29,0x42,0x94,0x5D,\
-    0xE1,0x7A,0x45,0x39,0x6D,0x88,0x99,\
-    0x6F,0x45,0x39,0x78,0x03,0x4D,0x68,\
-    0x34,0x16,0x64,0x58,0x51,0x47,0x29,\
-    0x45,0x70,0x3F,0x03,0xB8,0xCD,0x77,\
-    0xD1,0x77,0x7D,0x60,0x39,0x1A,0xA4,\
-    0x77,0x7D,0x3B,0x3D,0x49,0x68,0x47,\
-    0x43,0xB8,0xCD,0x1A,0xA8,0x77,0x7D,\
-    0x3B,0x31,0x76,0x87,0x77,0x7D,0x68,\
-    0x2C,0x16,0x51,0x77,0x7D,0x3B,0x3D,\
-    0x16,0x51,0x77,0x7D,0x3B,0x31,0x7B,\
-    0xCF,0x39,0xD4,0x47,0x29,0x73,0xC0,\
-    0x38,0x82,0x47,0x29,0x73,0x68,0x11,\
-    0x61,0x37,0x39,0x59,0x62,0x64,0x91,\
-    0x47,0x38,0x39,0x78,0x14,0x8F,0x37,\
-    0x38,0x11,0x37,0x5D,0x32,0x09,0x67,\
-    0x77,0x1D,0x39,0x3B,0xB8,0xC9,0x16,\
-    0x65,0x58,0x61,0x65,0x00,0x39,0x6A,\
-    0x76,0x2D,0x67,0x05,0xC6,0x96,0x77,\
-    0x6D,0x97,0xB8,0x89,0xD4,0x77,0x60,\
-    0x47,0x39,0x5A,0x6E,0x07,0x6D,0x27,\
-    0x39,0x39,0xDE,0x6A,0x11,0x47,0x38,\
-    0xC6,0x90,0x6A,0x11,0x47,0xC0,0xC6,\
-    0x91,0x67,0x54,0x47,0x29,0x5A,0x88,\
-    0xB7,0x54,0x47,0x29,0x5A,0x8A,0xB7,\
-    0x54,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x5A,0x89,0x6A,0x2D,0xB8,0xC3,0x73,\
-    0x51,0x77,0x7D,0x23,0x19,0x5E,0x48,\
-    0x05,0x6D,0x57,0x0F,0x21,0x90,0x7D,\
-    0x6D,0x47,0x18,0xE9,0x54,0x77,0x47,\
-    0x5A,0xB9,0x21,0x90,0x57,0x6C,0x15,\
-    0x39,0x4B,0x68,0x65,0x6D,0x67,0x38,\
-    0x6E,0x28,0x1A,0x8F,0x26,0x39,0xC5,\
-    0xEC,0x5D,0x2D,0x0D,0xB4,0x5E,0x36,\
-    0x5F,0x11,0x47,0x29,0x42,0x94,0x5F,\
-    0xE0,0x7A,0x45,0x39,0x6B,0x88,0x9B,\
-    0x6D,0x45,0x39,0x78,0x03,0x4D,0x68,\
-    0x35,0x16,0x65,0x3F,0x03,0xB8,0xC1,\
-    0x71,0x06,0x88,0x9B,0x09,0x80,0x39,\
-    0x78,0x50,0x6D,0x64,0xF4,0x39,0x78,\
-    0x0B,0x69,0x37,0x39,0x09,0x46,0x88,\
-    0x9B,0x64,0xF9,0x39,0x78,0x0B,0x65,\
-    0x08,0xD6,0x39,0x78,0x58,0x79,0x68,\
-    0x00,0x39,0x78,0x0B,0x69,0x68,0x00,\
-    0x39,0x78,0x0B,0x65,0x05,0x9E,0x77,\
-    0xD1,0x77,0x7D,0x0D,0x91,0x76,0x87,\
-    0x77,0x7D,0x0D,0x39,0x5E,0x6C,0x07,\
-    0x6D,0x27,0x3B,0x49,0x69,0x5F,0x32,\
-    0x6D,0x66,0x77,0x36,0x39,0x18,0x09,\
-    0x6F,0xC6,0x98,0x64,0x91,0x47,0x38,\
-    0x39,0x78,0x13,0x4D,0x5A,0x45,0x39,\
-    0x76,0x88,0x95,0x0F,0x57,0xC6,0x9F,\
-    0x3F,0x03,0xB8,0xC1,0x49,0x6B,0x58,\
-    0x6D,0x37,0x27,0x16,0x68,0x16,0x6D,\
-    0xBD,0xD9,0x76,0x87,0x77,0x7D,0x0D,\
-    0x17,0xC6,0x9F,0x10,0x67,0x54,0xC5,\
-    0x39,0x69,0x77,0x7D,0x23,0x19,0x59,\
-    0x2A,0x6A,0x11,0x47,0xA3,0xC6,0x90,\
-    0x3F,0x03,0xB8,0xCE,0x71,0x06,0x88,\
-    0x95,0x37,0x3D,0x00,0x36,0x43,0x36,\
-    0x16,0x68,0x3F,0x15,0x47,0xA3,0x58,\
-    0x68,0x8D,0xDF,0x08,0xD6,0x39,0x78,\
-    0x3D,0x43,0xB8,0xC3,0x5F,0x70,0x67,\
-    0x43,0xB8,0xC2,0x6A,0x68,0x11,0x7D,\
-    0x0D,0x17,0xC6,0x9F,0x10,0x67,0x54,\
-    0xC5,0x39,0x69,0x77,0x7D,0x23,0x19,\
-    0x59,0x6E,0x35,0x54,0x47,0x29,0x5D,\
-    0x48,0x39,0x33,0x09,0x4C,0x77,0x3E,\
-    0x88,0x95,0x0F,0xDE,0x3A,0x64,0x16,\
-    0x6D,0xB8,0x4F,0x58,0x68,0x8C,0xEB,\
-    0x6D,0x79,0x73,0xE5,0x10,0x61,0x75,\
-    0x00,0x39,0x78,0x13,0x65,0xF5,0x45,\
-    0x39,0x6C,0x13,0x6B,0x37,0x39,0x59,\
-    0x68,0x77,0xDD,0x64,0xF4,0x39,0x78,\
-    0x0C,0x91,0x7A,0x40,0x39,0x78,0x13,\
-    0x65,0xB8,0xC7,0x13,0x14,0x77,0x7D,\
-    0x23,0x11,0x25,0x7D,0x47,0x6C,0x97,\
-    0x05,0x39,0x96,0x6D,0xED,0x0D,0x00,\
-    0x39,0x78,0x13,0x4D,0x20,0x11,0x47,\
-    0x68,0x3D,0x03,0xB8,0xC7,0x5E,0x48,\
-    0x05,0x6D,0x55,0x3E,0x29,0x5D,0x6F,\
-    0x6D,0x4D,0x39,0x39,0x49,0xA7,0x51,\
-    0x47,0x13,0x22,0xE8,0x6F,0x6D,0x15,\
-    0x3E,0xF7,0x14,0x77,0x92,0xF9,0x57,\
-    0xC6,0x96,0x12,0x8D,0x6F,0x45,0x39,\
-    0x78,0x03,0x4D,0x68,0x05,0x39,0x78,\
-    0x0C,0x91,0x68,0x35,0x16,0x65,0x3F,\
-    0x03,0xB8,0xC7,0x77,0xD1,0x77,0x7D,\
-    0x60,0x39,0x1A,0xA4,0x77,0x7D,0x3B,\
-    0x3D,0x49,0x68,0x47,0x43,0xB8,0xC7,\
-    0x1A,0xA8,0x77,0x7D,0x3B,0x31,0x16,\
-    0x51,0x77,0x7D,0x3C,0xC5,0x16,0x51,\
-    0x77,0x7D,0x3B,0x3D,0x16,0x51,0x77,\
-    0x7D,0x3B,0x31,0x00,0x36,0x43,0x36,\
-    0x7B,0xCF,0x39,0xD4,0x47,0x29,0x73,\
-    0xC0,0x55,0x6D,0x5D,0xBF,0x76,0x87,\
-    0x77,0x4D,0x0D,0x38,0x5F,0x64,0x64,\
-    0x91,0x47,0x38,0x39,0x78,0x14,0x8C,\
-    0x37,0x38,0x59,0x6A,0x07,0x6D,0x6B,\
-    0x26,0x17,0x77,0x5F,0x32,0x6D,0x66,\
-    0x77,0x36,0x39,0x18,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x09,0x80,0x39,0x78,\
-    0x37,0x25,0x09,0x80,0x39,0x78,0x5B,\
-    0x41,0x09,0x80,0x39,0x78,0x5D,0x29,\
-    0x09,0x80,0x39,0x78,0x2B,0x5D,0x09,\
-    0x80,0x39,0x78,0x2B,0x29,0x15,0x80,\
-    0x39,0x78,0x1B,0x6D,0x09,0x4C,0x77,\
-    0x19,0x35,0x54,0x47,0x29,0x55,0x78,\
-    0x39,0xD4,0x47,0x29,0x07,0x00,0x39,\
-    0xD4,0x47,0x29,0x70,0x84,0x39,0xD4,\
-    0x47,0x29,0x1E,0xD8,0x39,0x18,0x09,\
-    0x48,0x77,0x19,0x39,0x1C,0x65,0x56,\
-    0x39,0x6C,0x57,0x02,0x47,0x31,0x29,\
-    0x47,0x77,0x62,0x0D,0xB0,0x5E,0x66,\
-    0x3D,0x6D,0x20,0x33,0xE9,0x54,0x77,\
-    0x92,0x55,0xE1,0x73,0x68,0x11,0x9B,\
-    0x09,0x4C,0x19,0x07,0x77,0x69,0x57,\
-    0x16,0x39,0x63,0x3D,0xE5,0x20,0x37,\
-    0x73,0x68,0x10,0x67,0x97,0x05,0x39,\
-    0x97,0x35,0x75,0x0D,0x39,0x5F,0x9E,\
-    0x39,0x18,0x09,0x48,0x77,0x19,0x3F,\
-    0x8A,0x48,0x35,0x25,0x47,0x77,0x72,\
-    0x6F,0x56,0x39,0x48,0x7F,0x54,0x47,\
-    0x3D,0x39,0x78,0x1B,0x64,0x20,0x39,\
-    0x38,0x7C,0x55,0x11,0x47,0x29,0x7B,\
-    0x20,0x5D,0x24,0x37,0x39,0x29,0x6E,\
-    0x9E,0xE5,0x9C,0xF9,0x43,0x68,0x6D,\
-    0x40,0x47,0x3B,0x00,0x36,0x43,0x36,\
-    0x11,0x54,0x77,0x92,0xBC,0x39,0x19,\
-    0x6D,0x9E,0xE5,0x67,0x79,0x49,0x60,\
-    0x9E,0xE5,0x55,0x09,0x71,0x69,0xB7,\
-    0xD1,0x47,0x39,0x39,0x98,0xB5,0xD1,\
-    0xB8,0xC6,0xC6,0x67,0xF5,0xED,0x56,\
-    0xB8,0x71,0x69,0x59,0x51,0x47,0xC6,\
-    0xC2,0x6A,0xCD,0x11,0x47,0x37,0x5F,\
-    0x44,0x57,0x68,0xAE,0xB1,0x19,0x28,\
-    0xA6,0xAA,0x37,0x39,0x29,0x6E,0x9E,\
-    0xE5,0x94,0xF9,0x09,0x79,0xB7,0xD1,\
-    0x47,0x39,0x3E,0x97,0x9C,0xE5,0x75,\
-    0x29,0xF9,0xD4,0x77,0x6D,0xB8,0xD9,\
-    0xFB,0xD4,0x88,0x92,0x47,0x26,0xBB,\
-    0xE8,0x47,0xEC,0x67,0x3C,0xD0,0xE0,\
-    0x55,0x2D,0x45,0x48,0xC6,0x87,0x0F,\
-    0x6D,0x45,0x48,0xC6,0x98,0x0F,0x6D,\
-    0x37,0x31,0x2B,0x59,0x3F,0x6C,0x87,\
-    0x85,0x39,0x68,0x77,0x62,0x85,0x85,\
-    0xC6,0x97,0x88,0x9D,0xC5,0xB9,0x2A,\
-    0xE9,0x3F,0x6C,0x39,0x39,0x73,0x45,\
-    0x77,0x6B,0x20,0x11,0x1B,0x54,0x77,\
-    0x92,0xBC,0x3F,0x15,0x6D,0x9E,0xE3,\
-    0x67,0x7F,0xE8,0xAF,0xA6,0xAC,0x57,\
-    0x8D,0x41,0x68,0x57,0x6A,0x15,0x39,\
-    0x47,0x68,0x69,0x6D,0xF9,0x14,0x39,\
-    0x6E,0x12,0x85,0x67,0x3E,0x68,0x28,\
-    0x1B,0x4D,0x65,0x05,0x39,0x97,0x8C,\
-    0x6B,0x6B,0x3C,0xD0,0xE6,0x57,0x2B,\
-    0x96,0xFE,0xE8,0xA9,0x35,0x7D,0x67,\
-    0x3E,0x6B,0x68,0x09,0x6D,0x59,0x39,\
-    0x19,0x6F,0x26,0x2D,0x2A,0xD3,0x19,\
-    0x6D,0x9E,0xE5,0x67,0x79,0x49,0x64,\
-    0x9E,0xE5,0x55,0x09,0x71,0x69,0xB7,\
-    0xD1,0x47,0x39,0x00,0x36,0x43,0x36,\
-    0x39,0x98,0xB5,0xD1,0xB8,0xC6,0xC6,\
-    0x67,0xF5,0xED,0x56,0xB8,0x71,0x69,\
-    0x07,0x6C,0x27,0x3B,0x49,0x68,0x5F,\
-    0x72,0x6D,0x26,0x15,0x77,0x59,0x72,\
-    0x6F,0x66,0x13,0x37,0x39,0x18,0x09,\
-    0x48,0x77,0x3E,0x88,0x95,0x68,0x3F,\
-    0x25,0x46,0x77,0x66,0xFB,0x05,0x39,\
-    0x78,0x11,0x43,0x67,0x45,0x39,0x97,\
-    0x8D,0xCD,0x57,0x11,0x39,0x69,0x93,\
-    0xE5,0x87,0x85,0x39,0x68,0x77,0x6C,\
-    0x6A,0x79,0xC6,0x94,0x57,0x11,0x47,\
-    0xC6,0xC3,0xC8,0x7F,0xC5,0x47,0x3B,\
-    0x39,0x69,0x77,0x54,0x47,0x3B,0x39,\
-    0x78,0x14,0x85,0x27,0x39,0x38,0xF0,\
-    0xCB,0x51,0x47,0x28,0x5F,0x46,0x57,\
-    0x11,0x47,0xC6,0xC3,0xC8,0x67,0x45,\
-    0x47,0x38,0xDB,0xE0,0xB7,0xD1,0x47,\
-    0x39,0x39,0x69,0x5A,0x2D,0xB8,0xC5,\
-    0x19,0x14,0x77,0x92,0xBD,0x99,0x31,\
-    0xC0,0x77,0x6C,0x47,0x38,0x39,0x51,\
-    0x77,0x6C,0x47,0x29,0x5A,0x80,0x17,\
-    0x6D,0x46,0x5D,0x31,0x51,0x77,0x69,\
-    0x47,0x29,0x55,0x61,0x10,0x6D,0x46,\
-    0x61,0x16,0x65,0x58,0x61,0x68,0x3E,\
-    0x49,0x68,0x67,0x6B,0xAE,0xB1,0x19,\
-    0x28,0xA6,0x91,0x47,0xC6,0xC2,0x68,\
-    0x49,0x7D,0x89,0x85,0x39,0x68,0x77,\
-    0x92,0xAF,0xBE,0x49,0x6A,0xC7,0xEA,\
-    0x21,0x39,0x39,0xEE,0x59,0x51,0x47,\
-    0xC6,0xC2,0x6A,0x07,0x6D,0x57,0x3F,\
-    0xD0,0xE0,0x5D,0x2D,0x6F,0x74,0xE0,\
-    0x94,0x77,0x92,0xBC,0x3F,0x16,0x64,\
-    0x47,0x58,0x3F,0x39,0xD3,0xE0,0xB7,\
-    0xD1,0x47,0x39,0x00,0x36,0x43,0x36,\
-    0x3E,0x97,0x05,0x6A,0x85,0x39,0x16,\
-    0x69,0x47,0x58,0x3F,0x39,0xD3,0xE0,\
-    0xB7,0xD1,0x47,0x39,0x3E,0x97,0x91,\
-    0xE5,0x35,0x39,0x2B,0x68,0x58,0x6C,\
-    0x09,0x80,0x39,0x78,0x37,0xFD,0x39,\
-    0x39,0x27,0x68,0x38,0x82,0x47,0x35,\
-    0x87,0x14,0x77,0x92,0x20,0x39,0x39,\
-    0xAA,0x3D,0x6A,0x2C,0x39,0x39,0xD4,\
-    0x57,0x11,0x47,0x29,0x7B,0xC8,0x57,\
-    0x6A,0x97,0xB9,0x1B,0x68,0xA7,0xED,\
-    0x95,0xB9,0xDC,0xE0,0xA5,0xED,0x96,\
-    0xF8,0x13,0x38,0x3D,0xE0,0x20,0x39,\
-    0x39,0xF6,0x58,0x61,0x68,0x3E,0x77,\
-    0xFD,0x27,0xE2,0x27,0x39,0x39,0xFA,\
-    0x07,0x65,0xF7,0xBE,0x5F,0x68,0x77,\
-    0x1B,0x69,0x05,0x39,0x97,0x8C,0x6F,\
-    0x37,0x39,0x29,0x6E,0x9E,0xE5,0x6D,\
-    0x79,0x11,0x25,0xAE,0x91,0x47,0xC6,\
-    0xC2,0x6E,0x58,0x61,0x77,0x0C,0x41,\
-    0x68,0x9D,0xE5,0x87,0x85,0x39,0x68,\
-    0x70,0x92,0x35,0x3E,0xFB,0x68,0x58,\
-    0x6C,0x77,0x0C,0x41,0x68,0x9D,0xE5,\
-    0x87,0x85,0x39,0x68,0x70,0x92,0xA1,\
-    0xB1,0x4B,0x68,0x65,0x6D,0x68,0x38,\
-    0x77,0xD1,0x77,0x7D,0x07,0xA9,0x47,\
-    0x68,0x69,0x6D,0x08,0xD6,0x39,0x64,\
-    0xC9,0x11,0x47,0xC6,0x5E,0x5E,0x07,\
-    0x12,0x87,0x3E,0x17,0x68,0x57,0x11,\
-    0x47,0x29,0x7B,0x38,0x57,0x6A,0xAE,\
-    0xB1,0xE8,0xA8,0x5D,0x3D,0x0D,0xB4,\
-    0x5E,0x76,0x58,0x61,0x68,0x3E,0x77,\
-    0xFD,0x27,0xE2,0x27,0x2D,0x49,0x6E,\
-    0xC7,0xEA,0x21,0x37,0x2A,0xAE,0x77,\
-    0x7D,0x2B,0x31,0x00,0x36,0x43,0x36,\
-    0x39,0x51,0x77,0x69,0x47,0x29,0x5A,\
-    0x80,0x07,0x6D,0x77,0x00,0x39,0x97,\
-    0x8D,0xE7,0x6A,0x79,0xC6,0x94,0x07,\
-    0x92,0x4A,0xB9,0xF8,0x11,0x77,0x92,\
-    0xBD,0x9D,0x17,0x77,0x5F,0x32,0x6D,\
-    0x66,0x15,0x77,0x39,0x33,0x09,0x4C,\
-    0x77,0x19,0x39,0x3B,0x47,0x39,0x16,\
-    0x6F,0x58,0x6B,0x68,0x3C,0x25,0x46,\
-    0x77,0x66,0x6D,0x05,0x39,0x97,0x8C,\
-    0x6D,0x37,0x39,0x29,0x6E,0x9E,0xE5,\
-    0x67,0x79,0x49,0x6C,0x9E,0xE5,0x55,\
-    0x09,0x61,0x69,0xB7,0xD1,0x47,0x39,\
-    0x39,0x98,0xB5,0xD1,0xB8,0xC6,0xC6,\
-    0x67,0xF5,0xED,0x56,0xB8,0x61,0x69,\
-    0x59,0x51,0x47,0xC6,0xC2,0x6A,0x75,\
-    0x1D,0xB8,0xD6,0x41,0x68,0x07,0x6D,\
-    0x57,0x17,0x39,0x7B,0x65,0x5D,0x1F,\
-    0x38,0xF9,0xD4,0x77,0x6D,0x47,0x36,\
-    0xFB,0xD4,0x88,0x92,0xB8,0xC9,0xBB,\
-    0xE8,0x66,0xEC,0x1F,0x38,0x19,0x46,\
-    0x77,0x61,0xAC,0xB1,0x0B,0x58,0x0F,\
-    0x6D,0x87,0x85,0x39,0x68,0x88,0x8D,\
-    0x85,0x85,0xC6,0x97,0x77,0x72,0xC5,\
-    0xB9,0x08,0xE9,0x0F,0x6D,0x45,0x49,\
-    0xC6,0x87,0x0F,0x6D,0x45,0x49,0xC6,\
-    0x98,0x0F,0x6D,0x0D,0x17,0x39,0x7F,\
-    0x10,0x61,0x37,0x39,0x34,0xA8,0xF6,\
-    0x14,0x47,0xC6,0xC3,0xCA,0x17,0x67,\
-    0x37,0xC6,0x34,0xE8,0xB6,0x14,0x47,\
-    0xC6,0xC3,0xCA,0x5D,0x72,0x6B,0x26,\
-    0x17,0x77,0x39,0x33,0x09,0x4C,0x77,\
-    0x3E,0x77,0x6D,0x68,0x3E,0x16,0x6E,\
-    0x58,0x68,0x5B,0x17,0x39,0x63,0x5D,\
-    0x51,0x47,0xC6,0x00,0x36,0x43,0x36,\
-    0xC2,0x68,0x07,0x6D,0x57,0x3F,0xD0,\
-    0xE0,0x57,0x2D,0x37,0x31,0xD0,0xE0,\
-    0x65,0x5D,0x1F,0x38,0xF9,0xD4,0x77,\
-    0x6D,0x47,0xC9,0xFB,0xD4,0x88,0x92,\
-    0xB8,0x36,0xBB,0xE8,0x66,0xEC,0x1F,\
-    0x38,0x17,0x54,0x77,0x92,0xBC,0x3B,\
-    0x49,0x69,0x9E,0xE5,0x75,0x09,0x41,\
-    0x68,0xB7,0xD1,0x47,0x39,0x39,0x78,\
-    0xB5,0xD1,0xB8,0xC6,0xC6,0x87,0xF5,\
-    0xED,0x76,0xB8,0x41,0x68,0x07,0x6D,\
-    0x57,0x17,0x39,0x7B,0x65,0x5D,0x1F,\
-    0x38,0xF9,0xD4,0x77,0x6D,0x47,0x36,\
-    0xFB,0xD4,0x88,0x92,0xB8,0xC9,0xBB,\
-    0xE8,0x66,0xEC,0x1F,0x38,0x19,0x46,\
-    0x77,0x61,0xAC,0xB1,0x0B,0x58,0x0F,\
-    0x6D,0x87,0x85,0x39,0x68,0x88,0x8D,\
-    0x85,0x85,0xC6,0x97,0x77,0x72,0xC5,\
-    0xB9,0x08,0xE9,0x0F,0x6D,0x45,0x49,\
-    0xC6,0x87,0x0F,0x6D,0x45,0x49,0xC6,\
-    0x98,0x0F,0x6D,0x0D,0x17,0x39,0x7F,\
-    0x10,0x61,0x37,0x39,0x34,0xA8,0xF6,\
-    0x14,0x47,0xC6,0xC3,0xCA,0x17,0x67,\
-    0x37,0xC6,0x34,0xE8,0xB6,0x14,0x47,\
-    0xC6,0xC3,0xCA,0x5D,0x72,0x6B,0x26,\
-    0x17,0x77,0x39,0x33,0x09,0x4C,0x77,\
-    0x3E,0x88,0x95,0x0F,0xDE,0x06,0x6C,\
-    0x6A,0x11,0x47,0x39,0xC6,0x97,0x63,\
-    0x51,0x47,0x39,0x45,0x68,0x0D,0x6D,\
-    0x71,0x05,0x3E,0x97,0x49,0x51,0x40,\
-    0xC6,0x31,0x91,0x77,0x6C,0x47,0xC6,\
-    0xC3,0xE8,0x35,0x54,0x47,0xC6,0xC3,\
-    0xEE,0x7F,0x94,0x47,0x3D,0x39,0x97,\
-    0x8D,0xED,0x37,0x39,0x29,0x46,0x77,\
-    0x67,0xA8,0xB1,0x00,0x36,0x43,0x36,\
-    0x2B,0x51,0x77,0x92,0xBD,0xBE,0xF9,\
-    0xD4,0x77,0x6D,0x47,0xB9,0xFB,0xD4,\
-    0x88,0x92,0xB8,0x46,0xBB,0xE8,0x64,\
-    0xAC,0x47,0xC6,0xC3,0xEF,0x5D,0x11,\
-    0x47,0xC6,0xC3,0xE1,0x07,0x6D,0x57,\
-    0x17,0x39,0x60,0x9A,0xE5,0x55,0x2C,\
-    0xF9,0xD4,0x77,0x6D,0x47,0xF9,0xFB,\
-    0xD4,0x88,0x92,0xB8,0x06,0xBB,0xE8,\
-    0x6D,0xEC,0x37,0x39,0x29,0x46,0x77,\
-    0x66,0xA0,0xB1,0x2B,0x7D,0xB7,0xD1,\
-    0x47,0x39,0x39,0x50,0xB5,0xD1,0xB8,\
-    0xC6,0xC6,0xAF,0xF5,0xED,0x5D,0xB8,\
-    0x49,0x68,0x67,0x43,0x47,0x35,0x2B,\
-    0x7D,0xB7,0xD1,0x47,0x39,0x39,0x6F,\
-    0xB5,0xD1,0xB8,0xC6,0xC6,0x90,0xF5,\
-    0xED,0x5D,0xB8,0x2A,0x86,0x77,0x64,\
-    0x47,0xC6,0xC3,0xE0,0x07,0x6A,0x55,\
-    0x00,0x39,0x97,0x8D,0xEA,0x87,0x85,\
-    0x39,0x68,0x77,0x6A,0x85,0x85,0xC6,\
-    0x97,0x88,0x95,0xC5,0xB9,0x2A,0xA9,\
-    0x77,0x92,0xBD,0xBE,0x41,0x68,0x55,\
-    0x11,0x47,0xC6,0xC2,0x6A,0x55,0x51,\
-    0x47,0xC6,0xC2,0x68,0x57,0x69,0xAE,\
-    0xB1,0x13,0x28,0x75,0x58,0x47,0x36,\
-    0x21,0x69,0x57,0x20,0x96,0xF0,0x3B,\
-    0x38,0x88,0x82,0x67,0x3D,0x6B,0x68,\
-    0x0F,0x6D,0x5F,0x39,0x81,0x14,0x77,\
-    0x62,0x2A,0xE7,0x19,0x54,0x77,0x6D,\
-    0x40,0xC6,0xD2,0xE0,0x45,0x54,0x47,\
-    0xC6,0xC3,0xF8,0xB7,0xD1,0x47,0x39,\
-    0xC6,0x88,0xB5,0xD1,0xB8,0xC6,0x39,\
-    0x77,0xF5,0xED,0x74,0xF8,0x39,0x97,\
-    0x8D,0xFD,0x37,0x3E,0x0B,0x51,0x77,\
-    0x92,0xBD,0xA9,0x00,0x36,0x43,0x36,\
-    0xF9,0xD4,0x77,0x6D,0x47,0x3E,0xFB,\
-    0xD4,0x88,0x92,0xB8,0xC1,0xBB,0xE8,\
-    0x44,0xAC,0x47,0xC6,0xC3,0xF8,0x57,\
-    0x51,0x47,0x39,0x46,0x97,0x94,0xE5,\
-    0x75,0x00,0x39,0x97,0x8D,0xFF,0x87,\
-    0x85,0x39,0x68,0x88,0x93,0x85,0x85,\
-    0xC6,0x97,0x77,0x6C,0xC5,0xB9,0x0A,\
-    0xA9,0x77,0x92,0xBD,0xAB,0x41,0x68,\
-    0x5D,0x11,0x47,0x29,0x7B,0xF0,0x57,\
-    0x69,0x97,0xB9,0x1B,0x68,0xA7,0xED,\
-    0x95,0xB9,0xDC,0xE0,0xA5,0xED,0x4B,\
-    0x0C,0x39,0x66,0x6F,0x6F,0x21,0x25,\
-    0x73,0x46,0x88,0x92,0x20,0x35,0x0B,\
-    0x5D,0x6F,0x6D,0xFC,0x78,0x7F,0x29,\
-    0xB1,0x2C,0x27,0x33,0x03,0x5D,0x6F,\
-    0x6D,0x5A,0x45,0x39,0x69,0x88,0x92,\
-    0x67,0x3D,0x6B,0x68,0x0F,0x6D,0x5F,\
-    0x39,0x19,0x6C,0x2E,0x2D,0x2A,0xF9,\
-    0x49,0x68,0x47,0x6E,0xAC,0xB1,0x0B,\
-    0x51,0x77,0x92,0xBD,0xAD,0xF9,0xD4,\
-    0x77,0x6D,0xB8,0xD9,0xFB,0xD4,0x88,\
-    0x92,0x47,0x26,0xBB,0xE8,0x44,0xAC,\
-    0x47,0xC6,0xC3,0xFC,0x07,0x6A,0x75,\
-    0x00,0x39,0x97,0x8D,0xF9,0x87,0x85,\
-    0x39,0x68,0x77,0x6A,0x85,0x85,0xC6,\
-    0x97,0x88,0x95,0xC5,0xB9,0x0A,0xA9,\
-    0x77,0x92,0xBD,0xAD,0x19,0x54,0x77,\
-    0x6D,0x38,0xC6,0xDA,0xE0,0x45,0x54,\
-    0x47,0xC6,0xC3,0xFE,0xB7,0xD1,0x47,\
-    0x39,0xC6,0x96,0xB5,0xD1,0xB8,0xC6,\
-    0x39,0x69,0xF5,0xED,0x74,0xF8,0x39,\
-    0x97,0x8D,0xFB,0x67,0x45,0x39,0x97,\
-    0x8C,0x8D,0x37,0x3D,0xD0,0xE0,0x65,\
-    0x45,0x47,0x38,0x00,0x36,0x43,0x36,\
-    0xF9,0xD4,0x77,0x6D,0x47,0xC9,0xFB,\
-    0xD4,0x88,0x92,0xB8,0x36,0xBB,0xE8,\
-    0x66,0x2C,0x47,0x38,0x13,0x14,0x77,\
-    0x92,0xBC,0xDB,0x3B,0x3D,0x88,0x82,\
-    0x67,0x45,0x39,0x97,0x8C,0x8D,0x37,\
-    0x31,0x2B,0x40,0x77,0x6C,0x87,0x85,\
-    0x39,0x68,0x77,0x62,0x85,0x85,0xC6,\
-    0x97,0x88,0x9D,0xC5,0xB9,0x28,0x29,\
-    0x77,0x6C,0x37,0x39,0x09,0x6D,0x9C,\
-    0xE5,0x75,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0xB8,0xD9,0xFB,0xD4,0x88,0x92,0x47,\
-    0x26,0xBB,0xE8,0x4D,0xEC,0x45,0x6C,\
-    0xC6,0x87,0x75,0x38,0xB8,0xC9,0x39,\
-    0x11,0x37,0x6D,0x47,0xC6,0xC3,0xCA,\
-    0x0D,0x6D,0x6D,0x45,0x39,0x78,0x35,\
-    0xF5,0x67,0x3C,0xE9,0xE8,0x51,0x6D,\
-    0x97,0xB9,0xEF,0xE8,0x92,0xE5,0x91,\
-    0xB9,0x35,0x5D,0x77,0x62,0x7F,0x3B,\
-    0x5F,0x72,0x3D,0x6F,0x20,0x37,0x0F,\
-    0x5D,0x4F,0x6D,0x75,0x3A,0x84,0x29,\
-    0x31,0x2C,0x89,0x78,0x59,0x60,0x4B,\
-    0x58,0x7F,0x39,0x2D,0x54,0x77,0x6C,\
-    0x67,0x3C,0x6B,0x68,0x0D,0x6D,0x5D,\
-    0x39,0x19,0x6D,0x2E,0x2D,0x2A,0xFB,\
-    0x49,0x68,0x47,0x6A,0xAC,0xB1,0x0B,\
-    0x51,0x77,0x92,0xBD,0xA1,0xF9,0xD4,\
-    0x77,0x6D,0xB8,0xD9,0xFB,0xD4,0x88,\
-    0x92,0x47,0x26,0xBB,0xE8,0x44,0xAC,\
-    0x47,0xC6,0xC3,0xF0,0x07,0x6A,0x75,\
-    0x00,0x39,0x97,0x8D,0xF5,0x87,0x85,\
-    0x39,0x68,0x77,0x6A,0x85,0x85,0xC6,\
-    0x97,0x88,0x95,0xC5,0xB9,0x0A,0xA9,\
-    0x77,0x92,0xBD,0xA1,0x19,0x54,0x77,\
-    0x6D,0x38,0xC6,0x00,0x36,0x43,0x36,\
-    0xDA,0xE0,0x45,0x54,0x47,0xC6,0xC3,\
-    0xF2,0xB7,0xD1,0x47,0x39,0xC6,0x96,\
-    0xB5,0xD1,0xB8,0xC6,0x39,0x69,0xF5,\
-    0xED,0x74,0xF8,0x39,0x97,0x8D,0xF7,\
-    0x67,0x45,0x39,0x97,0x8C,0x9D,0x37,\
-    0x3D,0xD0,0xE0,0x65,0x45,0x47,0x38,\
-    0xF9,0xD4,0x77,0x6D,0x47,0xC9,0xFB,\
-    0xD4,0x88,0x92,0xB8,0x36,0xBB,0xE8,\
-    0x66,0x2C,0x47,0x38,0x13,0x14,0x77,\
-    0x92,0xBC,0xCB,0x3B,0x3D,0x88,0x82,\
-    0x67,0x45,0x39,0x97,0x8C,0x9D,0x37,\
-    0x31,0x2B,0x40,0x77,0x6C,0x87,0x85,\
-    0x39,0x68,0x77,0x62,0x85,0x85,0xC6,\
-    0x97,0x88,0x9D,0xC5,0xB9,0x28,0x29,\
-    0x77,0x6C,0x37,0x39,0x09,0x6E,0x9C,\
-    0xE5,0x75,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0xB8,0xD9,0xFB,0xD4,0x88,0x92,0x47,\
-    0x26,0xBB,0xE8,0x4D,0xEC,0x45,0x6C,\
-    0xC6,0x87,0x75,0x38,0xB8,0xC9,0x39,\
-    0x11,0xF7,0x6D,0x47,0xC6,0xC3,0xCA,\
-    0x09,0x6D,0x53,0x05,0x39,0x66,0x5D,\
-    0x11,0x47,0x29,0x7B,0x20,0x57,0x6A,\
-    0xAE,0xB1,0x25,0x5D,0x7F,0x6F,0xFB,\
-    0x3B,0x5E,0x64,0x57,0x6A,0xAE,0xB1,\
-    0x31,0x5D,0x77,0x6D,0x4F,0x3C,0x5E,\
-    0x4A,0x07,0x6C,0x68,0x39,0x49,0x60,\
-    0x58,0x6D,0x67,0x74,0x19,0x6F,0x9E,\
-    0xE5,0x96,0xF9,0x49,0x68,0x47,0x7D,\
-    0x68,0x39,0x16,0x6E,0x16,0x6D,0xBC,\
-    0x45,0x76,0x87,0x77,0x7D,0x27,0x27,\
-    0x7B,0xCF,0x07,0x65,0x68,0x39,0x19,\
-    0x25,0x57,0x6A,0xAE,0xB1,0xE8,0xA8,\
-    0x07,0x6D,0x77,0x29,0x16,0x68,0x58,\
-    0x6B,0x26,0x39,0x00,0x36,0x43,0x36,\
-    0xC2,0x34,0x38,0x82,0x47,0x29,0x19,\
-    0x6F,0x25,0x6D,0x39,0x39,0x27,0x68,\
-    0x57,0x6A,0x1C,0x79,0x54,0xF2,0x0B,\
-    0x6D,0x53,0x05,0x39,0x67,0x5D,0x11,\
-    0x47,0x29,0x7B,0xF0,0x57,0x6B,0x97,\
-    0xB9,0x13,0x68,0xA7,0xED,0x9D,0xB9,\
-    0xDC,0xE0,0xAD,0xED,0x59,0x0C,0x61,\
-    0x6A,0xC9,0x6F,0x20,0x19,0x87,0x54,\
-    0x77,0x63,0x20,0x23,0x49,0x69,0x58,\
-    0x6D,0x37,0x31,0x16,0x68,0x07,0x6D,\
-    0x77,0x0C,0x61,0x68,0x58,0x6D,0x68,\
-    0x3E,0x58,0x68,0x8D,0x0D,0x08,0xD6,\
-    0x39,0x78,0x57,0x6B,0x15,0x39,0x45,\
-    0x68,0x6B,0x6D,0x67,0x3F,0x60,0x28,\
-    0x1A,0xD1,0x77,0x05,0x3E,0x88,0xB7,\
-    0x14,0x47,0xC6,0xC3,0xEC,0xF7,0x11,\
-    0x45,0x59,0x0A,0xA8,0x77,0x92,0xBD,\
-    0xBD,0x19,0x14,0x77,0x92,0xBD,0xB9,\
-    0x49,0x6F,0x65,0x45,0x47,0x38,0xF9,\
-    0xD4,0x77,0x6D,0x47,0x36,0xFB,0xD4,\
-    0x88,0x92,0xB8,0xC9,0xBB,0xE8,0x66,\
-    0x2C,0x47,0x38,0x13,0x14,0x77,0x92,\
-    0xBD,0xBF,0x3B,0x7D,0x77,0x9E,0x45,\
-    0x2C,0x39,0x94,0x7F,0xB8,0x47,0x3F,\
-    0x31,0xBD,0x77,0x6A,0x4F,0x80,0x39,\
-    0x6C,0x77,0x92,0xBD,0xB9,0x31,0x91,\
-    0x77,0x69,0x47,0x29,0x55,0x61,0x53,\
-    0x72,0x61,0x26,0x11,0x77,0x5D,0x72,\
-    0x6B,0x26,0x17,0x77,0x5D,0x32,0x09,\
-    0x67,0x77,0x1D,0x39,0x1C,0x05,0x00,\
-    0x39,0x78,0x1B,0x65,0x67,0x45,0x39,\
-    0x78,0x1B,0x64,0x4F,0xA9,0x39,0x6F,\
-    0x7F,0xFD,0x47,0x3C,0x31,0xF8,0x77,\
-    0x6B,0x4F,0xA9,0x00,0x36,0x43,0x36,\
-    0x39,0x6C,0x55,0x11,0x47,0x29,0x07,\
-    0xF6,0xE8,0x91,0x47,0x39,0x39,0x60,\
-    0x57,0x22,0x67,0xE0,0x09,0xB1,0x16,\
-    0x6D,0xBC,0x25,0x69,0xE7,0x39,0x18,\
-    0x45,0x3A,0x39,0x6B,0x75,0x6D,0x09,\
-    0x48,0x77,0x19,0x58,0x6A,0x59,0x16,\
-    0x39,0x63,0x57,0x02,0x47,0x35,0x73,\
-    0x51,0x77,0x7D,0x2C,0xC7,0x5F,0x6E,\
-    0x07,0x6D,0x27,0x39,0x39,0x02,0x7F,\
-    0x54,0x47,0x3E,0x39,0x78,0x04,0x98,\
-    0x20,0x39,0x39,0x34,0x07,0x6D,0x57,\
-    0x3E,0x16,0x68,0x58,0x65,0x68,0x05,\
-    0x39,0x78,0x1B,0x4D,0x09,0x80,0x39,\
-    0x78,0x43,0x9D,0x89,0x45,0x39,0x97,\
-    0x44,0xAA,0x47,0x29,0x55,0x72,0x38,\
-    0x82,0x47,0x35,0x73,0x51,0x77,0x7D,\
-    0x2B,0x29,0x5E,0x62,0x64,0x91,0x47,\
-    0x38,0x39,0x78,0x04,0x9B,0x27,0x23,\
-    0x73,0x51,0x77,0x7D,0x24,0xC9,0x5E,\
-    0x62,0x64,0x91,0x47,0x3D,0x39,0x78,\
-    0x04,0x9B,0x27,0x31,0x2A,0x94,0x77,\
-    0x6E,0x47,0x29,0x4A,0x9E,0x7F,0xD4,\
-    0x47,0x3E,0x39,0x78,0x04,0x98,0x37,\
-    0x38,0x59,0x6A,0x07,0x6D,0x69,0x26,\
-    0x77,0x1D,0x58,0x6A,0x68,0x3F,0x27,\
-    0x47,0x77,0x62,0x67,0x56,0x39,0x78,\
-    0x55,0x11,0x47,0x29,0x7B,0xF0,0x07,\
-    0x6D,0x57,0x3E,0xE9,0xE8,0x55,0x6D,\
-    0x97,0xB9,0xEB,0xE8,0x92,0xE5,0x95,\
-    0xB9,0x17,0x69,0x4B,0x5C,0x3F,0x39,\
-    0x85,0x14,0x75,0x2C,0x21,0x37,0x7B,\
-    0x51,0x77,0x7D,0x2B,0x29,0x7B,0x51,\
-    0x77,0x7D,0x24,0xC9,0x59,0x76,0xCB,\
-    0x11,0x40,0xD9,0x00,0x36,0x43,0x36,\
-    0x5F,0x78,0x35,0x54,0x47,0x29,0x55,\
-    0x78,0x64,0x91,0x47,0x38,0x39,0x78,\
-    0x14,0x9D,0x27,0x31,0x2A,0x94,0x77,\
-    0x6C,0x47,0x29,0x55,0x78,0x58,0x65,\
-    0x37,0x39,0x29,0x59,0x0F,0x6B,0x68,\
-    0x39,0x77,0xD1,0x77,0x7D,0x05,0xC9,\
-    0x69,0xE7,0x7F,0x54,0x47,0x3C,0x39,\
-    0x78,0x04,0x98,0x20,0x71,0x47,0x68,\
-    0x45,0x54,0x47,0x29,0x55,0x72,0x10,\
-    0x45,0x6B,0x05,0x39,0x68,0x70,0xB9,\
-    0x67,0x45,0x39,0x78,0x1B,0x4D,0x65,\
-    0x45,0x39,0x78,0x13,0x45,0x54,0x89,\
-    0x41,0x68,0x0F,0x6D,0x67,0x3E,0x6B,\
-    0x28,0x09,0x6D,0x79,0x39,0x8B,0x2F,\
-    0x14,0x69,0xF9,0xBF,0x54,0x82,0x7F,\
-    0xD4,0x47,0x3C,0x39,0x78,0x04,0x98,\
-    0x37,0x39,0x09,0x69,0x58,0x6D,0x09,\
-    0x80,0x39,0x78,0x50,0xF5,0x1F,0xB6,\
-    0x15,0x77,0x59,0x72,0x09,0x4C,0x16,\
-    0x65,0x5D,0x02,0x47,0x35,0x29,0x45,\
-    0x77,0x6F,0xF7,0x05,0x39,0x56,0x11,\
-    0x65,0x05,0x40,0x39,0x78,0x13,0x7D,\
-    0x27,0x0B,0x2A,0xA8,0x77,0x7D,0x23,\
-    0x11,0x49,0x6C,0x58,0x6D,0x0F,0x54,\
-    0x39,0x6B,0x58,0x51,0x47,0x29,0x5D,\
-    0x41,0x39,0xD4,0x47,0x29,0x0D,0x98,\
-    0x07,0x6D,0x57,0x14,0x39,0x69,0x58,\
-    0x6D,0x37,0x39,0x29,0x7D,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x50,0x1D,0x08,\
-    0xD6,0x39,0x7C,0x5D,0x32,0x09,0x4C,\
-    0x77,0x19,0x39,0x18,0x09,0x48,0x77,\
-    0x19,0x39,0x1C,0x4F,0x00,0x39,0x6D,\
-    0x77,0x7D,0x2B,0x21,0x5E,0x64,0x39,\
-    0xD4,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x70,0xE4,0x39,0xD4,0x47,0x29,0x70,\
-    0xC4,0x57,0x54,0x47,0x29,0x4A,0x90,\
-    0x10,0x45,0xF7,0x80,0x39,0x78,0x1B,\
-    0x6D,0x25,0x19,0x7B,0xD1,0x77,0x7D,\
-    0x34,0xC1,0x77,0xD1,0x77,0x7D,0x63,\
-    0x29,0x77,0xD1,0x77,0x7D,0x0E,0xD5,\
-    0x49,0x69,0x64,0xAD,0x47,0x29,0x52,\
-    0x95,0x64,0xAD,0x47,0x29,0x52,0x96,\
-    0x39,0x18,0x68,0x3E,0x2B,0x47,0x77,\
-    0x66,0x59,0x16,0x39,0x67,0x57,0x11,\
-    0x47,0x29,0x78,0x20,0x07,0x6D,0x57,\
-    0x38,0xE8,0xA8,0x65,0x7D,0xF5,0x05,\
-    0x39,0x97,0x10,0x7B,0x67,0x45,0x39,\
-    0x78,0x36,0x6D,0x37,0x39,0x29,0x69,\
-    0x36,0x9D,0x49,0x39,0x49,0x68,0x67,\
-    0x6A,0x96,0xF9,0x2B,0x78,0x69,0x6C,\
-    0x0D,0x38,0x52,0x46,0x3D,0x54,0x47,\
-    0x29,0x52,0x95,0x11,0x69,0x37,0xC6,\
-    0x59,0x4C,0x57,0x11,0x47,0x29,0x7B,\
-    0xF4,0x07,0x6D,0x57,0x3E,0xE9,0xE8,\
-    0x55,0x6D,0x97,0xB9,0xEB,0xE8,0x92,\
-    0xE5,0x95,0xB9,0xE8,0xA9,0x7B,0x3D,\
-    0x07,0x39,0x5E,0x6C,0x07,0x92,0x27,\
-    0x3B,0x19,0x6F,0x59,0x72,0x09,0x4C,\
-    0x77,0x19,0x88,0x6D,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0x38,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xB9,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x6F,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xB8,0xC6,0x97,0x88,0x92,0xB8,0xC6,\
-    0xC6,0xEA,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0xEE,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0x44,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0x00,0x36,0x43,0x36,\
-    0xBD,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0x47,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0x46,0xC6,\
-    0xC6,0x97,0x75,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x74,0x92,0xB8,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0x43,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0xB8,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0xB8,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x72,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x88,0x92,\
-    0xB8,0xC6,0xC6,0x97,0x88,0x92,0xB8,\
-    0xC6,0xC6,0x97,0x88,0x92,0x41,0xC6,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0x00,0x36,0x43,0x36,\
-    0xC6,0x97,0x88,0x92,0xB8,0xC6,0xC6,\
-    0x97,0x88,0x92,0xB8,0xC6,0xC6,0x97,\
-    0x88,0x92,0xB8,0xC6,0xC6,0x97,0x88,\
-    0x92,0xB8,0xC6,0xC6,0x97,0x70,0x65,\
-    0xB8,0xC6,0x38,0x48,0x72,0x6D,0x07,\
-    0x39,0x31,0x69,0x77,0x6D,0x47,0x39,\
-    0x39,0x68,0x77,0x6D,0x44,0x28,0x3F,\
-    0x68,0x37,0x6C,0x4F,0x38,0x39,0x78,\
-    0x3E,0x8D,0x47,0x39,0x39,0x68,0x72,\
-    0x2C,0x43,0x39,0x79,0x68,0x7F,0x6C,\
-    0x47,0x39,0x39,0x68,0x77,0x6D,0x47,\
-    0x39,0x3F,0x29,0x74,0x6D,0x07,0x38,\
-    0x31,0x69,0x77,0x7D,0x0E,0xD9,0x39,\
-    0x68,0x77,0x6D,0x40,0xD1,0x3E,0x68,\
-    0x37,0x6C,0x4F,0x38,0x39,0x78,0x3E,\
-    0x8D,0x47,0x39,0x39,0x68,0x77,0x7C,\
-    0x4E,0x39,0x79,0x68,0x7F,0x6C,0x47,\
-    0x29,0x06,0x44,0x77,0x6D,0x47,0x39,\
-    0x39,0x68,0x77,0x6D,0x47,0x39,0x38,\
-    0x69,0x7F,0x6D,0x07,0x39,0x31,0x69,\
-    0x77,0x7D,0x78,0xC9,0x39,0x68,0x77,\
-    0x6D,0x46,0x39,0x39,0x68,0x77,0x6D,\
-    0x45,0x78,0x3B,0x68,0x37,0x6D,0x4F,\
-    0x38,0x39,0x78,0x48,0x41,0x47,0x39,\
-    0x39,0x68,0x75,0x6D,0x47,0x39,0x39,\
-    0x68,0x70,0x8D,0x46,0x39,0x79,0x68,\
-    0x7F,0x6C,0x47,0x29,0x06,0x44,0x77,\
-    0x6D,0x47,0x39,0x3A,0x68,0x77,0x6D,\
-    0x47,0x39,0x71,0x8F,0x78,0x61,0x6D,\
-    0x56,0x39,0x48,0x57,0x20,0x65,0x74,\
-    0x19,0xB1,0x57,0xB4,0x65,0x45,0x39,\
-    0x78,0x03,0x64,0x57,0x28,0x73,0x68,\
-    0x10,0x6D,0x47,0xFB,0x89,0x54,0x77,\
-    0x6C,0x20,0x3D,0x00,0x36,0x43,0x36,\
-    0x59,0x68,0x76,0xA3,0x57,0x2C,0xD1,\
-    0xE0,0xB7,0xD1,0x47,0x39,0x39,0x67,\
-    0x22,0xED,0x21,0x39,0x39,0xC0,0x6D,\
-    0x54,0x47,0x29,0x4D,0x62,0x67,0x78,\
-    0x87,0x85,0x39,0x68,0x77,0x62,0x35,\
-    0x39,0x2B,0x6D,0xC7,0xEC,0x21,0x39,\
-    0x39,0xE2,0x49,0x54,0x47,0x29,0x4D,\
-    0x66,0x4F,0x54,0x47,0x29,0x4D,0x64,\
-    0x07,0x6D,0x77,0x3E,0x11,0x28,0x07,\
-    0x6D,0x77,0x3D,0xA9,0xE4,0x28,0xED,\
-    0x24,0x3D,0x4B,0x6F,0x17,0x69,0x75,\
-    0x3D,0xAB,0x2F,0x0B,0x6D,0x7B,0x38,\
-    0x73,0xEE,0x10,0x49,0x68,0x3A,0x0F,\
-    0x54,0x88,0x92,0x67,0x45,0x39,0x78,\
-    0x1B,0x4D,0x96,0xF5,0x11,0x20,0x57,\
-    0x6B,0x97,0x7A,0x45,0x68,0x4B,0x6D,\
-    0x5E,0x8C,0x51,0x69,0x1F,0x6D,0x0D,\
-    0xBF,0x5F,0x86,0x51,0x72,0x99,0x78,\
-    0x0A,0xAF,0x77,0x7D,0x33,0x37,0x29,\
-    0x6D,0x25,0x6D,0x35,0x36,0xFB,0x68,\
-    0x64,0xAC,0x47,0x29,0x4D,0x62,0xCF,\
-    0x2A,0x21,0x2D,0x31,0x91,0x77,0x68,\
-    0x47,0x29,0x4A,0x9D,0x44,0xA9,0x47,\
-    0x29,0x55,0x72,0x35,0x7C,0x27,0x39,\
-    0x38,0x40,0x25,0x14,0x47,0x29,0x4D,\
-    0x78,0x17,0x6D,0x46,0x27,0x7B,0x79,\
-    0x17,0x6D,0x46,0x21,0x31,0x51,0x77,\
-    0x68,0x47,0x29,0x4A,0x9D,0x11,0x6D,\
-    0x46,0x35,0x29,0x7D,0xB7,0x51,0x47,\
-    0xC9,0x5F,0x68,0x77,0x1D,0x4F,0x2C,\
-    0x39,0x6B,0x11,0x6D,0x47,0x51,0x29,\
-    0x7D,0xB7,0xD1,0x47,0x39,0x39,0x6F,\
-    0x28,0xED,0x25,0x63,0x29,0x7D,0xB7,\
-    0xD1,0x47,0x39,0x00,0x36,0x43,0x36,\
-    0x39,0x6F,0x28,0xED,0x24,0x3D,0x43,\
-    0x6F,0x17,0x67,0x57,0x2C,0xF9,0xD4,\
-    0x77,0x6D,0x47,0x3E,0x13,0x68,0x4F,\
-    0x68,0x74,0xFC,0x39,0x78,0x03,0x61,\
-    0x39,0x39,0x07,0x6D,0x3D,0xEA,0x20,\
-    0x25,0x03,0x54,0x88,0x92,0x6F,0x45,\
-    0x39,0x78,0x1B,0x4D,0x67,0x3E,0xE9,\
-    0x2D,0x09,0x6D,0x79,0x39,0x20,0xDD,\
-    0x0F,0x6C,0x3F,0x39,0x73,0xEF,0x11,\
-    0x83,0x4F,0xC0,0x39,0x6D,0x77,0x7D,\
-    0x34,0xCC,0x0A,0xAC,0x77,0x7D,0x2B,\
-    0x23,0x7B,0x79,0x17,0x6D,0x47,0xAD,\
-    0x29,0x7D,0x9F,0xE5,0x87,0x85,0x39,\
-    0x68,0x77,0x62,0x14,0xB9,0x5F,0x68,\
-    0x77,0xE9,0x39,0x39,0x27,0x45,0x77,\
-    0x6C,0x57,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0x47,0x36,0xD8,0x20,0xA9,0x2D,0x74,\
-    0xFE,0x39,0x78,0x03,0x61,0xF9,0x45,\
-    0x3E,0xBD,0x15,0x09,0x39,0x3F,0x01,\
-    0x54,0x88,0x92,0x6F,0x45,0x39,0x78,\
-    0x1B,0x4D,0x67,0x3E,0xE9,0x2C,0x09,\
-    0x6D,0x79,0x39,0x20,0xDD,0x0F,0x6F,\
-    0x3F,0x39,0x73,0xEF,0x11,0x83,0x74,\
-    0xC5,0x39,0x6E,0x77,0x7D,0x33,0x37,\
-    0x47,0x69,0x64,0xAA,0x47,0x29,0x4D,\
-    0x62,0x5F,0x11,0x47,0x29,0x4D,0x68,\
-    0x07,0x6E,0xAE,0xB1,0x2B,0x7C,0xB7,\
-    0xD1,0x47,0x39,0x39,0x98,0xB5,0xD1,\
-    0xB8,0xC6,0xC6,0x67,0xF5,0xED,0x5F,\
-    0xB8,0x3B,0x7C,0x77,0x9D,0x05,0x15,\
-    0x39,0x69,0x35,0x41,0x47,0x3B,0x2A,\
-    0xAF,0x77,0x7D,0x33,0x22,0x7B,0x51,\
-    0x77,0x7D,0x33,0x23,0x2B,0xEF,0x67,\
-    0x78,0xAF,0xB1,0x00,0x36,0x43,0x36,\
-    0xF9,0xD4,0x77,0x6D,0x47,0x36,0x6E,\
-    0xE8,0x11,0x6D,0x46,0x35,0x1B,0x14,\
-    0x77,0x7D,0x33,0x2B,0x29,0x79,0x2A,\
-    0x6D,0x21,0x05,0x27,0x51,0x77,0x7D,\
-    0x33,0x20,0x5E,0x72,0x3D,0x54,0x47,\
-    0x29,0x4D,0x72,0x10,0x63,0x54,0xC5,\
-    0x39,0x49,0x77,0x7D,0x33,0x20,0x2B,\
-    0xD4,0x77,0x6F,0x27,0x27,0x73,0x6F,\
-    0x11,0x77,0x0D,0x00,0x39,0x78,0x03,\
-    0x77,0x21,0x2B,0x31,0xD1,0x77,0x6B,\
-    0x47,0x29,0x4A,0x9D,0x7F,0x94,0x47,\
-    0x3E,0x39,0x78,0x04,0x98,0x05,0x28,\
-    0x29,0x79,0x26,0x6D,0x21,0x77,0x27,\
-    0x51,0x77,0x7D,0x33,0x20,0x5E,0x44,\
-    0x3D,0x54,0x47,0x29,0x4D,0x72,0x10,\
-    0x4D,0x54,0xC5,0x39,0x49,0x77,0x7D,\
-    0x33,0x20,0x29,0x51,0x77,0x7D,0x33,\
-    0x2A,0x6B,0x68,0x05,0x62,0x85,0x39,\
-    0x2A,0xA9,0x77,0x7D,0x33,0x2A,0x2B,\
-    0xD4,0x77,0x69,0x27,0x27,0x73,0x6F,\
-    0x11,0x77,0x0D,0x00,0x39,0x78,0x03,\
-    0x77,0x21,0x2B,0x31,0xD1,0x77,0x6B,\
-    0x47,0x29,0x4A,0x9D,0x7F,0x94,0x47,\
-    0x3E,0x39,0x78,0x04,0x98,0x05,0x28,\
-    0x27,0x79,0xC9,0x51,0x47,0x3B,0x5F,\
-    0x54,0x64,0x80,0x47,0x38,0x39,0x78,\
-    0x03,0x7A,0x54,0xD4,0x39,0x6A,0x77,\
-    0x7D,0x33,0x21,0x47,0x69,0x64,0xAA,\
-    0x47,0x29,0x4D,0x7B,0x35,0x54,0x47,\
-    0x29,0x4D,0x71,0x64,0xAA,0x47,0x29,\
-    0x4D,0x7E,0x65,0xD1,0x47,0x3A,0x19,\
-    0x54,0x77,0x6D,0x4E,0xFD,0xE9,0xD1,\
-    0x77,0x7D,0x2B,0x39,0x1A,0xA8,0x77,\
-    0x7D,0x34,0xC1,0x00,0x36,0x43,0x36,\
-    0x59,0x42,0xC9,0x51,0x47,0x3D,0x5F,\
-    0x4C,0x35,0x54,0x47,0x29,0x4D,0x71,\
-    0x64,0x91,0x47,0x38,0x39,0x78,0x03,\
-    0x7B,0x55,0x85,0x39,0x6B,0x57,0x51,\
-    0x47,0x39,0x30,0xAC,0xA7,0xD4,0x47,\
-    0x29,0x55,0x68,0x54,0xAD,0x47,0x29,\
-    0x4A,0x90,0x5F,0x72,0x6D,0x26,0x15,\
-    0x77,0x59,0x72,0x6F,0x66,0x13,0x37,\
-    0x39,0x18,0x68,0x34,0x16,0x64,0x58,\
-    0x6A,0x6D,0x45,0x39,0x78,0x04,0x98,\
-    0x4F,0x2C,0x39,0x6F,0x10,0x67,0x0D,\
-    0x00,0x39,0x78,0x03,0x7F,0x20,0x39,\
-    0x3A,0x36,0x5F,0x11,0x47,0x29,0x4D,\
-    0x7A,0x67,0x79,0x1A,0x39,0x5F,0x5C,\
-    0x69,0x54,0x47,0x29,0x4D,0x71,0x10,\
-    0x77,0x0D,0x00,0x39,0x78,0x03,0x77,\
-    0x20,0x37,0x2A,0x94,0x77,0x4C,0x47,\
-    0x29,0x4D,0x71,0x6F,0xD1,0x47,0x3B,\
-    0x59,0x7E,0x3D,0x6A,0x21,0x2B,0x73,\
-    0x51,0x77,0x7D,0x33,0x23,0x5F,0x62,\
-    0x7F,0xF8,0x47,0x3F,0x31,0xBD,0x77,\
-    0x6A,0x05,0x2D,0x29,0x7C,0x22,0x6D,\
-    0x21,0x2B,0x73,0x51,0x77,0x7D,0x33,\
-    0x20,0x5F,0x62,0x7F,0xF8,0x47,0x3F,\
-    0x31,0xBD,0x77,0x6A,0x05,0x2D,0x29,\
-    0x7C,0x26,0x6D,0x21,0x7F,0x27,0x51,\
-    0x77,0x7D,0x33,0x20,0x5E,0x44,0x3D,\
-    0x54,0x47,0x29,0x4D,0x72,0x10,0x4D,\
-    0x54,0xC5,0x39,0x49,0x77,0x7D,0x33,\
-    0x20,0x29,0x51,0x77,0x7D,0x33,0x2A,\
-    0x6B,0x68,0x05,0x62,0x85,0x39,0x2A,\
-    0xA9,0x77,0x7D,0x33,0x2A,0x21,0xD4,\
-    0x77,0x69,0x27,0x2F,0x73,0x6F,0x11,\
-    0x7F,0x0D,0x00,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x03,0x77,0x21,0x33,0x31,\
-    0xFD,0x77,0x6B,0x4F,0xEC,0x39,0x6F,\
-    0x35,0x79,0x57,0x2D,0x60,0x68,0x11,\
-    0x7F,0x0D,0x00,0x39,0x78,0x03,0x74,\
-    0x21,0x33,0x31,0xFD,0x77,0x6B,0x4F,\
-    0xEC,0x39,0x6F,0x35,0x79,0x57,0x2D,\
-    0x66,0x68,0x11,0x6D,0x47,0x59,0x27,\
-    0x51,0x77,0x7D,0x33,0x20,0x5E,0x2C,\
-    0x3D,0x54,0x47,0x29,0x4D,0x72,0x10,\
-    0x55,0x57,0x00,0x39,0x78,0x03,0x75,\
-    0x35,0x3F,0xF9,0xD4,0x77,0x6D,0x47,\
-    0xC6,0xFB,0x14,0x77,0x92,0xC6,0xF8,\
-    0x2A,0xA8,0x77,0x7D,0x33,0x20,0x6B,\
-    0x51,0x77,0x7D,0x33,0x2F,0x29,0x51,\
-    0x77,0x7D,0x33,0x2A,0x6B,0x68,0x05,\
-    0x62,0x85,0x39,0x2A,0xA9,0x77,0x7D,\
-    0x33,0x2A,0x21,0xD4,0x77,0x6E,0x27,\
-    0x2F,0x73,0x6F,0x11,0x7F,0x0D,0x00,\
-    0x39,0x78,0x03,0x77,0x21,0x33,0x31,\
-    0xFD,0x77,0x6B,0x4F,0xEC,0x39,0x6F,\
-    0x35,0x79,0x57,0x2D,0x62,0x68,0x11,\
-    0x41,0x59,0x00,0x39,0x78,0x03,0x74,\
-    0x20,0x2B,0x73,0x51,0x77,0x7D,0x33,\
-    0x23,0x5E,0x6E,0x7F,0xB8,0x47,0x3F,\
-    0x59,0x78,0x3D,0x6A,0x21,0x2B,0x73,\
-    0x51,0x77,0x7D,0x33,0x23,0x5F,0x62,\
-    0x7F,0xF8,0x47,0x3F,0x31,0xBD,0x77,\
-    0x6A,0x05,0x2D,0x73,0x7C,0x11,0x6D,\
-    0x47,0xD7,0x07,0x51,0x77,0x7D,0x2B,\
-    0x23,0x2A,0xAF,0x77,0x7D,0x33,0x2D,\
-    0x87,0x54,0x77,0x6A,0x25,0x39,0x39,\
-    0x10,0x7F,0x78,0x47,0x3E,0x5F,0x68,\
-    0x77,0xBF,0x6D,0x45,0x39,0x78,0x03,\
-    0x6D,0x45,0x2C,0x00,0x36,0x43,0x36,\
-    0x39,0x67,0x07,0x6D,0x57,0x3E,0x2B,\
-    0x7D,0xB7,0xD1,0x47,0x39,0x39,0x6F,\
-    0xB5,0xD1,0xB8,0xC6,0xC6,0x90,0xF5,\
-    0xED,0x5D,0xB8,0x31,0xFD,0x77,0x6E,\
-    0x37,0x31,0x16,0x68,0x3F,0x00,0x47,\
-    0x38,0x77,0xD1,0x77,0x7D,0x72,0x29,\
-    0x69,0xE7,0x09,0x6D,0x59,0x00,0x39,\
-    0x78,0x03,0x79,0x0D,0xBE,0x5E,0x72,\
-    0x57,0x11,0x47,0x29,0x55,0x48,0x57,\
-    0x6A,0x97,0x05,0x39,0x97,0x09,0x6D,\
-    0x59,0x39,0x22,0xD8,0x0F,0x6D,0x3F,\
-    0x38,0x73,0xEF,0x11,0x81,0x54,0xC5,\
-    0x39,0x69,0x77,0x7D,0x33,0x22,0x7B,\
-    0x51,0x77,0x7D,0x33,0x23,0x21,0xD4,\
-    0x77,0x68,0x27,0x5B,0x31,0x7D,0x77,\
-    0x6A,0x21,0x65,0x13,0x14,0x77,0x7D,\
-    0x33,0x39,0x49,0x69,0x9E,0xE5,0x55,\
-    0x2C,0xF9,0xD4,0x77,0x6D,0x47,0xC9,\
-    0xFB,0xD4,0x88,0x92,0xB8,0x36,0xBB,\
-    0xE8,0x6D,0xEC,0x45,0x2C,0x39,0x98,\
-    0x6C,0x14,0x47,0x29,0x4D,0x7C,0x77,\
-    0x6C,0x39,0x3F,0x19,0x14,0x77,0x7D,\
-    0x2B,0x19,0x19,0x6F,0xA7,0x51,0x47,\
-    0xC6,0x47,0x68,0x69,0x6D,0x5C,0x89,\
-    0x41,0x68,0x0F,0x6F,0x0D,0xBE,0x5F,\
-    0x84,0x09,0x6B,0x54,0xFE,0x39,0x78,\
-    0x03,0x78,0x54,0xC5,0x39,0x69,0x77,\
-    0x7D,0x33,0x22,0x7B,0x51,0x77,0x7D,\
-    0x33,0x23,0x21,0xEF,0x67,0x79,0x10,\
-    0x39,0x5F,0x68,0x76,0x7D,0x0D,0x00,\
-    0x39,0x78,0x03,0x74,0x21,0x39,0x38,\
-    0x6E,0x58,0x6B,0x6D,0x45,0x39,0x78,\
-    0x03,0x6D,0x37,0x3B,0xD0,0xE0,0x65,\
-    0x78,0x87,0x85,0x00,0x36,0x43,0x36,\
-    0x39,0x68,0x77,0x9D,0x85,0x85,0xC6,\
-    0x97,0x88,0x62,0xC5,0xB9,0x23,0xE9,\
-    0x07,0x6D,0x57,0x00,0x39,0x78,0x03,\
-    0x7E,0x55,0x2C,0xF9,0xD4,0x77,0x6D,\
-    0x47,0x36,0xFB,0xD4,0x88,0x92,0xB8,\
-    0xC9,0xBB,0xE8,0x6D,0xEC,0x5B,0x00,\
-    0x39,0x78,0x03,0x78,0x35,0x39,0x2B,\
-    0x6E,0x07,0x6D,0x57,0x00,0x39,0x78,\
-    0x03,0x79,0xD7,0xB8,0x66,0xE8,0x14,\
-    0x39,0x39,0x3E,0x19,0x14,0x77,0x7D,\
-    0x2B,0x19,0xE8,0xA9,0x57,0x6A,0x97,\
-    0x05,0x39,0x97,0x09,0x6D,0x59,0x39,\
-    0x22,0xD8,0x0F,0x6D,0x3F,0x38,0x73,\
-    0xEF,0x11,0x81,0x54,0xC5,0x39,0x69,\
-    0x77,0x7D,0x33,0x22,0x7B,0x51,0x77,\
-    0x7D,0x33,0x23,0x29,0x6E,0x29,0x6D,\
-    0x54,0xF9,0x39,0x78,0x03,0x78,0x59,\
-    0x00,0x39,0x78,0x03,0x7A,0xF9,0x00,\
-    0x39,0x78,0x03,0x7B,0x21,0x33,0x73,\
-    0x6F,0x10,0x6B,0x5F,0x85,0x39,0x60,\
-    0x17,0x09,0x5F,0x85,0x39,0x6F,0x17,\
-    0x33,0x37,0x31,0x16,0x68,0x3F,0x00,\
-    0x47,0x38,0x77,0xD1,0x77,0x7D,0x72,\
-    0x29,0x25,0x51,0x77,0x7D,0x33,0x2C,\
-    0x69,0xE7,0x67,0x54,0x47,0x29,0x4D,\
-    0x7C,0xE7,0x6B,0x39,0x39,0x27,0x68,\
-    0x3D,0xEA,0x20,0x19,0x19,0x14,0x77,\
-    0x7D,0x2B,0x19,0x49,0x68,0x67,0x6B,\
-    0x96,0xF9,0x19,0x6F,0xA7,0x51,0x47,\
-    0xC6,0x47,0x68,0x69,0x6D,0x5C,0x89,\
-    0x41,0x68,0x0F,0x6C,0x0D,0xBE,0x5F,\
-    0x84,0x64,0x91,0x47,0x38,0x39,0x78,\
-    0x03,0x76,0x05,0x00,0x39,0x78,0x03,\
-    0x77,0x5F,0x85,0x00,0x36,0x43,0x36,\
-    0x39,0x6D,0x35,0xD4,0x47,0x29,0x4A,\
-    0x90,0x5B,0x72,0x69,0x26,0x11,0x37,\
-    0x5D,0x32,0x09,0x4C,0x2B,0x51,0x77,\
-    0x7D,0x33,0x20,0x5E,0x78,0xC5,0x51,\
-    0x47,0xC6,0x5E,0x62,0x07,0x92,0x97,\
-    0x38,0x2A,0xA8,0x77,0x7D,0x33,0x20,\
-    0x58,0x68,0x8B,0x0B,0x09,0x4C,0x77,\
-    0x19,0x67,0x54,0x47,0x29,0x4D,0x73,\
-    0x24,0x6D,0x21,0x1F,0x2A,0x94,0x77,\
-    0x4C,0x47,0x29,0x4D,0x71,0x58,0x51,\
-    0x47,0x29,0x4D,0x68,0x07,0x6D,0x57,\
-    0x00,0x39,0x78,0x04,0x9B,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x72,0x09,0x7B,\
-    0x51,0x77,0x7D,0x33,0x22,0x69,0xE7,\
-    0x39,0x18,0x09,0x48,0x2A,0x94,0x77,\
-    0x6C,0x47,0x29,0x4D,0x72,0x39,0x18,\
-    0x09,0x48,0x7B,0x51,0x77,0x7D,0x33,\
-    0x30,0x49,0x69,0x64,0xAD,0x47,0x29,\
-    0x4D,0x62,0x35,0x14,0x47,0x29,0x4D,\
-    0x64,0x35,0x14,0x47,0x29,0x4D,0x66,\
-    0x44,0x91,0x47,0x38,0x39,0x78,0x03,\
-    0x7D,0x05,0x00,0x39,0x78,0x03,0x7F,\
-    0x54,0xF9,0x39,0x78,0x03,0x7E,0x05,\
-    0x00,0x39,0x78,0x03,0x79,0x05,0x00,\
-    0x39,0x78,0x03,0x78,0x05,0x00,0x39,\
-    0x78,0x03,0x7B,0x54,0xC5,0x39,0x97,\
-    0x77,0x7D,0x33,0x2E,0x7B,0x51,0x77,\
-    0x7D,0x33,0x21,0x7B,0x51,0x77,0x7D,\
-    0x33,0x20,0x19,0x14,0x77,0x7D,0x34,\
-    0xCC,0x31,0xB8,0x77,0x6A,0x4F,0xA9,\
-    0x39,0x6E,0x7F,0xFD,0x47,0x3C,0x31,\
-    0x91,0x77,0x68,0x47,0x29,0x55,0x70,\
-    0x35,0xD4,0x47,0x29,0x4A,0x90,0x39,\
-    0x18,0x09,0x48,0x00,0x36,0x43,0x36,\
-    0x77,0x19,0x39,0x1C,0x68,0x3E,0x09,\
-    0x47,0x77,0x67,0x79,0x16,0x39,0x66,\
-    0x3D,0x2D,0x20,0x3F,0x6A,0x28,0x10,\
-    0x7F,0x27,0x19,0x49,0x68,0x47,0x6A,\
-    0x68,0x39,0x77,0xD1,0x77,0x7D,0x25,\
-    0xC1,0x61,0xE7,0x17,0x7F,0x37,0x39,\
-    0x09,0x6F,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x24,0xAD,0x1F,0xB6,0x59,0x6A,\
-    0x07,0x6C,0x69,0x26,0x77,0x1D,0x39,\
-    0x1C,0x09,0x4C,0x77,0x19,0x58,0x6A,\
-    0x68,0x3F,0x16,0x6D,0x47,0x42,0x47,\
-    0x2B,0x17,0x47,0x77,0x79,0x6B,0x16,\
-    0x39,0x70,0x5D,0x42,0x47,0x25,0x73,\
-    0x28,0x10,0x6B,0x14,0x79,0x5E,0x7C,\
-    0x17,0x49,0x68,0x3C,0x16,0x6E,0x58,\
-    0x6A,0x09,0x80,0x39,0x78,0x14,0x39,\
-    0x08,0xD6,0x39,0x64,0x17,0x79,0x68,\
-    0x3C,0x16,0x6E,0x58,0x6A,0x09,0x80,\
-    0x39,0x78,0x23,0x55,0x08,0xD6,0x39,\
-    0x64,0x17,0x6F,0x37,0x38,0x13,0x77,\
-    0x5B,0x72,0x69,0x26,0x77,0x1D,0x39,\
-    0x1C,0x77,0x16,0x39,0x6E,0xC7,0x11,\
-    0x47,0x38,0x5F,0x60,0x39,0xD4,0x47,\
-    0x29,0x6D,0x14,0x17,0x6F,0x37,0x39,\
-    0x77,0x1D,0x39,0x1C,0x68,0x34,0x16,\
-    0x64,0x58,0x6A,0x6D,0x45,0x39,0x97,\
-    0x83,0x6D,0x0E,0xD4,0x39,0x72,0x7F,\
-    0x79,0x47,0x3E,0x5F,0x92,0x37,0xAD,\
-    0x47,0x45,0x3E,0x68,0x7F,0x79,0x47,\
-    0x3E,0x5E,0x6C,0x31,0xAD,0x27,0xD3,\
-    0x17,0x68,0x4C,0x11,0xC7,0x3C,0x39,\
-    0x70,0x4C,0x11,0x47,0x38,0x39,0x72,\
-    0x4C,0x11,0x58,0x29,0x39,0x74,0x35,\
-    0x40,0x47,0x27,0x00,0x36,0x43,0x36,\
-    0x31,0xBC,0x77,0x6A,0x01,0xFE,0x17,\
-    0x77,0x5F,0x32,0x6D,0x66,0x77,0x1D,\
-    0x3F,0x8A,0x48,0x39,0x15,0x51,0x77,\
-    0x7E,0x47,0x51,0x19,0x54,0x77,0x6D,\
-    0x46,0xCD,0x0B,0x54,0xC1,0x77,0x3F,\
-    0x93,0x43,0x3D,0x57,0x11,0x47,0x2A,\
-    0x39,0x68,0x55,0x11,0x47,0xC6,0xC3,\
-    0x68,0x64,0x28,0x47,0x6C,0x2A,0x2C,\
-    0x77,0x38,0x76,0x78,0x39,0x16,0x59,\
-    0x45,0x47,0x51,0xA7,0xEE,0xC9,0xED,\
-    0x22,0xD3,0x11,0x77,0x5D,0x72,0x6B,\
-    0x26,0x17,0x77,0x39,0x18,0x0F,0xDE,\
-    0x3E,0x64,0x09,0x6C,0x6B,0x00,0x39,\
-    0x7B,0x77,0x05,0x6F,0x45,0x39,0x7B,\
-    0x77,0x6D,0x6D,0x45,0x39,0x97,0x82,\
-    0x6D,0x6D,0x05,0x39,0x61,0xFE,0x05,\
-    0x26,0x39,0xC6,0x38,0x16,0xF5,0x67,\
-    0x74,0x2B,0x70,0x07,0x62,0x95,0x21,\
-    0xEB,0x70,0xA7,0x51,0x47,0xC6,0x73,\
-    0x68,0x11,0x99,0x37,0x38,0xA9,0x69,\
-    0x55,0x6D,0xF5,0x14,0x39,0x77,0x11,\
-    0x49,0x0D,0x2C,0x5F,0x48,0x67,0x54,\
-    0x47,0x29,0x45,0x50,0xC7,0x40,0x47,\
-    0x38,0x5F,0x7C,0x69,0x40,0x47,0x3B,\
-    0x5E,0x70,0xC9,0x51,0x47,0x38,0x5E,\
-    0x7A,0xC9,0x51,0x47,0x3A,0x5E,0x64,\
-    0x09,0x6C,0x65,0x15,0x39,0x00,0xE5,\
-    0xEB,0xF5,0xBC,0x5C,0xC6,0x57,0x6A,\
-    0x6D,0x26,0x15,0x77,0x59,0x72,0x6F,\
-    0x66,0x13,0x37,0x39,0x18,0x09,0x48,\
-    0x71,0x8F,0x48,0x61,0x3F,0x39,0x4D,\
-    0x47,0x01,0x17,0x6F,0x45,0x39,0x78,\
-    0x0B,0x55,0x6D,0x45,0x39,0x97,0x82,\
-    0x4D,0x5D,0xBA,0x00,0x36,0x43,0x36,\
-    0x43,0x76,0x0B,0xC7,0x5C,0x7F,0x39,\
-    0x69,0x09,0x6F,0x67,0x3C,0x6C,0x68,\
-    0x14,0x73,0x5C,0xBF,0x41,0x68,0x57,\
-    0x20,0x67,0x3E,0x6B,0x68,0x05,0x6D,\
-    0x55,0x39,0xE8,0xA9,0x67,0xEB,0x67,\
-    0x3E,0x6D,0x68,0x09,0x6D,0x59,0x39,\
-    0x87,0x6D,0x12,0x8F,0x5C,0x7B,0x39,\
-    0x76,0x6C,0x11,0x47,0xC6,0x39,0x77,\
-    0x16,0x6D,0xB9,0xA7,0x58,0x68,0x89,\
-    0x8B,0x5F,0xBA,0x58,0x68,0x88,0x49,\
-    0x69,0x39,0x87,0x54,0x77,0x6C,0x21,\
-    0x35,0x6B,0x6C,0x16,0x6D,0xB9,0xEB,\
-    0x81,0x54,0x77,0x6E,0x22,0x9D,0x19,\
-    0x6F,0x53,0x72,0x61,0x26,0x11,0x77,\
-    0x5D,0x72,0x6B,0x26,0x17,0x77,0x5F,\
-    0x32,0x6D,0x66,0x77,0x1D,0x39,0x1C,\
-    0x0F,0xDE,0x36,0x6C,0x6F,0x42,0x47,\
-    0x22,0x23,0x47,0x77,0x72,0x6D,0x45,\
-    0x39,0x97,0x82,0x4D,0x5D,0xBD,0x19,\
-    0x6C,0xC7,0x51,0x47,0xBD,0x5E,0x68,\
-    0x76,0x53,0xF7,0x05,0x39,0xE0,0x10,\
-    0x6D,0x47,0xC5,0x89,0x54,0x77,0xE1,\
-    0x20,0x39,0x39,0xE8,0xC7,0x51,0x47,\
-    0x99,0x5E,0x6C,0x17,0x6D,0x46,0x4B,\
-    0x17,0x51,0x77,0x7D,0x3B,0x15,0x19,\
-    0x6F,0x05,0x75,0xA5,0x91,0x22,0x28,\
-    0x77,0x6C,0x67,0x3E,0x7B,0x28,0x3F,\
-    0x2D,0x5C,0x79,0x39,0x6A,0x57,0x6A,\
-    0xA7,0xB1,0x22,0x28,0x77,0x6E,0x5C,\
-    0x7E,0x39,0x6C,0x59,0x54,0x47,0x29,\
-    0x45,0x58,0x57,0x6A,0x35,0x21,0xDB,\
-    0xC0,0x6C,0x2D,0x47,0x3C,0x19,0x6F,\
-    0x35,0x2D,0x0F,0x79,0x22,0x28,0x77,\
-    0x6B,0x67,0x3E,0x00,0x36,0x43,0x36,\
-    0xD9,0xE0,0x6C,0x2D,0x47,0x3E,0x22,\
-    0x2F,0x77,0x65,0x39,0x30,0x45,0x77,\
-    0x55,0x20,0x05,0x08,0x41,0x68,0x57,\
-    0x24,0x67,0x3E,0x6B,0x68,0x05,0x6D,\
-    0x55,0x39,0xE8,0xA9,0x35,0x7D,0x67,\
-    0x3E,0x6D,0x68,0x09,0x6D,0x59,0x39,\
-    0x87,0x6E,0x12,0x8F,0x27,0x39,0x39,\
-    0x96,0x59,0x54,0x47,0x29,0x45,0x4C,\
-    0x57,0x6A,0x35,0x21,0xDB,0xC0,0x6C,\
-    0x2D,0x47,0x38,0x19,0x6F,0x35,0x2D,\
-    0x0F,0x79,0x22,0x28,0x77,0x6F,0x67,\
-    0x3E,0xD9,0xE0,0x6C,0x2D,0x47,0x3A,\
-    0x22,0x2F,0x77,0x69,0x69,0x00,0x39,\
-    0x78,0x0B,0x45,0x67,0x3E,0x4B,0x70,\
-    0x95,0xC5,0x5C,0x79,0x39,0x6D,0x57,\
-    0x6A,0x05,0x79,0x71,0x28,0x6C,0x2D,\
-    0x47,0x3F,0x19,0x6F,0x97,0xE5,0x5C,\
-    0x79,0x39,0x6F,0x6C,0x2A,0x47,0x31,\
-    0x47,0x61,0x0B,0x72,0x65,0x74,0x7B,\
-    0x59,0x0F,0x6D,0x67,0x70,0x19,0x6F,\
-    0x25,0x6D,0x35,0x39,0x2B,0x68,0xA6,\
-    0xAC,0x05,0x29,0x19,0x6F,0x23,0x6D,\
-    0x39,0x39,0x27,0x68,0xC9,0x6B,0x22,\
-    0xDB,0x59,0x68,0x77,0xE7,0x79,0x00,\
-    0x39,0x78,0x0B,0x59,0x37,0x39,0x09,\
-    0x6F,0x97,0xED,0x5C,0x79,0x39,0x69,\
-    0x6C,0x2A,0x47,0x3B,0x45,0x6B,0x09,\
-    0x72,0x65,0x74,0x7B,0x59,0x1F,0x6D,\
-    0x67,0x70,0x19,0x6E,0x25,0x6D,0x35,\
-    0x39,0x2B,0x68,0xA6,0xAC,0x05,0x29,\
-    0x19,0x6E,0x23,0x6D,0x3B,0x39,0x25,\
-    0x68,0xCB,0x6A,0x22,0xDB,0x59,0x26,\
-    0x6C,0x28,0x47,0x38,0x73,0x6D,0x11,\
-    0x63,0x5C,0x45,0x00,0x36,0x43,0x36,\
-    0x39,0x6A,0x77,0x6F,0x5C,0x45,0x39,\
-    0xE0,0x77,0x6E,0x27,0x35,0x22,0x14,\
-    0x77,0x6F,0x47,0x3B,0x22,0x14,0x77,\
-    0x59,0x47,0x3A,0x47,0x77,0x35,0x40,\
-    0x47,0x3D,0x45,0x6D,0x57,0x6A,0x1C,\
-    0x39,0x5A,0x76,0x35,0x58,0x2F,0x39,\
-    0x19,0x25,0x57,0x6B,0x15,0x39,0x4B,\
-    0x68,0x65,0x6D,0x96,0xF8,0x7B,0x78,\
-    0x57,0x6B,0x13,0x39,0x45,0x68,0x6B,\
-    0x6D,0xFB,0x3E,0x5C,0x8A,0x55,0x20,\
-    0x59,0x20,0x45,0x67,0xA9,0x74,0x99,\
-    0x20,0xE5,0x54,0x77,0x92,0x0D,0x3F,\
-    0x5F,0x9C,0x0B,0x6C,0xDB,0x3E,0x22,\
-    0x2E,0x77,0x72,0x26,0x39,0xC5,0xCC,\
-    0x16,0x6D,0xBB,0xD5,0x23,0xD4,0x77,\
-    0xED,0x5C,0x7D,0x39,0x69,0x6C,0x28,\
-    0x47,0x3B,0x47,0x6B,0x0D,0x72,0x05,\
-    0x0C,0x41,0x68,0x57,0x20,0x67,0x3E,\
-    0x6B,0x68,0x05,0x6D,0x55,0x39,0xE8,\
-    0xA9,0x35,0x7D,0x67,0x3E,0x6D,0x68,\
-    0x09,0x6D,0x59,0x39,0x87,0x6D,0x12,\
-    0x8F,0x65,0x74,0x23,0x71,0x09,0x62,\
-    0x9D,0x20,0xE3,0x71,0xA9,0x51,0x47,\
-    0xC6,0x73,0x6F,0x11,0x99,0x39,0x38,\
-    0xA7,0x6D,0x6C,0x2A,0x47,0x26,0x2A,\
-    0xAC,0x77,0x7D,0x3B,0x01,0x58,0x68,\
-    0x8B,0xB3,0x6F,0x39,0x19,0x6C,0x5F,\
-    0x72,0x6D,0x26,0x15,0x77,0x59,0x72,\
-    0x6D,0x66,0x77,0x1D,0x3F,0x8A,0x58,\
-    0x25,0x13,0x47,0x77,0x49,0x69,0x16,\
-    0x39,0x40,0x0F,0x6D,0x61,0x45,0x39,\
-    0x78,0x0B,0x5B,0x05,0x6A,0x13,0x2D,\
-    0x07,0x73,0xF7,0xBE,0x5C,0x68,0x77,\
-    0xCF,0x6F,0x45,0x00,0x36,0x43,0x36,\
-    0x39,0x97,0x82,0x4D,0x5F,0x85,0x39,\
-    0xF8,0x0D,0x6C,0x0D,0x3E,0x5E,0x76,\
-    0x0F,0x6D,0x67,0x75,0x49,0x68,0x67,\
-    0x68,0x96,0xF9,0x29,0xFD,0x07,0x6D,\
-    0x57,0x24,0xE1,0x28,0x25,0x68,0x37,\
-    0x39,0x29,0x6D,0xC9,0xED,0x23,0xDF,\
-    0x0F,0xEC,0x5D,0x6A,0x15,0x3C,0x21,\
-    0x6D,0xCD,0x51,0x47,0x26,0x5D,0x56,\
-    0x09,0x72,0x37,0x39,0x29,0x6D,0xE7,\
-    0xEA,0x4F,0x39,0x39,0x68,0x10,0x7F,\
-    0x67,0x75,0x49,0x68,0x67,0x68,0x96,\
-    0xF9,0x7B,0x78,0x6F,0x68,0x15,0x3D,\
-    0x81,0x6F,0x13,0x73,0x67,0x75,0x49,\
-    0x68,0x67,0x69,0x96,0xF9,0x7B,0x78,\
-    0x57,0x21,0x57,0x3D,0x6B,0x68,0x05,\
-    0x6D,0x55,0x39,0xE8,0xA9,0x35,0x7D,\
-    0x13,0x3D,0x81,0x6F,0x12,0x8F,0x6D,\
-    0x75,0x21,0x75,0x0D,0x62,0x9F,0x24,\
-    0xE1,0x75,0xAD,0x51,0x47,0xC6,0x73,\
-    0x6D,0x11,0x99,0x3D,0x38,0xA3,0x6C,\
-    0x6E,0x28,0x47,0x26,0x58,0x68,0x8C,\
-    0xE5,0x39,0x39,0x58,0x68,0x8C,0xA3,\
-    0x27,0x39,0x38,0x50,0x5F,0x11,0x47,\
-    0xC6,0xCC,0x48,0x6F,0xD1,0x47,0xA9,\
-    0x43,0x69,0x0B,0x6D,0x35,0x27,0x19,\
-    0x24,0x07,0x6D,0x57,0x3C,0xE8,0xA8,\
-    0x67,0xF8,0x37,0x39,0x29,0x75,0xAB,\
-    0x2D,0x15,0x3C,0x83,0x69,0x14,0x87,\
-    0x71,0xBF,0x1F,0x64,0x57,0x2E,0x15,\
-    0xBA,0x23,0x78,0x0B,0x62,0x67,0x7A,\
-    0x6B,0xEB,0xAD,0x7D,0x67,0x7A,0x6B,\
-    0xEB,0xAD,0x7D,0x9B,0x05,0x39,0x97,\
-    0x3D,0x6B,0x21,0xD5,0x45,0x69,0xEB,\
-    0x68,0x5E,0x7F,0x00,0x36,0x43,0x36,\
-    0x39,0x77,0x16,0x6D,0xBC,0x15,0x58,\
-    0x68,0x8C,0x19,0x6D,0x3E,0x1F,0x54,\
-    0x77,0x7D,0x3B,0x01,0x4B,0x8A,0xAD,\
-    0xEC,0x67,0x7A,0x29,0xFC,0x25,0x69,\
-    0x37,0x3A,0xF9,0x6C,0xF7,0x51,0x47,\
-    0xA9,0x21,0xE8,0x07,0x73,0xF7,0xBC,\
-    0x5C,0x68,0x77,0x19,0x39,0x38,0x73,\
-    0x6D,0x10,0x73,0x7B,0x2A,0x19,0x24,\
-    0x07,0x6D,0x57,0x3E,0xE8,0xA8,0x67,\
-    0xF8,0x37,0x39,0x29,0x75,0xAB,0x2D,\
-    0x15,0x3E,0x49,0x68,0x67,0x6A,0xFD,\
-    0xB9,0x5D,0x8E,0x41,0xEB,0x65,0x3C,\
-    0x6B,0x69,0x69,0x6C,0xF5,0x05,0x39,\
-    0x77,0x13,0x0D,0x3B,0x26,0x1B,0x24,\
-    0x07,0x6D,0x57,0x38,0xA9,0xEE,0x7F,\
-    0x6D,0x47,0x39,0x5E,0x7A,0x57,0x21,\
-    0x37,0x39,0x29,0x69,0xA6,0xAD,0x05,\
-    0x29,0x27,0x69,0x25,0x6A,0xF9,0x3F,\
-    0x5D,0x56,0x57,0x24,0x37,0x39,0x29,\
-    0x6F,0xA6,0xAD,0x05,0x29,0x19,0x21,\
-    0x67,0x6A,0x15,0x39,0x4B,0x68,0x65,\
-    0x6D,0x96,0xF8,0x7B,0x78,0x23,0x6A,\
-    0xF9,0x3F,0x5C,0x8A,0x17,0x73,0x39,\
-    0x38,0x05,0x7B,0x05,0x73,0x67,0x75,\
-    0x49,0x68,0x67,0x6A,0x96,0xF9,0x29,\
-    0xFD,0x07,0x6D,0x57,0x24,0xE5,0x28,\
-    0x25,0x6A,0xF9,0x38,0x5A,0x82,0x41,\
-    0xEB,0x65,0x75,0x27,0x71,0x0B,0x62,\
-    0x99,0x20,0xE7,0x71,0xAB,0x51,0x47,\
-    0xC6,0x73,0x6E,0x11,0x99,0x3B,0x38,\
-    0xA5,0x6F,0x6E,0x2B,0x47,0x26,0x58,\
-    0x68,0x8D,0x8B,0x69,0x39,0x73,0x6F,\
-    0x11,0x65,0x37,0x27,0x89,0xED,0x12,\
-    0x6D,0xB8,0x13,0x00,0x36,0x43,0x36,\
-    0x19,0x6F,0x51,0x72,0x6F,0x26,0x13,\
-    0x77,0x5B,0x72,0x69,0x26,0x1F,0x37,\
-    0x5F,0x32,0x6D,0x66,0x77,0x1D,0x39,\
-    0x1C,0x0F,0xDE,0x3E,0x6C,0x6B,0x42,\
-    0x47,0x2E,0x13,0x14,0x77,0x92,0xB2,\
-    0x19,0x2A,0xBD,0x77,0x7D,0x3B,0x01,\
-    0x23,0xD4,0x77,0xF5,0x5C,0x7F,0x39,\
-    0x69,0xCB,0x51,0x47,0x3A,0x5F,0x68,\
-    0x77,0x13,0x69,0x00,0x39,0x78,0x0B,\
-    0x41,0x67,0x3E,0x4B,0x70,0x95,0xC5,\
-    0x5C,0x79,0x39,0x6A,0x57,0x6A,0x05,\
-    0x79,0x71,0x28,0x6C,0x2D,0x47,0x3A,\
-    0x19,0x6F,0x97,0xE5,0x5C,0x79,0x39,\
-    0x6C,0x6C,0x2A,0x47,0x3C,0x17,0x51,\
-    0x77,0x7D,0x3B,0x09,0x19,0x6F,0x05,\
-    0x75,0xA5,0x91,0x22,0x28,0x77,0x6B,\
-    0x67,0x3E,0x7B,0x28,0x3F,0x2D,0x5C,\
-    0x79,0x39,0x6F,0x57,0x6A,0xA7,0xB1,\
-    0x22,0x28,0x77,0x65,0x5C,0x7E,0x39,\
-    0x61,0x0D,0x72,0x65,0x74,0x7B,0x45,\
-    0x77,0x67,0x39,0x32,0x83,0x54,0x77,\
-    0x66,0x24,0x75,0x7B,0x59,0x0F,0x6D,\
-    0x67,0x70,0x19,0x6F,0x25,0x6D,0x35,\
-    0x39,0x2B,0x68,0xA6,0xAC,0x05,0x29,\
-    0x19,0x6F,0x23,0x6D,0x39,0x39,0x27,\
-    0x68,0xC9,0x68,0x22,0xDB,0x59,0x44,\
-    0x0D,0x72,0x05,0x14,0x39,0x6A,0x09,\
-    0x6E,0x67,0x3C,0x6E,0x68,0x14,0x73,\
-    0x05,0x0C,0x41,0x68,0x57,0x20,0x67,\
-    0x3E,0x6B,0x68,0x05,0x6D,0x55,0x39,\
-    0xE8,0xA9,0x35,0x7D,0x67,0x3E,0x6D,\
-    0x68,0x09,0x6D,0x59,0x39,0x87,0x6D,\
-    0x12,0x8F,0x65,0x74,0x27,0x71,0x0D,\
-    0x62,0x99,0x20,0x00,0x36,0x43,0x36,\
-    0xE7,0x71,0xAD,0x51,0x47,0xC6,0x73,\
-    0x6D,0x11,0x99,0x37,0x38,0xA9,0x6F,\
-    0x59,0x6D,0x5C,0x7E,0x39,0x77,0x16,\
-    0x6D,0xBE,0xEF,0x17,0x68,0x3D,0x6A,\
-    0x21,0x39,0x39,0xEE,0x16,0x6D,0xBE,\
-    0xBF,0x23,0xD4,0x77,0xED,0x5C,0x45,\
-    0x39,0xF0,0x77,0x6C,0x5C,0x7F,0x39,\
-    0x6A,0x09,0x6E,0x3B,0x26,0x7B,0x5D,\
-    0x0F,0x6D,0x67,0x74,0x19,0x6F,0x25,\
-    0x6D,0x35,0x39,0x2B,0x68,0xA6,0xAC,\
-    0x05,0x29,0x19,0x6F,0x23,0x6D,0x39,\
-    0x39,0x27,0x68,0xC9,0x6B,0x22,0xDB,\
-    0x1B,0x25,0x6B,0x74,0x39,0x36,0xE5,\
-    0x71,0xAB,0x74,0x99,0x05,0x39,0x97,\
-    0x3D,0x6A,0x21,0xCD,0x49,0x69,0xE7,\
-    0x6B,0x6B,0x39,0x22,0x2E,0x77,0x72,\
-    0x54,0xC5,0x39,0xF0,0x77,0x7D,0x3B,\
-    0x01,0x58,0x68,0x8E,0x1F,0x69,0x39,\
-    0x73,0x6F,0x11,0x4F,0x3B,0x39,0x25,\
-    0x51,0x77,0x92,0xB2,0x3D,0xD8,0x26,\
-    0x6B,0x54,0x47,0xC6,0xCC,0x6D,0xCB,\
-    0x14,0x47,0x29,0x45,0x5E,0x10,0x67,\
-    0x39,0x38,0x2A,0x94,0x77,0x6C,0x47,\
-    0x29,0x45,0x51,0x57,0x6A,0x6D,0x26,\
-    0x15,0x77,0x59,0x72,0x6D,0x66,0x77,\
-    0x1D,0x3F,0x8A,0x78,0x39,0x23,0x47,\
-    0x77,0x72,0x3B,0x39,0x4D,0x6B,0x01,\
-    0x6C,0x3F,0x46,0x63,0xEC,0x58,0x68,\
-    0x68,0x3D,0x58,0x68,0x8D,0x41,0x17,\
-    0xB6,0x17,0x68,0x3D,0x6A,0x21,0x01,\
-    0x73,0x6D,0x11,0x79,0x0F,0x41,0x3B,\
-    0xE0,0x58,0x51,0x47,0x29,0x6F,0xA8,\
-    0x16,0x6D,0xBB,0x07,0x17,0x68,0x27,\
-    0xE2,0x27,0x2B,0x00,0x36,0x43,0x36,\
-    0x71,0x10,0x75,0x59,0x68,0x05,0x39,\
-    0x78,0x23,0xE5,0x26,0x39,0xC5,0x42,\
-    0x59,0x6D,0x17,0xB6,0x73,0x6F,0x11,\
-    0x67,0x68,0x3C,0x58,0x68,0x89,0x45,\
-    0x69,0x39,0x61,0xE7,0xC9,0x6E,0x21,\
-    0x33,0x6B,0x6E,0x16,0x6D,0xBF,0xAF,\
-    0x85,0x6A,0x12,0xC7,0x67,0x3E,0x1D,\
-    0x77,0x51,0x72,0x6F,0x26,0x13,0x77,\
-    0x5B,0x72,0x69,0x26,0x77,0x1D,0x3F,\
-    0x8A,0x58,0x39,0x13,0x47,0x77,0x75,\
-    0x6F,0x16,0x39,0x74,0x59,0x42,0x47,\
-    0x19,0x1A,0xAC,0x77,0x7D,0x3B,0x19,\
-    0x1A,0xAF,0x77,0x7D,0x3B,0x1D,0x1A,\
-    0xAD,0x77,0x7D,0x3B,0x11,0x1A,0xAF,\
-    0x77,0x7D,0x3B,0x15,0x19,0x6D,0xA7,\
-    0xEA,0x14,0xB9,0x1A,0xA8,0x77,0x7D,\
-    0x3B,0x09,0x41,0x69,0x0D,0x6E,0x61,\
-    0x05,0x39,0x68,0x77,0xE1,0x05,0x9E,\
-    0x16,0x6B,0x16,0x6D,0xBE,0xB1,0x17,\
-    0x68,0x27,0xE2,0xF9,0x3C,0x5F,0x66,\
-    0x0B,0x6C,0x05,0x9E,0x58,0x68,0x88,\
-    0x59,0x69,0x39,0x61,0xE7,0x17,0x6F,\
-    0x3B,0x39,0x73,0x6F,0x11,0x45,0xFB,\
-    0x3D,0x5E,0xB0,0x58,0x54,0x47,0x29,\
-    0x45,0x40,0x58,0x54,0x47,0x29,0x45,\
-    0x48,0x16,0x6D,0xBC,0xBD,0x69,0xE7,\
-    0x59,0x6D,0x0D,0x3E,0x5F,0x64,0x07,\
-    0x6E,0x68,0x39,0x58,0x68,0x8A,0xED,\
-    0x69,0x39,0x61,0xE7,0x57,0x6A,0x61,\
-    0x26,0x11,0x77,0x5D,0x72,0x6B,0x26,\
-    0x17,0x77,0x39,0x18,0x68,0x3E,0x17,\
-    0x47,0x77,0x65,0x67,0x16,0x39,0x64,\
-    0x54,0xAA,0x47,0x29,0x45,0x44,0x54,\
-    0xAD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x45,0x58,0x3D,0x54,0x47,0x29,0x5A,\
-    0x90,0x11,0x75,0x26,0x39,0xC1,0xE4,\
-    0x59,0x6D,0x0D,0x3E,0x5F,0x62,0x64,\
-    0x91,0x47,0x38,0x39,0x78,0x14,0x95,\
-    0x27,0x3D,0x19,0x6F,0x17,0x7D,0x05,\
-    0x9E,0x71,0x10,0x77,0xCD,0x26,0x39,\
-    0xC1,0x9E,0x59,0x6D,0x67,0x3E,0x69,\
-    0xE7,0x59,0x72,0x09,0x4C,0x77,0x19,\
-    0x3F,0x8A,0x58,0x39,0x07,0x47,0x77,\
-    0x77,0x05,0x00,0x39,0x78,0x0B,0x54,\
-    0x74,0xFE,0x39,0x78,0x0B,0x59,0x0D,\
-    0x00,0x39,0x78,0x14,0x95,0x21,0x21,\
-    0x58,0x68,0x8F,0x2F,0x69,0x39,0x73,\
-    0x6F,0x11,0x67,0x54,0xC5,0x39,0x69,\
-    0x77,0x7D,0x24,0xC1,0x59,0x6C,0x57,\
-    0x6A,0x27,0x0F,0x4F,0x69,0x0F,0x6E,\
-    0x6D,0x05,0x39,0x68,0x77,0xE5,0x05,\
-    0x9E,0x16,0x6D,0x16,0x6D,0xBF,0x9D,\
-    0x17,0x68,0x27,0xE2,0xF9,0x3D,0x5F,\
-    0x78,0x0B,0x6C,0x37,0x38,0x16,0x68,\
-    0x16,0x6D,0xB9,0x77,0x17,0x68,0x2F,\
-    0xE2,0x27,0x3B,0x45,0x68,0x3D,0x6A,\
-    0x21,0x3D,0x85,0x6B,0x10,0xBB,0x67,\
-    0x3E,0x1F,0x77,0x5F,0x72,0x6D,0x26,\
-    0x15,0x77,0x59,0x72,0x09,0x4C,0x77,\
-    0x19,0x39,0x3B,0x47,0x39,0x16,0x6F,\
-    0x3D,0x54,0x47,0x29,0x5A,0x90,0x11,\
-    0x75,0x26,0x39,0xCE,0xB0,0x59,0x6D,\
-    0x0D,0x3E,0x5F,0x62,0x64,0x91,0x47,\
-    0x38,0x39,0x78,0x14,0x95,0x27,0x3D,\
-    0x19,0x6F,0x17,0x75,0x68,0x17,0x39,\
-    0x78,0x58,0x43,0x47,0x35,0x16,0x46,\
-    0x77,0x65,0x26,0x39,0xC7,0x18,0x59,\
-    0x6D,0x67,0x3E,0x00,0x36,0x43,0x36,\
-    0x76,0x87,0x77,0x61,0x69,0x26,0x77,\
-    0x36,0x39,0x18,0x57,0x00,0x39,0x78,\
-    0x0B,0x54,0x09,0x4C,0x77,0x19,0x39,\
-    0x1C,0x09,0x6F,0xC6,0x90,0x3F,0x8A,\
-    0x78,0x3D,0x45,0x6A,0x57,0x03,0x47,\
-    0x31,0x49,0x68,0x67,0x45,0x47,0x38,\
-    0x04,0x28,0x88,0x91,0x77,0x17,0xC6,\
-    0x94,0x96,0x25,0x7A,0x79,0xC6,0x94,\
-    0x57,0x03,0x47,0x31,0x49,0x68,0x67,\
-    0x45,0x47,0x3B,0x04,0x28,0x88,0x93,\
-    0x79,0x17,0xC6,0x94,0xF9,0x03,0xB8,\
-    0xC7,0x4D,0x68,0xC9,0x11,0x47,0x31,\
-    0x5B,0x68,0x76,0xD7,0x67,0x3E,0x89,\
-    0x14,0x77,0x65,0x25,0x39,0x39,0xD6,\
-    0x47,0x56,0x45,0x3F,0x77,0x93,0x77,\
-    0x6F,0x47,0x2B,0x39,0x4A,0x77,0x5B,\
-    0x47,0x73,0x39,0x34,0x77,0x03,0x47,\
-    0xB9,0x39,0xFA,0x77,0xC9,0x79,0x05,\
-    0x38,0x68,0xEC,0xA0,0x65,0x45,0x39,\
-    0x68,0xF7,0x6D,0x27,0x39,0x39,0xFC,\
-    0x49,0x51,0xB9,0x39,0x13,0x14,0x77,\
-    0x6D,0xC7,0x39,0x1B,0x14,0x77,0x69,\
-    0x47,0x39,0x59,0x68,0x77,0xED,0x79,\
-    0x05,0x3B,0x68,0x5D,0x11,0x47,0x39,\
-    0xB9,0x68,0x55,0x11,0x47,0x38,0x39,\
-    0x68,0x17,0x6D,0x47,0x55,0x07,0x54,\
-    0x73,0x6D,0x6D,0x45,0x39,0x69,0x77,\
-    0x6D,0x65,0x45,0x39,0x69,0xF7,0x6D,\
-    0x27,0x61,0x07,0x54,0x7F,0x6D,0x6D,\
-    0x45,0x39,0x69,0xF7,0x6D,0x65,0x45,\
-    0x39,0x6A,0x77,0x6D,0x27,0x7F,0x07,\
-    0x54,0x67,0x6D,0x6D,0x45,0x39,0x6A,\
-    0x77,0x6D,0x65,0x45,0x39,0x6A,0xF7,\
-    0x6D,0x27,0x0D,0x00,0x36,0x43,0x36,\
-    0x07,0x54,0x57,0x6D,0x6D,0x45,0x39,\
-    0x6A,0xF7,0x6D,0x65,0x45,0x39,0x6B,\
-    0x77,0x6D,0x27,0x1B,0x07,0x54,0x37,\
-    0x6D,0x6D,0x45,0x39,0x6B,0x77,0x6D,\
-    0x65,0x45,0x39,0x6B,0xF7,0x6D,0x27,\
-    0x29,0x07,0x54,0xF7,0x6D,0x6D,0x45,\
-    0x39,0x6B,0xF7,0x6D,0x65,0x45,0x39,\
-    0x6C,0x77,0x6D,0x74,0xC5,0x31,0x68,\
-    0x77,0x92,0xBF,0x39,0x3B,0x11,0xC8,\
-    0x92,0x47,0xC6,0xC1,0x68,0x44,0x91,\
-    0x65,0x05,0x39,0x97,0x8F,0x61,0x37,\
-    0x0F,0xB9,0x2F,0x44,0xAD,0x47,0xC6,\
-    0xC1,0x66,0x4D,0xD1,0xB8,0xC6,0x41,\
-    0x69,0xCF,0x51,0x47,0x38,0x5F,0x68,\
-    0x77,0xDF,0xFB,0x05,0x39,0x6A,0x11,\
-    0x6D,0x47,0x93,0x2A,0x94,0x77,0x38,\
-    0x47,0xC6,0xC3,0x4F,0x64,0x91,0x47,\
-    0x93,0x39,0x97,0x8D,0x4A,0x47,0x40,\
-    0x39,0x69,0x77,0x92,0xBF,0x37,0x4F,\
-    0x68,0x3D,0x14,0x47,0xC6,0xC1,0x64,\
-    0x1D,0x4B,0xFB,0x05,0x39,0x6A,0x11,\
-    0x4D,0x54,0xC5,0x39,0x3D,0x77,0x92,\
-    0xBD,0x1E,0x2A,0x94,0x77,0xC7,0x47,\
-    0xC6,0xC3,0x4F,0x57,0x6E,0x15,0xBA,\
-    0x89,0xD4,0x78,0x92,0xB8,0xC6,0x5C,\
-    0xBE,0x0B,0x6C,0x27,0xEB,0x3B,0x11,\
-    0x88,0x93,0x47,0xC6,0xC1,0x66,0x0F,\
-    0x6D,0x3D,0x39,0x82,0xA1,0x13,0x5B,\
-    0x0D,0x3D,0x5F,0x5A,0xCB,0x51,0x47,\
-    0x3B,0x5F,0x44,0x7B,0x38,0xB8,0xC6,\
-    0x5E,0x6C,0x0F,0x6C,0x27,0xD1,0x6D,\
-    0xE5,0x57,0x68,0x15,0xBC,0x89,0xD4,\
-    0x77,0x6D,0x46,0x39,0x5A,0xB2,0x0D,\
-    0x6D,0x54,0xC5,0x00,0x36,0x43,0x36,\
-    0x39,0x3D,0x77,0x92,0xBD,0x1E,0x2A,\
-    0x94,0x77,0xC7,0x47,0xC6,0xC3,0x4F,\
-    0x17,0xAB,0xFC,0xF0,0x5F,0x6E,0x0B,\
-    0x6D,0x27,0x39,0xC6,0x32,0x57,0x6F,\
-    0x15,0xBB,0x62,0xE8,0x12,0x6D,0xB8,\
-    0x69,0x45,0x69,0x17,0x6D,0xB8,0x73,\
-    0x3B,0x11,0x88,0x90,0x47,0xC6,0xC1,\
-    0x66,0x77,0x14,0x07,0x39,0x39,0x97,\
-    0x8F,0x6D,0x27,0x3B,0x45,0x69,0x57,\
-    0x03,0x47,0x35,0x28,0x2E,0x77,0x6F,\
-    0x0B,0xD7,0x19,0x94,0x88,0xB1,0x09,\
-    0x67,0x77,0x1D,0x39,0x1C,0x09,0x6F,\
-    0xC6,0x90,0x35,0x03,0xB8,0xC7,0x49,\
-    0x68,0x67,0x43,0x47,0x32,0x04,0x28,\
-    0x88,0x91,0x67,0x17,0xC6,0x94,0x95,\
-    0xE5,0x6A,0x79,0xC6,0x94,0x57,0x43,\
-    0xB8,0xC5,0x77,0x36,0x39,0x18,0x45,\
-    0x0D,0x77,0x19,0x39,0x3B,0xB8,0x49,\
-    0x71,0x8F,0x48,0x51,0x6D,0x57,0x39,\
-    0x60,0x5F,0x03,0x47,0x29,0x1F,0x06,\
-    0x77,0x79,0x39,0x39,0x41,0x69,0x57,\
-    0x51,0xB8,0x39,0x31,0x68,0xA7,0xE1,\
-    0x35,0x79,0x8B,0xE8,0x14,0x79,0x6A,\
-    0x75,0xC6,0x1C,0x75,0xC3,0x47,0x39,\
-    0x36,0x97,0x88,0x19,0x6F,0x57,0xC6,\
-    0x1C,0x49,0x51,0x67,0x39,0x73,0xFB,\
-    0x10,0x6D,0x46,0x2D,0x80,0x94,0x77,\
-    0x69,0x47,0x39,0x5D,0x68,0x76,0x67,\
-    0x67,0x35,0x45,0x57,0xBB,0xED,0x61,\
-    0x35,0xAF,0xEE,0x03,0x6D,0xF3,0x05,\
-    0x39,0xE8,0x13,0x7F,0x67,0x77,0x49,\
-    0x68,0x67,0x6F,0x96,0xF9,0x28,0x14,\
-    0x77,0x92,0xB8,0x41,0x6B,0x6A,0x17,\
-    0x85,0x37,0x27,0x00,0x36,0x43,0x36,\
-    0x89,0xFB,0x15,0x65,0x3D,0x27,0x49,\
-    0x8A,0xA6,0xFE,0x27,0x3D,0x13,0x7B,\
-    0x35,0xFE,0x33,0x39,0x8D,0x6D,0x13,\
-    0x75,0x67,0x77,0xE8,0xAE,0x07,0x6D,\
-    0x57,0x3B,0xE8,0xA8,0x07,0x6D,0x57,\
-    0x3B,0x28,0x1D,0x7F,0x6C,0xB8,0x41,\
-    0x6B,0x6A,0x17,0x89,0x68,0x35,0x58,\
-    0x68,0x77,0xAF,0x1F,0xB6,0x04,0x28,\
-    0x88,0x93,0x37,0x79,0xA9,0xEE,0x5A,\
-    0x2D,0xB8,0xC1,0x49,0x68,0x47,0x6A,\
-    0x68,0x39,0x49,0x28,0x58,0x6D,0x68,\
-    0x3A,0x49,0x68,0x47,0x43,0xB8,0xC7,\
-    0x16,0x68,0x3F,0x03,0xB8,0x41,0x58,\
-    0x68,0x77,0xD1,0x08,0xD6,0x39,0x7C,\
-    0x5F,0x6D,0x37,0x39,0x29,0x6D,0xC7,\
-    0xC3,0xB8,0xC1,0x5A,0x54,0x3D,0x69,\
-    0x21,0x01,0x4B,0x28,0xA1,0xEC,0x68,\
-    0x3A,0x58,0x68,0x77,0x17,0x1F,0xB6,\
-    0x04,0x28,0x88,0x93,0x37,0x39,0x09,\
-    0x6F,0x58,0x6D,0x37,0x79,0x16,0x68,\
-    0x58,0x6E,0x37,0x39,0x09,0x46,0x88,\
-    0x93,0x68,0x39,0x19,0x54,0x88,0x92,\
-    0xB8,0x41,0x71,0x1E,0x7F,0x2D,0x26,\
-    0x39,0x39,0x1E,0x38,0x82,0x47,0x2D,\
-    0x11,0x68,0x3D,0x2A,0x20,0x3F,0xB6,\
-    0x11,0x77,0x92,0xBF,0x39,0x1D,0x24,\
-    0x03,0x6D,0xF3,0x3C,0x5D,0x70,0xCF,\
-    0x51,0x47,0x38,0x5E,0x7A,0x07,0x6D,\
-    0x57,0x3B,0x2B,0x72,0xC5,0x58,0x4F,\
-    0x38,0x5E,0x6A,0x0F,0x6C,0x15,0x3B,\
-    0x59,0x8C,0x3D,0x2A,0x20,0x33,0x09,\
-    0x6F,0x31,0x2D,0x86,0x40,0x39,0x97,\
-    0x8F,0x6D,0x67,0x57,0x39,0x64,0x66,\
-    0x29,0x47,0x3B,0x00,0x36,0x43,0x36,\
-    0x75,0x86,0x4B,0x91,0xB8,0x71,0x77,\
-    0x36,0x39,0x18,0x09,0x6F,0xC6,0x90,\
-    0x57,0x51,0x47,0x3A,0xB9,0x68,0xB7,\
-    0xC3,0x47,0x31,0xE9,0xE8,0x5A,0x2D,\
-    0xB8,0xC5,0x09,0x54,0x76,0x6D,0x75,\
-    0x17,0xC6,0x94,0x94,0x05,0x09,0x67,\
-    0x77,0x1D,0x39,0x1C,0x09,0x6F,0xC6,\
-    0x90,0x3F,0x8A,0x48,0x3D,0x17,0x46,\
-    0x77,0x7D,0x3F,0x3B,0x15,0x46,0x77,\
-    0x79,0x9B,0xBE,0x0A,0x94,0x7F,0x6D,\
-    0x47,0xC6,0xC1,0x68,0x75,0x14,0xF8,\
-    0xC6,0x39,0x97,0x8F,0x6D,0x77,0x17,\
-    0x39,0x72,0xF6,0x14,0x47,0xC6,0xC1,\
-    0x68,0x44,0x91,0x67,0x32,0x39,0x97,\
-    0x8F,0x61,0x37,0x0B,0xB9,0x06,0x77,\
-    0x63,0x74,0xF9,0x39,0x97,0x8F,0x63,\
-    0x45,0x40,0xC6,0x93,0x77,0x92,0xBF,\
-    0x37,0x13,0x2F,0x55,0x03,0x47,0x31,\
-    0x82,0xAE,0x13,0x69,0x5D,0xE0,0x59,\
-    0x90,0x5D,0x2A,0x65,0x57,0x39,0x60,\
-    0x05,0x6D,0xFF,0x05,0x39,0x6A,0x11,\
-    0x6D,0x47,0x4F,0x39,0x11,0x77,0x6C,\
-    0x47,0xC6,0xC1,0x66,0x0D,0x6D,0x0D,\
-    0x40,0x39,0x97,0x8F,0x61,0x2D,0x1F,\
-    0x81,0x54,0x77,0x6F,0x21,0x19,0x2A,\
-    0x94,0x77,0x38,0x47,0xC6,0xC3,0x4F,\
-    0x64,0x91,0x47,0x93,0x39,0x97,0x8D,\
-    0x4A,0x67,0x3C,0x6B,0xED,0xC7,0xD1,\
-    0x47,0x39,0xC6,0x97,0x12,0xBB,0x3F,\
-    0x38,0x59,0xBA,0x75,0x14,0xB8,0xC7,\
-    0x39,0x97,0x8F,0x63,0x67,0x7E,0x24,\
-    0x38,0x88,0x92,0x67,0x7E,0x24,0x00,\
-    0x77,0x4D,0xB8,0xC6,0x82,0xAE,0x15,\
-    0x67,0x0D,0x2C,0x00,0x36,0x43,0x36,\
-    0x5F,0x6E,0x25,0xE0,0x15,0xB0,0x59,\
-    0x9A,0xCC,0xAB,0x22,0x3B,0x41,0x68,\
-    0x47,0x6C,0x15,0x78,0x89,0x14,0xCC,\
-    0xED,0x22,0x39,0xC6,0xE4,0x0F,0x6C,\
-    0x27,0x39,0xC6,0xEE,0x75,0x14,0xB8,\
-    0xC4,0x39,0x97,0x8F,0x63,0x47,0x40,\
-    0x79,0x68,0x77,0x92,0xBF,0x39,0x3B,\
-    0x11,0xA8,0x92,0x47,0xC6,0xC1,0x68,\
-    0x57,0x69,0x0B,0xD7,0x19,0x98,0x88,\
-    0x89,0x09,0x67,0x77,0x1D,0x75,0xE5,\
-    0x09,0x48,0x77,0x19,0x39,0x1C,0x68,\
-    0x3E,0x39,0x14,0x70,0x6D,0x67,0x45,\
-    0x39,0x97,0x8D,0x6D,0x05,0x51,0x39,\
-    0x32,0x75,0x45,0x47,0xC1,0x39,0x3A,\
-    0x77,0x45,0x47,0x38,0x39,0x3A,0x46,\
-    0x11,0x60,0x29,0x39,0x32,0x66,0x11,\
-    0x47,0x79,0x39,0x3B,0x77,0x05,0x46,\
-    0x29,0x39,0x38,0x59,0x51,0x47,0x29,\
-    0x65,0x38,0x39,0x16,0x3F,0x38,0x3B,\
-    0x14,0x8F,0x92,0x69,0x26,0x77,0x1D,\
-    0x3F,0x8A,0x87,0xF9,0x77,0xD1,0x77,\
-    0x7D,0x63,0x65,0x19,0x77,0x55,0x72,\
-    0x67,0x66,0x1B,0x37,0x39,0x1E,0x0F,\
-    0xDE,0xF9,0xA8,0x75,0x14,0xB0,0xC6,\
-    0x39,0x97,0x8D,0x3D,0x09,0x80,0x39,\
-    0x78,0x43,0xC5,0x67,0x26,0x1B,0x77,\
-    0x57,0x32,0x65,0x66,0x77,0x1B,0x3F,\
-    0x8A,0x87,0xF9,0x7B,0xCF,0x39,0xD4,\
-    0x47,0x29,0x0F,0x04,0x2F,0xE2,0x67,\
-    0x26,0x1B,0x77,0x57,0x32,0x65,0x66,\
-    0x77,0x1B,0x3F,0x8A,0x87,0xF9,0x49,\
-    0x69,0x58,0x6D,0x09,0x80,0x39,0x78,\
-    0x41,0x01,0x1F,0xB6,0x19,0x77,0x55,\
-    0x72,0x67,0x66,0x00,0x36,0x43,0x36,\
-    0x1B,0x37,0x39,0x1E,0x09,0x48,0x71,\
-    0x8F,0xB7,0xAD,0x37,0x3B,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x0F,0x04,0x2F,\
-    0xE2,0x67,0x26,0x1B,0x77,0x57,0x32,\
-    0x65,0x66,0x77,0x1B,0x39,0x1C,0x0F,\
-    0xDE,0xF9,0xA8,0x07,0x6E,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x71,0x55,0x61,\
-    0xE7,0x57,0x72,0x65,0x26,0x19,0x37,\
-    0x55,0x32,0x09,0x4A,0x77,0x19,0x3F,\
-    0x8A,0x87,0xF9,0x49,0x6C,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x41,0x01,0x1F,\
-    0xB6,0x19,0x77,0x55,0x72,0x67,0x66,\
-    0x1B,0x37,0x39,0x1E,0x09,0x48,0x71,\
-    0x8F,0xB7,0xAD,0x37,0x3C,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x0F,0x04,0x2F,\
-    0xE2,0x67,0x26,0x1B,0x77,0x57,0x32,\
-    0x65,0x66,0x77,0x1B,0x39,0x1C,0x0F,\
-    0xDE,0xF9,0xA8,0x07,0x6B,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x71,0x55,0x61,\
-    0xE7,0x57,0x72,0x65,0x26,0x19,0x37,\
-    0x55,0x32,0x09,0x4A,0x77,0x19,0x3F,\
-    0x8A,0x87,0xF9,0x49,0x6F,0x58,0x6D,\
-    0x09,0x80,0x39,0x78,0x41,0x01,0x1F,\
-    0xB6,0x19,0x77,0x55,0x72,0x67,0x66,\
-    0x1B,0x37,0x39,0x1E,0x09,0x48,0x71,\
-    0x8F,0xB7,0xAD,0x37,0x31,0x16,0x68,\
-    0x39,0xD4,0x47,0x29,0x0F,0x04,0x2F,\
-    0xE2,0x67,0x26,0x1B,0x77,0x57,0x32,\
-    0x65,0x66,0x77,0x1B,0x39,0x1C,0x0F,\
-    0xDE,0xF9,0xA8,0x07,0x64,0x68,0x39,\
-    0x77,0xD1,0x77,0x7D,0x71,0x55,0x61,\
-    0xE7,0x57,0x72,0x65,0x26,0x19,0x37,\
-    0x55,0x32,0x09,0x4A,0x77,0x19,0x3F,\
-    0x8A,0x87,0xF9,0x00,0x36,0x43,0x36,\
-    0x49,0x62,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x41,0x01,0x1F,0xB6,0x19,0x77,\
-    0x55,0x72,0x67,0x66,0x1B,0x37,0x39,\
-    0x1E,0x09,0x48,0x71,0x8F,0xB7,0xAD,\
-    0x37,0x32,0x16,0x68,0x39,0xD4,0x47,\
-    0x29,0x0F,0x04,0x2F,0xE2,0x67,0x26,\
-    0x1B,0x77,0x57,0x32,0x65,0x66,0x77,\
-    0x1B,0x39,0x1C,0x0F,0xDE,0xF9,0xA8,\
-    0x07,0x61,0x68,0x39,0x77,0xD1,0x77,\
-    0x7D,0x71,0x55,0x61,0xE7,0x57,0x72,\
-    0x65,0x26,0x19,0x37,0x55,0x32,0x09,\
-    0x4A,0x77,0x19,0x3F,0x8A,0x87,0xF9,\
-    0x49,0x65,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x41,0x01,0x1F,0xB6,0x19,0x77,\
-    0x55,0x72,0x67,0x66,0x1B,0x37,0x39,\
-    0x1E,0x09,0x48,0x71,0x8F,0xB7,0xAD,\
-    0x37,0x37,0x16,0x68,0x39,0xD4,0x47,\
-    0x29,0x0F,0x04,0x2F,0xE2,0x67,0x26,\
-    0x1B,0x77,0x57,0x32,0x65,0x66,0x77,\
-    0x1B,0x39,0x1C,0x0F,0xDE,0xF9,0xA8,\
-    0x07,0x62,0x68,0x39,0x77,0xD1,0x77,\
-    0x7D,0x71,0x55,0x61,0xE7,0x57,0x72,\
-    0x65,0x26,0x19,0x37,0x55,0x32,0x09,\
-    0x4A,0x77,0x19,0x3F,0x8A,0x87,0xF9,\
-    0x49,0x78,0x58,0x6D,0x09,0x80,0x39,\
-    0x78,0x41,0x01,0x1F,0xB6,0x19,0x77,\
-    0x55,0x72,0x67,0x66,0x1B,0x37,0x39,\
-    0x1E,0x09,0x48,0x71,0x8F,0xB7,0xAD,\
-    0x37,0x28,0x16,0x68,0x39,0xD4,0x47,\
-    0x29,0x0F,0x04,0x2F,0xE2,0x67,0x26,\
-    0x1B,0x77,0x57,0x32,0x65,0x66,0x77,\
-    0x1B,0x39,0x1C,0x0F,0xDE,0xF9,0xA8,\
-    0x07,0x7F,0x68,0x39,0x77,0xD1,0x77,\
-    0x7D,0x71,0x55,0x00,0x36,0x43,0x36,\
-    0x61,0xE7,0x57,0x72,0x65,0x26,0x19,\
-    0x37,0x55,0x32,0x09,0x4A,0x77,0x19,\
-    0x3F,0x8A,0x48,0x25,0x39,0x14,0x70,\
-    0x6D,0x6D,0x45,0x39,0x97,0x8D,0x6D,\
-    0x5C,0x45,0x39,0x3D,0x77,0x38,0x5C,\
-    0x45,0x39,0xC2,0x77,0x38,0x79,0x05,\
-    0x8F,0x72,0x44,0xAA,0x47,0x2A,0x39,\
-    0x16,0x4F,0x51,0xC7,0x39,0x43,0xC2,\
-    0x0B,0x38,0x6F,0x45,0x39,0x7B,0x77,\
-    0x6D,0x00,0xD5,0x39,0xD9,0x7F,0xFE,\
-    0x47,0x39,0x22,0x2E,0x77,0x38,0x5C,\
-    0x7C,0x39,0x3D,0x4E,0x2A,0x47,0x47,\
-    0x68,0xA4,0x88,0x83,0x39,0xC6,0x6A,\
-    0xEF,0x11,0x91,0x6F,0x26,0x13,0x77,\
-    0x5B,0x72,0x69,0x26,0x1F,0x37,0x5F,\
-    0x32,0x6D,0x66,0x77,0x1D,0x64,0x91,\
-    0x47,0x6C,0x39,0x97,0x8D,0x38,0x54,\
-    0xC5,0x39,0xC2,0x77,0x92,0xBD,0x6C,\
-    0x77,0x1D,0x39,0x1C,0x74,0xC5,0x8F,\
-    0x72,0x77,0x7E,0x47,0x47,0x77,0x1D,\
-    0x39,0x1C,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0x9D,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xA8,0x77,\
-    0x7D,0x1E,0xE1,0x39,0x78,0x2E,0x99,\
-    0x47,0x29,0x63,0x78,0x77,0x7D,0x1D,\
-    0x15,0x39,0x78,0x2D,0x25,0x47,0x29,\
-    0x63,0x0C,0x77,0x7D,0x1D,0xB9,0x39,\
-    0x78,0x2D,0xF1,0x47,0x29,0x63,0xD0,\
-    0x77,0x7D,0x1D,0xED,0x39,0x78,0x2D,\
-    0x9D,0x47,0x29,0x62,0x64,0x77,0x7D,\
-    0x1C,0x11,0x39,0x78,0x2C,0x29,0x47,\
-    0x29,0x62,0x08,0x77,0x7D,0x1C,0x45,\
-    0x39,0x78,0x2C,0xF5,0x47,0x29,0x62,\
-    0xDC,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x00,0x36,0x43,0x36,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x00,0x36,0x43,0x36,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x77,\
-    0x7D,0x1E,0xA9,0x39,0x78,0x2E,0xFD,\
-    0x47,0x29,0x60,0xF8,0x77,0x7D,0x1E,\
-    0xA9,0x39,0x78,0x2E,0xFD,0x47,0x29,\
-    0x60,0xF8,0x77,0x7D,0x1E,0xA9,0x39,\
-    0x78,0x2E,0xFD,0x47,0x29,0x60,0xF8,\
-    0x77,0x7D,0x1E,0xA9,0x39,0x78,0x2E,\
-    0xFD,0x47,0x29,0x60,0xF8,0x77,0x7D,\
-    0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x47,\
-    0x29,0x60,0xF8,0x77,0x7D,0x1E,0xA9,\
-    0x39,0x78,0x2E,0xFD,0x47,0x29,0x60,\
-    0xF8,0x77,0x7D,0x1E,0xA9,0x39,0x78,\
-    0x2E,0xFD,0x47,0x29,0x60,0xF8,0x39,\
-    0x3B,0xB8,0xC1,0x00,0x36,0x43,0x36,\
-    0x71,0x8F,0x68,0x69,0x7D,0x17,0x39,\
-    0x62,0x41,0x51,0x47,0x39,0x83,0x14,\
-    0x77,0x64,0x22,0x3F,0x49,0x69,0x17,\
-    0x6D,0x47,0x95,0x19,0x14,0x77,0x7D,\
-    0x24,0x8D,0x49,0x68,0x47,0x68,0x6D,\
-    0x49,0x35,0x68,0x44,0x91,0xED,0x93,\
-    0x39,0x68,0x7D,0xC7,0x74,0xC5,0x6C,\
-    0x3D,0x77,0x6D,0x42,0x6D,0x0A,0x94,\
-    0xF7,0xED,0x47,0x39,0x33,0xC2,0x44,\
-    0x91,0xED,0x93,0x39,0x68,0x7D,0xC7,\
-    0x74,0xC5,0x6C,0x3D,0x77,0x6D,0x42,\
-    0x6D,0x03,0xD4,0x47,0x5D,0x6D,0x00,\
-    0x39,0x7B,0x77,0x05,0x35,0x93,0x41,\
-    0x3D,0x57,0x11,0x47,0x2A,0x39,0x68,\
-    0x55,0x11,0x47,0xC6,0xC3,0x68,0x47,\
-    0x51,0xF1,0x23,0x2A,0x2C,0x77,0x38,\
-    0x54,0x78,0x39,0x3D,0x46,0x2D,0x47,\
-    0x47,0x05,0x7D,0x49,0x51,0x47,0xB9,\
-    0xF7,0x2E,0x3D,0x2A,0x21,0x17,0x31,\
-    0x6E,0x77,0x68,0x20,0x37,0x73,0x2F,\
-    0x11,0x49,0x74,0xC5,0xC9,0x98,0x77,\
-    0x6D,0x4D,0x93,0x59,0x76,0x59,0x45,\
-    0x47,0x51,0xA7,0xED,0xC9,0xD1,0x47,\
-    0x92,0x90,0x38,0x12,0xAB,0x74,0xC5,\
-    0x89,0xD8,0x77,0x6D,0x4D,0x93,0x49,\
-    0x69,0x17,0x7D,0x37,0x39,0x59,0x64,\
-    0x47,0x6E,0x15,0x7A,0x6E,0x28,0x12,\
-    0x6D,0xB8,0x51,0x49,0x69,0x51,0x72,\
-    0x6F,0x26,0x13,0x77,0x5B,0x72,0x69,\
-    0x26,0x13,0x37,0x39,0x33,0x09,0x4C,\
-    0x77,0x19,0x39,0x3B,0xB8,0xC1,0x71,\
-    0x8F,0x68,0x71,0x65,0x17,0x39,0x60,\
-    0x5D,0x43,0x47,0x35,0x11,0x46,0x77,\
-    0x7D,0x71,0x05,0x00,0x36,0x43,0x36,\
-    0x39,0x68,0xCF,0xD4,0x47,0x29,0x5A,\
-    0xDC,0x12,0x61,0x67,0x38,0xE9,0xEC,\
-    0xC7,0xD4,0x47,0x29,0x5A,0xB0,0x14,\
-    0x6B,0x37,0x38,0x59,0x68,0x77,0xA3,\
-    0x6F,0x7D,0x1F,0x2D,0x57,0x28,0x67,\
-    0x38,0x6B,0xE8,0x95,0xE5,0x06,0xC9,\
-    0x33,0x96,0x5D,0x25,0x74,0xC5,0x93,\
-    0xC2,0x77,0x6D,0x4D,0x93,0x0A,0x94,\
-    0x22,0x38,0x47,0x39,0x3C,0x3C,0x44,\
-    0x91,0x67,0x19,0x39,0x68,0x7D,0xC7,\
-    0x3D,0x39,0x03,0x7B,0x44,0x91,0xE7,\
-    0x99,0x39,0x68,0x7D,0xC7,0x7F,0xBC,\
-    0x13,0x51,0x77,0x7E,0x47,0x51,0x41,\
-    0xC2,0x05,0x38,0x67,0x45,0x39,0x7B,\
-    0x77,0x6D,0x65,0x45,0x39,0x97,0x8D,\
-    0x6D,0x54,0x78,0x39,0x3D,0x64,0x29,\
-    0x47,0x6C,0x08,0x14,0xC1,0x77,0x47,\
-    0x47,0x05,0x7C,0x49,0x51,0x47,0xB9,\
-    0xF7,0x3B,0x47,0x51,0x47,0xB9,0xF9,\
-    0x2E,0xC7,0x2A,0x20,0x23,0x31,0x6E,\
-    0x77,0x68,0x20,0x3F,0x89,0x2F,0x11,\
-    0x55,0x27,0x37,0x17,0x40,0x77,0x05,\
-    0xD9,0xBC,0x49,0x2C,0xC7,0xEA,0x25,\
-    0xF1,0x59,0x4C,0x57,0x26,0x13,0xB2,\
-    0x88,0xA5,0x13,0x65,0x13,0xB5,0x0F,\
-    0x54,0x77,0x6D,0x27,0x21,0x0A,0x94,\
-    0xE7,0xFD,0x47,0x39,0x33,0xC2,0x44,\
-    0x91,0x47,0x39,0x39,0x68,0x7D,0xC7,\
-    0x37,0x39,0x59,0x48,0x07,0x6C,0x27,\
-    0x25,0x09,0x6B,0x25,0x2E,0x10,0x79,\
-    0x5C,0x68,0x88,0x1F,0x74,0xC5,0xA9,\
-    0xF8,0x77,0x6D,0x4D,0x93,0x0A,0x94,\
-    0x77,0x6D,0x47,0x39,0x33,0xC2,0x07,\
-    0x6C,0x61,0x26,0x00,0x36,0x43,0x36,\
-    0x11,0x77,0x5D,0x72,0x6B,0x26,0x17,\
-    0x77,0x51,0x32,0x6F,0x66,0x13,0x37,\
-    0x39,0x33,0x09,0x4C,0x77,0x19,0x58,\
-    0x60,0x67,0x16,0x39,0x64,0x05,0x6D,\
-    0x65,0x56,0x39,0x60,0x5D,0x2D,0x67,\
-    0x79,0xE8,0x87,0x77,0x7D,0x16,0xF0,\
-    0x39,0x76,0x64,0x91,0x47,0x6C,0x39,\
-    0x97,0x8D,0x38,0x54,0xC5,0x39,0xC2,\
-    0x77,0x92,0xBD,0x6C,0x0A,0x94,0xC1,\
-    0x77,0x47,0x2A,0x39,0x16,0x45,0x51,\
-    0x45,0x39,0x82,0x21,0x10,0x69,0x37,\
-    0x38,0x59,0x6E,0xCC,0xA5,0x22,0xED,\
-    0x49,0x68,0x5D,0x32,0x09,0x4C,0x77,\
-    0x19,0x58,0x60,0x68,0x3E,0x19,0x47,\
-    0x77,0x7D,0x79,0x05,0x3B,0x68,0x5D,\
-    0x11,0x47,0xC6,0xC3,0x68,0x6C,0x11,\
-    0x47,0x6C,0x39,0x3D,0x6C,0x11,0x47,\
-    0x93,0x39,0x3D,0x45,0x51,0xF1,0x23,\
-    0x0A,0xA9,0x77,0x7E,0x47,0x47,0x1B,\
-    0x07,0x77,0x61,0x67,0x79,0x09,0x54,\
-    0x88,0x92,0x16,0xF6,0x39,0x70,0x6C,\
-    0x11,0x47,0x6C,0x39,0x3D,0x6C,0x11,\
-    0x47,0x93,0x39,0x3D,0x44,0xAC,0x47,\
-    0x2A,0x39,0x16,0x49,0x51,0x45,0x39,\
-    0x89,0x31,0x10,0x69,0x37,0x38,0x59,\
-    0x70,0xC4,0xA5,0x24,0xE3,0x22,0x14,\
-    0x77,0x38,0x47,0x6C,0x22,0x14,0x77,\
-    0xC7,0x47,0x6C,0x0A,0xA9,0x77,0x7E,\
-    0x47,0x47,0x49,0x68,0x59,0x72,0x6D,\
-    0x66,0x77,0x1D,0x39,0x1C,0x68,0x3E,\
-    0x16,0x6E,0x4B,0x42,0x47,0x37,0x2A,\
-    0x94,0x77,0x38,0x47,0xC6,0xC3,0x3D,\
-    0x64,0x91,0x47,0x93,0x39,0x97,0x8D,\
-    0x38,0x74,0xC5,0x00,0x36,0x43,0x36,\
-    0x8F,0x72,0x77,0x7E,0x47,0x47,0x16,\
-    0x6E,0x16,0x6D,0xBA,0x0D,0x61,0xE7,\
-    0x59,0x6D,0x0D,0x3E,0x5F,0x4C,0x58,\
-    0x60,0x67,0x45,0x39,0x78,0x14,0xD9,\
-    0x37,0x39,0x09,0x6E,0x3C,0x9D,0x4B,\
-    0x39,0x19,0x05,0x77,0x69,0x0F,0x51,\
-    0xC6,0x96,0x58,0x78,0x26,0x39,0xC6,\
-    0x2A,0x59,0x6D,0x17,0xB6,0x13,0x37,\
-    0x57,0x6A,0x6B,0x26,0x17,0x77,0x39,\
-    0x18,0x09,0x48,0x71,0x8F,0x78,0x6D,\
-    0x69,0x16,0x39,0x7C,0x5D,0x42,0x47,\
-    0x21,0x11,0x47,0x77,0x71,0x0D,0xBE,\
-    0x5F,0x6C,0x07,0x6D,0x27,0x07,0x2A,\
-    0x94,0x77,0x38,0x47,0xC6,0xC3,0x3D,\
-    0x64,0x91,0x47,0x93,0x39,0x97,0x8D,\
-    0x38,0x74,0xC5,0x8F,0x72,0x77,0x7E,\
-    0x47,0x47,0x16,0x6C,0x58,0x68,0x68,\
-    0x3E,0x58,0x68,0x8A,0xF1,0x08,0xD6,\
-    0x39,0x64,0x5B,0x6D,0x0D,0x3F,0x5F,\
-    0x78,0x58,0x6A,0x68,0x3D,0x16,0x6D,\
-    0x16,0x6D,0xB9,0xA5,0x15,0x68,0x38,\
-    0x82,0x47,0x35,0x19,0x6E,0x5F,0x72,\
-    0x6D,0x26,0x15,0x77,0x59,0x72,0x09,\
-    0x4C,0x39,0x68,0x77,0x6D,0x47,0x39,\
-    0x79,0x68,0x77,0x6D,0x27,0x39,0x39,\
-    0x68,0xF7,0x6D,0x47,0x3B,0x39,0x68,\
-    0x77,0x69,0x47,0x39,0x39,0x6E,0x77,\
-    0x6D,0x47,0x31,0x39,0x68,0x77,0x61,\
-    0x47,0x39,0x39,0x78,0x77,0x6D,0x09,\
-    0x48,0x77,0x19,0x77,0x6D,0x47,0x39,\
-    0x39,0x68,0x77,0x6D,0x47,0x39,0x39,\
-    0x68,0x77,0x6D,0x47,0x39,0x39,0x68,\
-    0x77,0x6D,0x47,0x39,0x39,0x68,0x77,\
-    0x6D,0x43,0x4D,0x00,0x36,0x43,0x36,\
-    0x44,0x54,0x45,0x43,0x00,0x49,0x00} // 16384
+    0x00,0x00,0x40,0x00,0x00,0x10,0x24,0x00,0x00,0x10,0x24,0x60,0xBF,0x77,0xD1,0x77,\
+    0x7D,0x1B,0x09,0x05,0x02,0x7D,0xFF,0x77,0x1D,0x39,0x1C,0x05,0x00,0x39,0x78,0xAF,\
+    0x0B,0x61,0x05,0x80,0x05,0x00,0x7D,0x05,0x01,0x1B,0xFD,0x6D,0x11,0x01,0x0C,0x99,\
+    0x37,0x38,0x2A,0xA8,0xBF,0x77,0x7D,0x3C,0xCC,0x7B,0x51,0x05,0x00,0xC1,0xDA,0x0B,\
+    0x02,0xC0,0x0B,0x01,0x23,0x39,0x05,0x01,0x2C,0xC4,0xBA,0x05,0x02,0xC7,0x11,0x02,\
+    0x3D,0x7B,0x11,0x05,0x00,0x3B,0xFF,0x77,0x1D,0x17,0x93,0x09,0x4C,0x77,0x3E,0xFF,\
+    0x88,0xBD,0x0F,0xDE,0x36,0x54,0x5D,0x11,0xFF,0x47,0x29,0x5D,0x6E,0x35,0x38,0x7D,\
+    0x05,0xFF,0x32,0xD0,0x39,0xD4,0x47,0x29,0x65,0x58,0xFE,0x05,0x02,0x2C,0x49,0x78,\
+    0x15,0x7E,0x03,0xEF,0xFF,0xC9,0x28,0x22,0xD3,0x58,0x68,0x88,0xE9,0xED,0x09,0x71,\
+    0x00,0x43,0xBD,0x05,0x01,0x2E,0x3D,0x3D,0xE7,0x38,0x2A,0xAD,0x59,0x01,0x05,0x02,\
+    0xC7,0x11,0x54,0xF6,0x77,0x01,0x1D,0x14,0x05,0x00,0xCD,0x73,0x7A,0x10,0xEF,0x6D,\
+    0x47,0xD9,0x73,0x89,0x01,0xCC,0x5F,0x68,0xDB,0x77,0xBB,0x2F,0x01,0x2B,0x5D,0x05,\
+    0x02,0x29,0x57,0xFE,0xAD,0x00,0x6F,0x6C,0xF7,0x05,0x39,0x0D,0x10,0xDD,0x63,0x05,\
+    0x00,0x0E,0x10,0x7F,0x05,0x00,0x0F,0x10,0xFF,0x7B,0x27,0x27,0x2A,0x94,0x77,0x6C,\
+    0x47,0xFF,0x29,0x45,0x76,0x17,0x77,0x54,0xC5,0x39,0xFF,0x6A,0x77,0x7D,0x3B,0x27,\
+    0x59,0x78,0x64,0x77,0x91,0x47,0x3A,0xE9,0x00,0x73,0x27,0x3F,0xB9,0x01,0xBB,0x3B,\
+    0x27,0x07,0x41,0x74,0x79,0x16,0x6B,0x00,0x3B,0xFD,0x24,0x05,0x02,0x21,0x49,0x6D,\
+    0x58,0x6D,0x37,0xF7,0x35,0x16,0x68,0xAD,0x01,0x17,0x2C,0x4D,0xD1,0x7F,0x47,0x3D,\
+    0x76,0x87,0x77,0x7D,0x0D,0x65,0x00,0x7F,0x13,0x6D,0x21,0x6B,0x45,0x61,0x51,0xD7,\
+    0x01,0xFB,0x6A,0x5F,0x05,0x01,0x68,0x07,0x6D,0x77,0x2C,0xBF,0x16,0x68,0x47,0x7E,\
+    0x0F,0xF9,0x2F,0x03,0x73,0xFF,0x00,0x5D,0x6D,0x5F,0xBC,0x07,0x7D,0x25,0xFF,0x2A,\
+    0x7D,0xBE,0x69,0xE7,0xC9,0x2B,0x23,0xDF,0x3D,0x73,0x6D,0x10,0xB7,0x3B,0x04,0x2F,\
+    0x49,0xB5,0x6F,0x59,0x00,0x38,0x29,0x05,0x64,0xAD,0x41,0x01,0x27,0xF5,0xE2,0x9B,\
+    0x00,0x69,0xD7,0x01,0x19,0x2C,0x3D,0x7D,0xFB,0x20,0x7D,0xE3,0x02,0xC0,0x5F,0x54,\
+    0x3D,0x54,0xAE,0x1D,0x01,0x11,0x59,0x68,0x8B,0x41,0x91,0x05,0x01,0x0B,0xAD,0x69,\
+    0x05,0x02,0x65,0x77,0x4D,0x01,0x6F,0x71,0x06,0xC0,0xF4,0x47,0x03,0xD7,0x00,0x38,\
+    0x29,0x00,0x94,0x08,0xD6,0x39,0x59,0x78,0x6D,0x49,0x47,0x01,0x42,0x91,0x3D,0x40,\
+    0x8B,0x59,0x01,0xBF,0x3B,0x35,0x5E,0x68,0x77,0xC5,0x8F,0x02,0x69,0x6F,0x21,0x39,\
+    0x39,0xF6,0x23,0x01,0x0A,0x28,0x05,0x01,0xDB,0x16,0x88,0x41,0x03,0x13,0x69,0x55,\
+    0x41,0x46,0x59,0xFF,0x0F,0x57,0xC6,0x93,0x3F,0x03,0xB8,0xC5,0x6B,0x49,0x6B,0xB3,\
+    0x00,0x27,0x0D,0x45,0x38,0x82,0x71,0x00,0xFF,0x46,0x88,0x96,0x20,0x5B,0x71,0x06,\
+    0x88,0xFD,0x8A,0x23,0x00,0x80,0x07,0x7F,0x68,0x39,0x49,0xB7,0x65,0x58,0x6D,0x35,\
+    0x01,0x59,0x29,0x7D,0x01,0x3D,0xFF,0x43,0xB8,0xDE,0x5E,0x2A,0x0B,0x6D,0x39,0xFF,\
+    0x39,0x43,0x78,0x05,0x6D,0x75,0x3E,0x29,0xFF,0x5E,0x6F,0x87,0xFA,0x39,0x24,0xE8,\
+    0x6F,0xFF,0xB9,0x9B,0x05,0x39,0x79,0x25,0x2A,0xF9,0xFF,0x7C,0x5C,0x80,0x4D,0xEA,\
+    0x68,0x05,0x39,0x47,0x6B,0x08,0x9D,0x41,0x00,0x2D,0x40,0x41,0x00,0x69,0x41,0x03,\
+    0x8F,0x3D,0xC5,0x54,0xF9,0x2B,0x41,0x47,0x02,0xB9,0x00,0x45,0xBF,0x64,0x10,0x6D,\
+    0xB9,0x3D,0x19,0xB9,0x01,0x29,0xFD,0x89,0xA9,0x40,0x2B,0x39,0x5D,0x68,0x8A,0x85,\
+    0xDE,0xBF,0x03,0x20,0x39,0xC4,0xB6,0x25,0x44,0x6D,0xBA,0x7F,0xED,0x77,0x19,0x39,\
+    0x1C,0x09,0x48,0xCD,0x41,0xFF,0x1C,0xE9,0x59,0x68,0x8A,0xA9,0x6F,0x26,0xFF,0x13,\
+    0x77,0x5B,0x72,0x69,0x26,0x1D,0x37,0xFF,0x51,0x32,0x6F,0x66,0x13,0x37,0x39,0x33,\
+    0xFC,0x99,0x80,0x23,0x02,0x71,0x8F,0x74,0x71,0x6D,0x56,0xFF,0x39,0x70,0x51,0x02,\
+    0x47,0x25,0x11,0x07,0xFF,0x77,0x4D,0x65,0x56,0x39,0x4C,0x3D,0x38,0xFF,0x21,0x3D,\
+    0x49,0x69,0x17,0x25,0x65,0x35,0xFF,0x17,0x79,0x0B,0x6C,0x8B,0xBE,0x73,0xEE,0xFF,\
+    0x10,0x67,0x14,0xBE,0x1B,0xEF,0x57,0x2A,0xFF,0x5F,0xA9,0x6B,0x3D,0x59,0x6B,0xFB,\
+    0x6C,0xFF,0x5D,0x78,0x5F,0x2C,0x9E,0xFF,0x21,0xB3,0xFF,0x25,0xEA,0x37,0x39,0x09,\
+    0x7D,0xC9,0xED,0xFF,0x22,0xCD,0x05,0x7D,0x7F,0x6B,0x47,0x39,0xFB,0x5E,0x7A,0x03,\
+    0x80,0x3F,0x15,0x68,0x57,0x2C,0xFF,0x96,0xFF,0x1B,0x39,0xA4,0xAB,0x57,0xA8,0xFF,\
+    0x6B,0x3D,0x07,0x6D,0x6B,0x26,0x17,0x77,0xFE,0x77,0x04,0x18,0x4B,0x16,0x39,0x96,\
+    0x77,0x6A,0xBF,0x21,0x25,0x0A,0x94,0x77,0x6F,0xAD,0x00,0x7C,0x7F,0x07,0x6D,0x57,\
+    0x16,0x39,0x63,0x44,0xB5,0x41,0x5F,0x60,0x7F,0x94,0x47,0x3C,0xCB,0x00,0x61,0x9B,\
+    0x01,0xEF,0x44,0x82,0x47,0x3F,0x0B,0x00,0x65,0x4F,0xC0,0xEB,0x39,0x6D,0x4D,0xC0,\
+    0x35,0x53,0xC2,0x2D,0x77,0x1D,0xFD,0x57,0x69,0x81,0x64,0x35,0x7D,0x05,0x11,0x39,\
+    0xFF,0x69,0x35,0x45,0x47,0x3B,0x31,0xB8,0x77,0xFF,0x69,0x4F,0xE9,0x39,0x68,0x7F,\
+    0xBD,0x47,0xB5,0x3F,0x23,0x02,0x29,0x83,0xC2,0x36,0x19,0x29,0xC0,0x23,0xFF,0x21,\
+    0x29,0xD4,0x77,0x54,0x56,0x45,0x39,0x77,0x00,0x77,0x6C,0x05,0x00,0x1F,0x77,0x6F,\
+    0x05,0x00,0x77,0x05,0x77,0x6E,0x05,0x00,0x2F,0x77,0x69,0xD7,0xC1,0xFB,0x13,0x70,\
+    0x6B,0x01,0x58,0x6A,0x79,0x16,0x39,0x5F,0x62,0x7F,0x54,0x47,0x3B,0x11,0x00,0x67,\
+    0x37,0x40,0xFF,0x19,0x47,0x6A,0x05,0x39,0x89,0x14,0x75,0xFF,0x6D,0x20,0x33,0x89,\
+    0x14,0x74,0x6D,0x20,0xFF,0x75,0x59,0x68,0x77,0xAF,0x37,0x39,0x29,0x7F,0x6F,0x3D,\
+    0x2D,0x20,0x39,0x39,0xD0,0x83,0x02,0xDF,0x40,0x66,0x3D,0x47,0x38,0x5F,0x00,0x12,\
+    0x56,0x7F,0x79,0x39,0x6A,0x58,0x65,0x37,0x3A,0x15,0x83,0xFF,0x07,0xC0,0x05,0x6D,\
+    0x55,0x39,0x19,0x69,0xFF,0x92,0xE5,0x87,0x05,0x39,0x6C,0x75,0x54,0xEB,0x47,0xC2,\
+    0x53,0x01,0xC6,0x6B,0x01,0x67,0x17,0xB6,0xEA,0x47,0x00,0x17,0x47,0x04,0x07,0xA1,\
+    0x02,0x11,0x39,0x78,0x6B,0x77,0x2D,0x41,0x00,0x69,0x41,0x00,0x39,0x29,0xB9,0x01,\
+    0xF5,0x30,0x47,0x22,0x5A,0x83,0x03,0x77,0x7D,0x47,0x79,0xBF,0x16,0x60,0x07,0x6C,\
+    0x68,0x39,0xEB,0x41,0x79,0xFF,0x91,0x4B,0x68,0x65,0x6D,0x67,0x38,0xDC,0xFF,0xE0,\
+    0xB7,0x51,0x47,0x3D,0x3B,0x51,0x77,0xED,0x96,0x23,0x00,0x62,0xF6,0x15,0x81,0x62,\
+    0x27,0xE2,0xFF,0x69,0x26,0x77,0x1D,0x39,0x1C,0x65,0x45,0xF6,0x61,0x41,0x4F,0x10,\
+    0x55,0x40,0x6C,0x20,0x39,0x38,0xFB,0x2A,0x67,0x1D,0x01,0x67,0xC7,0x51,0x47,0x0D,\
+    0xEB,0x5E,0x64,0x05,0x00,0x0F,0x11,0xC0,0xFB,0x27,0x39,0xFB,0x38,0x42,0x4B,0x83,\
+    0x10,0x49,0x4F,0x80,0x39,0x7D,0x6A,0x95,0x00,0x33,0x2A,0x94,0x77,0x59,0x71,0x01,\
+    0xFB,0x7F,0xC4,0xA3,0x40,0x69,0x3F,0x15,0x45,0xBC,0x5F,0x58,0x68,0x89,0xA5,0x1F,\
+    0xD1,0x01,0x93,0x81,0x81,0xDF,0x0C,0x98,0x20,0x0B,0x73,0x7F,0x41,0x2B,0x5E,0xA7,\
+    0x42,0x7F,0xD4,0x49,0x43,0xCB,0xC0,0x5C,0xE3,0x01,0x31,0xDF,0xC1,0x77,0x68,0x47,\
+    0x38,0x9D,0x42,0x2B,0x71,0xFF,0x10,0x74,0x6D,0x26,0x39,0xC7,0xE6,0x2F,0xBF,0xE2,\
+    0x27,0x39,0x39,0xAC,0x47,0x65,0x01,0x7A,0xF7,0x25,0x2D,0x74,0xE7,0x81,0x7F,0xF7,\
+    0x45,0x3B,0x7F,0xE8,0x14,0x6D,0x47,0x97,0x31,0xD1,0x1B,0x82,0x55,0x62,0x83,0xC0,\
+    0x0D,0x17,0x00,0x45,0x29,0x00,0xE2,0x8F,0x10,0xD5,0x5B,0x8F,0x0E,0x55,0x8F,0x02,\
+    0x03,0x8F,0x02,0x94,0x20,0xD5,0x09,0x8F,0x04,0x40,0x8F,0x08,0x5E,0x8F,0x13,0xC4,\
+    0x96,0x76,0x8F,0x00,0x0D,0x09,0x7F,0x41,0x2B,0x6B,0x28,0x8D,0x82,0x7F,0x7A,0xC7,\
+    0x11,0x45,0xB9,0x5A,0x48,0x3B,0x0D,0x76,0x35,0x05,0x75,0x15,0x35,0x00,0xA0,0x2F,\
+    0xE2,0x3F,0x81,0xAF,0x16,0x6D,0xB9,0x93,0x5B,0x41,0x77,0x9D,0x41,0x65,0xFF,0x14,\
+    0x79,0x5E,0x6E,0x47,0x51,0x45,0x2B,0xDF,0x59,0x40,0x07,0x4D,0x97,0xC5,0xC0,0x1B,\
+    0x6D,0xAD,0x64,0xDD,0x00,0x0B,0x7D,0x41,0x00,0x69,0xB9,0xC0,0x35,0xEA,0xDD,0x00,\
+    0x6B,0xC3,0x82,0x14,0x05,0x00,0x78,0x47,0x51,0xFB,0x44,0x39,0x3B,0x07,0x1A,0x79,\
+    0x5F,0x60,0x3D,0xFE,0x17,0x01,0x7C,0x10,0x6B,0x77,0x05,0x3B,0x7A,0x57,0x17,0x57,\
+    0x67,0xAF,0x43,0xD1,0xAF,0x40,0x6F,0x05,0x00,0xF7,0x6C,0x77,0x6F,0x55,0x44,0x36,\
+    0x0A,0x94,0x75,0x4D,0x13,0xA7,0x01,0x7F,0x85,0x01,0x41,0x2B,0x40,0x38,0xF5,0x00,\
+    0xFD,0x99,0xD5,0x81,0x0C,0x98,0x77,0x05,0x38,0x68,0xFF,0x39,0x18,0x09,0x6F,0xC6,\
+    0x90,0x58,0x60,0xDF,0x68,0x3E,0x16,0x63,0x55,0x2D,0x82,0x55,0x44,0xF3,0x47,0x3B,\
+    0xF5,0xC3,0x05,0x09,0x1F,0x29,0x09,0x6D,0xEF,0x39,0xBB,0x0A,0xAF,0x53,0x00,0x31,\
+    0x47,0x69,0xFF,0x25,0x2A,0x55,0x22,0x22,0xE9,0x0F,0x6D,0x3F,0x4B,0x7E,0x39,0xE9,\
+    0x1A,0x9F,0x29,0x0B,0x05,0x3F,0x78,0x05,0x3F,0x05,0x3F,0x05,0x25,0x77,0x05,0x3A,\
+    0xE8,0x1F,0x42,0xFF,0x37,0x59,0x72,0x6D,0x66,0x77,0x36,0x39,0xBF,0x18,0x68,0x34,\
+    0x16,0x6F,0x5D,0x49,0x41,0x64,0x7F,0x7F,0x78,0x47,0x3F,0x5E,0x4C,0x49,0x93,0x81,\
+    0xDF,0x78,0x25,0x2A,0x74,0xFE,0xA3,0x40,0x7D,0xF9,0xFF,0x45,0x3A,0x48,0x12,0x7D,\
+    0x4F,0xAC,0x39,0xD9,0x6E,0xD9,0x43,0xC5,0xC1,0x62,0xB8,0x29,0x00,0x3C,0x5E,0x57,\
+    0x68,0x76,0x7B,0x17,0x00,0x6D,0x4B,0x85,0x6D,0xD3,0x41,0xFF,0x45,0x57,0x2C,0x89,\
+    0x54,0x77,0x4C,0x25,0xFD,0x27,0x71,0xC0,0xE5,0xF7,0x05,0x39,0x72,0x10,0x7D,0x45,\
+    0x05,0x00,0x48,0x10,0x6D,0x47,0x5F,0x17,0x00,0xFF,0x59,0x20,0x39,0x39,0x00,0x17,\
+    0x6D,0x47,0x55,0xEB,0x0B,0x00,0x56,0x0B,0x00,0x18,0x9B,0xC0,0x07,0x29,0x00,0xF5,\
+    0xF5,0x0B,0xC0,0xD6,0x77,0x02,0x60,0xC9,0x11,0x47,0xEF,0x3B,0x5E,0x6E,0x49,0x69,\
+    0x81,0x46,0x65,0x40,0xFF,0x47,0x38,0x49,0x68,0x67,0x6C,0xF7,0x85,0xFF,0x39,0x68,\
+    0x77,0xDD,0x21,0x23,0x22,0x14,0xBF,0x77,0x7C,0x47,0x3B,0x09,0x6F,0x59,0xC4,0x65,\
+    0xFF,0x39,0x39,0x27,0x69,0xF9,0x11,0x44,0x39,0xAB,0x59,0x6C,0x2F,0x00,0x08,0x23,\
+    0xC0,0x13,0xBD,0x80,0x3A,0xFB,0x59,0x6D,0x4D,0x00,0x1C,0x16,0x6D,0xBA,0xBD,0xFB,\
+    0x17,0x68,0x6B,0x00,0x53,0x58,0x68,0x8A,0xA3,0xFB,0x69,0x39,0x1D,0x00,0x0D,0x37,\
+    0x39,0x29,0x45,0xFF,0x77,0x6C,0x35,0x29,0x8B,0xE8,0x11,0x67,0x7D,0x09,0xC3,0x80,\
+    0x44,0xAD,0x0D,0x39,0x5F,0x6B,0x03,0xC7,0x7A,0x44,0x91,0xC5,0x02,0x53,0x01,0x23,\
+    0x00,0xC9,0x45,0x6F,0x3A,0x68,0x17,0x43,0xF9,0x85,0x5F,0x72,0xFB,0x03,0xDE,0xC3,\
+    0x83,0x11,0x6B,0x79,0x05,0x1D,0x00,0x67,0x79,0xCE,0x8D,0x80,0x17,0x69,0x79,0xCF,\
+    0x81,0x05,0x01,0x79,0x58,0xFF,0x6A,0x26,0x39,0xC3,0xE4,0x2F,0xE2,0x69,0xE7,0x26,\
+    0x13,0x37,0xA5,0x80,0x6D,0x42,0x67,0x05,0xC6,0xFF,0x96,0x77,0x6D,0x97,0x96,0x39,\
+    0x6C,0xC7,0xFF,0xD1,0x47,0x34,0x39,0x68,0x24,0xAD,0x87,0xFA,0xCB,0x01,0x6C,0x5F,\
+    0xC1,0x58,0x6A,0x68,0x3F,0x16,0xFF,0x6D,0x5D,0x42,0x47,0x29,0x1B,0x47,0x77,0xFF,\
+    0x79,0xFD,0xB8,0x5C,0x6C,0x07,0x92,0x27,0xFF,0x79,0x47,0x68,0x57,0x28,0x6B,0x38,\
+    0xA5,0xFF,0xED,0x93,0xE3,0x67,0x38,0xA9,0x6D,0x05,0xFF,0x6E,0x85,0x39,0x73,0xEE,\
+    0x10,0x7D,0x3D,0xFF,0xC6,0xE7,0xF8,0xC9,0xE8,0x21,0x3B,0x47,0xFF,0x68,0x2F,0xE5,\
+    0x14,0xBF,0x5F,0x9A,0x3D,0xFF,0x6C,0x20,0x2D,0x45,0x97,0x07,0x6D,0x57,0xDF,0x29,\
+    0xE7,0xE8,0xC9,0xEB,0x17,0x01,0x25,0xE5,0xFF,0x14,0x38,0x5F,0x86,0x57,0x6A,0x6D,\
+    0x26,0xEF,0x15,0x77,0x59,0x72,0x5F,0x03,0x65,0x16,0x39,0xFF,0x60,0x57,0x42,0x47,\
+    0x35,0x47,0x68,0xE7,0xFF,0xEC,0x67,0x78,0x73,0xE8,0x10,0x49,0x65,0xFF,0x39,0x31,\
+    0x68,0x77,0x6D,0x20,0x33,0x47,0xFF,0x68,0x69,0x75,0x65,0x39,0x6A,0xE9,0x10,0x77,\
+    0x7F,0xA5,0xB0,0x61,0x40,0x75,0x99,0xB9,0x05,0x03,0xFF,0x6A,0xE9,0x11,0x9D,0x67,\
+    0x3E,0x17,0x77,0xFE,0xBF,0x01,0x71,0x8F,0x70,0x41,0x5D,0x16,0x39,0xFF,0x77,0x6B,\
+    0x42,0x47,0x1A,0x13,0x07,0x77,0xFF,0x49,0x63,0x56,0x39,0x40,0x35,0x7F,0x69,0xDF,\
+    0x00,0x39,0x6A,0x76,0x2D,0xD7,0x04,0xBE,0x89,0xFF,0xD4,0x77,0x60,0x47,0x39,0x5B,\
+    0x68,0x77,0xD7,0xBB,0x6F,0x40,0x17,0x01,0x57,0x31,0x41,0x4D,0x20,0xFF,0x3D,0x47,\
+    0x9C,0x17,0x6F,0x39,0xC6,0x2B,0xFF,0x44,0x77,0x6C,0x0D,0x39,0x5E,0x64,0xA5,0x7F,\
+    0x51,0x47,0xEF,0x33,0x69,0x77,0x4C,0x97,0x40,0xF7,0x6A,0xC5,0x6A,0xF7,0x40,0xC0,\
+    0x58,0x66,0x61,0xFE,0x2D,0x81,0x4D,0x59,0x15,0x39,0x69,0x3D,0x7E,0xFF,0x20,0x35,\
+    0xE7,0x54,0x77,0xBB,0x4D,0x3E,0xFB,0x39,0x49,0xAF,0x40,0x3B,0x87,0x6D,0x11,0x2B,\
+    0xFE,0xA9,0x40,0x6E,0x58,0x6D,0x68,0x35,0x16,0x65,0xFE,0x6F,0x81,0x0D,0x98,0x38,\
+    0x82,0x47,0x35,0x2B,0xFF,0x7B,0x10,0x47,0x39,0x39,0x73,0x6E,0x10,0xDF,0x49,0x57,\
+    0x0C,0x41,0x68,0x01,0x40,0x35,0xE9,0xFA,0x35,0x01,0x39,0x35,0x03,0x22,0xE8,0x0F,\
+    0x6D,0x67,0xFF,0x3E,0x6B,0x68,0x09,0x6D,0x59,0x39,0x85,0xFF,0x6F,0x15,0xB1,0x53,\
+    0x85,0x39,0x69,0x65,0xE7,0x79,0x59,0x2A,0x7D,0x0B,0x31,0x40,0x38,0x70,0x9C,0xFF,\
+    0x7F,0x6F,0x0D,0x3E,0x5E,0x6C,0x07,0x99,0xFF,0x27,0x3B,0x49,0x97,0x65,0x41,0x47,\
+    0x38,0xFF,0x73,0x6F,0x10,0x61,0x95,0x05,0x39,0xBE,0xEF,0x7D,0x6C,0x47,0x18,0x27,\
+    0x80,0x6F,0xF5,0x39,0xFF,0x5F,0x68,0x88,0x0B,0x61,0x66,0x13,0x77,0xFF,0x5B,0x72,\
+    0x69,0x26,0x1D,0x37,0x5F,0x32,0xD2,0x29,0xC0,0x1D,0x4F,0x40,0xFB,0x09,0xB8,0xFB,\
+    0x03,0x5A,0x6E,0xFD,0x07,0x6F,0x81,0x04,0x57,0x14,0x47,0x3B,0x38,0xFB,0x28,0x65,\
+    0xC3,0x81,0x48,0x10,0x69,0x37,0xCD,0x3F,0x59,0x6A,0x07,0x92,0x59,0x11,0xDD,0x00,\
+    0xA7,0x00,0xFE,0xDD,0x0A,0x68,0x10,0x51,0x59,0x29,0x73,0x69,0x97,0x10,0x61,0x99,\
+    0x71,0x01,0x6A,0x71,0x03,0xEF,0x00,0x6F,0xCF,0x36,0x9D,0x4F,0x3B,0x17,0x00,0x3B,\
+    0x1A,0x11,0xA9,0xFB,0x67,0x31,0x9D,0x42,0x6F,0xC6,0xB0,0x58,0x6A,0xFE,0x8B,0x54,\
+    0xF3,0x0F,0x57,0xC6,0x8F,0x3F,0x03,0xF7,0xB8,0xC1,0x49,0x43,0x40,0x0F,0x41,0x39,\
+    0x95,0xFF,0x16,0x6D,0xB9,0x0D,0x24,0x06,0x88,0x97,0xBB,0xB8,0xC9,0x05,0x00,0x96,\
+    0xB8,0xC8,0x05,0x00,0x91,0xFB,0xB8,0xCB,0x05,0x00,0x90,0xB8,0xCA,0x71,0x06,0xFB,\
+    0x88,0x8B,0x2F,0x00,0x90,0x07,0x6B,0x68,0x39,0xFF,0x71,0x10,0x77,0x91,0x26,0x39,\
+    0xC7,0x60,0xBF,0x6A,0x03,0xB8,0xC3,0xC6,0x84,0x05,0x00,0xC2,0xBB,0xC6,0x85,0x05,\
+    0x00,0xC5,0xC6,0x86,0x05,0x00,0xC4,0xEB,0xC6,0x87,0x53,0x00,0xDC,0x2F,0x00,0x95,\
+    0x37,0x3F,0xBF,0x16,0x68,0x3F,0x15,0x47,0xC2,0x59,0xC0,0xB1,0xBF,0x5A,0x57,0xC6,\
+    0x92,0x88,0x85,0x05,0x00,0x93,0xBB,0x88,0x84,0x05,0x00,0x94,0x88,0x87,0x05,0x00,\
+    0x95,0xFF,0x88,0x86,0x08,0xD6,0x39,0x58,0x3D,0x43,0xEF,0xB8,0xDE,0x5E,0x7C,0x05,\
+    0x00,0xDF,0x5E,0x66,0x7E,0x05,0x00,0xDC,0x5F,0x66,0x17,0x6B,0x37,0x89,0xC1,0xD5,\
+    0xFD,0x05,0x02,0xE7,0x77,0x00,0xB7,0x53,0x00,0xD9,0x49,0x7F,0x6B,0x58,0x6D,0x37,\
+    0x27,0x16,0x68,0xB3,0xC0,0xFF,0xB5,0x76,0x87,0x77,0x7D,0x0D,0x17,0xC6,0xF7,0xB7,\
+    0x10,0x2F,0x05,0x00,0x8A,0x10,0x51,0x67,0x7F,0x17,0xC6,0x84,0x55,0x43,0xB8,0xC9,\
+    0xC3,0xAB,0x7F,0x6A,0x7E,0xC6,0x9C,0x17,0x7F,0x68,0x3B,0x00,0xFD,0x58,0x3B,0x00,\
+    0x58,0x68,0x8B,0xF9,0x6A,0x79,0xEF,0xC6,0x9C,0x27,0xE2,0x4D,0x00,0x80,0xE7,0xC3,\
+    0xFF,0xB8,0xCD,0x7D,0xE8,0xE6,0xED,0x15,0xB9,0xFF,0x2A,0xA8,0x77,0x7D,0x24,0xD9,\
+    0x49,0x69,0xFE,0x2F,0xC0,0x67,0x77,0x1D,0x39,0x3B,0xB8,0xC9,0x6F,0x16,0x65,0x58,\
+    0x61,0xE5,0x57,0x38,0x6A,0xAD,0x00,0xFD,0xCE,0x01,0x42,0x3C,0x16,0x68,0x07,0x61,\
+    0x68,0xB5,0x39,0x59,0x00,0xB7,0xE9,0x00,0x78,0x67,0xF7,0x40,0x45,0xFF,0x76,0x24,\
+    0x6D,0x21,0x39,0x39,0xBC,0x3D,0xFE,0x0B,0x01,0x75,0x10,0x6D,0x47,0xF3,0x73,0x46,\
+    0xFF,0x88,0x9A,0x20,0x1D,0x29,0x51,0x77,0x7D,0xFF,0x3B,0x23,0x89,0x46,0x88,0x97,\
+    0x21,0x21,0xFA,0x0B,0x02,0x22,0x0B,0x00,0x96,0x21,0x35,0x2A,0x94,0xBF,0x77,0x6C,\
+    0x47,0x29,0x5A,0x8A,0xD9,0x40,0x91,0xFD,0x73,0x17,0x00,0x23,0x19,0x5E,0x4E,0x05,\
+    0x6D,0xFD,0x6D,0x17,0xC0,0x0B,0x75,0x57,0x0C,0x21,0x68,0xEF,0x7D,0x6D,0x47,0x18,\
+    0xE1,0x80,0x47,0x5C,0xB9,0xFF,0x21,0x68,0x57,0x6C,0x15,0x39,0x4B,0x68,0xFF,0x65,\
+    0x6D,0x67,0x38,0x62,0x28,0x1A,0x8F,0xFD,0x05,0x65,0xC0,0x14,0x8F,0x26,0x39,0xC4,\
+    0x06,0xFF,0x5F,0x2D,0x0D,0xB5,0x5E,0x00,0x5D,0x11,0xFF,0x47,0x29,0x42,0x94,0x5D,\
+    0xE1,0x7A,0x45,0xDF,0x39,0x6D,0x88,0x99,0x6F,0x41,0x00,0x03,0x4D,0xBF,0x68,0x34,\
+    0x16,0x64,0x58,0x51,0x89,0x00,0x70,0xFE,0xB3,0x00,0xCD,0x77,0xD1,0x77,0x7D,0x60,\
+    0x39,0xFB,0x1A,0xA4,0x7D,0x00,0x3D,0x49,0x68,0x47,0x43,0xB7,0xB8,0xCD,0x1A,0xFB,\
+    0x00,0x3B,0x31,0x6D,0x41,0x68,0xEB,0x2C,0x16,0x95,0x01,0x3D,0x05,0x02,0x31,0x7B,\
+    0xCF,0xF6,0x71,0xC1,0x73,0xC0,0x71,0xC0,0x29,0x73,0x68,0x11,0x7D,0x61,0xA9,0x40,\
+    0x62,0x64,0x91,0x47,0x38,0x71,0x01,0xBF,0x37,0x38,0x11,0x37,0x5D,0x32,0x2B,0x63,\
+    0x39,0x7F,0xDE,0x6A,0x11,0x47,0x38,0xC6,0x90,0x05,0x00,0x77,0xC0,0xC6,0x91,0x1F,\
+    0x41,0x5A,0x88,0xB7,0x05,0x01,0x7D,0x8A,0x05,0x02,0x89,0x6A,0x2D,0xB8,0xC3,0xF5,\
+    0x04,0x7F,0x48,0x05,0x6D,0x57,0x0F,0x21,0x90,0xEF,0x05,0xAF,0x5A,0xB9,0x21,0x90,\
+    0xEF,0x07,0x6E,0xEF,0x00,0x26,0xFF,0x39,0xC5,0xEC,0x5D,0x2D,0x0D,0xB4,0x5E,0xDB,\
+    0x36,0x5F,0xE9,0x02,0x5F,0xE0,0xE9,0x00,0x6B,0x88,0x39,0x9B,0x2B,0x41,0xE9,0x00,\
+    0x35,0x16,0x65,0xED,0x81,0x97,0x40,0xFF,0x9B,0x09,0x80,0x39,0x78,0x50,0x6D,0x64,\
+    0xFD,0xF4,0x43,0x40,0x69,0x37,0x39,0x09,0x46,0x88,0xD7,0x9B,0x64,0xF9,0x0B,0x00,\
+    0x65,0xA3,0x41,0x58,0x79,0xED,0x68,0x37,0x40,0x0B,0x69,0x05,0x02,0x65,0x05,0x9E,\
+    0x76,0x13,0x41,0x0D,0x91,0x6F,0x82,0x39,0x5E,0x6C,0xB3,0x00,0x57,0x3B,0x49,0x69,\
+    0xE9,0xC2,0x36,0x5F,0xC2,0x98,0xF5,0x03,0xFF,0x13,0x4D,0x5A,0x45,0x39,0x76,0x88,\
+    0x95,0xB2,0xAB,0x80,0x9F,0x53,0xC2,0xAB,0x86,0xBD,0xD9,0xAB,0x84,0x9F,0xBF,0x10,\
+    0x67,0x54,0xC5,0x39,0x69,0xCB,0x01,0x59,0x5D,0x2A,0xEF,0x00,0xA3,0xC6,0x90,0x27,\
+    0x86,0x3D,0x29,0xC2,0x9F,0xA3,0x58,0x68,0x8D,0xDF,0x83,0x01,0x05,0xC0,0xC3,0xFF,\
+    0x5F,0x70,0x67,0x43,0xB8,0xC2,0x6A,0x68,0xED,0x11,0x3B,0x0D,0x6E,0x35,0x19,0x40,\
+    0x5D,0x48,0x39,0xDF,0x33,0x09,0x4C,0x77,0x3E,0x71,0x00,0xDE,0x3A,0xFF,0x64,0x16,\
+    0x6D,0xB8,0x4F,0x58,0x68,0x8C,0xFF,0xEB,0x6D,0x79,0x73,0xE5,0x10,0x61,0x75,0xFE,\
+    0xB9,0x00,0x13,0x65,0xF5,0x45,0x39,0x6C,0x13,0x7A,0x47,0xC3,0xDD,0xE9,0x01,0x0C,\
+    0x91,0x7A,0x40,0x17,0x01,0xEF,0xB8,0xC7,0x13,0x14,0x47,0x00,0x11,0x25,0x7D,0xFF,\
+    0x47,0x6C,0x97,0x05,0x39,0x96,0x6D,0xED,0xFD,0x0D,0x2F,0x01,0x4D,0x20,0x11,0x47,\
+    0x68,0x3D,0xF7,0x03,0xB8,0xC7,0x67,0x41,0x55,0x3E,0x29,0x5D,0xFF,0x6F,0x6D,0x4D,\
+    0x39,0x39,0x49,0xA7,0x51,0xFF,0x47,0x13,0x22,0xE8,0x6F,0x6D,0x15,0x3E,0xFF,0xF7,\
+    0x14,0x77,0x92,0xF9,0x57,0xC6,0x96,0x4B,0x12,0x8D,0x39,0x84,0x05,0x53,0x01,0x55,\
+    0x44,0xC7,0x39,0x8E,0xD9,0xC7,0x39,0x83,0x2D,0x81,0x3C,0xC5,0x39,0x91,0x55,0x6D,\
+    0xFB,0x5D,0xBF,0x19,0x40,0x4D,0x0D,0x38,0x5F,0x64,0xFE,0x39,0x84,0x8C,0x37,0x38,\
+    0x59,0x6A,0x07,0x6D,0xEF,0x6B,0x26,0x17,0x77,0x61,0x46,0x48,0x77,0x19,0xDB,0x39,\
+    0x1C,0xAF,0x41,0x37,0x25,0x05,0x01,0x5B,0x41,0xB6,0x05,0x01,0x5D,0x29,0x05,0x01,\
+    0x2B,0x5D,0x05,0x02,0x29,0xAD,0x15,0x05,0x00,0x1B,0x6D,0x0D,0x40,0x19,0x19,0x41,\
+    0x55,0x6D,0x78,0x5F,0x01,0x07,0x00,0x05,0x01,0x70,0x84,0x05,0x01,0xFB,0x1E,0xD8,\
+    0x47,0x05,0x65,0x56,0x39,0x6C,0x57,0xFF,0x02,0x47,0x31,0x29,0x47,0x77,0x62,0x0D,\
+    0x7F,0xB0,0x5E,0x66,0x3D,0x6D,0x20,0x33,0x4B,0x80,0xF7,0x92,0x55,0xE1,0xC3,0x80,\
+    0x9B,0x09,0x4C,0x19,0xFF,0x07,0x77,0x69,0x57,0x16,0x39,0x63,0x3D,0x7F,0xE5,0x20,\
+    0x37,0x73,0x68,0x10,0x67,0x1F,0x40,0x7F,0x97,0x35,0x75,0x0D,0x39,0x5F,0x9E,0x41,\
+    0x03,0xFF,0x3F,0x8A,0x48,0x35,0x25,0x47,0x77,0x72,0xFF,0x6F,0x56,0x39,0x48,0x7F,\
+    0x54,0x47,0x3D,0x7E,0x77,0x00,0x64,0x20,0x39,0x38,0x7C,0x55,0x6F,0x80,0xFF,0x7B,\
+    0x20,0x5D,0x24,0x37,0x39,0x29,0x6E,0xFF,0x9E,0xE5,0x9C,0xF9,0x43,0x68,0x6D,0x40,\
+    0xF7,0x47,0x3B,0x11,0x59,0x00,0xBC,0x39,0x19,0x6D,0xFF,0x9E,0xE5,0x67,0x79,0x49,\
+    0x60,0x9E,0xE5,0xFF,0x55,0x09,0x71,0x69,0xB7,0xD1,0x47,0x39,0xFF,0x39,0x98,0xB5,\
+    0xD1,0xB8,0xC6,0xC6,0x67,0xFF,0xF5,0xED,0x56,0xB8,0x71,0x69,0x59,0x51,0xFF,0x47,\
+    0xC6,0xC2,0x6A,0xCD,0x11,0x47,0x37,0xFF,0x5F,0x44,0x57,0x68,0xAE,0xB1,0x19,0x28,\
+    0x7B,0xA6,0xAA,0x47,0x03,0x94,0xF9,0x09,0x79,0x2F,0x01,0xFF,0x3E,0x97,0x9C,0xE5,\
+    0x75,0x29,0xF9,0xD4,0xFF,0x77,0x6D,0xB8,0xD9,0xFB,0xD4,0x88,0x92,0xFF,0x47,0x26,\
+    0xBB,0xE8,0x47,0xEC,0x67,0x3C,0xFF,0xD0,0xE0,0x55,0x2D,0x45,0x48,0xC6,0x87,0xFB,\
+    0x0F,0x6D,0x05,0x00,0x98,0x0F,0x6D,0x37,0x31,0xFF,0x2B,0x59,0x3F,0x6C,0x87,0x85,\
+    0x39,0x68,0xFF,0x77,0x62,0x85,0x85,0xC6,0x97,0x88,0x9D,0xFF,0xC5,0xB9,0x2A,0xE9,\
+    0x3F,0x6C,0x39,0x39,0x7F,0x73,0x45,0x77,0x6B,0x20,0x11,0x1B,0x8F,0x01,0xFF,0x3F,\
+    0x15,0x6D,0x9E,0xE3,0x67,0x7F,0xE8,0xFF,0xAF,0xA6,0xAC,0x57,0x8D,0x41,0x68,0x57,\
+    0xFF,0x6A,0x15,0x39,0x47,0x68,0x69,0x6D,0xF9,0xFF,0x14,0x39,0x6E,0x12,0x85,0x67,\
+    0x3E,0x68,0xEF,0x28,0x1B,0x4D,0x65,0xF5,0x00,0x8C,0x6B,0x6B,0xFF,0x3C,0xD0,0xE6,\
+    0x57,0x2B,0x96,0xFE,0xE8,0xFF,0xA9,0x35,0x7D,0x67,0x3E,0x6B,0x68,0x09,0xFF,0x6D,\
+    0x59,0x39,0x19,0x6F,0x26,0x2D,0x2A,0xB5,0xD3,0xD1,0x04,0x64,0xD1,0x15,0x07,0x6C,\
+    0x23,0xC0,0x68,0xFF,0x5F,0x72,0x6D,0x26,0x15,0x77,0x59,0x72,0xCF,0x6F,0x66,0x13,\
+    0x37,0x3D,0x42,0xAB,0x80,0x68,0x3F,0xDF,0x25,0x46,0x77,0x66,0xFB,0x39,0x80,0x11,\
+    0x43,0xFF,0x67,0x45,0x39,0x97,0x8D,0xCD,0x57,0x11,0xEF,0x39,0x69,0x93,0xE5,0xB3,\
+    0x02,0x6C,0x6A,0x79,0xFF,0xC6,0x94,0x57,0x11,0x47,0xC6,0xC3,0xC8,0xAF,0x7F,0xC5,\
+    0x47,0x3B,0xED,0x80,0x54,0x05,0x00,0x78,0xFF,0x14,0x85,0x27,0x39,0x38,0xF0,0xCB,\
+    0x51,0xEF,0x47,0x28,0x5F,0x46,0x1D,0x03,0x67,0x45,0x47,0xF7,0x38,0xDB,0xE0,0x77,\
+    0x02,0x69,0x5A,0x2D,0xB8,0xFB,0xC5,0x19,0x99,0x80,0xBD,0x99,0x31,0xC0,0x77,0xF5,\
+    0x6C,0x45,0x80,0x51,0x05,0x00,0x29,0x5A,0x80,0x17,0x7F,0x6D,0x46,0x5D,0x31,0x51,\
+    0x77,0x69,0x0F,0x80,0xFF,0x61,0x10,0x6D,0x46,0x61,0x16,0x65,0x58,0x7F,0x61,0x68,\
+    0x3E,0x49,0x68,0x67,0x6B,0x61,0x42,0xBD,0x91,0x73,0x40,0x68,0x49,0x7D,0x89,0x77,\
+    0x01,0x92,0xFF,0xAF,0xBE,0x49,0x6A,0xC7,0xEA,0x21,0x39,0xFB,0x39,0xEE,0x8B,0x43,\
+    0x07,0x6D,0x57,0x3F,0xD0,0x7F,0xE0,0x5D,0x2D,0x6F,0x74,0xE0,0x94,0x31,0x41,0x7F,\
+    0x16,0x64,0x47,0x58,0x3F,0x39,0xD3,0x71,0x02,0xFF,0x3E,0x97,0x05,0x6A,0x85,0x39,\
+    0x16,0x69,0xFE,0x11,0x09,0x91,0xE5,0x35,0x39,0x2B,0x68,0x58,0xFD,0x6C,0xA5,0x82,\
+    0xFD,0x39,0x39,0x27,0x68,0x38,0xEF,0x82,0x47,0x35,0x87,0x95,0x00,0x20,0x39,0x39,\
+    0x7F,0xAA,0x3D,0x6A,0x2C,0x39,0x39,0xD4,0xB9,0x00,0xFF,0x29,0x7B,0xC8,0x57,0x6A,\
+    0x97,0xB9,0x1B,0xFF,0x68,0xA7,0xED,0x95,0xB9,0xDC,0xE0,0xA5,0x7F,0xED,0x96,0xF8,\
+    0x13,0x38,0x3D,0xE0,0x23,0x00,0xFD,0xF6,0x9B,0x01,0x77,0xFD,0x27,0xE2,0x27,0x39,\
+    0xFF,0x39,0xFA,0x07,0x65,0xF7,0xBE,0x5F,0x68,0xD7,0x77,0x1B,0x69,0x85,0x41,0x6F,\
+    0x09,0x83,0x6D,0x79,0xF7,0x11,0x25,0xAE,0xB3,0x01,0x6E,0x58,0x61,0x77,0xEF,0x0C,\
+    0x41,0x68,0x9D,0x31,0x42,0x70,0x92,0x35,0xF3,0x3E,0xFB,0x77,0x00,0x11,0x09,0xA1,\
+    0xB1,0x4B,0x68,0x6F,0x65,0x6D,0x68,0x38,0x8F,0xC1,0x07,0xA9,0xD9,0x41,0xDF,0x08,\
+    0xD6,0x39,0x64,0xC9,0x37,0x40,0x5E,0x5E,0xBF,0x07,0x12,0x87,0x3E,0x17,0x68,0x89,\
+    0x02,0x38,0xFF,0x57,0x6A,0xAE,0xB1,0xE8,0xA8,0x5D,0x3D,0xEF,0x0D,0xB4,0x5E,0x76,\
+    0x7D,0x06,0x2D,0x49,0x6E,0xFE,0x07,0x40,0x37,0x2A,0xAE,0x77,0x7D,0x2B,0x31,0xFC,\
+    0x49,0x40,0x3D,0x40,0x5A,0x80,0x07,0x6D,0x77,0x00,0xFA,0xA9,0x40,0xE7,0x9D,0x41,\
+    0x07,0x92,0x4A,0xB9,0xF8,0xF5,0x11,0x6D,0x40,0x9D,0xA1,0xC3,0x15,0x77,0x39,0x33,\
+    0xFE,0x77,0xC1,0x39,0x3B,0x47,0x39,0x16,0x6F,0x58,0x57,0x6B,0x68,0x3C,0xDF,0x41,\
+    0x6D,0xB9,0x01,0x6D,0xB9,0x03,0xAA,0x27,0x80,0x6C,0x27,0x81,0x61,0x27,0x8E,0x61,\
+    0xF9,0x84,0x75,0xDF,0x1D,0xB8,0xD6,0x41,0x68,0x73,0x40,0x17,0x39,0xDF,0x7B,0x65,\
+    0x5D,0x1F,0x38,0xE7,0x81,0x47,0x36,0xFE,0xE7,0x81,0xB8,0xC9,0xBB,0xE8,0x66,0xEC,\
+    0x1F,0xFF,0x38,0x19,0x46,0x77,0x61,0xAC,0xB1,0x0B,0xB7,0x58,0x0F,0x6D,0xE3,0x01,\
+    0x88,0x8D,0xDB,0x81,0x77,0x5F,0x72,0xC5,0xB9,0x08,0xE9,0xF9,0x80,0x49,0xFF,0x82,\
+    0xFD,0x49,0xFF,0x81,0x0D,0x17,0x39,0x7F,0x10,0x61,0xBF,0x37,0x39,0x34,0xA8,0xF6,\
+    0x14,0x27,0x80,0xCA,0x7F,0x17,0x67,0x37,0xC6,0x34,0xE8,0xB6,0x0B,0x02,0xDF,0x5D,\
+    0x72,0x6B,0x26,0x17,0xAD,0x03,0x3E,0x77,0xFF,0x6D,0x68,0x3E,0x16,0x6E,0x58,0x68,\
+    0x5B,0x8F,0x17,0x39,0x63,0x5D,0x83,0x01,0x7D,0x01,0xF1,0x40,0x57,0x5F,0x2D,0x37,\
+    0x31,0xD0,0xE0,0x83,0x06,0xC9,0x83,0x02,0xF5,0x36,0x83,0x03,0x17,0x3B,0xC1,0x3B,\
+    0x49,0x69,0x9E,0x5F,0xE5,0x75,0x09,0x41,0x68,0xCB,0x02,0x78,0xCB,0x02,0x9F,0x87,\
+    0xF5,0xED,0x76,0xB8,0xBF,0x3F,0xBF,0x29,0x88,0xFF,0x95,0x0F,0xDE,0x06,0x6C,0x6A,\
+    0x11,0x47,0xFF,0x39,0xC6,0x97,0x63,0x51,0x47,0x39,0x45,0xFF,0x68,0x0D,0x6D,0x71,\
+    0x05,0x3E,0x97,0x49,0xDF,0x51,0x40,0xC6,0x31,0x91,0xFF,0x80,0xC6,0xC3,0xF7,0xE8,\
+    0x35,0x54,0x05,0x00,0xEE,0x7F,0x94,0x47,0xF5,0x3D,0xBB,0x40,0xED,0x8B,0x40,0x46,\
+    0x77,0x67,0xA8,0x57,0xB1,0x2B,0x51,0xBB,0x40,0xBE,0xA1,0x02,0xB9,0xA1,0x02,0xDF,\
+    0x46,0xBB,0xE8,0x64,0xAC,0x29,0x00,0xEF,0x5D,0xFA,0x59,0xC1,0xE1,0xC5,0x02,0x60,\
+    0x9A,0xE5,0x55,0x2C,0xFA,0x23,0x02,0xF9,0x23,0x02,0x06,0xBB,0xE8,0x6D,0xEC,0xBE,\
+    0x41,0x02,0x66,0xA0,0xB1,0x2B,0x7D,0xFB,0x02,0x50,0xBE,0xFB,0x02,0xAF,0xF5,0xED,\
+    0x5D,0xB8,0x53,0xC0,0x43,0xAB,0x47,0x35,0x17,0x04,0x6F,0x17,0x02,0x90,0x17,0x01,\
+    0x2A,0xF7,0x86,0x77,0x64,0x53,0x00,0xE0,0x07,0x6A,0x55,0xEA,0x3F,0x81,0xEA,0xE3,\
+    0xC2,0x6A,0xFB,0x01,0x88,0x95,0xC5,0x77,0xB9,0x2A,0xA9,0x89,0x01,0x41,0x68,0x55,\
+    0x77,0x00,0xF7,0xC2,0x6A,0x55,0x85,0x42,0x57,0x69,0xAE,0xB1,0xFF,0x13,0x28,0x75,\
+    0x58,0x47,0x36,0x21,0x69,0xFF,0x57,0x20,0x96,0xF0,0x3B,0x38,0x88,0x82,0xFF,0x67,\
+    0x3D,0x6B,0x68,0x0F,0x6D,0x5F,0x39,0xFF,0x81,0x14,0x77,0x62,0x2A,0xE7,0x19,0x54,\
+    0x7F,0x77,0x6D,0x40,0xC6,0xD2,0xE0,0x45,0xDD,0x01,0xED,0xF8,0x71,0x01,0xC6,0x88,\
+    0x71,0x01,0x39,0x77,0xF5,0xF7,0xED,0x74,0xF8,0x65,0x00,0xFD,0x37,0x3E,0x0B,0xEA,\
+    0xE3,0x01,0xA9,0xBF,0x02,0x3E,0xBF,0x02,0xC1,0xBB,0xE8,0xED,0x44,0xE3,0x01,0xF8,\
+    0x57,0x2B,0x40,0x46,0x97,0x94,0xAB,0xE5,0x75,0x8F,0x01,0xFF,0x8B,0x42,0x93,0x8B,\
+    0x42,0x6C,0x77,0xC5,0xB9,0x0A,0x8F,0x01,0xAB,0x41,0x68,0x07,0x40,0xDF,0x29,0x7B,\
+    0xF0,0x57,0x69,0xA7,0xC9,0x4B,0x0C,0xFF,0x39,0x66,0x6F,0x6F,0x21,0x25,0x73,0x46,\
+    0xFF,0x88,0x92,0x20,0x35,0x0B,0x5D,0x6F,0x6D,0xFF,0xFC,0x78,0x7F,0x29,0xB1,0x2C,\
+    0x27,0x33,0xFD,0x03,0x0B,0x00,0x5A,0x45,0x39,0x69,0x88,0x92,0xFE,0xA7,0x05,0x19,\
+    0x6C,0x2E,0x2D,0x2A,0xF9,0x49,0xA7,0x68,0x47,0x6E,0xF1,0x40,0x89,0x01,0xAD,0x89,\
+    0x01,0xB8,0xED,0xD9,0x89,0x01,0x47,0x26,0x89,0x04,0xFC,0x07,0x6A,0xD2,0x83,0x02,\
+    0xF9,0x13,0x4B,0x83,0x02,0xAD,0xE3,0x01,0x38,0xC6,0x55,0xDA,0xE3,0x03,0xFE,0xE3,\
+    0x02,0x96,0xE3,0x02,0x69,0xE3,0x04,0x77,0xFB,0x67,0x45,0x5F,0xC0,0x8D,0x37,0x3D,\
+    0xAB,0x80,0xFB,0x45,0x47,0xAB,0x8D,0x2C,0x47,0x38,0x13,0x14,0xCE,0xAB,0x80,0xDB,\
+    0x3B,0x3D,0x3D,0x40,0x29,0x03,0x31,0x2B,0xD7,0x40,0x77,0x6C,0x6B,0x02,0x62,0x6B,\
+    0x02,0x9D,0xC5,0xFF,0xB9,0x28,0x29,0x77,0x6C,0x37,0x39,0x09,0xCF,0x6D,0x9C,0xE5,\
+    0x75,0xEB,0x42,0xA1,0x07,0x4D,0xEC,0xFF,0x45,0x6C,0xC6,0x87,0x75,0x38,0xB8,0xC9,\
+    0xEF,0x39,0x11,0x37,0x6D,0x7B,0x81,0x0D,0x6D,0x6D,0xFF,0x45,0x39,0x78,0x35,0xF5,\
+    0x67,0x3C,0xE9,0xFF,0xE8,0x51,0x6D,0x97,0xB9,0xEF,0xE8,0x92,0xFF,0xE5,0x91,0xB9,\
+    0x35,0x5D,0x77,0x62,0x7F,0xFF,0x3B,0x5F,0x72,0x3D,0x6F,0x20,0x37,0x0F,0xFF,0x5D,\
+    0x4F,0x6D,0x75,0x3A,0x84,0x29,0x31,0xFF,0x2C,0x89,0x78,0x59,0x60,0x4B,0x58,0x7F,\
+    0xFF,0x39,0x2D,0x54,0x77,0x6C,0x67,0x3C,0x6B,0x5E,0x99,0x80,0x5D,0x39,0x19,0x6D,\
+    0x13,0x40,0xFB,0x13,0x40,0x55,0x6A,0x13,0x44,0xA1,0x13,0x50,0xF0,0x13,0x44,0xF5,\
+    0x13,0x50,0x55,0xA1,0x13,0x4A,0xF2,0x13,0x50,0xF7,0xE9,0x02,0x9D,0x13,0x5C,0x55,\
+    0xCB,0x13,0x46,0x9D,0x13,0x58,0x6E,0x13,0x5B,0xF7,0x13,0x42,0xBF,0x09,0x6D,0x53,\
+    0x05,0x39,0x66,0x2D,0x82,0x20,0xFF,0x57,0x6A,0xAE,0xB1,0x25,0x5D,0x7F,0x6F,0xEF,\
+    0xFB,0x3B,0x5E,0x64,0x0B,0x01,0x31,0x5D,0x77,0xFF,0x6D,0x4F,0x3C,0x5E,0x4A,0x07,\
+    0x6C,0x68,0xFF,0x39,0x49,0x60,0x58,0x6D,0x67,0x74,0x19,0xEF,0x6F,0x9E,0xE5,0x96,\
+    0x15,0x81,0x7D,0x68,0x39,0xFF,0x16,0x6E,0x16,0x6D,0xBC,0x45,0x76,0x87,0xFF,0x77,\
+    0x7D,0x27,0x27,0x7B,0xCF,0x07,0x65,0xEF,0x68,0x39,0x19,0x25,0x35,0x01,0xE8,0xA8,\
+    0x07,0xFF,0x6D,0x77,0x29,0x16,0x68,0x58,0x6B,0x26,0xFF,0x39,0xC2,0x34,0x38,0x82,\
+    0x47,0x29,0x19,0xFF,0x6F,0x25,0x6D,0x39,0x39,0x27,0x68,0x57,0xBF,0x6A,0x1C,0x79,\
+    0x54,0xF2,0x0B,0x71,0x01,0x67,0x5E,0x9F,0x84,0x6B,0x97,0xB9,0x13,0x9F,0x80,0x9D,\
+    0x9F,0x80,0xFF,0xAD,0xED,0x59,0x0C,0x61,0x6A,0xC9,0x6F,0xFF,0x20,0x19,0x87,0x54,\
+    0x77,0x63,0x20,0x23,0xFF,0x49,0x69,0x58,0x6D,0x37,0x31,0x16,0x68,0xFE,0x4D,0x00,\
+    0x0C,0x61,0x68,0x58,0x6D,0x68,0x3E,0xFF,0x58,0x68,0x8D,0x0D,0x08,0xD6,0x39,0x78,\
+    0xFF,0x57,0x6B,0x15,0x39,0x45,0x68,0x6B,0x6D,0xFF,0x67,0x3F,0x60,0x28,0x1A,0xD1,\
+    0x77,0x05,0xEF,0x3E,0x88,0xB7,0x14,0xCB,0x00,0xEC,0xF7,0x11,0x6F,0x45,0x59,0x0A,\
+    0xA8,0x67,0x40,0xBD,0x19,0x25,0x40,0xAF,0xBD,0xB9,0x49,0x6F,0x43,0x46,0x36,0x43,\
+    0x42,0xC9,0xFE,0x43,0x47,0xBD,0xBF,0x3B,0x7D,0x77,0x9E,0x45,0xFF,0x2C,0x39,0x94,\
+    0x7F,0xB8,0x47,0x3F,0x31,0x7F,0xBD,0x77,0x6A,0x4F,0x80,0x39,0x6C,0x35,0x01,0xFF,\
+    0x31,0x91,0x77,0x69,0x47,0x29,0x55,0x61,0xFF,0x53,0x72,0x61,0x26,0x11,0x77,0x5D,\
+    0x72,0xFF,0x6B,0x26,0x17,0x77,0x5D,0x32,0x09,0x67,0xFF,0x77,0x1D,0x39,0x1C,0x05,\
+    0x00,0x39,0x78,0xFB,0x1B,0x65,0x79,0x40,0x78,0x1B,0x64,0x4F,0xA9,0xFF,0x39,0x6F,\
+    0x7F,0xFD,0x47,0x3C,0x31,0xF8,0xDB,0x77,0x6B,0x0B,0x00,0x6C,0x55,0xD1,0x00,0x07,\
+    0xF6,0xFF,0xE8,0x91,0x47,0x39,0x39,0x60,0x57,0x22,0xEF,0x67,0xE0,0x09,0xB1,0x1F,\
+    0x40,0x25,0x69,0xE7,0xFF,0x39,0x18,0x45,0x3A,0x39,0x6B,0x75,0x6D,0xFF,0x09,0x48,\
+    0x77,0x19,0x58,0x6A,0x59,0x16,0xFF,0x39,0x63,0x57,0x02,0x47,0x35,0x73,0x51,0xFF,\
+    0x77,0x7D,0x2C,0xC7,0x5F,0x6E,0x07,0x6D,0xFF,0x27,0x39,0x39,0x02,0x7F,0x54,0x47,\
+    0x3E,0xFF,0x39,0x78,0x04,0x98,0x20,0x39,0x39,0x34,0xEF,0x07,0x6D,0x57,0x3E,0x3D,\
+    0x40,0x65,0x68,0x05,0xFE,0x65,0x00,0x4D,0x09,0x80,0x39,0x78,0x43,0x9D,0x2D,0x89,\
+    0xEB,0x40,0x44,0xAA,0x95,0x00,0x72,0x4F,0x40,0x3B,0x02,0xFF,0x2B,0x29,0x5E,0x62,\
+    0x64,0x91,0x47,0x38,0x6E,0x35,0x00,0x9B,0x27,0x23,0x11,0x01,0x24,0xC9,0x11,0x02,\
+    0xFD,0x3D,0x11,0x02,0x31,0x2A,0x94,0x77,0x6E,0x47,0xDF,0x29,0x4A,0x9E,0x7F,0xD4,\
+    0x59,0x03,0x37,0x38,0xFF,0x59,0x6A,0x07,0x6D,0x69,0x26,0x77,0x1D,0xFF,0x58,0x6A,\
+    0x68,0x3F,0x27,0x47,0x77,0x62,0x6F,0x67,0x56,0x39,0x78,0xB3,0x01,0x7B,0xF0,0x71,\
+    0x01,0xD7,0xE9,0xE8,0x55,0x11,0xC0,0xEB,0x11,0xC0,0x95,0xB9,0xFF,0x17,0x69,0x4B,\
+    0x5C,0x3F,0x39,0x85,0x14,0x9F,0x75,0x2C,0x21,0x37,0x7B,0x6B,0x02,0x05,0x01,0x24,\
+    0xFF,0xC9,0x59,0x76,0xCB,0x11,0x40,0xD9,0x5F,0xD7,0x78,0x35,0x54,0x89,0x00,0x78,\
+    0x7D,0x03,0x14,0x9D,0xFA,0x6B,0x02,0x6C,0x11,0x01,0x58,0x65,0x37,0x39,0x29,0xFF,\
+    0x59,0x0F,0x6B,0x68,0x39,0x77,0xD1,0x77,0x5F,0x7D,0x05,0xC9,0x69,0xE7,0xD7,0x00,\
+    0x3C,0xD7,0x02,0xE7,0x71,0x47,0x68,0xF3,0x80,0xBF,0x00,0x10,0x45,0x6B,0xDF,0x05,\
+    0x39,0x68,0x70,0xB9,0x43,0x42,0x4D,0x65,0xFE,0x05,0x00,0x13,0x45,0x54,0x89,0x41,\
+    0x68,0x0F,0xFF,0x6D,0x67,0x3E,0x6B,0x28,0x09,0x6D,0x79,0xFF,0x39,0x8B,0x2F,0x14,\
+    0x69,0xF9,0xBF,0x54,0xC1,0x82,0xB9,0x00,0x3B,0x02,0xC9,0x80,0x09,0x80,0x07,0x41,\
+    0x50,0xF5,0xFF,0x1F,0xB6,0x15,0x77,0x59,0x72,0x09,0x4C,0xF7,0x16,0x65,0x5D,0x43,\
+    0x40,0x29,0x45,0x77,0x6F,0xFF,0xF7,0x05,0x39,0x56,0x11,0x65,0x05,0x40,0xFE,0x47,\
+    0x00,0x7D,0x27,0x0B,0x2A,0xA8,0x77,0x7D,0xFF,0x23,0x11,0x49,0x6C,0x58,0x6D,0x0F,\
+    0x54,0xFF,0x39,0x6B,0x58,0x51,0x47,0x29,0x5D,0x41,0xBF,0x39,0xD4,0x47,0x29,0x0D,\
+    0x98,0xE3,0x00,0x14,0x5D,0x39,0x51,0x81,0x39,0x29,0x7D,0x4D,0x04,0x1D,0x4B,0x80,\
+    0x7D,0x7C,0xD9,0x40,0x4C,0x77,0x19,0x39,0x18,0x9D,0x41,0xBF,0x39,0x1C,0x4F,0x00,\
+    0x39,0x6D,0xEF,0x00,0x21,0xDB,0x5E,0x64,0x35,0x01,0x70,0xE4,0x05,0x02,0xC4,0x57,\
+    0xBE,0xB9,0x00,0x4A,0x90,0x10,0x45,0xF7,0x35,0x00,0x1B,0x6F,0x6D,0x25,0x19,0x7B,\
+    0xDD,0x00,0x34,0xC1,0xE3,0x01,0xFB,0x63,0x29,0x05,0x01,0x0E,0xD5,0x49,0x69,0x64,\
+    0xDF,0xAD,0x47,0x29,0x52,0x95,0x05,0x02,0x96,0x39,0x7F,0x18,0x68,0x3E,0x2B,0x47,\
+    0x77,0x66,0xEB,0x40,0xDB,0x67,0x57,0x61,0x40,0x78,0x20,0x7D,0x00,0x38,0xE8,0xFF,\
+    0xA8,0x65,0x7D,0xF5,0x05,0x39,0x97,0x10,0xF5,0x7B,0xFB,0x01,0x36,0x89,0x01,0x69,\
+    0x36,0x9D,0x49,0xFF,0x39,0x49,0x68,0x67,0x6A,0x96,0xF9,0x2B,0xFF,0x78,0x69,0x6C,\
+    0x0D,0x38,0x52,0x46,0x3D,0xFE,0x6B,0x00,0x52,0x95,0x11,0x69,0x37,0xC6,0x59,0xED,\
+    0x4C,0x3B,0x01,0x7B,0xF4,0x9D,0x4D,0xE8,0xA9,0x7B,0xFF,0x3D,0x07,0x39,0x5E,0x6C,\
+    0x07,0x92,0x27,0xF7,0x3B,0x19,0x6F,0x0D,0x41,0x77,0x19,0x88,0x6D,0xBB,0xB8,0xC6,\
+    0xFB,0xC0,0x92,0xB8,0x38,0x05,0x02,0xC6,0xA9,0xB9,0x05,0x02,0x0B,0x00,0x6F,0x17,\
+    0x04,0xB8,0x17,0x03,0xC6,0xD5,0xEA,0x17,0x04,0xEE,0x17,0x03,0x44,0x1D,0x03,0xC6,\
+    0xBD,0xA6,0x2F,0x05,0x92,0x47,0x11,0x04,0x05,0x13,0x46,0x05,0x00,0x75,0x94,0x1D,\
+    0x16,0x05,0x07,0x74,0x1D,0x16,0x43,0x3B,0x1E,0x05,0x21,0x72,0xFA,0x23,0x1C,0x41,\
+    0x53,0x30,0x70,0x65,0xB8,0xC6,0x38,0xFF,0x48,0x72,0x6D,0x07,0x39,0x31,0x69,0x77,\
+    0xFD,0x6D,0xC5,0xC0,0x68,0x77,0x6D,0x44,0x28,0x3F,0x6F,0x68,0x37,0x6C,0x4F,0xE7,\
+    0x80,0x3E,0x8D,0x11,0x01,0xFF,0x72,0x2C,0x43,0x39,0x79,0x68,0x7F,0x6C,0xFE,0x1D,\
+    0x03,0x47,0x39,0x3F,0x29,0x74,0x6D,0x07,0xDD,0x38,0x2F,0x00,0x7D,0x0E,0xD9,0x11,\
+    0x01,0x40,0xD1,0xDD,0x3E,0x2F,0x0A,0x77,0x7C,0x4E,0x2F,0x03,0x29,0x06,0x7D,0x44,\
+    0x53,0x05,0x47,0x39,0x38,0x69,0x7F,0x65,0x03,0xD7,0x7D,0x78,0xC9,0x11,0x01,0x46,\
+    0x17,0x02,0x45,0x78,0x6F,0x3B,0x68,0x37,0x6D,0x3B,0x01,0x48,0x41,0x29,0x01,0x5D,\
+    0x75,0x2F,0x02,0x70,0x8D,0x46,0x41,0x0A,0x3A,0x41,0x02,0xFF,0x71,0x8F,0x78,0x61,\
+    0x6D,0x56,0x39,0x48,0xFF,0x57,0x20,0x65,0x74,0x19,0xB1,0x57,0xB4,0xFE,0x47,0xC1,\
+    0x03,0x64,0x57,0x28,0x73,0x68,0x10,0xFF,0x6D,0x47,0xFB,0x89,0x54,0x77,0x6C,0x20,\
+    0xFF,0x3D,0x59,0x68,0x76,0xA3,0x57,0x2C,0xD1,0xF7,0xE0,0xB7,0xD1,0x47,0x00,0x67,\
+    0x22,0xED,0x21,0xEF,0x39,0x39,0xC0,0x6D,0x5D,0x80,0x4D,0x62,0x67,0xF7,0x78,0x87,\
+    0x85,0x71,0x00,0x62,0x35,0x39,0x2B,0xB7,0x6D,0xC7,0xEC,0x17,0x00,0xE2,0x49,0x17,\
+    0x01,0x66,0xFD,0x4F,0x05,0x01,0x64,0x07,0x6D,0x77,0x3E,0x11,0xFD,0x28,0x05,0x00,\
+    0x3D,0xA9,0xE4,0x28,0xED,0x24,0xFF,0x3D,0x4B,0x6F,0x17,0x69,0x75,0x3D,0xAB,0xFF,\
+    0x2F,0x0B,0x6D,0x7B,0x38,0x73,0xEE,0x10,0x7F,0x49,0x68,0x3A,0x0F,0x54,0x88,0x92,\
+    0xBF,0xC3,0xFF,0x96,0xF5,0x11,0x20,0x57,0x6B,0x97,0x7A,0xFF,0x45,0x68,0x4B,0x6D,\
+    0x5E,0x8C,0x51,0x69,0xFF,0x1F,0x6D,0x0D,0xBF,0x5F,0x86,0x51,0x72,0xFF,0x99,0x78,\
+    0x0A,0xAF,0x77,0x7D,0x33,0x37,0xFF,0x29,0x6D,0x25,0x6D,0x35,0x36,0xFB,0x68,0xFB,\
+    0x64,0xAC,0x77,0x01,0xCF,0x2A,0x21,0x2D,0x31,0xF7,0x91,0x77,0x68,0x4D,0xC0,0x9D,\
+    0x44,0xA9,0x47,0xFF,0x29,0x55,0x72,0x35,0x7C,0x27,0x39,0x38,0xF7,0x40,0x25,0x14,\
+    0x1D,0x00,0x78,0x17,0x6D,0x46,0x77,0x27,0x7B,0x79,0x05,0x00,0x21,0x31,0x51,0x23,\
+    0x03,0xFF,0x11,0x6D,0x46,0x35,0x29,0x7D,0xB7,0x51,0xFF,0x47,0xC9,0x5F,0x68,0x77,\
+    0x1D,0x4F,0x2C,0x3F,0x39,0x6B,0x11,0x6D,0x47,0x51,0x11,0x00,0xD1,0x01,0xDF,0x6F,\
+    0x28,0xED,0x25,0x63,0x0B,0x07,0x24,0x3D,0xFF,0x43,0x6F,0x17,0x67,0x57,0x2C,0xF9,\
+    0xD4,0xFE,0x1F,0x40,0x3E,0x13,0x68,0x4F,0x68,0x74,0xFC,0xFE,0x13,0x40,0x61,0x39,\
+    0x39,0x07,0x6D,0x3D,0xEA,0xD7,0x20,0x25,0x03,0xB3,0x00,0x6F,0xB3,0x02,0x67,0x3E,\
+    0xFF,0xE9,0x2D,0x09,0x6D,0x79,0x39,0x20,0xDD,0xFF,0x0F,0x6C,0x3F,0x39,0x73,0xEF,\
+    0x11,0x83,0x7B,0x4F,0xC0,0xF5,0xC1,0x34,0xCC,0x0A,0xAC,0xFB,0xC0,0xFD,0x23,0x83,\
+    0x01,0x47,0xAD,0x29,0x7D,0x9F,0xE5,0xF6,0x25,0x43,0x14,0xB9,0x7D,0x00,0xE9,0x39,\
+    0x39,0x27,0xF7,0x45,0x77,0x6C,0x5F,0x04,0x36,0xD8,0x20,0xA9,0xF7,0x2D,0x74,0xFE,\
+    0x5F,0x01,0xF9,0x45,0x3E,0xBD,0x5F,0x15,0x09,0x39,0x3F,0x01,0x5F,0x09,0x2C,0x5F,\
+    0x04,0xBD,0x6F,0x5F,0x03,0x74,0xC5,0x39,0x6E,0x0D,0x41,0x47,0xD7,0x69,0x64,0xAA,\
+    0x07,0x41,0x5F,0xD7,0xC0,0x4D,0x68,0xBF,0x07,0x6E,0xAE,0xB1,0x2B,0x7C,0xBF,0x02,\
+    0x98,0xFB,0xB5,0xD1,0x81,0x80,0x67,0xF5,0xED,0x5F,0xB8,0xFF,0x3B,0x7C,0x77,0x9D,\
+    0x05,0x15,0x39,0x69,0xDF,0x35,0x41,0x47,0x3B,0x2A,0x43,0x41,0x22,0x7B,0xFD,0x51,\
+    0x05,0x00,0x23,0x2B,0xEF,0x67,0x78,0xAF,0x6D,0xB1,0x7D,0x03,0x6E,0xE8,0x19,0x41,\
+    0x1B,0x14,0x17,0x00,0xFF,0x2B,0x29,0x79,0x2A,0x6D,0x21,0x05,0x27,0xDE,0x23,0x01,\
+    0x20,0x5E,0x72,0x3D,0xC1,0x41,0x72,0x10,0xDF,0x63,0x54,0xC5,0x39,0x49,0x11,0x01,\
+    0x2B,0xD4,0xFF,0x77,0x6F,0x27,0x27,0x73,0x6F,0x11,0x77,0xFB,0x0D,0x00,0xAD,0x00,\
+    0x77,0x21,0x2B,0x31,0xD1,0xFB,0x77,0x6B,0x5B,0x41,0x7F,0x94,0x47,0x3E,0x39,0xFF,\
+    0x78,0x04,0x98,0x05,0x28,0x29,0x79,0x26,0x57,0x6D,0x21,0x77,0x41,0x04,0x44,0x41,\
+    0x04,0x4D,0x41,0x05,0xFD,0x29,0x17,0x01,0x2A,0x6B,0x68,0x05,0x62,0x85,0xA7,0x39,\
+    0x2A,0xA9,0x0B,0x01,0x53,0x00,0x69,0x53,0x1D,0x27,0xFF,0x79,0xC9,0x51,0x47,0x3B,\
+    0x5F,0x54,0x64,0xFB,0x80,0x47,0xCF,0x80,0x03,0x7A,0x54,0xD4,0x39,0xB5,0x6A,0x3B,\
+    0x00,0x21,0x01,0x44,0x7B,0x35,0x65,0x01,0x71,0xFE,0x0B,0x02,0x7E,0x65,0xD1,0x47,\
+    0x3A,0x19,0x54,0xBF,0x77,0x6D,0x4E,0xFD,0xE9,0xD1,0x7F,0x40,0x39,0xBB,0x1A,0xA8,\
+    0x8B,0x40,0xC1,0x59,0x42,0x41,0x00,0x3D,0xEB,0x5F,0x4C,0x29,0x04,0x91,0x47,0x02,\
+    0x7B,0x55,0x85,0xFF,0x39,0x6B,0x57,0x51,0x47,0x39,0x30,0xAC,0xBB,0xA7,0xD4,0x3F,\
+    0x80,0x68,0x54,0xAD,0x77,0x00,0x90,0xFF,0x5F,0x72,0x6D,0x26,0x15,0x77,0x59,0x72,\
+    0xFF,0x6F,0x66,0x13,0x37,0x39,0x18,0x68,0x34,0xDF,0x16,0x64,0x58,0x6A,0x6D,0x8B,\
+    0x40,0x04,0x98,0xEE,0x33,0x80,0x6F,0x10,0x67,0xA7,0x02,0x7F,0x20,0x39,0xFB,0x3A,\
+    0x36,0x79,0x42,0x7A,0x67,0x79,0x1A,0x39,0xD7,0x5F,0x5C,0x69,0x59,0x02,0x10,0xC5,\
+    0x04,0x20,0x37,0xEF,0x2A,0x94,0x77,0x4C,0x11,0x01,0x6F,0xD1,0x47,0xFF,0x3B,0x59,\
+    0x7E,0x3D,0x6A,0x21,0x2B,0x73,0xFE,0x79,0x42,0x5F,0x62,0x7F,0xF8,0x47,0x3F,0x31,\
+    0xFF,0xBD,0x77,0x6A,0x05,0x2D,0x29,0x7C,0x22,0xA5,0x6D,0x17,0x04,0x20,0x17,0x0B,\
+    0x43,0x40,0x7F,0x43,0x67,0x21,0xEA,0x43,0x41,0x2F,0x43,0x40,0x7F,0x43,0x44,0x33,\
+    0x31,0xFD,0xFF,0x77,0x6B,0x4F,0xEC,0x39,0x6F,0x35,0x79,0xAF,0x57,0x2D,0x60,0x68,\
+    0x17,0x04,0x74,0x17,0x0B,0x66,0xD5,0x68,0xFF,0x80,0x59,0x65,0x04,0x2C,0x65,0x04,\
+    0x55,0x57,0xEE,0x29,0x01,0x75,0x35,0x3F,0x1B,0x82,0xC6,0xFB,0x14,0xDF,0x77,0x92,\
+    0xC6,0xF8,0x2A,0x43,0x40,0x33,0x20,0xD5,0x6B,0x29,0x01,0x2F,0x7D,0x12,0x6E,0x7D,\
+    0x17,0x62,0x68,0xD7,0x11,0x41,0x59,0x7D,0x02,0x20,0x01,0x44,0x5E,0x6E,0xBF,0x7F,\
+    0xB8,0x47,0x3F,0x59,0x78,0x13,0x53,0x73,0x6D,0x7C,0x95,0x00,0xD7,0x07,0x17,0x00,\
+    0x2B,0x23,0xB1,0x82,0xFF,0x2D,0x87,0x54,0x77,0x6A,0x25,0x39,0x39,0x5F,0x10,0x7F,\
+    0x78,0x47,0x3E,0x3B,0xC0,0xBF,0x8B,0x41,0xFF,0x03,0x6D,0x45,0x2C,0x39,0x67,0x07,\
+    0x6D,0xE7,0x57,0x3E,0x2B,0xB3,0xC4,0xF3,0x82,0x90,0xF5,0xED,0xFB,0x5D,0xB8,0x7D,\
+    0x00,0x6E,0x37,0x31,0x16,0x68,0xDF,0x3F,0x00,0x47,0x38,0x77,0x03,0x80,0x72,0x29,\
+    0xEF,0x69,0xE7,0x09,0x6D,0x83,0x02,0x79,0x0D,0xBE,0xF7,0x5E,0x72,0x57,0xB5,0x40,\
+    0x55,0x48,0x57,0x6A,0xEF,0x97,0x05,0x39,0x97,0x17,0x00,0x39,0x22,0xD8,0xAF,0x0F,\
+    0x6D,0x3F,0x38,0x59,0xC0,0x81,0x61,0x40,0x69,0xFC,0x23,0xC7,0xD7,0x00,0x68,0x27,\
+    0x5B,0x31,0x7D,0x77,0xEF,0x6A,0x21,0x65,0x13,0x1D,0xC1,0x39,0x49,0x69,0xF7,0x9E,\
+    0xE5,0x55,0xB3,0xC3,0xC9,0xFB,0xD4,0x88,0x7F,0x92,0xB8,0x36,0xBB,0xE8,0x6D,0xEC,\
+    0x89,0x00,0xF7,0x98,0x6C,0x14,0x3D,0x40,0x7C,0x77,0x6C,0x39,0xFB,0x3F,0x19,0x29,\
+    0x00,0x2B,0x19,0x19,0x6F,0xA7,0xFF,0x51,0x47,0xC6,0x47,0x68,0x69,0x6D,0x5C,0xFF,\
+    0x89,0x41,0x68,0x0F,0x6F,0x0D,0xBE,0x5F,0xAF,0x84,0x09,0x6B,0x54,0xE3,0xC1,0x78,\
+    0x65,0x0C,0xEF,0xFF,0x67,0x79,0x10,0x39,0x5F,0x68,0x76,0x7D,0xBE,0xA3,0x44,0x39,\
+    0x38,0x6E,0x58,0x6B,0xE3,0x03,0x37,0xFF,0x3B,0xD0,0xE0,0x65,0x78,0x87,0x85,0x39,\
+    0xFF,0x68,0x77,0x9D,0x85,0x85,0xC6,0x97,0x88,0x9F,0x62,0xC5,0xB9,0x23,0xE9,0xF5,\
+    0x00,0x29,0x01,0x7E,0xAA,0x89,0x04,0x36,0x89,0x02,0xC9,0x89,0x01,0x5B,0x17,0x01,\
+    0x78,0xEF,0x35,0x39,0x2B,0x6E,0x23,0x04,0x79,0xD7,0xB8,0xBF,0x66,0xE8,0x14,0x39,\
+    0x39,0x3E,0x95,0x03,0xE8,0xFD,0xA9,0xF5,0x1F,0x29,0x6E,0x29,0x6D,0x54,0xF9,0xEC,\
+    0x47,0x01,0x31,0x42,0x7A,0xF9,0x05,0x01,0x7B,0x21,0x33,0xFF,0x73,0x6F,0x10,0x6B,\
+    0x5F,0x85,0x39,0x60,0xBB,0x17,0x09,0x05,0x00,0x6F,0x17,0x33,0x61,0x4B,0x25,0xDE,\
+    0x3B,0x01,0x2C,0x69,0xE7,0x67,0x45,0x81,0x7C,0xE7,0xFF,0x6B,0x39,0x39,0x27,0x68,\
+    0x3D,0xEA,0x20,0xFD,0x19,0x77,0x03,0x49,0x68,0x67,0x6B,0x96,0xF9,0x32,0x13,0x4C,\
+    0x6C,0x13,0x41,0x89,0xC4,0x76,0x05,0x39,0x82,0x59,0x00,0xFB,0x6D,0x35,0x89,0xC0,\
+    0x4A,0x90,0x5B,0x72,0x69,0xFF,0x26,0x11,0x37,0x5D,0x32,0x09,0x4C,0x2B,0xF6,0x9F,\
+    0x83,0x78,0xC5,0x3B,0x00,0x5E,0x62,0x07,0x92,0xFB,0x97,0x38,0x8D,0x83,0x58,0x68,\
+    0x8B,0x0B,0x09,0xF7,0x4C,0x77,0x19,0x71,0x02,0x73,0x24,0x6D,0x21,0xAD,0x1F,0x71,\
+    0xC5,0x58,0x51,0x05,0x00,0x68,0x01,0x43,0x04,0xD7,0x9B,0x68,0x39,0xA1,0x02,0x09,\
+    0xDD,0x02,0x22,0x69,0x5F,0xE7,0x39,0x18,0x09,0x48,0x29,0x00,0x6C,0xED,0x81,0xBC,\
+    0x0B,0x01,0x17,0x02,0x30,0x49,0x69,0x64,0xFB,0xC0,0x4D,0x6B,0x62,0x35,0xC7,0x41,\
+    0x64,0x05,0x02,0x66,0x44,0x9B,0x03,0x55,0x7D,0x9B,0x02,0x7F,0x13,0x42,0x7E,0x0B,\
+    0x02,0x79,0x05,0x02,0x55,0x78,0x05,0x02,0x7B,0x3D,0x40,0x97,0x41,0x00,0x2E,0x47,\
+    0x02,0xF5,0x21,0x05,0x02,0x20,0xF5,0x01,0x34,0xCC,0x31,0xB8,0xFF,0x77,0x6A,0x4F,\
+    0xA9,0x39,0x6E,0x7F,0xFD,0xBF,0x47,0x3C,0x31,0x91,0x77,0x68,0x75,0x80,0x70,0xFC,\
+    0xDD,0x03,0x77,0x01,0x77,0x19,0x39,0x1C,0x68,0x3E,0xFF,0x09,0x47,0x77,0x67,0x79,\
+    0x16,0x39,0x66,0xFF,0x3D,0x2D,0x20,0x3F,0x6A,0x28,0x10,0x7F,0xED,0x27,0x2B,0x40,\
+    0x47,0x6A,0xB3,0x03,0x25,0xC1,0x61,0xFF,0xE7,0x17,0x7F,0x37,0x39,0x09,0x6F,0x58,\
+    0xFF,0x6D,0x09,0x80,0x39,0x78,0x24,0xAD,0x1F,0xFF,0xB6,0x59,0x6A,0x07,0x6C,0x69,\
+    0x26,0x77,0xF7,0x1D,0x39,0x1C,0xFB,0x01,0x58,0x6A,0x68,0x3F,0xFF,0x16,0x6D,0x47,\
+    0x42,0x47,0x2B,0x17,0x47,0xFF,0x77,0x79,0x6B,0x16,0x39,0x70,0x5D,0x42,0xFF,0x47,\
+    0x25,0x73,0x28,0x10,0x6B,0x14,0x79,0xFF,0x5E,0x7C,0x17,0x49,0x68,0x3C,0x16,0x6E,\
+    0xFB,0x58,0x6A,0x3B,0x01,0x14,0x39,0x08,0xD6,0x39,0xB7,0x64,0x17,0x79,0x11,0x07,\
+    0x23,0x55,0x11,0x02,0x6F,0xCF,0x37,0x38,0x13,0x77,0x6D,0x41,0x53,0x01,0x77,0x16,\
+    0xFF,0x39,0x6E,0xC7,0x11,0x47,0x38,0x5F,0x60,0xAD,0x39,0xA7,0x00,0x6D,0x14,0x1D,\
+    0x00,0x39,0x17,0x01,0x68,0xDF,0x34,0x16,0x64,0x58,0x6A,0x93,0x80,0x97,0x83,0x7F,\
+    0x6D,0x0E,0xD4,0x39,0x72,0x7F,0x79,0x89,0xC0,0x7F,0x92,0x37,0xAD,0x47,0x45,0x3E,\
+    0x68,0x0B,0x01,0xFF,0x5E,0x6C,0x31,0xAD,0x27,0xD3,0x17,0x68,0x7F,0x4C,0x11,0xC7,\
+    0x3C,0x39,0x70,0x4C,0x41,0x00,0xFF,0x39,0x72,0x4C,0x11,0x58,0x29,0x39,0x74,0xFF,\
+    0x35,0x40,0x47,0x27,0x31,0xBC,0x77,0x6A,0xFF,0x01,0xFE,0x17,0x77,0x5F,0x32,0x6D,\
+    0x66,0xFF,0x77,0x1D,0x3F,0x8A,0x48,0x39,0x15,0x51,0xFF,0x77,0x7E,0x47,0x51,0x19,\
+    0x54,0x77,0x6D,0xFF,0x46,0xCD,0x0B,0x54,0xC1,0x77,0x3F,0x93,0xFB,0x43,0x3D,0x95,\
+    0xC0,0x2A,0x39,0x68,0x55,0x11,0xFF,0x47,0xC6,0xC3,0x68,0x64,0x28,0x47,0x6C,0xFF,\
+    0x2A,0x2C,0x77,0x38,0x76,0x78,0x39,0x16,0xFF,0x59,0x45,0x47,0x51,0xA7,0xEE,0xC9,\
+    0xED,0xFF,0x22,0xD3,0x11,0x77,0x5D,0x72,0x6B,0x26,0xFF,0x17,0x77,0x39,0x18,0x0F,\
+    0xDE,0x3E,0x64,0xFF,0x09,0x6C,0x6B,0x00,0x39,0x7B,0x77,0x05,0xEB,0x6F,0x45,0x05,\
+    0x00,0x6D,0x9B,0x01,0x82,0x6D,0x6D,0xFF,0x05,0x39,0x61,0xFE,0x05,0x26,0x39,0xC6,\
+    0xFF,0x38,0x16,0xF5,0x67,0x74,0x2B,0x70,0x07,0xDF,0x62,0x95,0x21,0xEB,0x70,0x75,\
+    0x81,0x73,0x68,0xFF,0x11,0x99,0x37,0x38,0xA9,0x69,0x55,0x6D,0xFF,0xF5,0x14,0x39,\
+    0x77,0x11,0x49,0x0D,0x2C,0x7B,0x5F,0x48,0x39,0x81,0x45,0x50,0xC7,0x40,0xEF,0x00,\
+    0xFF,0x7C,0x69,0x40,0x47,0x3B,0x5E,0x70,0xC9,0xDF,0x51,0x47,0x38,0x5E,0x7A,0x05,\
+    0x00,0x3A,0x5E,0xFE,0x5F,0x00,0x65,0x15,0x39,0x00,0xE5,0xEB,0xF5,0xFF,0xBC,0x5C,\
+    0xC6,0x57,0x6A,0x6D,0x26,0x15,0x7F,0x77,0x59,0x72,0x6F,0x66,0x13,0x37,0xBB,0x41,\
+    0xFF,0x71,0x8F,0x48,0x61,0x3F,0x39,0x4D,0x47,0xBB,0x01,0x17,0x7D,0x00,0x78,0x0B,\
+    0x55,0x7D,0x02,0x4D,0xFF,0x5D,0xBA,0x43,0x76,0x0B,0xC7,0x5C,0x7F,0xFF,0x39,0x69,\
+    0x09,0x6F,0x67,0x3C,0x6C,0x68,0xFF,0x14,0x73,0x5C,0xBF,0x41,0x68,0x57,0x20,0xFF,\
+    0x67,0x3E,0x6B,0x68,0x05,0x6D,0x55,0x39,0xFF,0xE8,0xA9,0x67,0xEB,0x67,0x3E,0x6D,\
+    0x68,0xFE,0x7D,0xC1,0x87,0x6D,0x12,0x8F,0x5C,0x7B,0x39,0xFB,0x76,0x6C,0xEF,0x00,\
+    0x39,0x77,0x16,0x6D,0xB9,0xFF,0xA7,0x58,0x68,0x89,0x8B,0x5F,0xBA,0x58,0xFF,0x68,\
+    0x88,0x49,0x69,0x39,0x87,0x54,0x77,0xDF,0x6C,0x21,0x35,0x6B,0x6C,0x17,0x00,0xEB,\
+    0x81,0xFF,0x54,0x77,0x6E,0x22,0x9D,0x19,0x6F,0x53,0xE7,0x72,0x61,0x26,0x01,0x45,\
+    0x49,0x43,0x39,0x1C,0x0F,0xFF,0xDE,0x36,0x6C,0x6F,0x42,0x47,0x22,0x23,0xF7,0x47,\
+    0x77,0x72,0x83,0x04,0xBD,0x19,0x6C,0xC7,0xFF,0x51,0x47,0xBD,0x5E,0x68,0x76,0x53,\
+    0xF7,0xFF,0x05,0x39,0xE0,0x10,0x6D,0x47,0xC5,0x89,0x7F,0x54,0x77,0xE1,0x20,0x39,\
+    0x39,0xE8,0x17,0x00,0xFF,0x99,0x5E,0x6C,0x17,0x6D,0x46,0x4B,0x17,0xFE,0xA5,0x80,\
+    0x3B,0x15,0x19,0x6F,0x05,0x75,0xA5,0xFF,0x91,0x22,0x28,0x77,0x6C,0x67,0x3E,0x7B,\
+    0xFF,0x28,0x3F,0x2D,0x5C,0x79,0x39,0x6A,0x57,0xF7,0x6A,0xA7,0xB1,0x11,0x00,0x6E,\
+    0x5C,0x7E,0x39,0xFB,0x6C,0x59,0x1F,0x41,0x58,0x57,0x6A,0x35,0x21,0xFF,0xDB,0xC0,\
+    0x6C,0x2D,0x47,0x3C,0x19,0x6F,0xEF,0x35,0x2D,0x0F,0x79,0x1D,0x00,0x6B,0x67,0x3E,\
+    0xFB,0xD9,0xE0,0x11,0x00,0x3E,0x22,0x2F,0x77,0x65,0xFF,0x39,0x30,0x45,0x77,0x55,\
+    0x20,0x05,0x08,0xDA,0xE9,0x00,0x24,0xE9,0x07,0x35,0x7D,0xE9,0x06,0x6E,0x12,0x5F,\
+    0x8F,0x27,0x39,0x39,0x96,0x4D,0x02,0x4C,0x4D,0x06,0xD5,0x38,0x4D,0x06,0x6F,0x4D,\
+    0x04,0x3A,0x4D,0x00,0x69,0x69,0xFE,0x53,0xC0,0x0B,0x45,0x67,0x3E,0x4B,0x70,0x95,\
+    0xFD,0xC5,0x8F,0x00,0x6D,0x57,0x6A,0x05,0x79,0x71,0x7D,0x28,0x1D,0x00,0x3F,0x19,\
+    0x6F,0x97,0xE5,0x11,0x00,0xFF,0x6F,0x6C,0x2A,0x47,0x31,0x47,0x61,0x0B,0xFF,0x72,\
+    0x65,0x74,0x7B,0x59,0x0F,0x6D,0x67,0xFF,0x70,0x19,0x6F,0x25,0x6D,0x35,0x39,0x2B,\
+    0xFF,0x68,0xA6,0xAC,0x05,0x29,0x19,0x6F,0x23,0xFF,0x6D,0x39,0x39,0x27,0x68,0xC9,\
+    0x6B,0x22,0xBF,0xDB,0x59,0x68,0x77,0xE7,0x79,0x4D,0x01,0x59,0xD6,0x41,0xC1,0x97,\
+    0xED,0x3B,0x00,0x69,0x3B,0x00,0x3B,0x45,0xAB,0x6B,0x09,0x3B,0x02,0x1F,0x3B,0x01,\
+    0x6E,0x3B,0x08,0x6E,0xFF,0x23,0x6D,0x3B,0x39,0x25,0x68,0xCB,0x6A,0xFE,0x3B,0x00,\
+    0x26,0x6C,0x28,0x47,0x38,0x73,0x6D,0xFF,0x11,0x63,0x5C,0x45,0x39,0x6A,0x77,0x6F,\
+    0xFE,0x05,0x00,0xE0,0x77,0x6E,0x27,0x35,0x22,0x14,0xEF,0x77,0x6F,0x47,0x3B,0x05,\
+    0x00,0x59,0x47,0x3A,0xDB,0x47,0x77,0xDB,0x80,0x3D,0x45,0xA1,0x00,0x1C,0x39,0xFF,\
+    0x5A,0x76,0x35,0x58,0x2F,0x39,0x19,0x25,0xFF,0x57,0x6B,0x15,0x39,0x4B,0x68,0x65,\
+    0x6D,0xFF,0x96,0xF8,0x7B,0x78,0x57,0x6B,0x13,0x39,0xFF,0x45,0x68,0x6B,0x6D,0xFB,\
+    0x3E,0x5C,0x8A,0xFF,0x55,0x20,0x59,0x20,0x45,0x67,0xA9,0x74,0xFF,0x99,0x20,0xE5,\
+    0x54,0x77,0x92,0x0D,0x3F,0xFF,0x5F,0x9C,0x0B,0x6C,0xDB,0x3E,0x22,0x2E,0xFF,0x77,\
+    0x72,0x26,0x39,0xC5,0xCC,0x16,0x6D,0xFF,0xBB,0xD5,0x23,0xD4,0x77,0xED,0x5C,0x7D,\
+    0xFE,0xA1,0x00,0x28,0x47,0x3B,0x47,0x6B,0x0D,0x72,0xE3,0x05,0x0C,0x39,0x8B,0x4F,\
+    0x48,0x39,0x80,0x65,0x74,0x23,0xFF,0x71,0x09,0x62,0x9D,0x20,0xE3,0x71,0xA9,0xFE,\
+    0xDB,0x81,0x6F,0x11,0x99,0x39,0x38,0xA7,0x6D,0xEE,0xDD,0x00,0x26,0x2A,0xAC,0xD9,\
+    0x40,0x01,0x58,0x68,0xFF,0x8B,0xB3,0x6F,0x39,0x19,0x6C,0x5F,0x72,0xFC,0xB7,0x83,\
+    0x77,0xC3,0x58,0x25,0x13,0x47,0x77,0x49,0x7F,0x69,0x16,0x39,0x40,0x0F,0x6D,0x61,\
+    0xB7,0x81,0xFF,0x5B,0x05,0x6A,0x13,0x2D,0x07,0x73,0xF7,0x9F,0xBE,0x5C,0x68,0x77,\
+    0xCF,0xC9,0x80,0x3F,0x80,0x5F,0xFF,0x85,0x39,0xF8,0x0D,0x6C,0x0D,0x3E,0x5E,0xFD,\
+    0x76,0x5B,0x40,0x75,0x49,0x68,0x67,0x68,0x96,0xFF,0xF9,0x29,0xFD,0x07,0x6D,0x57,\
+    0x24,0xE1,0xFF,0x28,0x25,0x68,0x37,0x39,0x29,0x6D,0xC9,0xFF,0xED,0x23,0xDF,0x0F,\
+    0xEC,0x5D,0x6A,0x15,0xFF,0x3C,0x21,0x6D,0xCD,0x51,0x47,0x26,0x5D,0xF7,0x56,0x09,\
+    0x72,0x17,0x01,0xE7,0xEA,0x4F,0x39,0xEF,0x39,0x68,0x10,0x7F,0x35,0x05,0x7B,0x78,\
+    0x6F,0x7F,0x68,0x15,0x3D,0x81,0x6F,0x13,0x73,0x11,0x02,0xBD,0x69,0x11,0x01,0x57,\
+    0x21,0x57,0x3D,0xD1,0x07,0x13,0xFE,0x1D,0x00,0x12,0x8F,0x6D,0x75,0x21,0x75,0x0D,\
+    0xBF,0x62,0x9F,0x24,0xE1,0x75,0xAD,0xCB,0x01,0x6D,0xFF,0x11,0x99,0x3D,0x38,0xA3,\
+    0x6C,0x6E,0x28,0xFF,0x47,0x26,0x58,0x68,0x8C,0xE5,0x39,0x39,0x7E,0x05,0x00,0xA3,\
+    0x27,0x39,0x38,0x50,0x5F,0x29,0xC0,0xFF,0xCC,0x48,0x6F,0xD1,0x47,0xA9,0x43,0x69,\
+    0xBF,0x0B,0x6D,0x35,0x27,0x19,0x24,0x95,0x00,0x3C,0xEF,0xE8,0xA8,0x67,0xF8,0x7D,\
+    0x00,0x75,0xAB,0x2D,0xFF,0x15,0x3C,0x83,0x69,0x14,0x87,0x71,0xBF,0xFF,0x1F,0x64,\
+    0x57,0x2E,0x15,0xBA,0x23,0x78,0xFF,0x0B,0x62,0x67,0x7A,0x6B,0xEB,0xAD,0x7D,0xFE,\
+    0x05,0x03,0x9B,0x05,0x39,0x97,0x3D,0x6B,0x21,0x7F,0xD5,0x45,0x69,0xEB,0x68,0x5E,\
+    0x7F,0x71,0xC1,0xFB,0xBC,0x15,0x59,0x00,0x19,0x6D,0x3E,0x1F,0x54,0xFE,0x31,0x41,\
+    0x4B,0x8A,0xAD,0xEC,0x67,0x7A,0x29,0xFF,0xFC,0x25,0x69,0x37,0x3A,0xF9,0x6C,0xF7,\
+    0x5F,0x51,0x47,0xA9,0x21,0xE8,0x19,0x40,0xBC,0x19,0x40,0x7B,0x19,0x39,0x09,0x80,\
+    0x10,0x73,0x7B,0x2A,0x71,0x02,0xF5,0x3E,0x71,0x08,0x3E,0xD7,0x00,0x6A,0xFD,0xB9,\
+    0x5D,0xFF,0x8E,0x41,0xEB,0x65,0x3C,0x6B,0x69,0x69,0xFF,0x6C,0xF5,0x05,0x39,0x77,\
+    0x13,0x0D,0x3B,0xFB,0x26,0x1B,0x29,0x01,0x38,0xA9,0xEE,0x7F,0x6D,0xBF,0x47,0x39,\
+    0x5E,0x7A,0x57,0x21,0x2F,0x00,0x69,0xFF,0xA6,0xAD,0x05,0x29,0x27,0x69,0x25,0x6A,\
+    0xBF,0xF9,0x3F,0x5D,0x56,0x57,0x24,0x11,0x00,0x6F,0x5E,0x11,0x01,0x19,0x21,0x67,\
+    0x6A,0x33,0x87,0x23,0x1D,0x00,0xFF,0x5C,0x8A,0x17,0x73,0x39,0x38,0x05,0x7B,0xB5,\
+    0x05,0x37,0x43,0x6A,0x7F,0x45,0xE5,0x28,0x3B,0x00,0x38,0xFB,0x5A,0x82,0x6B,0x00,\
+    0x75,0x27,0x71,0x0B,0x62,0xDF,0x99,0x20,0xE7,0x71,0xAB,0x31,0x41,0x6E,0x11,0x7F,\
+    0x99,0x3B,0x38,0xA5,0x6F,0x6E,0x2B,0x31,0x41,0xEF,0x8D,0x8B,0x69,0x39,0x0F,0x80,\
+    0x65,0x37,0x27,0xFF,0x89,0xED,0x12,0x6D,0xB8,0x13,0x19,0x6F,0xFF,0x51,0x72,0x6F,\
+    0x26,0x13,0x77,0x5B,0x72,0xBF,0x69,0x26,0x1F,0x37,0x5F,0x32,0x09,0x81,0x39,0xFF,\
+    0x1C,0x0F,0xDE,0x3E,0x6C,0x6B,0x42,0x47,0xFF,0x2E,0x13,0x14,0x77,0x92,0xB2,0x19,\
+    0x2A,0xF9,0xBD,0x01,0x41,0x81,0x80,0xF5,0x5C,0x7F,0x39,0x69,0xFF,0xCB,0x51,0x47,\
+    0x3A,0x5F,0x68,0x77,0x13,0xAA,0x89,0xC2,0x41,0x89,0xC6,0x6A,0x89,0xC6,0x3A,0x89,\
+    0xC4,0x6C,0xEE,0x6F,0x80,0x3C,0x17,0x51,0x3B,0x00,0x09,0x19,0x6F,0xEF,0x05,0x75,\
+    0xA5,0x91,0xCB,0xC0,0x6B,0x67,0x3E,0xEF,0x7B,0x28,0x3F,0x2D,0xA7,0xC1,0x57,0x6A,\
+    0xA7,0xFD,0xB1,0x11,0x00,0x65,0x5C,0x7E,0x39,0x61,0x0D,0xFE,0x71,0xC1,0x45,0x77,\
+    0x67,0x39,0x32,0x83,0x54,0xAF,0x77,0x66,0x24,0x75,0xB9,0xD8,0x68,0x7D,0xC0,0x44,\
+    0xFE,0xFF,0x80,0x14,0x39,0x6A,0x09,0x6E,0x67,0x3C,0xEF,0x6E,0x68,0x14,0x73,0x0B,\
+    0xDD,0x27,0x71,0x0D,0xFC,0x0D,0x42,0x3F,0x85,0x37,0x38,0xA9,0x6F,0x59,0x6D,0xFC,\
+    0x77,0x00,0xE5,0x40,0xBE,0xEF,0x17,0x68,0x3D,0x6A,0xAF,0x21,0x39,0x39,0xEE,0x0B,\
+    0x00,0xBF,0x65,0xC2,0x45,0xCF,0x39,0xF0,0x77,0x6C,0xE9,0x00,0x5F,0x00,0x3B,0x26,\
+    0xEB,0x7B,0x5D,0x89,0x00,0x74,0x89,0x12,0x6B,0x22,0xDB,0xFF,0x1B,0x25,0x6B,0x74,\
+    0x39,0x36,0xE5,0x71,0xF7,0xAB,0x74,0x99,0x3F,0x81,0x6A,0x21,0xCD,0x49,0xDF,0x69,\
+    0xE7,0x6B,0x6B,0x39,0xB9,0xC1,0x54,0xC5,0xEC,0x47,0x00,0x6B,0xC2,0x8E,0x1F,0x73,\
+    0x42,0x4F,0x3B,0x39,0xFB,0x25,0x51,0x4F,0x40,0x3D,0xD8,0x26,0x6B,0x54,0xFE,0xAB,\
+    0x80,0x6D,0xCB,0x14,0x47,0x29,0x45,0x5E,0xFF,0x10,0x67,0x39,0x38,0x2A,0x94,0x77,\
+    0x6C,0xEE,0x0B,0x00,0x51,0x57,0x6A,0x8F,0xC9,0x78,0x39,0x23,0xFF,0x47,0x77,0x72,\
+    0x3B,0x39,0x4D,0x6B,0x01,0xFF,0x6C,0x3F,0x46,0x63,0xEC,0x58,0x68,0x68,0x5D,0x3D,\
+    0xC1,0x40,0x41,0x17,0xB6,0xB3,0x02,0x01,0xCB,0x00,0xFF,0x79,0x0F,0x41,0x3B,0xE0,\
+    0x58,0x51,0x47,0xFF,0x29,0x6F,0xA8,0x16,0x6D,0xBB,0x07,0x17,0xFF,0x68,0x27,0xE2,\
+    0x27,0x2B,0x71,0x10,0x75,0xFF,0x59,0x68,0x05,0x39,0x78,0x23,0xE5,0x26,0x7F,0x39,\
+    0xC5,0x42,0x59,0x6D,0x17,0xB6,0x7D,0x00,0xFF,0x67,0x68,0x3C,0x58,0x68,0x89,0x45,\
+    0x69,0xFF,0x39,0x61,0xE7,0xC9,0x6E,0x21,0x33,0x6B,0xFF,0x6E,0x16,0x6D,0xBF,0xAF,\
+    0x85,0x6A,0x12,0x9F,0xC7,0x67,0x3E,0x1D,0x77,0x03,0x87,0x77,0x01,0x58,0xFF,0x39,\
+    0x13,0x47,0x77,0x75,0x6F,0x16,0x39,0x7F,0x74,0x59,0x42,0x47,0x19,0x1A,0xAC,0xC5,\
+    0x00,0x77,0x19,0x1A,0xAF,0x05,0x00,0x1D,0x1A,0xAD,0x05,0x00,0xFD,0x11,0x0B,0x02,\
+    0x15,0x19,0x6D,0xA7,0xEA,0x14,0xF7,0xB9,0x1A,0xA8,0xDF,0x41,0x41,0x69,0x0D,0x6E,\
+    0xFF,0x61,0x05,0x39,0x68,0x77,0xE1,0x05,0x9E,0xEB,0x16,0x6B,0x49,0x40,0xB1,0x89,\
+    0x01,0xF9,0x3C,0x5F,0xFF,0x66,0x0B,0x6C,0x05,0x9E,0x58,0x68,0x88,0xDD,0x59,0x77,\
+    0x01,0x17,0x6F,0x3B,0x07,0x41,0x45,0xFB,0x5F,0x3D,0x5E,0xB0,0x58,0x54,0xEF,0x00,\
+    0x40,0x05,0x02,0xFD,0x48,0x6B,0xC0,0xBD,0x69,0xE7,0x59,0x6D,0x0D,0xBF,0x3E,0x5F,\
+    0x64,0x07,0x6E,0x68,0xD1,0xC0,0x8A,0xFD,0xED,0x2F,0x01,0x57,0x6A,0x61,0x26,0x11,\
+    0x77,0xFF,0x5D,0x72,0x6B,0x26,0x17,0x77,0x39,0x18,0xFF,0x68,0x3E,0x17,0x47,0x77,\
+    0x65,0x67,0x16,0xEF,0x39,0x64,0x54,0xAA,0x35,0x00,0x44,0x54,0xAD,0xF6,0x05,0x00,\
+    0x58,0x3D,0x41,0x00,0x5A,0x90,0x11,0x75,0xEF,0x26,0x39,0xC1,0xE4,0x41,0x02,0x62,\
+    0x64,0x91,0xFF,0x47,0x38,0x39,0x78,0x14,0x95,0x27,0x3D,0xFF,0x19,0x6F,0x17,0x7D,\
+    0x05,0x9E,0x71,0x10,0xFB,0x77,0xCD,0x1D,0x00,0x9E,0x59,0x6D,0x67,0x3E,0xBE,0x65,\
+    0x00,0x72,0x09,0x4C,0x77,0x19,0xE3,0x01,0x07,0xEF,0x47,0x77,0x77,0x05,0xC3,0x81,\
+    0x54,0x74,0xFE,0xF6,0x05,0x00,0x59,0x0D,0x0B,0x00,0x14,0x95,0x21,0x21,0xAF,0x58,\
+    0x68,0x8F,0x2F,0xAF,0x42,0x67,0xC1,0x40,0x69,0xFF,0x77,0x7D,0x24,0xC1,0x59,0x6C,\
+    0x57,0x6A,0x7F,0x27,0x0F,0x4F,0x69,0x0F,0x6E,0x6D,0xE3,0x01,0xD5,0xE5,0xE3,0x00,\
+    0x6D,0x3D,0x40,0x9D,0xE3,0x02,0x3D,0x5F,0xFF,0x78,0x0B,0x6C,0x37,0x38,0x16,0x68,\
+    0x16,0xFF,0x6D,0xB9,0x77,0x17,0x68,0x2F,0xE2,0x27,0xFB,0x3B,0x45,0x9D,0x41,0x3D,\
+    0x85,0x6B,0x10,0xBB,0x3F,0x67,0x3E,0x1F,0x77,0x5F,0x72,0xD3,0x43,0x77,0x01,0xBF,\
+    0x39,0x3B,0x47,0x39,0x16,0x6F,0xB3,0x07,0xCE,0xFD,0xB0,0xB3,0x10,0x75,0x68,0x17,\
+    0x39,0x78,0x58,0xFF,0x43,0x47,0x35,0x16,0x46,0x77,0x65,0x26,0xF7,0x39,0xC7,0x18,\
+    0xB9,0x01,0x76,0x87,0x77,0x61,0x9E,0x9D,0x40,0x36,0x39,0x18,0x57,0xB3,0x02,0x4D,\
+    0x02,0x1C,0xEF,0x09,0x6F,0xC6,0x90,0x27,0x80,0x3D,0x45,0x6A,0xFF,0x57,0x03,0x47,\
+    0x31,0x49,0x68,0x67,0x45,0xFF,0x47,0x38,0x04,0x28,0x88,0x91,0x77,0x17,0xFF,0xC6,\
+    0x94,0x96,0x25,0x7A,0x79,0xC6,0x94,0xDA,0x17,0x06,0x3B,0x17,0x00,0x93,0x79,0x17,\
+    0x00,0xF9,0x03,0xFF,0xB8,0xC7,0x4D,0x68,0xC9,0x11,0x47,0x31,0xFF,0x5B,0x68,0x76,\
+    0xD7,0x67,0x3E,0x89,0x14,0xFF,0x77,0x65,0x25,0x39,0x39,0xD6,0x47,0x56,0xFF,0x45,\
+    0x3F,0x77,0x93,0x77,0x6F,0x47,0x2B,0xFF,0x39,0x4A,0x77,0x5B,0x47,0x73,0x39,0x34,\
+    0xFF,0x77,0x03,0x47,0xB9,0x39,0xFA,0x77,0xC9,0xFF,0x79,0x05,0x38,0x68,0xEC,0xA0,\
+    0x65,0x45,0xFF,0x39,0x68,0xF7,0x6D,0x27,0x39,0x39,0xFC,0xFF,0x49,0x51,0xB9,0x39,\
+    0x13,0x14,0x77,0x6D,0xFF,0xC7,0x39,0x1B,0x14,0x77,0x69,0x47,0x39,0xFF,0x59,0x68,\
+    0x77,0xED,0x79,0x05,0x3B,0x68,0xFF,0x5D,0x11,0x47,0x39,0xB9,0x68,0x55,0x11,0xFE,\
+    0xCB,0x00,0x68,0x17,0x6D,0x47,0x55,0x07,0x54,0xAF,0x73,0x6D,0x6D,0x45,0x43,0x40,\
+    0x6D,0x3B,0x00,0x69,0x5E,0x3B,0x00,0x61,0x07,0x54,0x7F,0x11,0x02,0xF7,0x11,0x01,\
+    0xFF,0x6A,0x77,0x6D,0x27,0x7F,0x07,0x54,0x67,0xF0,0x11,0x01,0x0B,0x00,0x11,0x01,\
+    0x23,0x00,0x0D,0x07,0x54,0x57,0xF4,0x11,0x02,0x23,0x02,0x6B,0x23,0x00,0x1B,0x07,\
+    0x54,0x37,0xF0,0x11,0x01,0x0B,0x00,0x11,0x01,0x23,0x00,0x29,0x07,0x54,0xF7,0xFC,\
+    0x11,0x02,0x23,0x02,0x6C,0x77,0x6D,0x74,0xC5,0x31,0xFF,0x68,0x77,0x92,0xBF,0x39,\
+    0x3B,0x11,0xC8,0xFF,0x92,0x47,0xC6,0xC1,0x68,0x44,0x91,0x65,0xFE,0x8F,0xC0,0x8F,\
+    0x61,0x37,0x0F,0xB9,0x2F,0x44,0xFD,0xAD,0x11,0x00,0x66,0x4D,0xD1,0xB8,0xC6,0x41,\
+    0xFF,0x69,0xCF,0x51,0x47,0x38,0x5F,0x68,0x77,0xFF,0xDF,0xFB,0x05,0x39,0x6A,0x11,\
+    0x6D,0x47,0x7D,0x93,0x77,0xC0,0x38,0x47,0xC6,0xC3,0x4F,0x7F,0x40,0x7F,0x93,0x39,\
+    0x97,0x8D,0x4A,0x47,0x40,0xAD,0x00,0x7F,0x92,0xBF,0x37,0x4F,0x68,0x3D,0x14,0x35,\
+    0x00,0xD7,0x64,0x1D,0x4B,0x29,0x02,0x4D,0x09,0x80,0x3D,0x77,0xD7,0x92,0xBD,0x1E,\
+    0x2F,0x00,0xC7,0x2F,0x01,0x57,0x6E,0xFF,0x15,0xBA,0x89,0xD4,0x78,0x92,0xB8,0xC6,\
+    0xFF,0x5C,0xBE,0x0B,0x6C,0x27,0xEB,0x3B,0x11,0xFB,0x88,0x93,0x65,0x01,0x0F,0x6D,\
+    0x3D,0x39,0x82,0xFF,0xA1,0x13,0x5B,0x0D,0x3D,0x5F,0x5A,0xCB,0xFF,0x51,0x47,0x3B,\
+    0x5F,0x44,0x7B,0x38,0xB8,0xFF,0xC6,0x5E,0x6C,0x0F,0x6C,0x27,0xD1,0x6D,0xFF,0xE5,\
+    0x57,0x68,0x15,0xBC,0x89,0xD4,0x77,0x7F,0x6D,0x46,0x39,0x5A,0xB2,0x0D,0x6D,0x53,\
+    0x0D,0x7F,0x17,0xAB,0xFC,0xF0,0x5F,0x6E,0x0B,0x61,0x40,0xFF,0xC6,0x32,0x57,0x6F,\
+    0x15,0xBB,0x62,0xE8,0xFF,0x12,0x6D,0xB8,0x69,0x45,0x69,0x17,0x6D,0xEB,0xB8,0x73,\
+    0x5F,0x00,0x90,0x5F,0x01,0x77,0x14,0x07,0xD5,0x39,0xD7,0x00,0x6D,0x63,0x80,0x69,\
+    0xD9,0x40,0x35,0x28,0xFF,0x2E,0x77,0x6F,0x0B,0xD7,0x19,0x94,0x88,0x5F,0xB1,0x09,\
+    0x67,0x77,0x1D,0x0F,0x83,0x35,0xDF,0x40,0xAE,0xF1,0x40,0x43,0x47,0x32,0x09,0x81,\
+    0x67,0xF1,0x40,0x95,0xBB,0xE5,0x6A,0x09,0x81,0x43,0xB8,0xC5,0x3F,0x81,0x45,0xFD,\
+    0x0D,0x87,0x81,0xB8,0x49,0x71,0x8F,0x48,0x51,0xFF,0x6D,0x57,0x39,0x60,0x5F,0x03,\
+    0x47,0x29,0xFF,0x1F,0x06,0x77,0x79,0x39,0x39,0x41,0x69,0xFF,0x57,0x51,0xB8,0x39,\
+    0x31,0x68,0xA7,0xE1,0xFF,0x35,0x79,0x8B,0xE8,0x14,0x79,0x6A,0x75,0xFF,0xC6,0x1C,\
+    0x75,0xC3,0x47,0x39,0x36,0x97,0xFF,0x88,0x19,0x6F,0x57,0xC6,0x1C,0x49,0x51,0xFF,\
+    0x67,0x39,0x73,0xFB,0x10,0x6D,0x46,0x2D,0xFB,0x80,0x94,0xF7,0x41,0x5D,0x68,0x76,\
+    0x67,0x67,0xFF,0x35,0x45,0x57,0xBB,0xED,0x61,0x35,0xAF,0xFF,0xEE,0x03,0x6D,0xF3,\
+    0x05,0x39,0xE8,0x13,0xF7,0x7F,0x67,0x77,0x7D,0x00,0x6F,0x96,0xF9,0x28,0xFF,0x14,\
+    0x77,0x92,0xB8,0x41,0x6B,0x6A,0x17,0xFF,0x85,0x37,0x27,0x89,0xFB,0x15,0x65,0x3D,\
+    0xFF,0x27,0x49,0x8A,0xA6,0xFE,0x27,0x3D,0x13,0xFF,0x7B,0x35,0xFE,0x33,0x39,0x8D,\
+    0x6D,0x13,0xFF,0x75,0x67,0x77,0xE8,0xAE,0x07,0x6D,0x57,0xF7,0x3B,0xE8,0xA8,0x05,\
+    0x01,0x28,0x1D,0x7F,0x6C,0xFE,0x2F,0x02,0x89,0x68,0x35,0x58,0x68,0x77,0xAF,0xFB,\
+    0x1F,0xB6,0xB1,0x81,0x37,0x79,0xA9,0xEE,0x5A,0xFF,0x2D,0xB8,0xC1,0x49,0x68,0x47,\
+    0x6A,0x68,0x7F,0x39,0x49,0x28,0x58,0x6D,0x68,0x3A,0x0B,0x00,0xFF,0x43,0xB8,0xC7,\
+    0x16,0x68,0x3F,0x03,0xB8,0xFD,0x41,0x29,0x00,0xD1,0x08,0xD6,0x39,0x7C,0x5F,0xFF,\
+    0x6D,0x37,0x39,0x29,0x6D,0xC7,0xC3,0xB8,0xFF,0xC1,0x5A,0x54,0x3D,0x69,0x21,0x01,\
+    0x4B,0x5F,0x28,0xA1,0xEC,0x68,0x3A,0x1D,0x00,0x17,0x47,0x04,0xFF,0x39,0x09,0x6F,\
+    0x58,0x6D,0x37,0x79,0x16,0xF7,0x68,0x58,0x6E,0x0B,0x00,0x46,0x88,0x93,0x68,0xEF,\
+    0x39,0x19,0x54,0x88,0xA1,0x00,0x71,0x1E,0x7F,0xFF,0x2D,0x26,0x39,0x39,0x1E,0x38,\
+    0x82,0x47,0xFF,0x2D,0x11,0x68,0x3D,0x2A,0x20,0x3F,0xB6,0xED,0x11,0x4B,0x81,0x1D,\
+    0x24,0xD1,0x00,0x3C,0x5D,0x70,0xF6,0x33,0x81,0x5E,0x7A,0xA1,0x01,0x2B,0x72,0xC5,\
+    0x58,0xFF,0x4F,0x38,0x5E,0x6A,0x0F,0x6C,0x15,0x3B,0xFB,0x59,0x8C,0x29,0x00,0x33,\
+    0x09,0x6F,0x31,0x2D,0xFB,0x86,0x40,0x91,0x41,0x67,0x57,0x39,0x64,0x66,0xFF,0x29,\
+    0x47,0x3B,0x75,0x86,0x4B,0x91,0xB8,0xF9,0x71,0x67,0x41,0x8B,0x41,0x57,0x51,0x47,\
+    0x3A,0xB9,0x7F,0x68,0xB7,0xC3,0x47,0x31,0xE9,0xE8,0xC5,0x00,0xBF,0xC5,0x09,0x54,\
+    0x76,0x6D,0x75,0x91,0x40,0x94,0xFD,0x05,0xAF,0x47,0x3F,0x8A,0x48,0x3D,0x17,0x46,\
+    0xFF,0x77,0x7D,0x3F,0x3B,0x15,0x46,0x77,0x79,0xBF,0x9B,0xBE,0x0A,0x94,0x7F,0x6D,\
+    0xC3,0x81,0x75,0xF7,0x14,0xF8,0xC6,0x59,0x01,0x77,0x17,0x39,0x72,0xD9,0xF6,0x8D,\
+    0x81,0xD5,0x80,0x67,0x32,0xD5,0x82,0x0B,0xB9,0xDF,0x06,0x77,0x63,0x74,0xF9,0x0B,\
+    0x00,0x63,0x45,0x77,0x40,0xC6,0x93,0xB1,0x81,0x13,0x2F,0x55,0xE9,0xC0,0xFF,0x82,\
+    0xAE,0x13,0x69,0x5D,0xE0,0x59,0x90,0x77,0x5D,0x2A,0x65,0xD9,0x40,0x05,0x6D,0xFF,\
+    0xE7,0x83,0xDF,0x4F,0x39,0x11,0x77,0x6C,0x3F,0x81,0x0D,0x6D,0xFD,0x0D,0xAD,0x01,\
+    0x61,0x2D,0x1F,0x81,0x54,0x77,0xF7,0x6F,0x21,0x19,0xFF,0x8D,0x67,0x3C,0x6B,0xED,\
+    0xFF,0xC7,0xD1,0x47,0x39,0xC6,0x97,0x12,0xBB,0xFF,0x3F,0x38,0x59,0xBA,0x75,0x14,\
+    0xB8,0xC7,0x7E,0x65,0x01,0x67,0x7E,0x24,0x38,0x88,0x92,0x05,0x00,0xFF,0x00,0x77,\
+    0x4D,0xB8,0xC6,0x82,0xAE,0x15,0xFF,0x67,0x0D,0x2C,0x5F,0x6E,0x25,0xE0,0x15,0xFF,\
+    0xB0,0x59,0x9A,0xCC,0xAB,0x22,0x3B,0x41,0xFF,0x68,0x47,0x6C,0x15,0x78,0x89,0x14,\
+    0xCC,0xDF,0xED,0x22,0x39,0xC6,0xE4,0xED,0x80,0x39,0xC6,0x75,0xEE,0x3B,0x00,0xC4,\
+    0x3B,0x01,0x47,0x40,0x79,0x9B,0xC4,0xED,0xA8,0x9B,0xC2,0x57,0x69,0xB1,0x80,0x98,\
+    0x88,0x89,0xDE,0x01,0x41,0x75,0xE5,0x09,0x48,0x8D,0x80,0x1C,0x68,0x7F,0x3E,0x39,\
+    0x14,0x70,0x6D,0x67,0x45,0x83,0x00,0xFF,0x6D,0x05,0x51,0x39,0x32,0x75,0x45,0x47,\
+    0xFF,0xC1,0x39,0x3A,0x77,0x45,0x47,0x38,0x39,0xFF,0x3A,0x46,0x11,0x60,0x29,0x39,\
+    0x32,0x66,0xFF,0x11,0x47,0x79,0x39,0x3B,0x77,0x05,0x46,0xFF,0x29,0x39,0x38,0x59,\
+    0x51,0x47,0x29,0x65,0xFF,0x38,0x39,0x16,0x3F,0x38,0x3B,0x14,0x8F,0xFF,0x92,0x69,\
+    0x26,0x77,0x1D,0x3F,0x8A,0x87,0xFF,0xF9,0x77,0xD1,0x77,0x7D,0x63,0x65,0x19,0xFF,\
+    0x77,0x55,0x72,0x67,0x66,0x1B,0x37,0x39,0xFF,0x1E,0x0F,0xDE,0xF9,0xA8,0x75,0x14,\
+    0xB0,0xFE,0x43,0x40,0x8D,0x3D,0x09,0x80,0x39,0x78,0x43,0xFF,0xC5,0x67,0x26,0x1B,\
+    0x77,0x57,0x32,0x65,0xF7,0x66,0x77,0x1B,0x2F,0x01,0x7B,0xCF,0x39,0xD4,0xBF,0x47,\
+    0x29,0x0F,0x04,0x2F,0xE2,0x17,0x0B,0x49,0xF7,0x69,0x58,0x6D,0x2F,0x01,0x41,0x01,\
+    0x1F,0xB6,0xFE,0x4D,0x07,0x09,0x48,0x71,0x8F,0xB7,0xAD,0x37,0xB7,0x3B,0x16,0x68,\
+    0x35,0x0F,0x39,0x1C,0x6B,0x01,0x07,0xF7,0x6E,0x68,0x39,0x83,0x01,0x71,0x55,0x61,\
+    0xE7,0xFF,0x57,0x72,0x65,0x26,0x19,0x37,0x55,0x32,0xAF,0x09,0x4A,0x77,0x19,0x53,\
+    0x02,0x6C,0x53,0x18,0x3C,0xA2,0x53,0x18,0x6B,0x53,0x18,0xCF,0x80,0x53,0x16,0x31,\
+    0x53,0x18,0x64,0xAA,0x53,0x18,0x62,0x53,0x18,0x32,0x53,0x18,0x61,0x53,0x18,0x65,\
+    0xAA,0x53,0x18,0x37,0x53,0x18,0x62,0x53,0x18,0x78,0x53,0x18,0x28,0x5A,0x53,0x18,\
+    0x7F,0x53,0x15,0x48,0x25,0x81,0x81,0x6D,0x81,0x82,0xBF,0x5C,0x45,0x39,0x3D,0x77,\
+    0x38,0x05,0x00,0xC2,0xFF,0x77,0x38,0x79,0x05,0x8F,0x72,0x44,0xAA,0xFF,0x47,0x2A,\
+    0x39,0x16,0x4F,0x51,0xC7,0x39,0xFF,0x43,0xC2,0x0B,0x38,0x6F,0x45,0x39,0x7B,0xFF,\
+    0x77,0x6D,0x00,0xD5,0x39,0xD9,0x7F,0xFE,0xEF,0x47,0x39,0x22,0x2E,0x29,0x00,0x7C,\
+    0x39,0x3D,0xFF,0x4E,0x2A,0x47,0x47,0x68,0xA4,0x88,0x83,0xFF,0x39,0xC6,0x6A,0xEF,\
+    0x11,0x91,0x6F,0x26,0xFF,0x13,0x77,0x5B,0x72,0x69,0x26,0x1F,0x37,0xBF,0x5F,0x32,\
+    0x6D,0x66,0x77,0x1D,0x5F,0xC0,0x6C,0xEE,0x59,0x00,0x38,0x54,0xC5,0x53,0x00,0x92,\
+    0xBD,0x6C,0xFE,0xFB,0xC1,0x74,0xC5,0x8F,0x72,0x77,0x7E,0x47,0xFD,0x47,0x0B,0x01,\
+    0x47,0x29,0x60,0xF8,0x77,0x7D,0x3F,0x1E,0xA9,0x39,0x78,0x2E,0xFD,0x0B,0x3F,0x0B,\
+    0x3F,0xA4,0x0B,0x3F,0x0B,0x2E,0x9D,0x47,0x3F,0x0B,0x3A,0xA8,0x0B,0x00,0xE1,0xFE,\
+    0x0B,0x00,0x99,0x47,0x29,0x63,0x78,0x77,0x7D,0xBF,0x1D,0x15,0x39,0x78,0x2D,0x25,\
+    0x0B,0x00,0x0C,0xAA,0x0B,0x00,0xB9,0x0B,0x00,0xF1,0x0B,0x00,0xD0,0x0B,0x00,0xED,\
+    0xFE,0x0B,0x00,0x9D,0x47,0x29,0x62,0x64,0x77,0x7D,0xBF,0x1C,0x11,0x39,0x78,0x2C,\
+    0x29,0x0B,0x00,0x08,0x2A,0x0B,0x00,0x45,0x0B,0x00,0xF5,0x0B,0x00,0xDC,0x8F,0x3F,\
+    0x0B,0x3F,0x80,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,0x3F,0x0B,\
+    0x21,0x39,0xFF,0x3B,0xB8,0xC1,0x71,0x8F,0x68,0x69,0x7D,0xFF,0x17,0x39,0x62,0x41,\
+    0x51,0x47,0x39,0x83,0xFF,0x14,0x77,0x64,0x22,0x3F,0x49,0x69,0x17,0xFF,0x6D,0x47,\
+    0x95,0x19,0x14,0x77,0x7D,0x24,0xFF,0x8D,0x49,0x68,0x47,0x68,0x6D,0x49,0x35,0xFF,\
+    0x68,0x44,0x91,0xED,0x93,0x39,0x68,0x7D,0xFF,0xC7,0x74,0xC5,0x6C,0x3D,0x77,0x6D,\
+    0x42,0xFF,0x6D,0x0A,0x94,0xF7,0xED,0x47,0x39,0x33,0xFD,0xC2,0x17,0x0D,0x03,0xD4,\
+    0x47,0x5D,0x6D,0x00,0xFF,0x39,0x7B,0x77,0x05,0x35,0x93,0x41,0x3D,0xFF,0x57,0x11,\
+    0x47,0x2A,0x39,0x68,0x55,0x11,0xFF,0x47,0xC6,0xC3,0x68,0x47,0x51,0xF1,0x23,0xFF,\
+    0x2A,0x2C,0x77,0x38,0x54,0x78,0x39,0x3D,0xFF,0x46,0x2D,0x47,0x47,0x05,0x7D,0x49,\
+    0x51,0xFF,0x47,0xB9,0xF7,0x2E,0x3D,0x2A,0x21,0x17,0xFF,0x31,0x6E,0x77,0x68,0x20,\
+    0x37,0x73,0x2F,0xFF,0x11,0x49,0x74,0xC5,0xC9,0x98,0x77,0x6D,0xFF,0x4D,0x93,0x59,\
+    0x76,0x59,0x45,0x47,0x51,0xFF,0xA7,0xED,0xC9,0xD1,0x47,0x92,0x90,0x38,0x3F,0x12,\
+    0xAB,0x74,0xC5,0x89,0xD8,0x17,0x01,0x9B,0x00,0xFF,0x7D,0x37,0x39,0x59,0x64,0x47,\
+    0x6E,0x15,0xFF,0x7A,0x6E,0x28,0x12,0x6D,0xB8,0x51,0x49,0xFF,0x69,0x51,0x72,0x6F,\
+    0x26,0x13,0x77,0x5B,0xFF,0x72,0x69,0x26,0x13,0x37,0x39,0x33,0x09,0xF7,0x4C,0x77,\
+    0x19,0xD7,0x04,0x71,0x65,0x17,0x39,0xFF,0x60,0x5D,0x43,0x47,0x35,0x11,0x46,0x77,\
+    0xFF,0x7D,0x71,0x05,0x39,0x68,0xCF,0xD4,0x47,0xFF,0x29,0x5A,0xDC,0x12,0x61,0x67,\
+    0x38,0xE9,0xFB,0xEC,0xC7,0x0B,0x01,0xB0,0x14,0x6B,0x37,0x38,0xFF,0x59,0x68,0x77,\
+    0xA3,0x6F,0x7D,0x1F,0x2D,0xFF,0x57,0x28,0x67,0x38,0x6B,0xE8,0x95,0xE5,0xFF,0x06,\
+    0xC9,0x33,0x96,0x5D,0x25,0x74,0xC5,0xFB,0x93,0xC2,0x71,0x01,0x0A,0x94,0x22,0x38,\
+    0x47,0x7F,0x39,0x3C,0x3C,0x44,0x91,0x67,0x19,0xE9,0x01,0xFF,0x3D,0x39,0x03,0x7B,\
+    0x44,0x91,0xE7,0x99,0xFE,0x0B,0x01,0x7F,0xBC,0x13,0x51,0x77,0x7E,0x47,0x7F,0x51,\
+    0x41,0xC2,0x05,0x38,0x67,0x45,0xF5,0x00,0x7F,0x6D,0x65,0x45,0x39,0x97,0x8D,0x6D,\
+    0xE3,0x01,0xFF,0x64,0x29,0x47,0x6C,0x08,0x14,0xC1,0x77,0xDA,0xE9,0x00,0x7C,0xE9,\
+    0x02,0x3B,0x47,0x05,0x00,0xF9,0x2E,0xEF,0xC7,0x2A,0x20,0x23,0xEF,0x02,0x3F,0x89,\
+    0x2F,0xFF,0x11,0x55,0x27,0x37,0x17,0x40,0x77,0x05,0xFF,0xD9,0xBC,0x49,0x2C,0xC7,\
+    0xEA,0x25,0xF1,0xFF,0x59,0x4C,0x57,0x26,0x13,0xB2,0x88,0xA5,0xFF,0x13,0x65,0x13,\
+    0xB5,0x0F,0x54,0x77,0x6D,0xBF,0x27,0x21,0x0A,0x94,0xE7,0xFD,0x67,0x43,0x47,0xF9,\
+    0x39,0x71,0x01,0xFB,0x00,0x48,0x07,0x6C,0x27,0x25,0xFF,0x09,0x6B,0x25,0x2E,0x10,\
+    0x79,0x5C,0x68,0xBF,0x88,0x1F,0x74,0xC5,0xA9,0xF8,0xA7,0x03,0x77,0xFD,0x6D,0x29,\
+    0x01,0x07,0x6C,0x61,0x26,0x11,0x77,0xFF,0x5D,0x72,0x6B,0x26,0x17,0x77,0x51,0x32,\
+    0xFB,0x6F,0x66,0x13,0x45,0x58,0x60,0x67,0x16,0x39,0xDF,0x64,0x05,0x6D,0x65,0x56,\
+    0x13,0x40,0x2D,0x67,0xFF,0x79,0xE8,0x87,0x77,0x7D,0x16,0xF0,0x39,0xDF,0x76,0x64,\
+    0x91,0x47,0x6C,0xB3,0x00,0x38,0x54,0xFF,0xC5,0x39,0xC2,0x77,0x92,0xBD,0x6C,0x0A,\
+    0xFD,0x94,0xB3,0x00,0x2A,0x39,0x16,0x45,0x51,0x45,0xDF,0x39,0x82,0x21,0x10,0x69,\
+    0x1F,0x40,0x6E,0xCC,0x7F,0xA5,0x22,0xED,0x49,0x68,0x5D,0x32,0x47,0x03,0xFF,0x68,\
+    0x3E,0x19,0x47,0x77,0x7D,0x79,0x05,0xB7,0x3B,0x68,0x5D,0xD9,0x42,0x6C,0x11,0x41,\
+    0x00,0x3D,0xDE,0x05,0x00,0x93,0x39,0x3D,0x45,0xE5,0x40,0x0A,0xA9,0xFE,0x13,0x40,\
+    0x47,0x1B,0x07,0x77,0x61,0x67,0x79,0xFF,0x09,0x54,0x88,0x92,0x16,0xF6,0x39,0x70,\
+    0xD6,0x23,0x09,0x44,0xAC,0x5F,0x01,0x49,0x5F,0x00,0x89,0x31,0xFE,0x5F,0x02,0x70,\
+    0xC4,0xA5,0x24,0xE3,0x22,0x14,0xEF,0x77,0x38,0x47,0x6C,0x05,0x00,0xC7,0x47,0x6C,\
+    0xFE,0x41,0x03,0x49,0x68,0x59,0x72,0x6D,0x66,0x77,0xFF,0x1D,0x39,0x1C,0x68,0x3E,\
+    0x16,0x6E,0x4B,0xDF,0x42,0x47,0x37,0x2A,0x94,0x23,0x00,0xC6,0xC3,0xF5,0x3D,0xB3,\
+    0x00,0x93,0xB3,0x01,0x74,0xC5,0x8F,0x72,0xFE,0x29,0x01,0x16,0x6E,0x16,0x6D,0xBA,\
+    0x0D,0x61,0x7F,0xE7,0x59,0x6D,0x0D,0x3E,0x5F,0x4C,0xE9,0x00,0xFF,0x45,0x39,0x78,\
+    0x14,0xD9,0x37,0x39,0x09,0xFF,0x6E,0x3C,0x9D,0x4B,0x39,0x19,0x05,0x77,0xFF,0x69,\
+    0x0F,0x51,0xC6,0x96,0x58,0x78,0x26,0xFF,0x39,0xC6,0x2A,0x59,0x6D,0x17,0xB6,0x13,\
+    0xF7,0x37,0x57,0x6A,0x1F,0x41,0x39,0x18,0x09,0x48,0xFF,0x71,0x8F,0x78,0x6D,0x69,\
+    0x16,0x39,0x7C,0xFF,0x5D,0x42,0x47,0x21,0x11,0x47,0x77,0x71,0xFF,0x0D,0xBE,0x5F,\
+    0x6C,0x07,0x6D,0x27,0x07,0xFE,0x6B,0x16,0x6C,0x58,0x68,0x68,0x3E,0x58,0x68,0xFF,\
+    0x8A,0xF1,0x08,0xD6,0x39,0x64,0x5B,0x6D,0xFF,0x0D,0x3F,0x5F,0x78,0x58,0x6A,0x68,\
+    0x3D,0xFF,0x16,0x6D,0x16,0x6D,0xB9,0xA5,0x15,0x68,0xFF,0x38,0x82,0x47,0x35,0x19,\
+    0x6E,0x5F,0x72,0xFF,0x6D,0x26,0x15,0x77,0x59,0x72,0x09,0x4C,0xAB,0x39,0x68,0x97,\
+    0x41,0x79,0x05,0x00,0x27,0xC1,0x40,0xF7,0x57,0x6D,0x47,0x3B,0x11,0x00,0x69,0xCD,\
+    0x40,0x6E,0x17,0x00,0xF5,0x31,0x0B,0x00,0x61,0x0B,0x00,0x78,0x77,0x6D,0x09,0xC7,\
+    0x48,0x77,0x19,0x29,0x01,0x2F,0x03,0x05,0x0D,0x43,0x4D,0x0F,0x44,0x54,0x45,0x43}
 
 #endif
\ No newline at end of file
@@ -21,6 +21,9 @@ accept liability for any damage arising from its use.
 
 #include "t8can.h"
 #include "interfaces.h"
+#ifdef T8_SIMULATOR
+#include "t8sim.h"
+#endif
 
 // constants
 #define CMD_BUF_LENGTH      32              ///< command buffer size
@@ -45,13 +48,17 @@ void t8_can()
     // Note that at the moment this is only for T8 ECUs at 500 kbits
     t8_can_show_help();
 
+#ifdef T8_SIMULATOR
+    printf("Talking to the simulated T8 ECU, not the CAN bus\r\n");
+    t8sim_start();
+#endif
     char data[8];
-    printf("Trying to listen to  CAN P-Bus (500 kBit/s)...\r\n");
-    can_configure(2, 500000, 1);
-    if (can_wait_timeout(T8ANYMSG, data, 8, T8MESSAGETIMEOUT)) {
-        printf("Connected to Saab P-Bus\r\n");
-        printf("Switching to P-Bus active mode\r\n");
-        can_configure(2, 500000, 0);
+    printf("Listening for the CAN bus bit rate...\r\n");
+    uint32_t rate = can_autobaud();
+    if (rate) {
+        printf("Connected to a CAN bus at %lu Bit/s\r\n", rate);
+        printf("Switching to active mode\r\n");
+        can_configure(2, rate, 0);
     } else {
         printf("I did not receive any P-Bus messages\r\n");
         printf("Switching to P-Bus active mode\r\n");
@@ -65,13 +72,8 @@ void t8_can()
         }
     }
 
-    can_reset_filters();
-    can_add_filter(2, 0x645);         //645h - CIM
-    can_add_filter(2, 0x7E0);         //7E0h -
-    can_add_filter(2, 0x7E8);         //7E8h -
-    can_add_filter(2, 0x311);         //311h -
-    can_add_filter(2, 0x5E8);         //5E8h -
-    //can_add_filter(2, 0x101);         //101h -
+    can_filter_load(2, can_filter_T8);
+    t8_begin();
 
 
 // main loop
@@ -93,6 +95,7 @@ void t8_can()
             switch (rx_char) {
                     // 'ESC' key to go back to mbed Just4Trionic 'home' menu
                 case '\e':
+                    t8_end();
                     can_close();
                     return;
                     // end-of-command reached
@@ -206,6 +209,33 @@ uint8_t execute_t8_cmd()
                 printf("FAILED to connect!\r\n");
                 return TERM_ERR;
             }
+// Use the GMLAN high speed programming mode if the ECU agrees (single wire bus only)
+        case 's':
+        case 'S':
+            GMLANfast = !GMLANfast;
+            printf("High speed programming mode %s\r\n", GMLANfast ? "on" : "off");
+            if (GMLANfast && can_get_bitrate() >= GMLANFASTBITRATE)
+                printf("The bus runs at %lu Bit/s, the mode is only used on the single wire bus\r\n", can_get_bitrate());
+            return TERM_OK;
+// Silence every node on the bus while programming
+        case 'q':
+        case 'Q':
+            GMLANsilence = !GMLANsilence;
+            printf("Silencing all nodes while programming %s\r\n", GMLANsilence ? "on" : "off");
+            return TERM_OK;
+// Show how the CAN controller is coping
+        case 'E':
+            can_show_health();
+            return TERM_OK;
+#ifdef T8_SIMULATOR
+// What the simulated T8 has been asked to do
+        case 'X':
+            t8sim_report();
+            return TERM_OK;
+// Change how the simulated T8 behaves
+        case 'Y':
+            return t8sim_set(cmd_buffer + 1) ? TERM_OK : TERM_ERR;
+#endif
 // Show the VIN code
         case 'v':
             return t8_show_VIN()
@@ -246,6 +276,13 @@ void t8_can_show_help()
     printf("\r\n");
     printf("I - Try to open CAN I-Bus (47619 Bit/s)\r\n");
     printf("P - Try to open CAN P-Bus (500 kBit/s)\r\n");
+    printf("S - Toggle the high speed programming mode (%s)\r\n", GMLANfast ? "on" : "off");
+    printf("Q - Toggle silencing all nodes while programming (%s)\r\n", GMLANsilence ? "on" : "off");
+    printf("E - Show the CAN controller's error counters\r\n");
+#ifdef T8_SIMULATOR
+    printf("X - Report what the simulated T8 ECU has done\r\n");
+    printf("Yname=value - Change a simulated T8 setting, Y alone lists them\r\n");
+#endif
     printf("\r\n");
     printf("'ESC' - Return to Just4Trionic Main Menu\r\n");
     printf("\r\n");
@@ -271,6 +308,9 @@ void t8_can_show_full_help()
     printf("\r\n");
     printf("I - Try to open CAN I-Bus (47619 Bit/s)\r\n");
     printf("P - Try to open CAN P-Bus (500 kBit/s)\r\n");
+    printf("S - Toggle the high speed programming mode (%s)\r\n", GMLANfast ? "on" : "off");
+    printf("Q - Toggle silencing all nodes while programming (%s)\r\n", GMLANsilence ? "on" : "off");
+    printf("E - Show the CAN controller's error counters\r\n");
     printf("\r\n");
     printf("\r\n");
     printf("i - Send initialisation message to T8\r\n");
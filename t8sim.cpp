@@ -0,0 +1,539 @@
+// t8sim.cpp - a simulated T8 ECU
+//
+// canutils hands every frame the adapter sends to t8sim_frame(), requests are
+// reassembled and answered by a thread of their own at a lower priority than
+// the tester side, so the time the tester takes is not hidden by the ECU's.
+// The other nodes on the bus are a ticker delivering frames at the configured
+// bus load until they are told to be quiet.
+
+#include "t8sim.h"
+#include "t8utils.h"
+#include "isotp.h"
+
+#ifdef T8_SIMULATOR
+
+t8sim_config_t t8sim = {
+    T8SIM_LATENCY_MS, T8SIM_ERASE_MS, T8SIM_STMIN, T8SIM_FRAME_US, T8SIM_BUS_LOAD, T8SIM_FOOTER, 0, 0, 0
+};
+
+#define T8SIM_REQUEST (6 + GMLANTRANSFERMAX)  // longest request, a TransferData block
+// The tester can send a whole request before the lower priority ECU thread gets
+// to run, so there is room for all of its frames and a few more
+#define T8SIM_QUEUE 256                 // frames waiting for the ECU, must be a power of 2
+#if T8SIM_QUEUE < (T8SIM_REQUEST + 6) / 7 + 8
+#error T8SIM_QUEUE is too small for the longest request
+#endif
+#define T8SIM_NOISEID 0x1A0             // id of the other nodes' frames
+#define T8SIM_VIN "YS3FF45S831004321"
+
+static CANMessage t8sim_queue[T8SIM_QUEUE];
+static volatile uint32_t t8sim_head = 0;
+static volatile uint32_t t8sim_tail = 0;
+static EventFlags t8sim_event;
+static Thread t8sim_thread(osPriorityBelowNormal, 1024);
+static Ticker t8sim_noise;
+static bool t8sim_running = false;
+
+// The ECU's state
+static uint32_t t8sim_reqid;            // id the request being answered came on
+static bool t8sim_silent;               // normal communication disabled
+static bool t8sim_requested;            // programming mode requested
+static bool t8sim_programming;
+static bool t8sim_unlocked;
+static bool t8sim_download;             // RequestDownload accepted
+static bool t8sim_loader;               // the bootloader is running
+static uint16_t t8sim_seed;
+static uint32_t t8sim_load_address;     // where the bootloader upload started
+static uint32_t t8sim_load_next;        // where its next block has to go
+
+// Statistics for t8sim_report()
+static uint32_t t8sim_requests;
+static uint32_t t8sim_frames;
+static uint32_t t8sim_dropped;
+static volatile uint32_t t8sim_overruns;
+static uint32_t t8sim_read;
+static uint32_t t8sim_programmed;
+static uint32_t t8sim_checksum;
+static uint32_t t8sim_refused;
+
+static uint8_t t8sim_request_data[T8SIM_REQUEST];
+static uint8_t t8sim_response[2 + 0xFF];
+
+//
+// t8sim_frame
+//
+// Queues a frame sent by the adapter for the ECU once it is off the simulated
+// bus, called by can_sim_tx_done() with interrupts disabled.
+//
+void t8sim_frame(const CANMessage &msg)
+{
+    uint32_t head = t8sim_head;
+    if (head - t8sim_tail >= T8SIM_QUEUE) {
+        t8sim_overruns++;
+        return;
+    }
+    t8sim_queue[head & (T8SIM_QUEUE - 1)] = msg;
+    t8sim_head = head + 1;
+    t8sim_event.set(0x01);
+}
+
+static bool t8sim_get(CANMessage &msg, uint32_t timeout)
+{
+    Timer timer;
+    timer.start();
+    while (true) {
+        t8sim_event.clear(0x01);
+        uint32_t tail = t8sim_tail;
+        if (tail != t8sim_head) {
+            msg = t8sim_queue[tail & (T8SIM_QUEUE - 1)];
+            t8sim_tail = tail + 1;
+            return true;
+        }
+        int32_t remaining = timeout - timer.read_ms();
+        if (remaining <= 0)
+            return false;
+        t8sim_event.wait_any(0x01, remaining);
+    }
+}
+
+//
+// t8sim_noise_tick
+//
+// The other nodes, delivers as many frames every millisecond as fill the
+// configured share of the bus at the current bit rate
+//
+static void t8sim_noise_tick()
+{
+    static uint32_t owed = 0;           // bits * 100
+    static uint8_t count = 0;
+    const uint32_t frame = CAN_FRAME_BITS_STD + 8 * 8;
+    if (t8sim_silent || !t8sim.bus_load) {
+        owed = 0;
+        return;
+    }
+    owed += t8sim.bus_load * can_get_bitrate() / 1000;
+    while (owed >= frame * 100) {
+        owed -= frame * 100;
+        char data[8] = {(char)count++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        can_rx_inject(CANMessage(T8SIM_NOISEID, data, 8));
+    }
+}
+
+//
+// t8sim_frame_us
+//
+// How long a frame takes on the simulated bus at the current bit rate, longer
+// for the share of the bus the other nodes use. Both the adapter's frames, see
+// can_tx_load(), and the ECU's are charged this.
+//
+uint32_t t8sim_frame_us(const CANMessage &msg)
+{
+    uint32_t us = (CAN_FRAME_BITS_STD + 8 * msg.len) * 1000000 / can_get_bitrate();
+    if (!t8sim_silent && t8sim.bus_load < 100)
+        us = us * 100 / (100 - t8sim.bus_load);
+    return us;
+}
+
+//
+// t8sim_send
+//
+// Puts one of the ECU's frames on the simulated bus, taking as long as the frame
+// would.
+//
+static void t8sim_send(uint32_t id, const uint8_t *data)
+{
+    CANMessage msg(id, (const char *)data, 8);
+    t8sim_frames++;
+    wait_us(t8sim_frame_us(msg) + t8sim.frame_us);
+    if (t8sim.drop_every && t8sim_frames % t8sim.drop_every == 0) {
+        t8sim_dropped++;
+        return;
+    }
+    can_rx_inject(msg);
+}
+
+//
+// t8sim_respond
+//
+// Sends a response, in consecutive frames at the pace the tester's flow control
+// asks for if it doesn't fit in a single frame. The block size is not used, the
+// adapter always asks for everything at once.
+//
+static void t8sim_respond(uint32_t RespID, const uint8_t *data, uint16_t length)
+{
+    uint8_t frame[8];
+    memset(frame, ISOTP_PADDING, sizeof(frame));
+    if (length <= 7) {
+        frame[0] = ISOTP_SINGLE_FRAME | length;
+        memcpy(frame + 1, data, length);
+        t8sim_send(RespID, frame);
+        return;
+    }
+    frame[0] = ISOTP_FIRST_FRAME | (length >> 8);
+    frame[1] = length & 0xFF;
+    memcpy(frame + 2, data, 6);
+    t8sim_send(RespID, frame);
+    CANMessage msg;
+    do {
+        if (!t8sim_get(msg, ISOTP_N_BS))
+            return;
+    } while (msg.id != t8sim_reqid || (msg.data[0] & 0xF0) != ISOTP_FLOW_CONTROL);
+    if ((msg.data[0] & 0x0F) != ISOTP_FC_CTS)
+        return;
+    uint8_t stmin = msg.data[2];
+    uint32_t gap_us = (stmin <= 0x7F) ? stmin * 1000 : (stmin >= 0xF1 && stmin <= 0xF9) ? (stmin - 0xF0) * 100 : 0;
+    uint8_t sequence = 1;
+    for (uint16_t sent = 6; sent < length; sent += 7) {
+        uint16_t count = (length - sent < 7) ? length - sent : 7;
+        memset(frame, ISOTP_PADDING, sizeof(frame));
+        frame[0] = ISOTP_CONSECUTIVE_FRAME | (sequence++ & 0x0F);
+        memcpy(frame + 1, data + sent, count);
+        if (gap_us)
+            wait_us(gap_us);
+        t8sim_send(RespID, frame);
+    }
+}
+
+static void t8sim_negative(uint32_t RespID, uint8_t service, uint8_t nrc)
+{
+    const uint8_t response[3] = {0x7F, service, nrc};
+    t8sim_respond(RespID, response, 3);
+}
+
+//
+// t8sim_flash
+//
+// A byte of the simulated FLASH. The initial stack pointer and the footer address
+// are where t8_flash and t8_dump look for them, the rest is a fixed pattern.
+//
+static uint8_t t8sim_flash(uint32_t address)
+{
+    if (address < 4)
+        return T8POINTER >> (8 * (3 - address));
+    if (address >= 0x020140 && address < 0x020144)
+        return t8sim.footer >> (8 * (0x020143 - address));
+    return (address * 0x9E3779B1) >> 24;
+}
+
+//
+// t8sim_service
+//
+// Answers a complete request the way a T8 and its bootloader would.
+//
+static void t8sim_service(uint32_t RespID, const uint8_t *request, uint16_t length)
+{
+    uint8_t *response = t8sim_response;
+    uint16_t size = 1;
+    uint8_t service = request[0];
+    t8sim_requests++;
+    ThisThread::sleep_for(t8sim.latency_ms);
+    if (t8sim.pending_every && t8sim_requests % t8sim.pending_every == 0 && service != 0x3E) {
+        t8sim_negative(RespID, service, 0x78);
+        ThisThread::sleep_for(t8sim.latency_ms);
+    }
+    response[0] = service + 0x40;
+    switch (service) {
+        case 0x3E:                      // TesterPresent
+        case 0x10:                      // InitiateDiagnosticOperation
+        case 0x28:                      // DisableNormalCommunication
+            break;
+        case 0xA2:                      // ReportProgrammedState, fully programmed
+            response[size++] = 0x00;
+            break;
+        case 0xA5:                      // ProgrammingMode
+            if (length < 2) {
+                t8sim_negative(RespID, service, 0x12);
+                return;
+            }
+            if (request[1] != GMLANEnableProgrammingMode) {
+                t8sim_requested = true;
+                break;
+            }
+            t8sim_programming = t8sim_requested;
+            return;                     // enabling gets no answer
+        case 0x27:                      // SecurityAccess, odd levels ask for a seed, even ones send the key
+            if (length < 2) {
+                t8sim_negative(RespID, service, 0x12);
+                return;
+            }
+            response[size++] = request[1];
+            if (request[1] & 0x01) {
+                while (!t8sim_unlocked && !t8sim_seed)
+                    t8sim_seed = can_time_us();
+                response[size++] = t8sim_unlocked ? 0x00 : t8sim_seed >> 8;
+                response[size++] = t8sim_unlocked ? 0x00 : t8sim_seed & 0xFF;
+            } else if (length < 4 || ((request[2] << 8) | request[3]) != t8_security_key(t8sim_seed, request[1] - 1)) {
+                t8sim_seed = 0;
+                t8sim_negative(RespID, service, 0x35);
+                return;
+            } else {
+                t8sim_unlocked = true;
+            }
+            break;
+        case 0x34:                      // RequestDownload, the bootloader erases the FLASH
+            if (!t8sim_programming || !t8sim_unlocked) {
+                t8sim_negative(RespID, service, 0x22);
+                return;
+            }
+            if (t8sim_loader) {
+                t8sim_negative(RespID, service, 0x78);
+                ThisThread::sleep_for(t8sim.erase_ms);
+                t8sim_programmed = 0;
+                t8sim_checksum = 0;
+            }
+            t8sim_download = true;
+            break;
+        case 0x36: {                    // TransferData, the bootloader upload, its start or the BIN file
+            if (!t8sim_download || length < 6) {
+                t8sim_negative(RespID, service, 0x22);
+                return;
+            }
+            uint32_t address = (request[2] << 24) | (request[3] << 16) | (request[4] << 8) | request[5];
+            if (t8sim.refuse_every && ++t8sim_refused % t8sim.refuse_every == 0) {
+                t8sim_negative(RespID, service, 0x85);
+                return;
+            }
+            if (request[1] == GMLANEXECUTE) {
+                if (t8sim_loader || address < t8sim_load_address || address >= t8sim_load_next) {
+                    t8sim_negative(RespID, service, 0x31);
+                    return;
+                }
+                t8sim_loader = true;
+                t8sim_download = false;
+            } else if (!t8sim_loader) {
+                if (t8sim_load_next == t8sim_load_address)
+                    t8sim_load_address = t8sim_load_next = address;
+                if (address != t8sim_load_next) {
+                    t8sim_negative(RespID, service, 0x31);
+                    return;
+                }
+                t8sim_load_next += length - 6;
+            } else {
+                for (uint16_t i = 6; i < length; i++)
+                    t8sim_checksum += request[i];
+                t8sim_programmed += length - 6;
+            }
+            break;
+        }
+        case 0x21: {                    // the bootloader's ReadMemoryByAddress
+            uint32_t address = (length >= 6) ? (request[2] << 24) | (request[3] << 16) | (request[4] << 8) | request[5] : T8FLASHSIZE;
+            if (!t8sim_loader) {
+                t8sim_negative(RespID, service, 0x11);
+                return;
+            }
+            if (address + request[1] > T8FLASHSIZE) {
+                t8sim_negative(RespID, service, 0x31);
+                return;
+            }
+            response[size++] = request[1];
+            for (uint16_t i = 0; i < request[1]; i++)
+                response[size++] = t8sim_flash(address + i);
+            t8sim_read += request[1];
+            break;
+        }
+        case 0x23: {                    // ReadMemoryByAddress, 4 byte address and 2 byte size
+            uint32_t address = (length >= 7) ? (request[1] << 24) | (request[2] << 16) | (request[3] << 8) | request[4] : T8FLASHSIZE;
+            uint16_t count = (length >= 7) ? (request[5] << 8) | request[6] : 0;
+            if (address + count > T8FLASHSIZE || count > sizeof(t8sim_response) - 5) {
+                t8sim_negative(RespID, service, 0x31);
+                return;
+            }
+            memcpy(response + size, request + 1, 4);
+            size += 4;
+            for (uint16_t i = 0; i < count; i++)
+                response[size++] = t8sim_flash(address + i);
+            break;
+        }
+        case 0x1A:                      // ReadDataByIdentifier, only the VIN
+            if (length < 2 || request[1] != 0x90) {
+                t8sim_negative(RespID, service, 0x31);
+                return;
+            }
+            response[size++] = 0x90;
+            memcpy(response + size, T8SIM_VIN, sizeof(T8SIM_VIN) - 1);
+            size += sizeof(T8SIM_VIN) - 1;
+            break;
+        case 0x3B:                      // WriteDataByIdentifier
+            response[size++] = (length >= 2) ? request[1] : 0x00;
+            break;
+        case 0x20:                      // ReturnToNormalMode, the bootloader is gone
+            t8sim_silent = false;
+            t8sim_requested = false;
+            t8sim_programming = false;
+            t8sim_unlocked = false;
+            t8sim_download = false;
+            t8sim_loader = false;
+            t8sim_seed = 0;
+            t8sim_load_address = t8sim_load_next = 0;
+            break;
+        default:
+            t8sim_negative(RespID, service, 0x11);
+            return;
+    }
+    t8sim_respond(RespID, response, size);
+}
+
+//
+// t8sim_thd
+//
+// Reassembles the requests for the ECU, sending the flow control for the ones
+// that come in several frames
+//
+static void t8sim_thd()
+{
+    CANMessage msg;
+    while (true) {
+        if (!t8sim_get(msg, 1000))
+            continue;
+        if (msg.id == GMLANALLNODES) {
+            // Functional requests to all nodes, only silencing them is acted on
+            if (msg.data[0] == 0xFE && msg.data[2] == 0x28)
+                t8sim_silent = true;
+            else if (msg.data[0] == 0xFE && msg.data[2] == 0x20)
+                t8sim_silent = false;
+            continue;
+        }
+        uint32_t RespID;
+        if (msg.id == T8TSTRID)
+            RespID = T8ECU_ID;
+        else if (msg.id == T8USDTREQID)
+            RespID = T8UUDTRESPID;
+        else
+            continue;
+        t8sim_reqid = msg.id;
+        uint16_t length;
+        switch (msg.data[0] & 0xF0) {
+            case ISOTP_SINGLE_FRAME:
+                length = msg.data[0] & 0x0F;
+                if (!length || length >= msg.len)
+                    continue;
+                memcpy(t8sim_request_data, msg.data + 1, length);
+                break;
+            case ISOTP_FIRST_FRAME: {
+                length = ((msg.data[0] & 0x0F) << 8) | msg.data[1];
+                uint8_t flow[8] = {ISOTP_FLOW_CONTROL | ISOTP_FC_CTS, 0x00, t8sim.stmin, 0x00, 0x00, 0x00, 0x00, 0x00};
+                if (length > T8SIM_REQUEST) {
+                    flow[0] = ISOTP_FLOW_CONTROL | ISOTP_FC_OVERFLOW;
+                    t8sim_send(RespID, flow);
+                    continue;
+                }
+                memcpy(t8sim_request_data, msg.data + 2, 6);
+                t8sim_send(RespID, flow);
+                uint16_t received = 6;
+                uint8_t sequence = 1;
+                while (received < length && t8sim_get(msg, ISOTP_N_CR)) {
+                    if (msg.id != t8sim_reqid || (msg.data[0] & 0xF0) != ISOTP_CONSECUTIVE_FRAME)
+                        continue;
+                    if ((msg.data[0] & 0x0F) != (sequence++ & 0x0F))
+                        break;          // a frame went missing, the request is lost
+                    memcpy(t8sim_request_data + received, msg.data + 1, (length - received < 7) ? length - received : 7);
+                    received += 7;
+                }
+                if (received < length)
+                    continue;
+                break;
+            }
+            default:
+                continue;
+        }
+        t8sim_service(RespID, t8sim_request_data, length);
+    }
+}
+
+//
+// t8sim_start
+//
+// Starts the simulated ECU, or resets it if it is running, with the statistics
+//
+void t8sim_start()
+{
+    t8sim_silent = false;
+    t8sim_requested = false;
+    t8sim_programming = false;
+    t8sim_unlocked = false;
+    t8sim_download = false;
+    t8sim_loader = false;
+    t8sim_seed = 0;
+    t8sim_load_address = t8sim_load_next = 0;
+    t8sim_requests = t8sim_frames = t8sim_dropped = t8sim_overruns = 0;
+    t8sim_read = t8sim_programmed = t8sim_checksum = t8sim_refused = 0;
+    if (!t8sim_running) {
+        t8sim_thread.start(&t8sim_thd);
+        t8sim_noise.attach_us(&t8sim_noise_tick, 1000);
+        t8sim_running = true;
+    }
+}
+
+//
+// t8sim_set
+//
+// Changes one of the t8sim settings, "name=value" with the value in decimal or
+// 0x hex. An empty setting lists them all.
+//
+// return:    false for an unknown name or a value out of range
+//
+bool t8sim_set(const char *setting)
+{
+    static const char *const names[] = {"latency", "erase", "stmin", "frame", "load", "footer", "drop", "pending", "refuse"};
+    if (!*setting) {
+        printf("latency=%u erase=%u stmin=%u frame=%u load=%u footer=0x%06lX drop=%u pending=%u refuse=%u\r\n",
+               t8sim.latency_ms, t8sim.erase_ms, t8sim.stmin, t8sim.frame_us, t8sim.bus_load, t8sim.footer,
+               t8sim.drop_every, t8sim.pending_every, t8sim.refuse_every);
+        return true;
+    }
+    const char *equals = strchr(setting, '=');
+    if (!equals)
+        return false;
+    uint32_t value = strtoul(equals + 1, NULL, 0);
+    size_t length = equals - setting;
+    uint8_t n = 0;
+    while (n < sizeof(names) / sizeof(names[0]) && (strlen(names[n]) != length || strncmp(setting, names[n], length)))
+        n++;
+    if (n != 5 && value > 0xFFFF)
+        return false;
+    switch (n) {
+        case 0:
+            t8sim.latency_ms = value;
+            return true;
+        case 1:
+            t8sim.erase_ms = value;
+            return true;
+        case 2:
+            if (value > 0x7F)
+                return false;
+            t8sim.stmin = value;
+            return true;
+        case 3:
+            t8sim.frame_us = value;
+            return true;
+        case 4:
+            if (value > 100)
+                return false;
+            t8sim.bus_load = value;
+            return true;
+        case 5:
+            t8sim.footer = value;
+            return true;
+        case 6:
+            t8sim.drop_every = value;
+            return true;
+        case 7:
+            t8sim.pending_every = value;
+            return true;
+        case 8:
+            t8sim.refuse_every = value;
+            return true;
+    }
+    return false;
+}
+
+void t8sim_report()
+{
+    printf("Simulated T8: %lu requests, %lu frames sent (%lu dropped), %lu frames it had no room for\r\n",
+           t8sim_requests, t8sim_frames, t8sim_dropped, t8sim_overruns);
+    printf("Bootloader 0x%04lX bytes at 0x%06lX (%s), read 0x%06lX bytes, programmed 0x%06lX bytes, checksum 0x%08lX\r\n",
+           t8sim_load_next - t8sim_load_address, t8sim_load_address, t8sim_loader ? "running" : "not running",
+           t8sim_read, t8sim_programmed, t8sim_checksum);
+}
+
+#endif
@@ -0,0 +1,49 @@
+
+// t8sim.h - a simulated T8 ECU on a loopback CAN bus, for trying out and timing
+// t8_dump, t8_flash, t8_recover and t8_authenticate without a car
+
+#ifndef __T8SIM_H__
+#define __T8SIM_H__
+
+#include "mbed.h"
+
+#include "common.h"
+#include "canutils.h"
+
+// Built with T8_SIMULATOR defined, every frame the adapter sends goes to the
+// simulated ECU instead of the CAN controller, one at a time after as long as it
+// would take on the bus, and its replies are delivered as if they had been received. The ECU answers the GMLAN services the T8 functions
+// use, takes the real bootloader upload and then serves a 1 MB FLASH worked out
+// from the address, there isn't the RAM for a copy. What is programmed is
+// counted and checksummed instead, see t8sim_report().
+
+// Defaults for t8sim, which can be changed while the simulation runs with
+// t8sim_set(), the T8 menu's 'Y' command
+#define T8SIM_LATENCY_MS 2              // before each response
+#define T8SIM_ERASE_MS 3000             // FLASH erase when the bootloader gets RequestDownload
+#define T8SIM_STMIN 0                   // STmin in the ECU's flow controls, milliseconds
+#define T8SIM_FRAME_US 0                // extra time between the ECU's consecutive frames
+#define T8SIM_BUS_LOAD 30               // percent of the bus used by the other nodes
+#define T8SIM_FOOTER 0x0E0000           // footer address stored at 0x020140 in the FLASH
+
+struct t8sim_config_t {
+    uint16_t latency_ms;
+    uint16_t erase_ms;
+    uint8_t stmin;
+    uint16_t frame_us;
+    uint8_t bus_load;
+    uint32_t footer;
+    // Fault injection, every n-th one, 0 for never
+    uint16_t drop_every;                // frame from the ECU lost
+    uint16_t pending_every;             // request answered with 'response pending' first
+    uint16_t refuse_every;              // TransferData block refused
+};
+extern t8sim_config_t t8sim;
+
+extern void t8sim_start();
+extern void t8sim_frame(const CANMessage &msg);
+extern uint32_t t8sim_frame_us(const CANMessage &msg);
+extern void t8sim_report();
+extern bool t8sim_set(const char *setting);
+
+#endif
@@ -18,11 +18,13 @@ accept liability for any damage arising from its use.
 #include "t8utils.h"
 #include "interfaces.h"
 #include "t8bootloaders.h"
-
-Timer   TesterPresent;
+#include "isotp.h"
 
 static const uint8_t T8BootloaderRead[] = T8_BOOTLOADER_DUMP;
 static const uint8_t T8BootLoaderWrite[] = T8_BOOTLOADER_PROG;
+
+// The utility file running on the ECU, NULL if none (or it may have been lost)
+static const uint8_t *T8Resident = NULL;
 //
 // t8_initialise
 //
@@ -41,42 +43,19 @@ bool t8_initialise()
 
 bool t8_show_VIN()
 {
-    uint32_t i;
-    char T8TxFlo[] = T8FLOCTL;
-    char T8TxMsg[] = T8REQVIN;
-    char T8RxMsg[8];
+    int32_t i, length;
+    uint8_t T8TxMsg[] = T8REQVIN;
+    uint8_t T8RxMsg[0x20];
     printf("Requesting VIN from T8...\r\n");
     // Send "Request VIN" to Trionic8
-    if (!can_send_timeout (T8TSTRID, T8TxMsg, 8, T8MESSAGETIMEOUT))
-        return false;
-    // wait for the T8 to reply
-    // Read "Seed"
-    // if a message is not received id return false
-    if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
+    if (!isotp_send(T8TSTRID, T8ECU_ID, T8TxMsg, sizeof(T8TxMsg)))
         return false;
-    //* DEBUG info...
-    for (i = 0; i < 8; i++ ) printf("0x%02X ", T8RxMsg[i] );
-    printf("\r\n");
-    for (i = 5; i < 8; i++ ) printf("%c", T8RxMsg[i] );
-    printf("\r\n");
-    // Send Trionic8 a "Flow Control Message to get the rest of the VIN
-    if (!can_send_timeout (T8TSTRID, T8TxFlo, 8, T8MESSAGETIMEOUT))
+    // wait for the T8 to reply, the VIN follows the service and identifier bytes
+    length = GMLANResponse(T8TSTRID, T8ECU_ID, T8TxMsg[0], T8RxMsg, sizeof(T8RxMsg));
+    if (length < 2)
         return false;
-    if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
-        return false;
-    //* DEBUG info...
-    for (i = 0; i < 8; i++ ) printf("0x%02X ", T8RxMsg[i] );
-    printf("\r\n");
-    for (i = 1; i < 8; i++ ) printf("%c", T8RxMsg[i] );
+    for (i = 2; i < length; i++ ) printf("%c", T8RxMsg[i] );
     printf("\r\n");
-    if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
-        return false;
-    //* DEBUG info...
-    for (i = 0; i < 8; i++ ) printf("0x%02X ", T8RxMsg[i] );
-    printf("\r\n");
-    for (i = 1; i < 8; i++ ) printf("%c", T8RxMsg[i] );
-    printf("\r\n");
-    //*/
     return true;
 }
 
@@ -106,6 +85,7 @@ bool t8_write_VIN()
 //    GMLANTesterPresent(T8REQID, T8RESPID);
 //    wait_ms(2000);
 //
+    can_mailbox_flush(T8ECU_ID);
     if (!can_send_timeout (T8TSTRID, SetVin10, 8, T8MESSAGETIMEOUT)) {
         printf("Unable to write VIN\r\n");
         return false;
@@ -140,6 +120,33 @@ bool t8_write_VIN()
 //
 }
 
+//
+// t8_security_key
+//
+// works out the key the T8 expects for 'seed' at security access 'level'
+//
+uint16_t t8_security_key(uint16_t seed, char level)
+{
+    uint16_t key = (seed >> 5) | (seed << 11);
+    key += 0xB988;
+    if (level == 0xFD) {
+        key /= 3;
+        key ^= 0x8749;
+        key += 0x0ACF;
+        key ^= 0x81BF;
+    } else if (level == 0xFB) {
+        key ^= 0x8749;
+        key += 0x06D3;
+        key ^= 0xCFDF;
+    }
+    /* CIM KEY CALCULATION
+        uint16_t key = (seed + 0x9130);
+        key = (key >> 8) | (key << 8);
+        key -= 0x3FC7;
+    */
+    return key;
+}
+
 //
 // t8_authenticate
 //
@@ -162,7 +169,6 @@ bool t8_authenticate(uint32_t ReqID, uint32_t RespID, char level)
         if (GMLANSecurityAccessRequest(ReqID, RespID, level, seed))
             break;
         ThisThread::sleep_for(1000);
-        GMLANTesterPresent(ReqID, RespID);
     }
     if (i == 20) {
         printf("Unable to request SEED value for security access\r\n");
@@ -173,68 +179,115 @@ bool t8_authenticate(uint32_t ReqID, uint32_t RespID, char level)
         printf("T8 ECU is already unlocked\r\n");
         return true;
     }
-    key = (seed >> 5) | (seed << 11);
-    key += 0xB988;
-    if (level == 0xFD) {
-        key /= 3;
-        key ^= 0x8749;
-        key += 0x0ACF;
-        key ^= 0x81BF;
-    } else if (level == 0xFB) {
-        key ^= 0x8749;
-        key += 0x06D3;
-        key ^= 0xCFDF;
-    }
-    /* CIM KEY CALCULATION
-        uint16_t key = (seed + 0x9130);
-        key = (key >> 8) | (key << 8);
-        key -= 0x3FC7;
-    */
+    key = t8_security_key(seed, level);
     ThisThread::sleep_for(1);
     if (!GMLANSecurityAccessSendKey(ReqID, RespID, level, key)) {
         printf("Unable to send KEY value for security access\r\n");
         return false;
     }
     printf("Key Accepted\r\n");
-    ThisThread::sleep_for(500);       // was 5
+    GMLANReady(ReqID, RespID, 500);     // was a fixed 500 ms (and 5 before that)
     return true;
 }
 
 
 //
-// t8_dump
-//
-// dumps the T8 BIN File
-// but doesn't displays anything.
+// t8_dump_request
 //
-// inputs:    none
-// return:    bool true if there was a message, false if no message.
+// sends a ReadMemoryByAddress request for 'size' bytes at 'address'
 //
-
-bool t8_dump()
+static bool t8_dump_request(uint32_t address, uint8_t size)
 {
-    uint32_t i = 0, k = 0;
-    char T8TxMsg[8];
-    char T8RxMsg[8];
+    uint8_t T8TxMsg[6];
+    T8TxMsg[0] = 0x21;
+    T8TxMsg[1] = size;
+    T8TxMsg[2] = (uint8_t) (address >> 24);
+    T8TxMsg[3] = (uint8_t) (address >> 16);
+    T8TxMsg[4] = (uint8_t) (address >> 8);
+    T8TxMsg[5] = (uint8_t) (address);
+    if (!isotp_send(T8TSTRID, T8ECU_ID, T8TxMsg, 6)) {
+        printf("Unable to download FLASH\r\n");
+        return false;
+    }
+    return true;
+}
 
-    timer.reset();
-    timer.start();
-    printf("Creating FLASH dump file...\r\n");
+//
+// t8_bootloader_resident
+//
+// checks that 'UtilityFile' is the bootloader started last time and that it still
+// answers a short ReadMemoryByAddress, the ECU's own software would refuse one
+//
+static bool t8_bootloader_resident(const uint8_t *UtilityFile)
+{
+    uint8_t T8RxMsg[2 + 4];
+    if (T8Resident != UtilityFile)
+        return false;
+    if (t8_dump_request(0x020140, 4)
+            && GMLANResponse(T8TSTRID, T8ECU_ID, 0x21, T8RxMsg, sizeof(T8RxMsg)) == sizeof(T8RxMsg)
+            && T8RxMsg[0] == 0x61)
+        return true;
+    T8Resident = NULL;
+    return false;
+}
 
 //
-    if (!GMLANprogrammingSetupProcess(T8REQID, T8RESPID))
+// t8_start_bootloader
+//
+// All steps needed to get a bootloader running: programming mode, security access
+// and the upload. They are skipped if the same bootloader is still running from
+// the last dump or flash.
+//
+// inputs:    ids to talk to the ECU with, the utility file and its length
+// return:    bool true if the bootloader is running
+//
+static bool t8_start_bootloader(uint32_t ReqID, uint32_t RespID, const uint8_t *UtilityFile, uint32_t length)
+{
+    if (t8_bootloader_resident(UtilityFile)) {
+        printf("The bootloader is still running, skipping the setup\r\n");
+        return true;
+    }
+    T8Resident = NULL;
+//
+    if (!GMLANprogrammingSetupProcess(ReqID, RespID))
         return false;
 //
     printf("Requesting Security Access\r\n");
-    if (!t8_authenticate(T8REQID, T8RESPID, 0x01)) {
+    if (!t8_authenticate(ReqID, RespID, 0x01)) {
         printf("Unable to get Security Access\r\n");
         return false;
     }
     printf("Security Access Granted\r\n");
 //
-    if(!GMLANprogrammingUtilityFileProcess(T8REQID, T8RESPID, T8BootloaderRead))
+    if (!GMLANprogrammingUtilityFileProcess(ReqID, RespID, UtilityFile, length))
         return false;
+    T8Resident = UtilityFile;
+    return true;
+}
+
+//
+// t8_dump
+//
+// dumps the T8 BIN File
+// but doesn't displays anything.
 //
+// inputs:    none
+// return:    bool true if there was a message, false if no message.
+//
+
+static bool t8_dump_session()
+{
+    const uint8_t T8DumpBlocks[] = T8DUMPBLOCKS;
+    uint8_t T8RxMsg[2 + 0xFF];        // 0x61, block size and the data
+    int32_t length = 0;
+    uint8_t block = 0;
+
+    timer.reset();
+    timer.start();
+    printf("Creating FLASH dump file...\r\n");
+
+    if (!t8_start_bootloader(T8REQID, T8RESPID, T8BootloaderRead, sizeof(T8BootloaderRead)))
+        return false;
 //
     printf("Downloading FLASH BIN file...\r\n");
     printf("Creating FLASH dump file...\r\n");
@@ -244,92 +297,68 @@ bool t8_dump()
         return TERM_ERR;
     }
     printf("  0.00 %% complete.\r");
-    TesterPresent.start();
 
 // It is possible to save some time by only reading the program code and CAL data
 // This is just a rough calculation, and slight overestimate of the number of blocks of data needed to send the BIN file
-    T8TxMsg[0] = 0x06;
-    T8TxMsg[1] = 0x21;
-    T8TxMsg[2] = 0x80;  // Blocksize
-    T8TxMsg[3] = 0x00;  // This address (0x020140) points to the Header at the end of the BIN
-    T8TxMsg[4] = 0x02;
-    T8TxMsg[5] = 0x01;
-    T8TxMsg[6] = 0x40;
-    T8TxMsg[7] = 0xaa;
-    if (!can_send_timeout (T8TSTRID, T8TxMsg, 7, T8MESSAGETIMEOUT)) {
-        printf("Unable to download FLASH\r\n");
-        return false;
+// Reading the Header (at 0x020140, near the end of the BIN) also finds the largest block size the bootloader
+// supports, a bootloader that returns fewer bytes than asked for gets that many bytes per request from then on
+    for (uint32_t i = 0; i < sizeof(T8DumpBlocks) && !block; i++) {
+        if (!t8_dump_request(0x020140, T8DumpBlocks[i]))
+            return false;
+        length = GMLANResponse(T8TSTRID, T8ECU_ID, 0x21, T8RxMsg, sizeof(T8RxMsg));
+        if (length >= 2 + 4 && T8RxMsg[0] == 0x61)
+            block = (length - 2 < T8DumpBlocks[i]) ? length - 2 : T8DumpBlocks[i];
     }
-    if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
+    if (!block)
         return false;
-    uint32_t EndAddress = (T8RxMsg[5] << 16) | (T8RxMsg[6] << 8) | T8RxMsg[7];
+    uint32_t EndAddress = (T8RxMsg[3] << 16) | (T8RxMsg[4] << 8) | T8RxMsg[5];
     EndAddress += 0x200;    // Add some bytes for the Footer itself and to account for division rounded down later
-    char T8TxFlo[] = T8FLOCTL;
-    can_send_timeout (T8TSTRID, T8TxFlo, 8, T8MESSAGETIMEOUT);
-    for (i = 0; i < 0x12; i++) {
-        if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
-            return false;
-    }
+    if (EndAddress > T8FLASHSIZE)
+        EndAddress = T8FLASHSIZE;
     printf("Reading your BIN file adjusted for footer = 0x%06lX Bytes\r\n", EndAddress );
-
-    for ( uint32_t StartAddress = 0x0; StartAddress < EndAddress; StartAddress +=0x80 ) {     // 0x100000
-        T8TxMsg[0] = 0x06;
-        T8TxMsg[1] = 0x21;
-        T8TxMsg[2] = 0x80;  // Blocksize
-        T8TxMsg[3] = (char) (StartAddress >> 24);
-        T8TxMsg[4] = (char) (StartAddress >> 16);
-        T8TxMsg[5] = (char) (StartAddress >> 8);
-        T8TxMsg[6] = (char) (StartAddress);
-        T8TxMsg[7] = 0xaa;
+    printf("Reading 0x%02X bytes per request\r\n", block);
+
+// The request for the next block is sent as soon as a block has arrived so that the ECU
+// is busy answering it while this block is written to the file, the CAN interrupt keeps
+// collecting its frames in the meantime. There is always a request outstanding so
+// TesterPresent is left to the background keep alive, which only speaks when the bus is quiet.
+    Timer transfer;
+    transfer.start();
+    uint8_t size = (EndAddress < block) ? EndAddress : block;
+    if (!t8_dump_request(0, size))
+        return false;
+    for ( uint32_t StartAddress = 0x0; StartAddress < EndAddress; StartAddress += size ) {     // 0x100000
+        size = (EndAddress - StartAddress < block) ? EndAddress - StartAddress : block;
 #ifdef DEBUG
         printf("block %#.3f\r\n",timer.read());
 #endif
-        if (!can_send_timeout (T8TSTRID, T8TxMsg, 7, T8MESSAGETIMEOUT)) {
-            printf("Unable to download FLASH\r\n");
-            return false;
-        }
-        if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
+        if (GMLANResponse(T8TSTRID, T8ECU_ID, 0x21, T8RxMsg, sizeof(T8RxMsg)) != 2 + size)
             return false;
 #ifdef DEBUG
-        printf("first %#.3f\r\n",timer.read());
+        printf("data %#.3f\r\n",timer.read());
 #endif
-        uint32_t txpnt = 0;
-        for (k = 4; k < 8; k++ ) file_buffer[txpnt++] = T8RxMsg[k];
-
-        uint8_t DataFrames = 0x12;
-        char iFrameNumber = 0x21;
-        char T8TxFlo[] = T8FLOCTL;
-        can_send_timeout (T8TSTRID, T8TxFlo, 8, T8MESSAGETIMEOUT);
-#ifdef DEBUG
-        printf("flowCtrl %#.3f\r\n",timer.read());
-#endif
-        for (i = 0; i < DataFrames; i++) {
-            if (!can_wait_timeout(T8ECU_ID, T8RxMsg, 8, T8MESSAGETIMEOUT))
+        uint32_t NextAddress = StartAddress + size;
+        if (NextAddress < EndAddress) {
+            if (!t8_dump_request(NextAddress, (EndAddress - NextAddress < block) ? EndAddress - NextAddress : block))
                 return false;
-#ifdef DEBUG
-            printf("Consec %#.3f\r\n",timer.read());
-#endif
-            iFrameNumber++;
-            for (k = 1; k < 8; k++ ) file_buffer[txpnt++] = T8RxMsg[k];
         }
-        fwrite((file_buffer), 1, 0x80, fp);
+        fwrite((T8RxMsg + 2), 1, size, fp);
         if (ferror (fp)) {
             fclose (fp);
             printf ("Error writing to the FLASH BIN file.\r\n");
             return TERM_ERR;
         }
         printf("%6.2f\r", (100.0*(float)StartAddress)/(float)(EndAddress) );
-        if (TesterPresent.read_ms() > 2000) {
-            GMLANTesterPresent(T8REQID, T8RESPID);
-            TesterPresent.reset();
-        }
+        GMLANSessionService();          // let other ECUs' sessions carry on, e.g. keep the CIM awake
     }
+    transfer.stop();
+    printf("Read 0x%06lX bytes at %.1f KB/s\r\n", EndAddress, (float)EndAddress / 1024.0 / transfer.read());
 
     for (uint32_t i = 0; i < 0x80; i++)
         file_buffer[i] = 0xFF;
-    while ( ftell(fp) < 0x100000 ) {
+    while ( ftell(fp) < T8FLASHSIZE ) {
 //  for ( uint32_t StartAddress = EndAddress; StartAddress < 0x100000; StartAddress +=0x80 ) {
-        fwrite((file_buffer), 1, 0x80, fp);
+        fwrite((file_buffer), 1, (T8FLASHSIZE - ftell(fp) < 0x80) ? T8FLASHSIZE - ftell(fp) : 0x80, fp);
         if (ferror (fp)) {
             fclose (fp);
             printf ("Error writing to the FLASH BIN file.\r\n");
@@ -345,36 +374,87 @@ bool t8_dump()
 }
 
 
-bool t8_flash()
-{
-    uint32_t i = 0, j = 0, k = 0;
+//
+// The BIN file is sent by a pipeline of three stages:
+// - t8_flash_rd_thd reads blocks of 0xE0 bytes from the file into free slots
+//   and encrypts them, a word at a time, with a precomputed keystream
+// - t8_flash_bin sends the full slots to the ECU with TransferData
+// so the next block is ready before the ECU acknowledges the current one.
+//
+// The key is 6 bytes long and a block is 0xE0 bytes so block i starts at
+// position (0xE0*i) % 6 = (2*i) % 6 of the key, there are only 3 different
+// keystreams for a whole block.
+//
+#define T8FLASHBLOCK 0xE0
+#define T8FLASHSLOTS 4
+#define T8FLASHPHASES 3
 
-    timer.reset();
-    timer.start();
-    printf("FLASHing T8 BIN file...\r\n");
+typedef struct {
+    uint32_t data[T8FLASHBLOCK / 4];
+} t8_flash_slot_t;
+
+static t8_flash_slot_t t8_flash_slots[T8FLASHSLOTS];
+static Semaphore t8_flash_slot_free(T8FLASHSLOTS, T8FLASHSLOTS);
+static Semaphore t8_flash_slot_full(0, T8FLASHSLOTS);
+static uint32_t t8_keystream[T8FLASHPHASES][T8FLASHBLOCK / 4];
+static FILE *t8_flash_fp;
+static uint32_t t8_flash_blocks;
+static volatile bool t8_flash_error;
+static volatile bool t8_flash_abort;
 
 //
-    if (!GMLANprogrammingSetupProcess(T8REQID, T8RESPID))
-        return false;
+// t8_keystream_init
 //
-    printf("Requesting Security Access\r\n");
-    if (!t8_authenticate(T8REQID, T8RESPID, 0x01)) {
-        printf("Unable to get Security Access\r\n");
-        return false;
+// works out the keystream for each of the positions in the key a block can start at
+//
+static void t8_keystream_init()
+{
+    const uint8_t key[6] = { 0x39, 0x68, 0x77, 0x6D, 0x47, 0x39 };
+    for (uint32_t phase = 0; phase < T8FLASHPHASES; phase++) {
+        uint8_t *stream = (uint8_t *)t8_keystream[phase];
+        for (uint32_t j = 0; j < T8FLASHBLOCK; j++)
+            stream[j] = key[((2 * phase) + j) % 6];
     }
-    printf("Security Access Granted\r\n");
+}
+
 //
-// All steps needed to transfer and start a bootloader ('Utility File' in GMLAN parlance)
-//    const uint8_t BootLoader[] = T8BootloaderProg;
-//    if(!GMLANprogrammingUtilityFileProcess(T8REQID, T8RESPID, BootLoader))
-    if(!GMLANprogrammingUtilityFileProcess(T8REQID, T8RESPID, T8BootLoaderWrite))
-        return false;
+// t8_flash_rd_thd
+//
+// reads and encrypts the blocks of the BIN file for t8_flash_bin
+//
+static void t8_flash_rd_thd()
+{
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < t8_flash_blocks; i++) {
+        t8_flash_slot_free.acquire();
+        if (t8_flash_abort)
+            return;
+        uint32_t *data = t8_flash_slots[slot].data;
+        if (!fread(data, T8FLASHBLOCK, 1, t8_flash_fp)) {
+            t8_flash_error = true;
+            t8_flash_slot_full.release();
+            return;
+        }
+        const uint32_t *stream = t8_keystream[i % T8FLASHPHASES];
+        for (uint32_t w = 0; w < T8FLASHBLOCK / 4; w++)
+            data[w] ^= stream[w];
+        t8_flash_slot_full.release();
+        slot = (slot + 1) % T8FLASHSLOTS;
+    }
+}
+
+//
+// t8_flash_bin
 //
+// checks the BIN file, erases the FLASH and sends the BIN file to the T8 bootloader,
+// then returns the ECU to normal mode. Shared by t8_flash() and t8_recover().
+//
+// inputs:    none
+// return:    bool true if the ECU was programmed, false if not.
+//
+static bool t8_flash_bin()
+{
     uint32_t StartAddress = 0x020000;
-    uint32_t txpnt = 0;
-    char iFrameNumber = 0x21;
-    char GMLANMsg[8];
-    char data2Send[0xE0];
 //
     // fopen modified.bin here, check it is OK and work out how much data I need to send
     // need lots of fcloses though
@@ -382,7 +462,7 @@ bool t8_flash()
     FILE *fp = fopen("/local/modified.bin", "r");    // Open "modified.bin" on the local file system for reading
     if (!fp) {
         printf("Error: I could not find the BIN file MODIFIED.BIN\r\n");;
-        return TERM_ERR;
+        return false;
     }
     // obtain file size - it should match the size of the FLASH chips:
     fseek (fp , 0 , SEEK_END);
@@ -393,7 +473,7 @@ bool t8_flash()
     uint32_t stack_long = 0;
     if (!fread(&stack_long,4,1,fp)) {
         fclose(fp);
-        return TERM_ERR;
+        return false;
     }
     stack_long = (stack_long >> 24) | ((stack_long << 8) & 0x00FF0000) | ((stack_long >> 8) & 0x0000FF00) |  (stack_long << 24);
 //
@@ -401,7 +481,7 @@ bool t8_flash()
         fclose(fp);
         printf("The BIN file does not appear to be for a T8 ECU :-(\r\n");
         printf("BIN file size: %#010lx, FLASH chip size: %#010x, Pointer: %#010lx.\r\n", file_size, T7FLASHSIZE, stack_long);
-        return TERM_ERR;
+        return false;
     }
 // It is possible to save some time by only sending the program code and CAL data
 // This is just a rough calculation, and slight overestimate of the number of blocks of data needed to send the BIN file
@@ -409,14 +489,14 @@ bool t8_flash()
     fseek(fp,0x020140,SEEK_SET);
     if (!fread(&blocks2Send,4,1,fp)) {
         fclose(fp);
-        return TERM_ERR;
+        return false;
     }
     blocks2Send = (blocks2Send >> 24) | ((blocks2Send << 8) & 0x00FF0000) | ((blocks2Send >> 8) & 0x0000FF00) |  (blocks2Send << 24);
     printf("Start address of BIN file's Footer area = 0x%06lX\r\n", blocks2Send );
     blocks2Send += 0x200;       // Add some bytes for the Footer itself and to account for division rounded down later
     blocks2Send -= 0x020000;    // Remove 0x020000 because we don't send the bootblock and adaptation blocks
     printf("Amount of data to send BIN file adjusted for footer = 0x%06lX Bytes\r\n", blocks2Send );
-    blocks2Send /= 0xE0;
+    blocks2Send /= T8FLASHBLOCK;
     printf("Number of Blocks of 0xE0 Bytes needed to send BIN file = 0x%04lX\r\n", blocks2Send );
 // Move BIN file pointer to start of data
     fseek (fp , 0x020000 , SEEK_SET);
@@ -427,209 +507,170 @@ bool t8_flash()
         printf("Unable to erase the FLASH chip!\r\n");
         return false;
     }
+// Start reading the BIN file
+    t8_keystream_init();
+    while (t8_flash_slot_full.try_acquire());
+    while (t8_flash_slot_free.try_acquire());
+    for (uint32_t i = 0; i < T8FLASHSLOTS; i++)
+        t8_flash_slot_free.release();
+    t8_flash_fp = fp;
+    t8_flash_blocks = blocks2Send;
+    t8_flash_error = false;
+    t8_flash_abort = false;
+    Thread flash_rd(osPriorityNormal, 2048);
+    flash_rd.start(&t8_flash_rd_thd);
 // Now send the BIN file
-    GMLANTesterPresent(T8REQID, T8RESPID);
-    TesterPresent.start();
+    GMLANPaceStart();
     printf("Sending FLASH BIN file\r\n");
     printf("  0.00 %% complete.\r");
-    for (i=0; i<blocks2Send; i++) {
-        // get a block of 0xE0 bytes in an array called data2Send
-        if (!fread(data2Send,0xE0,1,fp)) {
-            fclose(fp);
+    bool status = true;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < blocks2Send; i++) {
+        t8_flash_slot_full.acquire();
+        if (t8_flash_error) {
             printf("\r\nError reading the BIN file MODIFIED.BIN\r\n");
-            return false;
+            status = false;
+            break;
         }
-        // encrypt data2Send array by XORing with 6 different values in a ring (modulo function)
-        char key[6] = { 0x39, 0x68, 0x77, 0x6D, 0x47, 0x39 };
-        for ( j = 0; j < 0xE0; j++ )
-            data2Send[j] ^= key[(((0xE0*i)+j) % 6)];
         // Send the block of data
-        if (!GMLANDataTransferFirstFrame(T8REQID, T8RESPID, 0xE6, GMLANDOWNLOAD, StartAddress)) {
-            fclose(fp);
-            printf("\r\nUnable to start BIN File Upload\r\n");
-            return false;
-        }
-        // Send 0x20 messages of 0x07 bytes each (0x20 * 0x07 = 0xE0)
-        txpnt = 0;
-        iFrameNumber = 0x21;
-        for (j=0; j < 0x20; j++) {
-            GMLANMsg[0] = iFrameNumber;
-            for (k=1; k<8; k++)
-                GMLANMsg[k] = data2Send[txpnt++];
-            if (!can_send_timeout(T8REQID, GMLANMsg, 8, GMLANPTCT)) {
-                fclose(fp);
-                printf("\r\nUnable to send BIN File\r\n");
-                return false;
-            }
-            ++iFrameNumber &= 0x2F;
-            wait_us(1000);   // can be as low as 250 for an ECU on its own, but need 1000 (1ms) to work in a car (use a longer delay to be ultrasafe??? )
-        }
-        if (!GMLANDataTransferBlockAcknowledge(T8RESPID)) {
-            fclose(fp);
-            return false;
-        }
-        if (TesterPresent.read_ms() > 2000) {
-            GMLANTesterPresent(T8REQID, T8RESPID);
-            TesterPresent.reset();
+        if (!GMLANTransferData(T8REQID, T8RESPID, GMLANDOWNLOAD, StartAddress, (uint8_t *)t8_flash_slots[slot].data, T8FLASHBLOCK)) {
+            printf("\r\nUnable to send BIN File\r\n");
+            status = false;
+            break;
         }
-        StartAddress += 0xE0;
+        t8_flash_slot_free.release();
+        slot = (slot + 1) % T8FLASHSLOTS;
+        StartAddress += T8FLASHBLOCK;
+        GMLANSessionService();
         printf("%6.2f\r", (100.0*(float)i)/(float)(blocks2Send) );
     }
+    if (!status) {
+        t8_flash_abort = true;
+        t8_flash_slot_free.release();
+    }
+    flash_rd.join();
+    fclose(fp);
+    GMLANPaceReport();
+    if (!status)
+        return false;
 // FLASHing complete
     printf("%6.2f\r\n", (float)100 );
 // End programming session and return to normal mode
+    T8Resident = NULL;
     if (!GMLANReturnToNormalMode(T8REQID, T8RESPID)) {
-        fclose(fp);
         printf("UH-OH! T8 ECU did not Return To Normal Mode!!\r\n");
         return false;
     }
+    return true;
+}
+
+
+static bool t8_flash_session()
+{
+    timer.reset();
+    timer.start();
+    printf("FLASHing T8 BIN file...\r\n");
+
+    if (!t8_start_bootloader(T8REQID, T8RESPID, T8BootLoaderWrite, sizeof(T8BootLoaderWrite)))
+        return false;
+//
+    if (!t8_flash_bin())
+        return false;
     timer.stop();
     printf("SUCCESS! FLASHing the BIN file took %#.1f seconds.\r\n",timer.read());
-    fclose(fp);
     return true;
 }
 
-bool t8_recover()
+static bool t8_recover_session()
 {
-    uint32_t i = 0, j = 0, k = 0;
-
     timer.reset();
     timer.start();
     printf("Recovering your T8 ECU ...\r\n");
 //
-    if (!GMLANprogrammingSetupProcess(T8USDTREQID, T8UUDTRESPID))
+    if (!t8_start_bootloader(T8USDTREQID, T8UUDTRESPID, T8BootLoaderWrite, sizeof(T8BootLoaderWrite)))
         return false;
 //
-    printf("Requesting Security Access\r\n");
-    if (!t8_authenticate(T8USDTREQID, T8UUDTRESPID, 0x01)) {
-        printf("Unable to get Security Access\r\n");
+    if (!t8_flash_bin())
         return false;
-    }
-    printf("Security Access Granted\r\n");
+    timer.stop();
+    printf("SUCCESS: Your T8 ECU has been recovered.\r\n");
+    return true;
+}
+
 //
-//    const uint8_t BootLoader[] = T8BootloaderProg;
-//    if(!GMLANprogrammingUtilityFileProcess(T8USDTREQID, T8UUDTRESPID, BootLoader))
-    if(!GMLANprogrammingUtilityFileProcess(T8USDTREQID, T8UUDTRESPID, T8BootLoaderWrite))
-        return false;
+// t8_dump, t8_flash and t8_recover
 //
-
-
-// All steps needed to transfer and start a bootloader ('Utility File' in GMLAN parlance)
-    uint32_t StartAddress = 0x020000;
-    uint32_t txpnt = 0;
-    char iFrameNumber = 0x21;
-    char GMLANMsg[8];
-    char data2Send[0xE0];
+// keep the ECU in its diagnostic session with a background TesterPresent for
+// as long as they are talking to it, and afterwards while a bootloader is left
+// running so the next dump or flash can use it, until t8_end()
 //
-    // fopen modified.bin here, check it is OK and work out how much data I need to send
-    // need lots of fcloses though
-    printf("Checking the FLASH BIN file...\r\n");
-    FILE *fp = fopen("/local/modified.bin", "r");    // Open "modified.bin" on the local file system for reading
-    if (!fp) {
-        printf("Error: I could not find the BIN file MODIFIED.BIN\r\n");;
-        return TERM_ERR;
+bool t8_dump()
+{
+    GMLANKeepAliveStart(T8REQID, T8RESPID, GMLANKEEPALIVEMS, false);
+    bool result = t8_dump_session();
+    if (!T8Resident) {
+        GMLANKeepAliveStop(T8REQID);
+        GMLANKeepAliveStop(GMLANALLNODES);
+        GMLANRestoreBitrate();
     }
-    // obtain file size - it should match the size of the FLASH chips:
-    fseek (fp , 0 , SEEK_END);
-    uint32_t file_size = ftell (fp);
-    rewind (fp);
+    return result;
+}
 
-    // read the initial stack pointer value in the BIN file - it should match the value expected for the type of ECU
-    uint32_t stack_long = 0;
-    if (!fread(&stack_long,4,1,fp)) {
-        fclose(fp);
-        return TERM_ERR;
+bool t8_flash()
+{
+    GMLANKeepAliveStart(T8REQID, T8RESPID, GMLANKEEPALIVEMS, false);
+    bool result = t8_flash_session();
+    if (!T8Resident) {
+        GMLANKeepAliveStop(T8REQID);
+        GMLANKeepAliveStop(GMLANALLNODES);
+        GMLANRestoreBitrate();
     }
-    stack_long = (stack_long >> 24) | ((stack_long << 8) & 0x00FF0000) | ((stack_long >> 8) & 0x0000FF00) |  (stack_long << 24);
+    return result;
+}
+
 //
-    if (file_size != T8FLASHSIZE || stack_long != T8POINTER) {
-        fclose(fp);
-        printf("The BIN file does not appear to be for a T8 ECU :-(\r\n");
-        printf("BIN file size: %#010lx, FLASH chip size: %#010x, Pointer: %#010lx.\r\n", file_size, T7FLASHSIZE, stack_long);
-        return TERM_ERR;
-    }
-// It is possible to save some time by only sending the program code and CAL data
-// This is just a rough calculation, and slight overestimate of the number of blocks of data needed to send the BIN file
-    uint32_t blocks2Send;
-    fseek(fp,0x020140,SEEK_SET);
-    if (!fread(&blocks2Send,4,1,fp)) {
-        fclose(fp);
-        return TERM_ERR;
-    }
-    blocks2Send = (blocks2Send >> 24) | ((blocks2Send << 8) & 0x00FF0000) | ((blocks2Send >> 8) & 0x0000FF00) |  (blocks2Send << 24);
-    printf("Start address of BIN file's Footer area = 0x%06lX\r\n", blocks2Send );
-    blocks2Send += 0x200;       // Add some bytes for the Footer itself and to account for division rounded down later
-    blocks2Send -= 0x020000;    // Remove 0x020000 because we don't send the bootblock and adaptation blocks
-    printf("Amount of data to send BIN file adjusted for footer = 0x%06lX Bytes\r\n", blocks2Send );
-    blocks2Send /= 0xE0;
-    printf("Number of Blocks of 0xE0 Bytes needed to send BIN file = 0x%04lX\r\n", blocks2Send );
-// Move BIN file pointer to start of data
-    fseek (fp , 0x020000 , SEEK_SET);
-// Erase the FLASH
-    printf("Waiting for FLASH to be Erased\r\n");
-    if (!GMLANRequestDownload(T8REQID, T8RESPID, GMLANRequestDownloadModeEncrypted)) {
-        fclose(fp);
-        printf("Unable to erase the FLASH chip!\r\n");
-        return false;
-    }
-// Now send the BIN file
-    GMLANTesterPresent(T8REQID, T8RESPID);
-    TesterPresent.start();
-    printf("Sending FLASH BIN file\r\n");
-    printf("  0.00 %% complete.\r");
-    for (i=0; i<blocks2Send; i++) {
-        // get a block of 0xE0 bytes in an array called data2Send
-        if (!fread(data2Send,0xE0,1,fp)) {
-            fclose(fp);
-            printf("\r\nError reading the BIN file MODIFIED.BIN\r\n");
-            return false;
-        }
-        // encrypt data2Send array by XORing with 6 different values in a ring (modulo function)
-        char key[6] = { 0x39, 0x68, 0x77, 0x6D, 0x47, 0x39 };
-        for ( j = 0; j < 0xE0; j++ )
-            data2Send[j] ^= key[(((0xE0*i)+j) % 6)];
-        // Send the block of data
-        if (!GMLANDataTransferFirstFrame(T8REQID, T8RESPID, 0xE6, GMLANDOWNLOAD, StartAddress)) {
-            fclose(fp);
-            printf("\r\nUnable to start BIN File Upload\r\n");
-            return false;
-        }
-        // Send 0x20 messages of 0x07 bytes each (0x20 * 0x07 = 0xE0)
-        txpnt = 0;
-        iFrameNumber = 0x21;
-        for (j=0; j < 0x20; j++) {
-            GMLANMsg[0] = iFrameNumber;
-            for (k=1; k<8; k++)
-                GMLANMsg[k] = data2Send[txpnt++];
-            if (!can_send_timeout(T8REQID, GMLANMsg, 8, GMLANPTCT)) {
-                fclose(fp);
-                printf("\r\nUnable to send BIN File\r\n");
-                return false;
-            }
-            ++iFrameNumber &= 0x2F;
-            wait_us(1000);   // was 250 use 1000 or wait_ms(1) to be ultrasafe
-        }
-        if (!GMLANDataTransferBlockAcknowledge(T8RESPID)) {
-            fclose(fp);
-            return false;
-        }
-        if (TesterPresent.read_ms() > 2000) {
-            GMLANTesterPresent(T8REQID, T8RESPID);
-            TesterPresent.reset();
-        }
-        StartAddress += 0xE0;
-        printf("%6.2f\r", (100.0*(float)i)/(float)(blocks2Send) );
+// t8_begin
+//
+// Entering the T8 menu: the T8's replies get their mailboxes for as long as the
+// menu is used, so an answer that comes late is kept with the other T8 replies,
+// where the next request throws it away, instead of turning up in the receive ring.
+//
+void t8_begin()
+{
+    can_mailbox_open(T8RESPID);
+    can_mailbox_open(T8UUDTRESPID);
+}
+
+//
+// t8_end
+//
+// Leaving the T8 menu: a bootloader left running for the next dump or flash is
+// told to return to normal mode so the ECU starts its own software again, and
+// everything else the session left running is stopped.
+//
+void t8_end()
+{
+    if (T8Resident) {
+        T8Resident = NULL;
+        printf("Returning the T8 to normal mode\r\n");
+        if (!GMLANReturnToNormalMode(T8REQID, T8RESPID))
+            printf("UH-OH! T8 ECU did not Return To Normal Mode!!\r\n");
     }
-// FLASHing complete
-    printf("%6.2f\r\n", (float)100 );
-// End programming session and return to normal mode
-    if (!GMLANReturnToNormalMode(T8REQID, T8RESPID)) {
-        fclose(fp);
-        printf("UH-OH! T8 ECU did not Return To Normal Mode!!\r\n");
-        return false;
+    GMLANEnd();
+    can_mailbox_close(T8UUDTRESPID);
+    can_mailbox_close(T8RESPID);
+}
+
+bool t8_recover()
+{
+    GMLANKeepAliveStart(T8USDTREQID, T8UUDTRESPID, GMLANKEEPALIVEMS, false);
+    GMLANKeepAliveStart(T8REQID, T8RESPID, GMLANKEEPALIVEMS, false);
+    bool result = t8_recover_session();
+    if (!T8Resident) {
+        GMLANKeepAliveStop(T8REQID);
+        GMLANKeepAliveStop(GMLANALLNODES);
+        GMLANRestoreBitrate();
     }
-    timer.stop();
-    fclose(fp);
-    printf("SUCCESS: Your T8 ECU has been recovered.\r\n");
-    return true;
+    GMLANKeepAliveStop(T8USDTREQID);
+    return result;
 }
@@ -23,14 +23,11 @@
 
 //#define T8REQVIN    {0x02,0x09,0x02,0x00,0x00,0x00,0x00,0x00}
 // Request VIN using ReadDataByIdentifier method using DID
-#define T8REQVIN    {0x02,0x1A,0x90,0x00,0x00,0x00,0x00,0x00}
-
-
-// A "Flow Control" message. Send to let T8 it is OK to send the rest of the messages it has
-#define T8FLOCTL    {0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00}
+#define T8REQVIN    {0x1A,0x90}
 
 
 // read_trionic8
+#define T8DUMPBLOCKS {0xF0, 0xC0, 0x80} // ReadMemoryByAddress block sizes to try, largest first
 
 
 // flash_trionic8
@@ -45,10 +42,13 @@
 extern bool t8_initialise();
 extern bool t8_show_VIN();
 extern bool t8_write_VIN();
+extern uint16_t t8_security_key(uint16_t seed, char level);
 extern bool t8_authenticate(uint32_t ReqID, uint32_t RespID, char level);
 extern bool t8_dump();
 extern bool t8_flash();
 extern bool t8_recover();
+extern void t8_begin();
+extern void t8_end();
 
 
 #endif
\ No newline at end of file
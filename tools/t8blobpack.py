@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Compress the T8 bootloader utility files for the firmware image.
+
+Reads the raw byte arrays from t8bootloaders_raw.h and writes t8bootloaders.h
+with the same macro names holding a header and the LZSS compressed bootloader.
+The header is three big endian longs: the size of the bootloader, the address
+it is loaded at and its entry point. lzss.cpp decompresses the bootloader while
+GMLANprogrammingUtilityFileProcess sends it.
+
+usage: t8blobpack.py [raw header] [output header]
+"""
+
+import os
+import re
+import struct
+import sys
+
+# Must match lzss.h
+OFFSET_BITS = 10
+LENGTH_BITS = 6
+MIN_MATCH = 3
+WINDOW = 1 << OFFSET_BITS
+MAX_MATCH = (1 << LENGTH_BITS) - 1 + MIN_MATCH
+
+# name: (load address, entry point)
+BLOBS = {
+    'T8_BOOTLOADER_PROG': (0x102400, 0x102460),
+    'T8_BOOTLOADER_DUMP': (0x102400, 0x102460),
+}
+
+# The raw utility files hold blocks of 0xEA bytes of bootloader, each followed
+# by 4 padding bytes, and then the last 4 bytes of the bootloader
+RAW_BLOCK = 0xEA
+RAW_PADDING = 4
+RAW_TAIL = 4
+
+
+def read_blob(source, name):
+    match = re.search(r'#define ' + name + r' \{\\(.*?)\}', source, re.S)
+    if not match:
+        sys.exit('%s not found' % name)
+    return bytes(int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', match.group(1)))
+
+
+def strip_padding(data):
+    image = bytearray()
+    pos = 0
+    while len(data) - pos >= RAW_BLOCK + RAW_PADDING + RAW_TAIL:
+        image += data[pos:pos + RAW_BLOCK]
+        pos += RAW_BLOCK + RAW_PADDING
+    image += data[pos:pos + RAW_TAIL]
+    return bytes(image)
+
+
+def compress(data):
+    """LZSS: a flag byte before every 8 items, bit set for a literal byte,
+    bit clear for a 2 byte match of (offset - 1) and (length - MIN_MATCH)."""
+    out = bytearray()
+    chains = {}
+    i = 0
+    while i < len(data):
+        flag_pos = len(out)
+        out.append(0)
+        for bit in range(8):
+            if i >= len(data):
+                break
+            best_len, best_off = 0, 0
+            for j in reversed(chains.get(data[i:i + MIN_MATCH], [])):
+                if i - j > WINDOW:
+                    break
+                k = 0
+                while k < MAX_MATCH and i + k < len(data) and data[j + k] == data[i + k]:
+                    k += 1
+                if k > best_len:
+                    best_len, best_off = k, i - j
+            step = best_len if best_len >= MIN_MATCH else 1
+            if step == 1:
+                out[flag_pos] |= 1 << bit
+                out.append(data[i])
+            else:
+                code = best_off - 1
+                out.append(code & 0xFF)
+                out.append(((code >> 8) << LENGTH_BITS) | (best_len - MIN_MATCH))
+            for p in range(i, i + step):
+                chains.setdefault(data[p:p + MIN_MATCH], []).append(p)
+            i += step
+    return bytes(out)
+
+
+def decompress(packed):
+    out = bytearray()
+    i = 0
+    while i < len(packed):
+        flags = packed[i]
+        i += 1
+        for bit in range(8):
+            if i >= len(packed):
+                break
+            if flags & (1 << bit):
+                out.append(packed[i])
+                i += 1
+            else:
+                offset = (packed[i] | ((packed[i + 1] >> LENGTH_BITS) << 8)) + 1
+                length = (packed[i + 1] & ((1 << LENGTH_BITS) - 1)) + MIN_MATCH
+                i += 2
+                for _ in range(length):
+                    out.append(out[-offset])
+    return bytes(out)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    raw = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, 't8bootloaders_raw.h')
+    output = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, '..', 't8bootloaders.h')
+    source = open(raw).read()
+    lines = ['#ifndef __T8BOOTLOADERS_H__',
+             '#define __T8BOOTLOADERS_H__',
+             '',
+             '// Generated by tools/t8blobpack.py from tools/t8bootloaders_raw.h, do not edit.',
+             '// LZSS compressed T8 bootloader utility files, see lzss.h',
+             '']
+    for name, (load, entry) in BLOBS.items():
+        data = strip_padding(read_blob(source, name))
+        packed = compress(data)
+        if decompress(packed) != data:
+            sys.exit('%s does not decompress to the original' % name)
+        print('%s: %d -> %d bytes, load 0x%06X, entry 0x%06X' % (name, len(data), len(packed), load, entry))
+        packed = struct.pack('>III', len(data), load, entry) + packed
+        lines.append('#define %s {\\' % name)
+        for row in range(0, len(packed), 16):
+            chunk = packed[row:row + 16]
+            text = ','.join('0x%02X' % b for b in chunk)
+            last = row + 16 >= len(packed)
+            lines.append('    ' + text + ('}' if last else ',\\'))
+        lines.append('')
+    lines.append('#endif')
+    with open(output, 'w', newline='\r\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
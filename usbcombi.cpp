@@ -407,7 +407,7 @@ void USBCombi::_send_isr()
     }
 }
 
-bool USBCombi::receive(uint8_t *buffer, uint32_t size,  uint32_t *size_read)
+bool USBCombi::receive(uint8_t *buffer, uint32_t size,  uint32_t *size_read, uint32_t timeout)
 {
     lock();
 
@@ -420,7 +420,7 @@ bool USBCombi::receive(uint8_t *buffer, uint32_t size,  uint32_t *size_read)
 
     unlock();
 
-    read_op.wait(NULL);
+    read_op.wait(NULL, timeout);
     return read_op.result;
 }
 
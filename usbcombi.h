@@ -152,9 +152,11 @@ public:
     * @param size the maximum number of bytes to read
     * @param actual A pointer to where to store the number of bytes actually read
     *   or NULL to read the full size
+    * @param timeout milliseconds to wait before giving up the read
     * @returns true if successful false if interrupted due to a state change
+    *   or the timeout
     */
-    bool receive(uint8_t *buffer, uint32_t size, uint32_t *actual = NULL);
+    bool receive(uint8_t *buffer, uint32_t size, uint32_t *actual = NULL, uint32_t timeout = osWaitForever);
 
     /**
      * Read from the receive buffer